@@ -0,0 +1,45 @@
+# Profile guided build, run by the pgo target:
+#   cmake -DSOURCE_DIR=<src> -DBINARY_DIR=<dir> [-DC_COMPILER=cc] [-DLTO=ON] -P checksum_pgo.cmake
+# 1. configures BINARY_DIR with CHECKSUM_PGO=GENERATE and builds the instrumented benchmark
+# 2. trains by running the benchmark suite
+# 3. reconfigures the same directory with CHECKSUM_PGO=USE and rebuilds everything; GCC names
+#    the profiles after the object paths, so both phases have to share the build directory
+if(NOT SOURCE_DIR OR NOT BINARY_DIR)
+    message(FATAL_ERROR "SOURCE_DIR and BINARY_DIR are required")
+endif()
+if(NOT LTO)
+    set(LTO OFF)
+endif()
+
+set(PROFILE_DIR ${BINARY_DIR}/pgo-data)
+set(CONFIGURE_ARGS -S ${SOURCE_DIR} -B ${BINARY_DIR} -DCMAKE_BUILD_TYPE=Release
+    -DCHECKSUM_LTO=${LTO} -DCHECKSUM_PGO_DIR=${PROFILE_DIR})
+if(C_COMPILER)
+    list(APPEND CONFIGURE_ARGS -DCMAKE_C_COMPILER=${C_COMPILER})
+endif()
+
+function(pgo_run)
+    execute_process(COMMAND ${ARGN} RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "pgo step failed: ${ARGN}")
+    endif()
+endfunction()
+
+file(REMOVE_RECURSE ${PROFILE_DIR})
+pgo_run(${CMAKE_COMMAND} ${CONFIGURE_ARGS} -DCHECKSUM_PGO=GENERATE)
+pgo_run(${CMAKE_COMMAND} --build ${BINARY_DIR} --target checksum_bench)
+pgo_run(${BINARY_DIR}/checksum_bench)
+
+# clang writes raw profiles that have to be merged first
+file(GLOB RAW_PROFILES ${PROFILE_DIR}/*.profraw)
+if(RAW_PROFILES)
+    find_program(LLVM_PROFDATA NAMES llvm-profdata)
+    if(NOT LLVM_PROFDATA)
+        message(FATAL_ERROR "llvm-profdata is needed to merge the clang profiles")
+    endif()
+    pgo_run(${LLVM_PROFDATA} merge -o ${PROFILE_DIR}/default.profdata ${RAW_PROFILES})
+endif()
+
+pgo_run(${CMAKE_COMMAND} ${CONFIGURE_ARGS} -DCHECKSUM_PGO=USE)
+pgo_run(${CMAKE_COMMAND} --build ${BINARY_DIR})
+message(STATUS "Profile guided build ready in ${BINARY_DIR}")
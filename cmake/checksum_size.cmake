@@ -0,0 +1,114 @@
+# Footprint report of libcrc, run by the size_report target:
+#   cmake -DSOURCE_DIR=<src> -DBINARY_DIR=<dir> [-DC_COMPILER=cc] [-DBUILD_TYPE=MinSizeRel] [-DOBJCOPY=objcopy]
+#         [-DCRC8_MODELS=CRC8_MODEL,...] [-DCRC16_MODELS=...] [-DCRC32_MODELS=...] [-DCRC64_MODELS=...]
+#         -P checksum_size.cmake
+# Builds libcrc.a in BINARY_DIR/<profile> for every CHECKSUM_CRC_PROFILE and reads the sections of its
+# objects: flash is text and data, RAM is data and bss. The slicing tables are generated at run time,
+# so they show up as bss; stacks are not counted, nor what the linker would drop as unused.
+# The profiles build with CHECKSUM_WERROR, so the report also fails on a warning in any of them.
+if(NOT SOURCE_DIR OR NOT BINARY_DIR)
+    message(FATAL_ERROR "SOURCE_DIR and BINARY_DIR are required")
+endif()
+if(NOT BUILD_TYPE)
+    set(BUILD_TYPE Release)
+endif()
+
+# the size of the toolchain that built the objects, next to its objcopy when cross compiling
+if(OBJCOPY)
+    string(REGEX REPLACE "objcopy([^/]*)$" "size\\1" SIZE_CANDIDATE "${OBJCOPY}")
+    if(EXISTS "${SIZE_CANDIDATE}")
+        set(SIZE "${SIZE_CANDIDATE}")
+    endif()
+endif()
+if(NOT SIZE)
+    find_program(SIZE NAMES size)
+    if(NOT SIZE)
+        message(FATAL_ERROR "size is needed to read the sections")
+    endif()
+endif()
+
+set(CONFIGURE_ARGS -S ${SOURCE_DIR} -DCMAKE_BUILD_TYPE=${BUILD_TYPE} -DCHECKSUM_BUILD_TESTS=OFF -DCHECKSUM_WERROR=ON)
+if(C_COMPILER)
+    list(APPEND CONFIGURE_ARGS -DCMAKE_C_COMPILER=${C_COMPILER})
+endif()
+set(MODELS "")
+foreach(width 8 16 32 64)
+    if(NOT CRC${width}_MODELS)
+        set(CRC${width}_MODELS ALL)
+    endif()
+    string(REPLACE "," ";" list "${CRC${width}_MODELS}")
+    list(APPEND CONFIGURE_ARGS "-DCHECKSUM_CRC${width}_MODELS=${list}")
+    string(APPEND MODELS " crc${width}: ${CRC${width}_MODELS}")
+endforeach()
+
+function(size_run)
+    execute_process(COMMAND ${ARGN} RESULT_VARIABLE result OUTPUT_VARIABLE output ERROR_VARIABLE output)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "size report step failed: ${ARGN}\n${output}")
+    endif()
+endfunction()
+
+# right aligned column
+function(size_column out text width)
+    string(LENGTH "${text}" length)
+    set(padded "${text}")
+    while(length LESS width)
+        string(PREPEND padded " ")
+        math(EXPR length "${length} + 1")
+    endwhile()
+    set(${out} "${padded}" PARENT_SCOPE)
+endfunction()
+
+function(size_row name text data bss)
+    math(EXPR flash "${text} + ${data}")
+    math(EXPR ram "${data} + ${bss}")
+    set(row "  ${name}")
+    string(LENGTH "${name}" length)
+    while(length LESS 20)
+        string(APPEND row " ")
+        math(EXPR length "${length} + 1")
+    endwhile()
+    foreach(value ${text} ${data} ${bss} ${flash} ${ram})
+        size_column(cell ${value} 9)
+        string(APPEND row "${cell}")
+    endforeach()
+    message("${row}")
+endfunction()
+
+message("libcrc footprint, ${BUILD_TYPE} build,${MODELS}")
+foreach(profile FULL SMALL TINY)
+    string(TOLOWER ${profile} directory)
+    set(PROFILE_DIR ${BINARY_DIR}/${directory})
+    size_run(${CMAKE_COMMAND} ${CONFIGURE_ARGS} -B ${PROFILE_DIR} -DCHECKSUM_CRC_PROFILE=${profile})
+    size_run(${CMAKE_COMMAND} --build ${PROFILE_DIR} --target crc_static)
+    file(GLOB_RECURSE LIBRARY ${PROFILE_DIR}/libcrc.a)
+    if(NOT LIBRARY)
+        message(FATAL_ERROR "no libcrc.a in ${PROFILE_DIR}")
+    endif()
+    list(GET LIBRARY 0 LIBRARY)
+    execute_process(COMMAND ${SIZE} -B ${LIBRARY} RESULT_VARIABLE result OUTPUT_VARIABLE output)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "${SIZE} failed on ${LIBRARY}")
+    endif()
+
+    message("")
+    message("${profile}")
+    message("  object                  text     data      bss    flash      RAM")
+    set(total_text 0)
+    set(total_data 0)
+    set(total_bss 0)
+    string(REPLACE "\n" ";" lines "${output}")
+    foreach(line ${lines})
+        if(line MATCHES "^ *([0-9]+)[ \t]+([0-9]+)[ \t]+([0-9]+)[ \t]+[0-9]+[ \t]+[0-9a-fA-F]+[ \t]+([^ \t]+)")
+            set(text ${CMAKE_MATCH_1})
+            set(data ${CMAKE_MATCH_2})
+            set(bss ${CMAKE_MATCH_3})
+            string(REGEX REPLACE "\\.c\\.o(bj)?$" "" name "${CMAKE_MATCH_4}")
+            size_row(${name} ${text} ${data} ${bss})
+            math(EXPR total_text "${total_text} + ${text}")
+            math(EXPR total_data "${total_data} + ${data}")
+            math(EXPR total_bss "${total_bss} + ${bss}")
+        endif()
+    endforeach()
+    size_row(total ${total_text} ${total_data} ${total_bss})
+endforeach()
@@ -0,0 +1,50 @@
+#ifndef __CDC_H__
+#define __CDC_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "../md5/md5.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A chunk boundary found by the chunker, with the MD5 of the chunk's bytes */
+typedef struct {
+    uint64_t offset;        /* position of the chunk in the stream */
+    size_t length;          /* chunk length in bytes */
+    uint8_t digest[16];     /* MD5 of the chunk */
+} cdc_chunk_t;
+
+typedef void (*cdc_chunk_callback_t)(const cdc_chunk_t *chunk, void *user_data);
+
+/* Data structure for content-defined chunking (gear hash, FastCDC normalized chunking) */
+typedef struct {
+    size_t min_size;        /* no boundary before this many bytes */
+    size_t avg_size;        /* harder mask before, easier mask after this many bytes */
+    size_t max_size;        /* forced boundary at this many bytes */
+    uint64_t mask_s;        /* boundary mask below avg_size */
+    uint64_t mask_l;        /* boundary mask above avg_size */
+    uint64_t hash;          /* rolling gear hash */
+    uint64_t offset;        /* stream offset of the current chunk */
+    size_t length;          /* bytes of the current chunk seen so far */
+    md5_ctx md5;            /* digest of the current chunk */
+    bool multi_lane;        /* digest whole chunks of a buffer with md5_multi_lane */
+    size_t pending;         /* chunks waiting for the multi-lane digest */
+    cdc_chunk_t pending_chunk[MD5_LANES];
+    uint8_t *pending_data[MD5_LANES];
+    cdc_chunk_callback_t callback;
+    void *user_data;
+} cdc_ctx;
+
+void cdc_init(cdc_ctx *ctx, size_t min_size, size_t avg_size, size_t max_size, bool multi_lane,
+              cdc_chunk_callback_t callback, void *user_data);
+void cdc_update(cdc_ctx *ctx, uint8_t *input_buffer, size_t input_length);
+void cdc_final(cdc_ctx *ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CDC_H__ */
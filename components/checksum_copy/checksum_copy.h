@@ -0,0 +1,104 @@
+#ifndef __CHECKSUM_COPY_H__
+#define __CHECKSUM_COPY_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Copy side of the crcN_copy and md5_copy_update primitives. They walk the source in chunks
+ * small enough to stay in the L1 cache: each chunk is checksummed, then copied out of the
+ * cache, so the source is read from memory once, as by memcpy alone. Copies from
+ * CHECKSUM_COPY_NONTEMPORAL bytes on use non-temporal stores, the destination (a frame
+ * handed to a device, a file buffer) going to memory without evicting the working set.
+ */
+
+/* bytes checksummed then copied at a time */
+#define CHECKSUM_COPY_CHUNK 4096
+
+/* copies from this length on bypass the caches, about a core's L2: shorter destinations
+   are cheaper to leave in the cache, in case they are read again */
+#ifndef CHECKSUM_COPY_NONTEMPORAL
+#define CHECKSUM_COPY_NONTEMPORAL (2 * 1024 * 1024)
+#endif
+
+/**
+ * @brief Copies one chunk, with non-temporal stores when asked and the CPU has them.
+ *        checksum_copy_fence has to follow the last non-temporal chunk. The cached copy is
+ *        a vector loop as well: with the length bounded by the chunk, compilers expand
+ *        memcpy into rep movs, slow from unaligned sources.
+ *
+ * @param destination Destination
+ * @param source Source, not overlapping the destination
+ * @param length Bytes to copy
+ * @param nontemporal Bypass the caches
+ */
+static inline void checksum_copy_chunk(uint8_t *destination, const uint8_t *source, size_t length, bool nontemporal) {
+#if defined(__SSE2__)
+    if (nontemporal) {
+        /* the streaming stores need 16 byte aligned destinations */
+        size_t head = (16 - ((uintptr_t)destination & 15)) & 15;
+        if (head > length) {
+            head = length;
+        }
+        memcpy(destination, source, head);
+        destination += head;
+        source += head;
+        length -= head;
+        for (; length >= 64; length -= 64, destination += 64, source += 64) {
+            __m128i a = _mm_loadu_si128((const __m128i *)source);
+            __m128i b = _mm_loadu_si128((const __m128i *)(source + 16));
+            __m128i c = _mm_loadu_si128((const __m128i *)(source + 32));
+            __m128i d = _mm_loadu_si128((const __m128i *)(source + 48));
+            _mm_stream_si128((__m128i *)destination, a);
+            _mm_stream_si128((__m128i *)(destination + 16), b);
+            _mm_stream_si128((__m128i *)(destination + 32), c);
+            _mm_stream_si128((__m128i *)(destination + 48), d);
+        }
+    } else {
+        for (; length >= 64; length -= 64, destination += 64, source += 64) {
+            __m128i a = _mm_loadu_si128((const __m128i *)source);
+            __m128i b = _mm_loadu_si128((const __m128i *)(source + 16));
+            __m128i c = _mm_loadu_si128((const __m128i *)(source + 32));
+            __m128i d = _mm_loadu_si128((const __m128i *)(source + 48));
+            _mm_storeu_si128((__m128i *)destination, a);
+            _mm_storeu_si128((__m128i *)(destination + 16), b);
+            _mm_storeu_si128((__m128i *)(destination + 32), c);
+            _mm_storeu_si128((__m128i *)(destination + 48), d);
+        }
+    }
+#else
+    (void)nontemporal;
+#endif
+    memcpy(destination, source, length);
+}
+
+/**
+ * @brief Orders the non-temporal stores of checksum_copy_chunk before the stores that follow,
+ *        such as the one handing the destination over
+ *
+ * @param nontemporal Whether the chunks were copied non-temporal
+ */
+static inline void checksum_copy_fence(bool nontemporal) {
+#if defined(__SSE2__)
+    if (nontemporal) {
+        _mm_sfence();
+    }
+#else
+    (void)nontemporal;
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CHECKSUM_COPY_H__ */
@@ -0,0 +1,334 @@
+/**
+ * @file checksum_stats.c
+ * @brief Per-thread hot path counters of the checksum components, summed on read
+ * @copyright Copyright (c) 2023
+ */
+#define _GNU_SOURCE
+#include "checksum_stats.h"
+#include <assert.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define CHECKSUM_STATS_CACHE_LINE 64
+
+/* Every counter starts its own cache line */
+typedef struct {
+    checksum_stats_counter_t value;
+} __attribute__((aligned(CHECKSUM_STATS_CACHE_LINE))) checksum_stats_cell_t;
+
+/* One per recording thread, only ever written by that thread; folded into the retired sums and freed when it exits */
+typedef struct checksum_stats_thread {
+    checksum_stats_cell_t cell[CHECKSUM_STATS_ALGORITHMS][CHECKSUM_STATS_MODELS][CHECKSUM_STATS_IMPLEMENTATIONS];
+    struct checksum_stats_thread *next;
+} checksum_stats_thread_t;
+
+static __thread checksum_stats_thread_t *checksum_stats_local;
+static checksum_stats_thread_t *checksum_stats_threads;     /* counters of the running threads */
+static checksum_stats_snapshot_t checksum_stats_retired;    /* sums of the threads that exited */
+static pthread_mutex_t checksum_stats_lock = PTHREAD_MUTEX_INITIALIZER;     /* guards the two above, never taken on the hot path */
+static pthread_key_t checksum_stats_key;
+static pthread_once_t checksum_stats_key_once = PTHREAD_ONCE_INIT;
+
+static const char *checksum_stats_algorithm_name[CHECKSUM_STATS_ALGORITHMS] = {
+    "crc8", "crc16", "crc32", "crc64", "md5",
+};
+
+static const char *checksum_stats_implementation_name[CHECKSUM_STATS_IMPLEMENTATIONS] = {
+    "bitwise", "mirror", "table", "nibble", "slicing", "hardware", "scalar", "multi_lane", "bit_sliced",
+};
+
+/**
+ * @brief Adds one thread's counters into a sum
+ *
+ * @param to Sum
+ * @param thread Counters, possibly still being written by their thread
+ */
+static void checksum_stats_sum(checksum_stats_snapshot_t *to, checksum_stats_thread_t *thread) {
+    to->threads++;
+    for (int a = 0; a < CHECKSUM_STATS_ALGORITHMS; a++) {
+        for (int m = 0; m < CHECKSUM_STATS_MODELS; m++) {
+            for (int i = 0; i < CHECKSUM_STATS_IMPLEMENTATIONS; i++) {
+                checksum_stats_counter_t *from = &thread->cell[a][m][i].value;
+                checksum_stats_counter_t *sum = &to->counter[a][m][i];
+                sum->calls += __atomic_load_n(&from->calls, __ATOMIC_RELAXED);
+                sum->bytes += __atomic_load_n(&from->bytes, __ATOMIC_RELAXED);
+                sum->failures += __atomic_load_n(&from->failures, __ATOMIC_RELAXED);
+                sum->nanoseconds += __atomic_load_n(&from->nanoseconds, __ATOMIC_RELAXED);
+                for (int b = 0; b < CHECKSUM_STATS_BUCKETS; b++) {
+                    sum->histogram[b] += __atomic_load_n(&from->histogram[b], __ATOMIC_RELAXED);
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Thread exit destructor: moves the thread's counters into the retired sums and frees them
+ *
+ * @param arg The exiting thread's checksum_stats_thread_t
+ */
+static void checksum_stats_retire(void *arg) {
+    checksum_stats_thread_t *thread = (checksum_stats_thread_t *)arg;
+
+    pthread_mutex_lock(&checksum_stats_lock);
+    checksum_stats_sum(&checksum_stats_retired, thread);
+    for (checksum_stats_thread_t **link = &checksum_stats_threads; *link != NULL; link = &(*link)->next) {
+        if (*link == thread) {
+            *link = thread->next;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&checksum_stats_lock);
+
+    checksum_stats_local = NULL;
+    free(thread);
+}
+
+static void checksum_stats_key_create(void) {
+    pthread_key_create(&checksum_stats_key, checksum_stats_retire);
+}
+
+/**
+ * @brief Returns the calling thread's counters, registering them on first use
+ *
+ * @return checksum_stats_thread_t* Counters, NULL when out of memory
+ */
+static checksum_stats_thread_t *checksum_stats_thread(void) {
+    checksum_stats_thread_t *thread = checksum_stats_local;
+
+    if (thread != NULL) {
+        return thread;
+    }
+    if (posix_memalign((void **)&thread, CHECKSUM_STATS_CACHE_LINE, sizeof(checksum_stats_thread_t)) != 0) {
+        return NULL;
+    }
+    memset(thread, 0, sizeof(checksum_stats_thread_t));
+
+    pthread_once(&checksum_stats_key_once, checksum_stats_key_create);
+    if (pthread_setspecific(checksum_stats_key, thread) != 0) {
+        free(thread);
+        return NULL;
+    }
+    pthread_mutex_lock(&checksum_stats_lock);
+    thread->next = checksum_stats_threads;
+    checksum_stats_threads = thread;
+    pthread_mutex_unlock(&checksum_stats_lock);
+    checksum_stats_local = thread;
+    return thread;
+}
+
+/* only the owning thread writes a counter, so a plain add published with a relaxed store is enough */
+static inline void checksum_stats_add(uint64_t *counter, uint64_t value) {
+    __atomic_store_n(counter, *counter + value, __ATOMIC_RELAXED);
+}
+
+static inline unsigned int checksum_stats_bucket(size_t length) {
+    unsigned int bucket = (length == 0) ? 0 : 64 - (unsigned int)__builtin_clzll((unsigned long long)length);
+    return (bucket < CHECKSUM_STATS_BUCKETS) ? bucket : CHECKSUM_STATS_BUCKETS - 1;
+}
+
+/**
+ * @brief Monotonic clock for the call timings
+ *
+ * @return uint64_t Nanoseconds
+ */
+uint64_t checksum_stats_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Counts one call on the calling thread
+ *
+ * @param algorithm Checksum algorithm
+ * @param model Reference model of the algorithm, 0 for MD5
+ * @param implementation Code path that did the work
+ * @param length Input length
+ * @param start checksum_stats_now() at the start of the call
+ */
+void checksum_stats_record(checksum_stats_algorithm_e algorithm, int model, checksum_stats_implementation_e implementation,
+                           size_t length, uint64_t start) {
+    /* parameter checkout */
+    assert(algorithm < CHECKSUM_STATS_ALGORITHMS);
+    assert(model >= 0 && model < CHECKSUM_STATS_MODELS);
+    assert(implementation < CHECKSUM_STATS_IMPLEMENTATIONS);
+
+    uint64_t end = checksum_stats_now();
+    checksum_stats_thread_t *thread = checksum_stats_thread();
+    if (thread == NULL) {
+        return;
+    }
+
+    checksum_stats_counter_t *counter = &thread->cell[algorithm][model][implementation].value;
+    checksum_stats_add(&counter->calls, 1);
+    checksum_stats_add(&counter->bytes, length);
+    checksum_stats_add(&counter->nanoseconds, end - start);
+    checksum_stats_add(&counter->histogram[checksum_stats_bucket(length)], 1);
+}
+
+/**
+ * @brief Counts one failed package check on the calling thread
+ *
+ * @param algorithm Checksum algorithm
+ * @param model Reference model of the algorithm
+ * @param implementation Code path of the check
+ */
+void checksum_stats_failure(checksum_stats_algorithm_e algorithm, int model, checksum_stats_implementation_e implementation) {
+    /* parameter checkout */
+    assert(algorithm < CHECKSUM_STATS_ALGORITHMS);
+    assert(model >= 0 && model < CHECKSUM_STATS_MODELS);
+    assert(implementation < CHECKSUM_STATS_IMPLEMENTATIONS);
+
+    checksum_stats_thread_t *thread = checksum_stats_thread();
+    if (thread == NULL) {
+        return;
+    }
+    checksum_stats_add(&thread->cell[algorithm][model][implementation].value.failures, 1);
+}
+
+/**
+ * @brief Sums the counters of every thread, running or exited. The threads keep running, so each
+ *        counter is exact but counters of a call in progress may not all be included yet.
+ *
+ * @param snapshot Summed counters
+ */
+void checksum_stats_snapshot(checksum_stats_snapshot_t *snapshot) {
+    /* parameter checkout */
+    assert(snapshot != NULL);
+
+    pthread_mutex_lock(&checksum_stats_lock);
+    memcpy(snapshot, &checksum_stats_retired, sizeof(checksum_stats_snapshot_t));
+    for (checksum_stats_thread_t *thread = checksum_stats_threads; thread != NULL; thread = thread->next) {
+        checksum_stats_sum(snapshot, thread);
+    }
+    pthread_mutex_unlock(&checksum_stats_lock);
+}
+
+/**
+ * @brief Writes the counters that were used, one per line as text or as one JSON object
+ *
+ * @param stream Output stream
+ * @param snapshot Counters from checksum_stats_snapshot
+ * @param format CHECKSUM_STATS_TEXT or CHECKSUM_STATS_JSON
+ */
+void checksum_stats_dump(FILE *stream, const checksum_stats_snapshot_t *snapshot, checksum_stats_format_e format) {
+    /* parameter checkout */
+    assert(stream != NULL);
+    assert(snapshot != NULL);
+
+    bool first = true;
+
+    if (format == CHECKSUM_STATS_JSON) {
+        fprintf(stream, "{\"threads\":%u,\"counters\":[", snapshot->threads);
+    } else {
+        fprintf(stream, "%-6s %5s %-10s %12s %14s %9s %10s  %s\n",
+                "algo", "model", "impl", "calls", "bytes", "failures", "MB/s", "sizes (bucket:calls)");
+    }
+
+    for (int a = 0; a < CHECKSUM_STATS_ALGORITHMS; a++) {
+        for (int m = 0; m < CHECKSUM_STATS_MODELS; m++) {
+            for (int i = 0; i < CHECKSUM_STATS_IMPLEMENTATIONS; i++) {
+                const checksum_stats_counter_t *counter = &snapshot->counter[a][m][i];
+                if (counter->calls == 0 && counter->failures == 0) {
+                    continue;
+                }
+
+                if (format == CHECKSUM_STATS_JSON) {
+                    fprintf(stream, "%s{\"algorithm\":\"%s\",\"model\":%d,\"implementation\":\"%s\","
+                            "\"calls\":%llu,\"bytes\":%llu,\"failures\":%llu,\"nanoseconds\":%llu,\"histogram\":[",
+                            first ? "" : ",", checksum_stats_algorithm_name[a], m, checksum_stats_implementation_name[i],
+                            (unsigned long long)counter->calls, (unsigned long long)counter->bytes,
+                            (unsigned long long)counter->failures, (unsigned long long)counter->nanoseconds);
+                    for (int b = 0; b < CHECKSUM_STATS_BUCKETS; b++) {
+                        fprintf(stream, "%s%llu", b ? "," : "", (unsigned long long)counter->histogram[b]);
+                    }
+                    fprintf(stream, "]}");
+                } else {
+                    double rate = counter->nanoseconds ? (double)counter->bytes * 1e3 / (double)counter->nanoseconds : 0.0;
+                    fprintf(stream, "%-6s %5d %-10s %12llu %14llu %9llu %10.1f ",
+                            checksum_stats_algorithm_name[a], m, checksum_stats_implementation_name[i],
+                            (unsigned long long)counter->calls, (unsigned long long)counter->bytes,
+                            (unsigned long long)counter->failures, rate);
+                    /* bucket b holds lengths below 2^b, the last one everything longer */
+                    for (int b = 0; b < CHECKSUM_STATS_BUCKETS; b++) {
+                        if (counter->histogram[b] != 0) {
+                            fprintf(stream, " %s%zu:%llu", (b == CHECKSUM_STATS_BUCKETS - 1) ? ">=" : "<",
+                                    (b == CHECKSUM_STATS_BUCKETS - 1) ? (size_t)1 << (b - 1) : (size_t)1 << b,
+                                    (unsigned long long)counter->histogram[b]);
+                        }
+                    }
+                    fprintf(stream, "\n");
+                }
+                first = false;
+            }
+        }
+    }
+
+    if (format == CHECKSUM_STATS_JSON) {
+        fprintf(stream, "]}\n");
+    }
+}
+
+#ifndef CHECKSUM_NO_MAIN
+#define TEST
+#endif
+#ifdef TEST
+#define TEST_THREADS 4
+#define TEST_RECORDS 100000
+
+static void *test_thread(void *arg) {
+    int model = (int)(size_t)arg;
+
+    for (size_t i = 0; i < TEST_RECORDS; i++) {
+        checksum_stats_record(CHECKSUM_STATS_CRC32, model, CHECKSUM_STATS_TABLE, i % 100, checksum_stats_now());
+        if (i % 10 == 0) {
+            checksum_stats_failure(CHECKSUM_STATS_CRC32, model, CHECKSUM_STATS_TABLE);
+        }
+    }
+    checksum_stats_record(CHECKSUM_STATS_MD5, 0, CHECKSUM_STATS_SCALAR, 1 << 20, checksum_stats_now());
+    return NULL;
+}
+
+int main() {
+    static checksum_stats_snapshot_t snapshot;
+    pthread_t thread[TEST_THREADS];
+    bool succeed = true;
+
+#if 1
+    printf("---------checksum stats-----------\n");
+    for (size_t t = 0; t < TEST_THREADS; t++) {
+        pthread_create(&thread[t], NULL, test_thread, (void *)(t % 2));
+    }
+    for (size_t t = 0; t < TEST_THREADS; t++) {
+        pthread_join(thread[t], NULL);
+    }
+
+    checksum_stats_snapshot(&snapshot);
+    for (int model = 0; model < 2; model++) {
+        checksum_stats_counter_t *counter = &snapshot.counter[CHECKSUM_STATS_CRC32][model][CHECKSUM_STATS_TABLE];
+        uint64_t buckets = 0;
+        for (int b = 0; b < CHECKSUM_STATS_BUCKETS; b++) {
+            buckets += counter->histogram[b];
+        }
+        /* two threads per model, lengths 0..99 */
+        if (counter->calls != 2 * TEST_RECORDS || buckets != 2 * TEST_RECORDS ||
+            counter->bytes != 2 * (TEST_RECORDS / 100) * (99 * 100 / 2) || counter->failures != 2 * TEST_RECORDS / 10 ||
+            counter->histogram[0] != 2 * TEST_RECORDS / 100 || counter->histogram[7] != 2 * (TEST_RECORDS / 100) * 36) {
+            succeed = false;
+        }
+    }
+    /* the threads exited, their counters live on only in the retired sums */
+    if (snapshot.threads != TEST_THREADS || checksum_stats_threads != NULL ||
+        snapshot.counter[CHECKSUM_STATS_MD5][0][CHECKSUM_STATS_SCALAR].histogram[CHECKSUM_STATS_BUCKETS - 1] != TEST_THREADS) {
+        succeed = false;
+    }
+    printf("checksum stats check %s.\n", succeed ? "succeed" : "fail");
+    checksum_stats_dump(stdout, &snapshot, CHECKSUM_STATS_TEXT);
+    checksum_stats_dump(stdout, &snapshot, CHECKSUM_STATS_JSON);
+#endif
+    return 0;
+}
+#endif
@@ -0,0 +1,84 @@
+#ifndef __CHECKSUM_STATS_H__
+#define __CHECKSUM_STATS_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The counters are compiled in only with CHECKSUM_STATS defined for the whole build,
+   otherwise the hooks below expand to nothing and the snapshot stays zero */
+// #define CHECKSUM_STATS
+
+typedef enum {
+    CHECKSUM_STATS_CRC8 = 0,
+    CHECKSUM_STATS_CRC16,
+    CHECKSUM_STATS_CRC32,
+    CHECKSUM_STATS_CRC64,
+    CHECKSUM_STATS_MD5,
+    CHECKSUM_STATS_ALGORITHMS,
+} checksum_stats_algorithm_e;
+
+typedef enum {
+    CHECKSUM_STATS_BITWISE = 0,     /* crcN_calculate */
+    CHECKSUM_STATS_MIRROR,          /* crcN_calculate_mirror_mode */
+    CHECKSUM_STATS_TABLE,           /* 256 entry lookup table */
+    CHECKSUM_STATS_NIBBLE,          /* 16 entry lookup table */
+    CHECKSUM_STATS_SLICING,         /* slicing-by-8 tables */
+    CHECKSUM_STATS_HARDWARE,        /* crc32 instruction or carry-less multiply */
+    CHECKSUM_STATS_SCALAR,          /* md5_update */
+    CHECKSUM_STATS_MULTI_LANE,      /* md5_multi_lane, one call per batch */
+    CHECKSUM_STATS_BIT_SLICED,      /* crc8_package_check_batch, one call per batch */
+    CHECKSUM_STATS_IMPLEMENTATIONS,
+} checksum_stats_implementation_e;
+
+#define CHECKSUM_STATS_MODELS 12    /* more than any CRC width has */
+#define CHECKSUM_STATS_BUCKETS 16   /* bucket i counts lengths in [2^(i-1), 2^i), the last one the rest */
+
+typedef struct {
+    uint64_t calls;
+    uint64_t bytes;
+    uint64_t failures;              /* package checks that didn't match */
+    uint64_t nanoseconds;
+    uint64_t histogram[CHECKSUM_STATS_BUCKETS];
+} checksum_stats_counter_t;
+
+/* Sum of every thread's counters */
+typedef struct {
+    checksum_stats_counter_t counter[CHECKSUM_STATS_ALGORITHMS][CHECKSUM_STATS_MODELS][CHECKSUM_STATS_IMPLEMENTATIONS];
+    unsigned int threads;           /* threads that recorded anything */
+} checksum_stats_snapshot_t;
+
+typedef enum {
+    CHECKSUM_STATS_TEXT = 0,
+    CHECKSUM_STATS_JSON,
+} checksum_stats_format_e;
+
+uint64_t checksum_stats_now(void);
+void checksum_stats_record(checksum_stats_algorithm_e algorithm, int model, checksum_stats_implementation_e implementation,
+                           size_t length, uint64_t start);
+void checksum_stats_failure(checksum_stats_algorithm_e algorithm, int model, checksum_stats_implementation_e implementation);
+void checksum_stats_snapshot(checksum_stats_snapshot_t *snapshot);
+void checksum_stats_dump(FILE *stream, const checksum_stats_snapshot_t *snapshot, checksum_stats_format_e format);
+
+#ifdef CHECKSUM_STATS
+#define CHECKSUM_STATS_BEGIN(start) uint64_t start = checksum_stats_now()
+#define CHECKSUM_STATS_RECORD(algorithm, model, implementation, length, start) \
+    checksum_stats_record((algorithm), (int)(model), (implementation), (length), (start))
+#define CHECKSUM_STATS_FAILURE(algorithm, model, implementation) \
+    checksum_stats_failure((algorithm), (int)(model), (implementation))
+#else
+#define CHECKSUM_STATS_BEGIN(start)
+#define CHECKSUM_STATS_RECORD(algorithm, model, implementation, length, start) ((void)0)
+#define CHECKSUM_STATS_FAILURE(algorithm, model, implementation) ((void)0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CHECKSUM_STATS_H__ */
@@ -1,924 +1,2146 @@
-/**
- * @file crc16.c
- * @brief Cyclic Redundancy Check (CRC16)
- * @copyright Copyright (c) 2023
- *
- * Change Logs:
- * Data             Author                          Notes
- * 2023-04-23       vector(vector_qiu@163.com)      first version
- *
- */
-#include "crc16.h"
-#include <assert.h>
-
-static const uint16_t CRC16_IBM_MODEL_TABLE[256] = {
-    0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241, 0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
-    0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40, 0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
-    0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40, 0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
-    0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641, 0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040,
-    0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240, 0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441,
-    0x3C00, 0xFCC1, 0xFD81, 0x3D40, 0xFF01, 0x3FC0, 0x3E80, 0xFE41, 0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
-    0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41, 0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
-    0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640, 0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041,
-    0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240, 0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
-    0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41, 0xAA01, 0x6AC0, 0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840,
-    0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41, 0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40,
-    0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1, 0xB681, 0x7640, 0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
-    0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241, 0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440,
-    0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40, 0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
-    0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40, 0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
-    0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641, 0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040
-};
-/* Reference Model:CRC16_MAXIM_MODEL */
-static const uint16_t CRC16_MAXIM_MODEL_TABLE[256] = {
-    0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241, 0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
-    0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40, 0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
-    0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40, 0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
-    0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641, 0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040,
-    0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240, 0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441,
-    0x3C00, 0xFCC1, 0xFD81, 0x3D40, 0xFF01, 0x3FC0, 0x3E80, 0xFE41, 0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
-    0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41, 0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
-    0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640, 0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041,
-    0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240, 0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
-    0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41, 0xAA01, 0x6AC0, 0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840,
-    0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41, 0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40,
-    0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1, 0xB681, 0x7640, 0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
-    0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241, 0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440,
-    0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40, 0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
-    0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40, 0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
-    0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641, 0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040
-};
-/* Reference Model:CRC16_USB_MODEL */
-static const uint16_t CRC16_USB_MODEL_TABLE[256] = {
-    0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241, 0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
-    0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40, 0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
-    0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40, 0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
-    0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641, 0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040,
-    0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240, 0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441,
-    0x3C00, 0xFCC1, 0xFD81, 0x3D40, 0xFF01, 0x3FC0, 0x3E80, 0xFE41, 0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
-    0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41, 0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
-    0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640, 0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041,
-    0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240, 0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
-    0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41, 0xAA01, 0x6AC0, 0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840,
-    0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41, 0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40,
-    0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1, 0xB681, 0x7640, 0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
-    0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241, 0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440,
-    0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40, 0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
-    0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40, 0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
-    0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641, 0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040
-};
-/* Reference Model:CRC16_MODBUS_MODEL */
-const uint16_t CRC16_MODBUS_MODEL_TABLE[256] = {
-    0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241, 0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
-    0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40, 0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
-    0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40, 0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
-    0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641, 0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040,
-    0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240, 0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441,
-    0x3C00, 0xFCC1, 0xFD81, 0x3D40, 0xFF01, 0x3FC0, 0x3E80, 0xFE41, 0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
-    0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41, 0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
-    0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640, 0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041,
-    0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240, 0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
-    0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41, 0xAA01, 0x6AC0, 0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840,
-    0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41, 0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40,
-    0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1, 0xB681, 0x7640, 0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
-    0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241, 0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440,
-    0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40, 0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
-    0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40, 0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
-    0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641, 0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040
-};
-/* Reference Model:CRC16_CCITT_MODEL */
-static const uint16_t CRC16_CCITT_MODEL_TABLE[256] = {
-    0x0000, 0x1189, 0x2312, 0x329B, 0x4624, 0x57AD, 0x6536, 0x74BF, 0x8C48, 0x9DC1, 0xAF5A, 0xBED3, 0xCA6C, 0xDBE5, 0xE97E, 0xF8F7,
-    0x1081, 0x0108, 0x3393, 0x221A, 0x56A5, 0x472C, 0x75B7, 0x643E, 0x9CC9, 0x8D40, 0xBFDB, 0xAE52, 0xDAED, 0xCB64, 0xF9FF, 0xE876,
-    0x2102, 0x308B, 0x0210, 0x1399, 0x6726, 0x76AF, 0x4434, 0x55BD, 0xAD4A, 0xBCC3, 0x8E58, 0x9FD1, 0xEB6E, 0xFAE7, 0xC87C, 0xD9F5,
-    0x3183, 0x200A, 0x1291, 0x0318, 0x77A7, 0x662E, 0x54B5, 0x453C, 0xBDCB, 0xAC42, 0x9ED9, 0x8F50, 0xFBEF, 0xEA66, 0xD8FD, 0xC974,
-    0x4204, 0x538D, 0x6116, 0x709F, 0x0420, 0x15A9, 0x2732, 0x36BB, 0xCE4C, 0xDFC5, 0xED5E, 0xFCD7, 0x8868, 0x99E1, 0xAB7A, 0xBAF3,
-    0x5285, 0x430C, 0x7197, 0x601E, 0x14A1, 0x0528, 0x37B3, 0x263A, 0xDECD, 0xCF44, 0xFDDF, 0xEC56, 0x98E9, 0x8960, 0xBBFB, 0xAA72,
-    0x6306, 0x728F, 0x4014, 0x519D, 0x2522, 0x34AB, 0x0630, 0x17B9, 0xEF4E, 0xFEC7, 0xCC5C, 0xDDD5, 0xA96A, 0xB8E3, 0x8A78, 0x9BF1,
-    0x7387, 0x620E, 0x5095, 0x411C, 0x35A3, 0x242A, 0x16B1, 0x0738, 0xFFCF, 0xEE46, 0xDCDD, 0xCD54, 0xB9EB, 0xA862, 0x9AF9, 0x8B70,
-    0x8408, 0x9581, 0xA71A, 0xB693, 0xC22C, 0xD3A5, 0xE13E, 0xF0B7, 0x0840, 0x19C9, 0x2B52, 0x3ADB, 0x4E64, 0x5FED, 0x6D76, 0x7CFF,
-    0x9489, 0x8500, 0xB79B, 0xA612, 0xD2AD, 0xC324, 0xF1BF, 0xE036, 0x18C1, 0x0948, 0x3BD3, 0x2A5A, 0x5EE5, 0x4F6C, 0x7DF7, 0x6C7E,
-    0xA50A, 0xB483, 0x8618, 0x9791, 0xE32E, 0xF2A7, 0xC03C, 0xD1B5, 0x2942, 0x38CB, 0x0A50, 0x1BD9, 0x6F66, 0x7EEF, 0x4C74, 0x5DFD,
-    0xB58B, 0xA402, 0x9699, 0x8710, 0xF3AF, 0xE226, 0xD0BD, 0xC134, 0x39C3, 0x284A, 0x1AD1, 0x0B58, 0x7FE7, 0x6E6E, 0x5CF5, 0x4D7C,
-    0xC60C, 0xD785, 0xE51E, 0xF497, 0x8028, 0x91A1, 0xA33A, 0xB2B3, 0x4A44, 0x5BCD, 0x6956, 0x78DF, 0x0C60, 0x1DE9, 0x2F72, 0x3EFB,
-    0xD68D, 0xC704, 0xF59F, 0xE416, 0x90A9, 0x8120, 0xB3BB, 0xA232, 0x5AC5, 0x4B4C, 0x79D7, 0x685E, 0x1CE1, 0x0D68, 0x3FF3, 0x2E7A,
-    0xE70E, 0xF687, 0xC41C, 0xD595, 0xA12A, 0xB0A3, 0x8238, 0x93B1, 0x6B46, 0x7ACF, 0x4854, 0x59DD, 0x2D62, 0x3CEB, 0x0E70, 0x1FF9,
-    0xF78F, 0xE606, 0xD49D, 0xC514, 0xB1AB, 0xA022, 0x92B9, 0x8330, 0x7BC7, 0x6A4E, 0x58D5, 0x495C, 0x3DE3, 0x2C6A, 0x1EF1, 0x0F78
-};
-/* Reference Model:CRC16_CCITT_FALSE_MODEL */
-static const uint16_t CRC16_CCITT_FALSE_MODEL_TABLE[256] = {
-    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7, 0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
-    0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6, 0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
-    0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485, 0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
-    0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4, 0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
-    0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823, 0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
-    0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12, 0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
-    0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41, 0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
-    0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70, 0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
-    0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F, 0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
-    0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E, 0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
-    0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D, 0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
-    0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C, 0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
-    0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB, 0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
-    0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A, 0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
-    0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9, 0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
-    0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8, 0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0
-};
-/* Reference Model:CRC16_X25_MODEL */
-static const uint16_t CRC16_X25_MODEL_TABLE[256] = {
-    0x0000, 0x1189, 0x2312, 0x329B, 0x4624, 0x57AD, 0x6536, 0x74BF, 0x8C48, 0x9DC1, 0xAF5A, 0xBED3, 0xCA6C, 0xDBE5, 0xE97E, 0xF8F7,
-    0x1081, 0x0108, 0x3393, 0x221A, 0x56A5, 0x472C, 0x75B7, 0x643E, 0x9CC9, 0x8D40, 0xBFDB, 0xAE52, 0xDAED, 0xCB64, 0xF9FF, 0xE876,
-    0x2102, 0x308B, 0x0210, 0x1399, 0x6726, 0x76AF, 0x4434, 0x55BD, 0xAD4A, 0xBCC3, 0x8E58, 0x9FD1, 0xEB6E, 0xFAE7, 0xC87C, 0xD9F5,
-    0x3183, 0x200A, 0x1291, 0x0318, 0x77A7, 0x662E, 0x54B5, 0x453C, 0xBDCB, 0xAC42, 0x9ED9, 0x8F50, 0xFBEF, 0xEA66, 0xD8FD, 0xC974,
-    0x4204, 0x538D, 0x6116, 0x709F, 0x0420, 0x15A9, 0x2732, 0x36BB, 0xCE4C, 0xDFC5, 0xED5E, 0xFCD7, 0x8868, 0x99E1, 0xAB7A, 0xBAF3,
-    0x5285, 0x430C, 0x7197, 0x601E, 0x14A1, 0x0528, 0x37B3, 0x263A, 0xDECD, 0xCF44, 0xFDDF, 0xEC56, 0x98E9, 0x8960, 0xBBFB, 0xAA72,
-    0x6306, 0x728F, 0x4014, 0x519D, 0x2522, 0x34AB, 0x0630, 0x17B9, 0xEF4E, 0xFEC7, 0xCC5C, 0xDDD5, 0xA96A, 0xB8E3, 0x8A78, 0x9BF1,
-    0x7387, 0x620E, 0x5095, 0x411C, 0x35A3, 0x242A, 0x16B1, 0x0738, 0xFFCF, 0xEE46, 0xDCDD, 0xCD54, 0xB9EB, 0xA862, 0x9AF9, 0x8B70,
-    0x8408, 0x9581, 0xA71A, 0xB693, 0xC22C, 0xD3A5, 0xE13E, 0xF0B7, 0x0840, 0x19C9, 0x2B52, 0x3ADB, 0x4E64, 0x5FED, 0x6D76, 0x7CFF,
-    0x9489, 0x8500, 0xB79B, 0xA612, 0xD2AD, 0xC324, 0xF1BF, 0xE036, 0x18C1, 0x0948, 0x3BD3, 0x2A5A, 0x5EE5, 0x4F6C, 0x7DF7, 0x6C7E,
-    0xA50A, 0xB483, 0x8618, 0x9791, 0xE32E, 0xF2A7, 0xC03C, 0xD1B5, 0x2942, 0x38CB, 0x0A50, 0x1BD9, 0x6F66, 0x7EEF, 0x4C74, 0x5DFD,
-    0xB58B, 0xA402, 0x9699, 0x8710, 0xF3AF, 0xE226, 0xD0BD, 0xC134, 0x39C3, 0x284A, 0x1AD1, 0x0B58, 0x7FE7, 0x6E6E, 0x5CF5, 0x4D7C,
-    0xC60C, 0xD785, 0xE51E, 0xF497, 0x8028, 0x91A1, 0xA33A, 0xB2B3, 0x4A44, 0x5BCD, 0x6956, 0x78DF, 0x0C60, 0x1DE9, 0x2F72, 0x3EFB,
-    0xD68D, 0xC704, 0xF59F, 0xE416, 0x90A9, 0x8120, 0xB3BB, 0xA232, 0x5AC5, 0x4B4C, 0x79D7, 0x685E, 0x1CE1, 0x0D68, 0x3FF3, 0x2E7A,
-    0xE70E, 0xF687, 0xC41C, 0xD595, 0xA12A, 0xB0A3, 0x8238, 0x93B1, 0x6B46, 0x7ACF, 0x4854, 0x59DD, 0x2D62, 0x3CEB, 0x0E70, 0x1FF9,
-    0xF78F, 0xE606, 0xD49D, 0xC514, 0xB1AB, 0xA022, 0x92B9, 0x8330, 0x7BC7, 0x6A4E, 0x58D5, 0x495C, 0x3DE3, 0x2C6A, 0x1EF1, 0x0F78
-};
-/* Reference Model:CRC16_XMODEM_MODEL */
-static const uint16_t CRC16_XMODEM_MODEL_TABLE[256] = {
-    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7, 0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
-    0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6, 0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
-    0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485, 0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
-    0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4, 0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
-    0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823, 0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
-    0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12, 0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
-    0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41, 0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
-    0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70, 0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
-    0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F, 0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
-    0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E, 0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
-    0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D, 0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
-    0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C, 0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
-    0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB, 0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
-    0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A, 0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
-    0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9, 0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
-    0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8, 0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0
-};
-/* Reference Model:CRC16_DNP_MODEL */
-static const uint16_t CRC16_DNP_MODEL_TABLE[256] = {
-    0x0000, 0x365E, 0x6CBC, 0x5AE2, 0xD978, 0xEF26, 0xB5C4, 0x839A, 0xFF89, 0xC9D7, 0x9335, 0xA56B, 0x26F1, 0x10AF, 0x4A4D, 0x7C13,
-    0xB26B, 0x8435, 0xDED7, 0xE889, 0x6B13, 0x5D4D, 0x07AF, 0x31F1, 0x4DE2, 0x7BBC, 0x215E, 0x1700, 0x949A, 0xA2C4, 0xF826, 0xCE78,
-    0x29AF, 0x1FF1, 0x4513, 0x734D, 0xF0D7, 0xC689, 0x9C6B, 0xAA35, 0xD626, 0xE078, 0xBA9A, 0x8CC4, 0x0F5E, 0x3900, 0x63E2, 0x55BC,
-    0x9BC4, 0xAD9A, 0xF778, 0xC126, 0x42BC, 0x74E2, 0x2E00, 0x185E, 0x644D, 0x5213, 0x08F1, 0x3EAF, 0xBD35, 0x8B6B, 0xD189, 0xE7D7,
-    0x535E, 0x6500, 0x3FE2, 0x09BC, 0x8A26, 0xBC78, 0xE69A, 0xD0C4, 0xACD7, 0x9A89, 0xC06B, 0xF635, 0x75AF, 0x43F1, 0x1913, 0x2F4D,
-    0xE135, 0xD76B, 0x8D89, 0xBBD7, 0x384D, 0x0E13, 0x54F1, 0x62AF, 0x1EBC, 0x28E2, 0x7200, 0x445E, 0xC7C4, 0xF19A, 0xAB78, 0x9D26,
-    0x7AF1, 0x4CAF, 0x164D, 0x2013, 0xA389, 0x95D7, 0xCF35, 0xF96B, 0x8578, 0xB326, 0xE9C4, 0xDF9A, 0x5C00, 0x6A5E, 0x30BC, 0x06E2,
-    0xC89A, 0xFEC4, 0xA426, 0x9278, 0x11E2, 0x27BC, 0x7D5E, 0x4B00, 0x3713, 0x014D, 0x5BAF, 0x6DF1, 0xEE6B, 0xD835, 0x82D7, 0xB489,
-    0xA6BC, 0x90E2, 0xCA00, 0xFC5E, 0x7FC4, 0x499A, 0x1378, 0x2526, 0x5935, 0x6F6B, 0x3589, 0x03D7, 0x804D, 0xB613, 0xECF1, 0xDAAF,
-    0x14D7, 0x2289, 0x786B, 0x4E35, 0xCDAF, 0xFBF1, 0xA113, 0x974D, 0xEB5E, 0xDD00, 0x87E2, 0xB1BC, 0x3226, 0x0478, 0x5E9A, 0x68C4,
-    0x8F13, 0xB94D, 0xE3AF, 0xD5F1, 0x566B, 0x6035, 0x3AD7, 0x0C89, 0x709A, 0x46C4, 0x1C26, 0x2A78, 0xA9E2, 0x9FBC, 0xC55E, 0xF300,
-    0x3D78, 0x0B26, 0x51C4, 0x679A, 0xE400, 0xD25E, 0x88BC, 0xBEE2, 0xC2F1, 0xF4AF, 0xAE4D, 0x9813, 0x1B89, 0x2DD7, 0x7735, 0x416B,
-    0xF5E2, 0xC3BC, 0x995E, 0xAF00, 0x2C9A, 0x1AC4, 0x4026, 0x7678, 0x0A6B, 0x3C35, 0x66D7, 0x5089, 0xD313, 0xE54D, 0xBFAF, 0x89F1,
-    0x4789, 0x71D7, 0x2B35, 0x1D6B, 0x9EF1, 0xA8AF, 0xF24D, 0xC413, 0xB800, 0x8E5E, 0xD4BC, 0xE2E2, 0x6178, 0x5726, 0x0DC4, 0x3B9A,
-    0xDC4D, 0xEA13, 0xB0F1, 0x86AF, 0x0535, 0x336B, 0x6989, 0x5FD7, 0x23C4, 0x159A, 0x4F78, 0x7926, 0xFABC, 0xCCE2, 0x9600, 0xA05E,
-    0x6E26, 0x5878, 0x029A, 0x34C4, 0xB75E, 0x8100, 0xDBE2, 0xEDBC, 0x91AF, 0xA7F1, 0xFD13, 0xCB4D, 0x48D7, 0x7E89, 0x246B, 0x1235
-};
-
-/* http://www.ip33.com/crc.html */
-/* polynomial discard MSB or LSB because they are always 1 */
-typedef struct {
-    uint16_t initial_value;
-    uint16_t result_xor_value;
-    uint16_t polynomial;
-    bool input_inversion;
-    bool output_inversion;
-} crc16_param_t;
-
-// #define PRINT_TABLE
-#ifndef PRINT_TABLE
-static crc16_param_t crc16_param[] = {
-    {0x0000, 0x0000, 0x8005, true, true},       // Reference Model:CRC16_IBM_MODEL
-    {0x0000, 0xFFFF, 0x8005, true, true},       // Reference Model:CRC16_MAXIM_MODEL
-    {0xFFFF, 0xFFFF, 0x8005, true, true},       // Reference Model:CRC16_USB_MODEL
-    {0xFFFF, 0x0000, 0x8005, true, true},       // Reference Model:CRC16_MODBUS_MODEL
-    {0x0000, 0x0000, 0x1021, true, true},       // Reference Model:CRC16_CCITT_MODEL
-    {0xFFFF, 0x0000, 0x1021, false, false},     // Reference Model:CRC16_CCITT_FALSE_MODEL
-    {0xFFFF, 0xFFFF, 0x1021, true, true},       // Reference Model:CRC16_X25_MODEL
-    {0x0000, 0x0000, 0x1021, false, false},     // Reference Model:CRC16_XMODEM_MODEL
-    {0x0000, 0xFFFF, 0x3D65, true, true},       // Reference Model:CRC16_DNP_MODEL
-};
-#else
-/* Generate table usage */
-static crc16_param_t crc16_param[] = {
-    {0x0000, 0x0000, 0x8005, true, true},       // Reference Model:CRC16_IBM_MODEL
-    {0x0000, 0x0000, 0x8005, true, true},       // Reference Model:CRC16_MAXIM_MODEL
-    {0x0000, 0x0000, 0x8005, true, true},       // Reference Model:CRC16_USB_MODEL
-    {0x0000, 0x0000, 0x8005, true, true},       // Reference Model:CRC16_MODBUS_MODEL
-    {0x0000, 0x0000, 0x1021, true, true},       // Reference Model:CRC16_CCITT_MODEL
-    {0x0000, 0x0000, 0x1021, false, false},     // Reference Model:CRC16_CCITT_FALSE_MODEL
-    {0x0000, 0x0000, 0x1021, true, true},       // Reference Model:CRC16_X25_MODEL
-    {0x0000, 0x0000, 0x1021, false, false},     // Reference Model:CRC16_XMODEM_MODEL
-    {0x0000, 0x0000, 0x3D65, true, true},       // Reference Model:CRC16_DNP_MODEL
-};
-#endif
-
-/**
- * @brief uint8_t type data inversion
- *
- * @param data Data to be reversed
- * @return uint8_t The reversed data
- */
-static uint8_t u8_data_inversion(uint8_t data) {
-    uint8_t result = 0;
-    for (uint8_t i = 0; i < 8; i++) {
-        result <<= 1;
-        result |= (data >> i) & 0x01;
-    }
-    return result;
-}
-
-/**
- * @brief uint16_t type data inversion
- *
- * @param data Data to be reversed
- * @return uint16_t The reversed data
- */
-static uint16_t u16_data_inversion(uint16_t data) {
-    uint16_t result = 0;
-    for (uint8_t i = 0; i < 16; i++) {
-        result <<= 1;
-        result |= (data >> i) & 0x0001;
-    }
-    return result;
-}
-
-/**
- * @brief Calculates the 16 bit wide CRC of an input data of a given length.
- *
- * @param param CRC16 reference model
- * @param input_data Input uint8 t type array data
- * @param length Input uint8 t type array length
- * @return uint16_t CRC16 result
- */
-uint16_t crc16_calculate(CRC16_reference_model_e model, uint8_t *input_data, size_t length) {
-    /* parameter checkout */
-    assert(model < CRC16_NONE_MODEL);
-    assert(input_data != NULL);
-    assert(length > 0);
-
-    uint16_t crc16 = crc16_param[model].initial_value;
-    uint16_t polynomial = crc16_param[model].polynomial;
-    uint8_t data;
-
-    for (size_t i = 0; i < length; i++) {
-        data = *input_data++;
-        if (crc16_param[model].input_inversion) {
-            data = u8_data_inversion(data);
-        }
-        crc16 ^= (uint16_t)data << 8;
-        for (uint8_t j = 0; j < 8; j++) {
-            if (crc16 & 0x8000) {
-                crc16 <<= 1;
-                crc16 ^= polynomial; //  polynomial discard MSB or LSB because they are always 1, don't need to compute
-            } else {
-                crc16 <<= 1;
-            }
-
-        }
-    }
-
-    if (crc16_param[model].output_inversion) {
-        crc16 = u16_data_inversion(crc16);
-    }
-
-    return (crc16 ^ crc16_param[model].result_xor_value);
-}
-
-/**
- * @brief The mirror mode computes the 16-bit wide CRC of the input data of a given length.
- *
- * @param param CRC16 reference model
- * @param input_data Input uint8 t type array data
- * @param length Input uint8 t type array length
- * @return uint16_t CRC16 result
- */
-uint16_t crc16_calculate_mirror_mode(CRC16_reference_model_e model, uint8_t *input_data, size_t length) {
-    /* parameter checkout */
-    assert(model < CRC16_NONE_MODEL);
-    assert(input_data != NULL);
-    assert(length > 0);
-
-    uint16_t crc16 = crc16_param[model].initial_value;
-    uint16_t polynomial = u16_data_inversion(crc16_param[model].polynomial);
-    uint8_t data;
-
-    for (size_t i = 0; i < length; i++) {
-        data = *input_data++;
-        if (!crc16_param[model].input_inversion) {
-            data = u8_data_inversion(data);
-        }
-        crc16 ^= data;
-        for (uint8_t j = 0; j < 8; j++) {
-            if (crc16 & 0x0001) {
-                crc16 >>= 1;
-                crc16 ^= polynomial; //  polynomial discard MSB or LSB because they are always 1, don't need to compute
-            } else {
-                crc16 >>= 1;
-            }
-
-        }
-    }
-
-    if (!crc16_param[model].output_inversion) {
-        crc16 = u16_data_inversion(crc16);
-    }
-
-    return (crc16 ^ crc16_param[model].result_xor_value);
-}
-
-/**
- * @brief CRC16 calculation method group package
- *
- * @param param CRC16 reference model
- * @param input_data Packets of CRC16 to be computed, last byte of the array holds the CRC16 result
- * @param length Length of the CRC16 packet
- */
-void crc16_calculate_package(CRC16_reference_model_e model, uint8_t *input_data, size_t length) {
-    /* parameter checkout */
-    assert(model < CRC16_NONE_MODEL);
-    assert(input_data != NULL);
-    assert(length > 0);
-
-    uint16_t crc16_result = 0;
-    if (crc16_param[model].input_inversion == true && crc16_param[model].output_inversion == true) {
-        crc16_result = crc16_calculate_mirror_mode(model, input_data, length - 2);
-    } else {
-        crc16_result = crc16_calculate(model, input_data, length - 2);
-    }
-
-    *(input_data + length - 2) = crc16_result & 0xFF;
-    *(input_data + length - 1) = (crc16_result >> 8) & 0xFF;
-}
-
-/**
- * @brief CRC16 lookup table package
- *
- * @param param CRC16 reference model
- * @param input_data Packets of CRC16 to be computed, last byte of the array holds the CRC16 result
- * @param length Length of the CRC16 packet
- */
-void crc16_lookup_table_package(CRC16_reference_model_e model, uint8_t *input_data, size_t length) {
-    /* parameter checkout */
-    assert(model < CRC16_NONE_MODEL);
-    assert(input_data != NULL);
-    assert(length > 0);
-
-    uint16_t crc16_result = 0;
-    uint8_t *p = input_data;
-    if (p != NULL) {
-        switch (model)
-        {
-        case CRC16_IBM_MODEL:
-            crc16_result = crc16_param[model].initial_value;
-            for (size_t i = 0; i < length - 2; i++) {
-                crc16_result = (crc16_result >> 8) ^ CRC16_IBM_MODEL_TABLE[(crc16_result ^ *p++) & 0xFF];
-            }
-            crc16_result ^= crc16_param[model].result_xor_value;
-            break;
-
-        case CRC16_MAXIM_MODEL:
-            crc16_result = crc16_param[model].initial_value;
-            for (size_t i = 0; i < length - 2; i++) {
-                crc16_result = (crc16_result >> 8) ^ CRC16_MAXIM_MODEL_TABLE[(crc16_result ^ *p++) & 0xFF];
-            }
-            crc16_result ^= crc16_param[model].result_xor_value;
-            break;
-
-        case CRC16_USB_MODEL:
-            crc16_result = crc16_param[model].initial_value;
-            for (size_t i = 0; i < length - 2; i++) {
-                crc16_result = (crc16_result >> 8) ^ CRC16_USB_MODEL_TABLE[(crc16_result ^ *p++) & 0xFF];
-            }
-            crc16_result ^= crc16_param[model].result_xor_value;
-            break;
-
-        case CRC16_MODBUS_MODEL:
-            crc16_result = crc16_param[model].initial_value;
-            for (size_t i = 0; i < length - 2; i++) {
-                crc16_result = (crc16_result >> 8) ^ CRC16_MODBUS_MODEL_TABLE[(crc16_result ^ *p++) & 0xFF];
-            }
-            crc16_result ^= crc16_param[model].result_xor_value;
-            break;
-
-        case CRC16_CCITT_MODEL:
-            crc16_result = crc16_param[model].initial_value;
-            for (size_t i = 0; i < length - 2; i++) {
-                crc16_result = (crc16_result >> 8) ^ CRC16_CCITT_MODEL_TABLE[(crc16_result ^ *p++) & 0xFF];
-            }
-            crc16_result ^= crc16_param[model].result_xor_value;
-            break;
-
-        case CRC16_CCITT_FALSE_MODEL:
-            crc16_result = crc16_param[model].initial_value;
-            for (size_t i = 0; i < length - 2; i++) {
-                crc16_result = (crc16_result << 8) ^ CRC16_CCITT_FALSE_MODEL_TABLE[((crc16_result >> 8) ^ (*p++))];
-            }
-            crc16_result ^= crc16_param[model].result_xor_value;
-            break;
-
-        case CRC16_X25_MODEL:
-            crc16_result = crc16_param[model].initial_value;
-            for (size_t i = 0; i < length - 2; i++) {
-                crc16_result = (crc16_result >> 8) ^ CRC16_X25_MODEL_TABLE[(crc16_result ^ *p++) & 0xFF];
-            }
-            crc16_result ^= crc16_param[model].result_xor_value;
-            break;
-
-        case CRC16_XMODEM_MODEL:
-            crc16_result = crc16_param[model].initial_value;
-            for (size_t i = 0; i < length - 2; i++) {
-                crc16_result = (crc16_result << 8) ^ CRC16_XMODEM_MODEL_TABLE[((crc16_result >> 8) ^ (*p++))];
-            }
-            crc16_result ^= crc16_param[model].result_xor_value;
-            break;
-
-        case CRC16_DNP_MODEL:
-            crc16_result = crc16_param[model].initial_value;
-            for (size_t i = 0; i < length - 2; i++) {
-                crc16_result = (crc16_result >> 8) ^ CRC16_DNP_MODEL_TABLE[(crc16_result ^ *p++) & 0xFF];
-            }
-            crc16_result ^= crc16_param[model].result_xor_value;
-            break;
-
-        default:
-            break;
-        }
-    }
-
-    *(input_data + length - 2) = crc16_result & 0xFF;
-    *(input_data + length - 1) = (crc16_result >> 8) & 0xFF;
-}
-
-/**
- * @brief CRC16 calculation method package check
- *
- * @param param CRC16 reference model
- * @param input_data CRC16 packages to check
- * @param length Length of the CRC8 packet
- * @return true CRC16 checks succeed
- * @return false CRC16 checks fails
- */
-bool crc16_package_check(CRC16_reference_model_e model, uint8_t *input_data, size_t length) {
-    /* parameter checkout */
-    assert(model < CRC16_NONE_MODEL);
-    assert(input_data != NULL);
-    assert(length > 0);
-
-    uint16_t crc16_actual_value = ((uint16_t)(*(input_data + length - 1) << 8) | (*(input_data + length - 2)));
-    uint16_t crc16_result = 0;
-    if (crc16_param[model].input_inversion == true && crc16_param[model].output_inversion == true) {
-        crc16_result = crc16_calculate_mirror_mode(model, input_data, length - 2);
-    } else {
-        crc16_result = crc16_calculate(model, input_data, length - 2);
-    }
-    if (crc16_result != crc16_actual_value) {
-        return false;
-    }
-    return true;
-}
-
-/**
- * @brief CRC8 lookup table packages check
- *
- * @param param CRC8 reference model
- * @param input_data CRC8 packages to check
- * @param length Length of the CRC8 packet
- * @return true CRC8 checks succeed
- * @return false CRC8 checks fails
- */
-bool crc16_lookup_table_package_check(CRC16_reference_model_e model, uint8_t *input_data, size_t length) {
-    assert(model <= CRC16_NONE_MODEL);
-    assert(input_data != NULL);
-    assert(length > 0);
-
-    uint16_t crc16_result = 0;
-    uint16_t crc16_actual_value = ((uint16_t)(*(input_data + length - 1) << 8) | (*(input_data + length - 2)));
-    uint8_t *p = input_data;
-    switch (model)
-    {
-    case CRC16_IBM_MODEL:
-        crc16_result = crc16_param[model].initial_value;
-        for (size_t i = 0; i < length - 2; i++) {
-            crc16_result = (crc16_result >> 8) ^ CRC16_IBM_MODEL_TABLE[(crc16_result ^ *p++) & 0xFF];
-        }
-        crc16_result ^= crc16_param[model].result_xor_value;
-        break;
-
-    case CRC16_MAXIM_MODEL:
-        crc16_result = crc16_param[model].initial_value;
-        for (size_t i = 0; i < length - 2; i++) {
-            crc16_result = (crc16_result >> 8) ^ CRC16_MAXIM_MODEL_TABLE[(crc16_result ^ *p++) & 0xFF];
-        }
-        crc16_result ^= crc16_param[model].result_xor_value;
-        break;
-
-    case CRC16_USB_MODEL:
-        crc16_result = crc16_param[model].initial_value;
-        for (size_t i = 0; i < length - 2; i++) {
-            crc16_result = (crc16_result >> 8) ^ CRC16_USB_MODEL_TABLE[(crc16_result ^ *p++) & 0xFF];
-        }
-        crc16_result ^= crc16_param[model].result_xor_value;
-        break;
-
-    case CRC16_MODBUS_MODEL:
-        crc16_result = crc16_param[model].initial_value;
-        for (size_t i = 0; i < length - 2; i++) {
-            crc16_result = (crc16_result >> 8) ^ CRC16_MODBUS_MODEL_TABLE[(crc16_result ^ *p++) & 0xFF];
-        }
-        crc16_result ^= crc16_param[model].result_xor_value;
-        break;
-
-    case CRC16_CCITT_MODEL:
-        crc16_result = crc16_param[model].initial_value;
-        for (size_t i = 0; i < length - 2; i++) {
-            crc16_result = (crc16_result >> 8) ^ CRC16_CCITT_MODEL_TABLE[(crc16_result ^ *p++) & 0xFF];
-        }
-        crc16_result ^= crc16_param[model].result_xor_value;
-        break;
-
-    case CRC16_CCITT_FALSE_MODEL:
-        crc16_result = crc16_param[model].initial_value;
-        for (size_t i = 0; i < length - 2; i++) {
-            crc16_result = (crc16_result << 8) ^ CRC16_CCITT_FALSE_MODEL_TABLE[((crc16_result >> 8) ^ (*p++))];
-        }
-        crc16_result ^= crc16_param[model].result_xor_value;
-        break;
-
-    case CRC16_X25_MODEL:
-        crc16_result = crc16_param[model].initial_value;
-        for (size_t i = 0; i < length - 2; i++) {
-            crc16_result = (crc16_result >> 8) ^ CRC16_X25_MODEL_TABLE[(crc16_result ^ *p++) & 0xFF];
-        }
-        crc16_result ^= crc16_param[model].result_xor_value;
-        break;
-
-    case CRC16_XMODEM_MODEL:
-        crc16_result = crc16_param[model].initial_value;
-        for (size_t i = 0; i < length - 2; i++) {
-            crc16_result = (crc16_result << 8) ^ CRC16_XMODEM_MODEL_TABLE[((crc16_result >> 8) ^ (*p++))];
-        }
-        crc16_result ^= crc16_param[model].result_xor_value;
-        break;
-
-    case CRC16_DNP_MODEL:
-        crc16_result = crc16_param[model].initial_value;
-        for (size_t i = 0; i < length - 2; i++) {
-            crc16_result = (crc16_result >> 8) ^ CRC16_DNP_MODEL_TABLE[(crc16_result ^ *p++) & 0xFF];
-        }
-        crc16_result ^= crc16_param[model].result_xor_value;
-        break;
-
-    default:
-        break;
-    }
-
-    if (crc16_result != crc16_actual_value) {
-        return false;
-    }
-    return true;
-}
-
-#define TEST
-#ifdef TEST
-#include <stdio.h>
-
-static void print_crc16_table(CRC16_reference_model_e model);
-
-int main() {
-    uint8_t input_data[12] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x08};
-#if 0
-    uint16_t crc16_ibm_model = crc16_calculate(CRC16_IBM_MODEL, input_data, 10);
-    uint16_t crc16_maxim_model = crc16_calculate(CRC16_MAXIM_MODEL, input_data, 10);
-    uint16_t crc16_usb_model = crc16_calculate(CRC16_USB_MODEL, input_data, 10);
-    uint16_t crc16_modbus_model = crc16_calculate(CRC16_MODBUS_MODEL, input_data, 10);
-    uint16_t crc16_ccitt_model = crc16_calculate(CRC16_CCITT_MODEL, input_data, 10);
-    uint16_t crc16_ccitt_false_model = crc16_calculate(CRC16_CCITT_FALSE_MODEL, input_data, 10);
-    uint16_t crc16_x25_model = crc16_calculate(CRC16_X25_MODEL, input_data, 10);
-    uint16_t crc16_xmodem_model = crc16_calculate(CRC16_XMODEM_MODEL, input_data, 10);
-    uint16_t crc16_dnp_model = crc16_calculate(CRC16_DNP_MODEL, input_data, 10);
-
-    uint16_t mirror_crc16_ibm_model = crc16_calculate_mirror_mode(CRC16_IBM_MODEL, input_data, 10);
-    uint16_t mirror_crc16_maxim_model = crc16_calculate_mirror_mode(CRC16_MAXIM_MODEL, input_data, 10);
-    uint16_t mirror_crc16_usb_model = crc16_calculate_mirror_mode(CRC16_USB_MODEL, input_data, 10);
-    uint16_t mirror_crc16_modbus_model = crc16_calculate_mirror_mode(CRC16_MODBUS_MODEL, input_data, 10);
-    uint16_t mirror_crc16_ccitt_model = crc16_calculate_mirror_mode(CRC16_CCITT_MODEL, input_data, 10);
-    uint16_t mirror_crc16_ccitt_false_model = crc16_calculate_mirror_mode(CRC16_CCITT_FALSE_MODEL, input_data, 10);
-    uint16_t mirror_crc16_x25_model = crc16_calculate_mirror_mode(CRC16_X25_MODEL, input_data, 10);
-    uint16_t mirror_crc16_xmodem_model = crc16_calculate_mirror_mode(CRC16_XMODEM_MODEL, input_data, 10);
-    uint16_t mirror_crc16_dnp_model = crc16_calculate_mirror_mode(CRC16_DNP_MODEL, input_data, 10);
-
-    printf("---------------------------crc16_calculate result-----------------------\n");
-    printf("crc16_ibm_model result = 0x%04x\n", crc16_ibm_model);
-    printf("crc16_maxim_model result = 0x%04x\n", crc16_maxim_model);
-    printf("crc16_usb_model result = 0x%04x\n", crc16_usb_model);
-    printf("crc16_modbus_model result = 0x%04x\n", crc16_modbus_model);
-    printf("crc16_ccitt_model result = 0x%04x\n", crc16_ccitt_model);
-    printf("crc16_ccitt_false_model result = 0x%04x\n", crc16_ccitt_false_model);
-    printf("crc16_x25_model result = 0x%04x\n", crc16_x25_model);
-    printf("crc16_xmodem_model result = 0x%04x\n", crc16_xmodem_model);
-    printf("crc16_dnp_model result = 0x%04x\n", crc16_dnp_model);
-
-
-    printf("---------------------crc16_calculate_mirror_mode result------------------\n");
-    printf("mirror_crc16_ibm_model result = 0x%04x\n", mirror_crc16_ibm_model);
-    printf("mirror_crc16_maxim_model result = 0x%04x\n", mirror_crc16_maxim_model);
-    printf("mirror_crc16_usb_model result = 0x%04x\n", mirror_crc16_usb_model);
-    printf("mirror_crc16_modbus_model result = 0x%04x\n", mirror_crc16_modbus_model);
-    printf("mirror_crc16_ccitt_model result = 0x%04x\n", mirror_crc16_ccitt_model);
-    printf("mirror_crc16_ccitt_false_model result = 0x%04x\n", mirror_crc16_ccitt_false_model);
-    printf("mirror_crc16_x25_model result = 0x%04x\n", mirror_crc16_x25_model);
-    printf("mirror_crc16_xmodem_model result = 0x%04x\n", mirror_crc16_xmodem_model);
-    printf("mirror_crc16_dnp_model result = 0x%04x\n", mirror_crc16_dnp_model);
-#endif
-
-#if 0
-    print_crc16_table(CRC16_IBM_MODEL);
-    print_crc16_table(CRC16_MAXIM_MODEL);
-    print_crc16_table(CRC16_USB_MODEL);
-    print_crc16_table(CRC16_MODBUS_MODEL);
-    print_crc16_table(CRC16_CCITT_MODEL);
-    print_crc16_table(CRC16_CCITT_FALSE_MODEL);
-    print_crc16_table(CRC16_X25_MODEL);
-    print_crc16_table(CRC16_XMODEM_MODEL);
-    print_crc16_table(CRC16_DNP_MODEL);
-#endif
-#if 0
-    uint16_t crc16_result = 0;
-    bool crc16_check_result = false;
-    printf("data:[");
-    for (int i; i < sizeof(input_data)/sizeof(input_data[0]); i++) {
-        printf("0x%02x, ", input_data[i]);
-    }
-    printf("]\n");
-
-    crc16_calculate_package(CRC16_IBM_MODEL, input_data, 12);
-    crc16_result = input_data[11] << 8 | input_data[10];
-    printf("crc16_calculate_package CRC16_IBM_MODEL result = 0x%04x\n", crc16_result);
-    crc16_check_result = crc16_package_check(CRC16_IBM_MODEL, input_data, 12);
-    if (crc16_check_result) {
-        printf("crc16_calculate_package CRC16_IBM_MODEL check succeed.\n");
-    } else {
-        printf("crc16_calculate_package CRC16_IBM_MODEL check fail.\n");
-    }
-
-    crc16_calculate_package(CRC16_MAXIM_MODEL, input_data, 12);
-    crc16_result = input_data[11] << 8 | input_data[10];
-    printf("crc16_calculate_package CRC16_MAXIM_MODEL result = 0x%04x\n", crc16_result);
-    crc16_check_result = crc16_package_check(CRC16_MAXIM_MODEL, input_data, 12);
-    if (crc16_check_result) {
-        printf("crc16_calculate_package CRC16_MAXIM_MODEL check succeed.\n");
-    } else {
-        printf("crc16_calculate_package CRC16_MAXIM_MODEL check fail.\n");
-    }
-
-    crc16_calculate_package(CRC16_USB_MODEL, input_data, 12);
-    crc16_result = input_data[11] << 8 | input_data[10];
-    printf("crc16_calculate_package CRC16_USB_MODEL result = 0x%04x\n", crc16_result);
-    crc16_check_result = crc16_package_check(CRC16_USB_MODEL, input_data, 12);
-    if (crc16_check_result) {
-        printf("crc16_calculate_package CRC16_USB_MODEL check succeed.\n");
-    } else {
-        printf("crc16_calculate_package CRC16_USB_MODEL check fail.\n");
-    }
-
-    crc16_calculate_package(CRC16_MODBUS_MODEL, input_data, 12);
-    crc16_result = input_data[11] << 8 | input_data[10];
-    printf("crc16_calculate_package CRC16_MODBUS_MODEL result = 0x%04x\n", crc16_result);
-    crc16_check_result = crc16_package_check(CRC16_MODBUS_MODEL, input_data, 12);
-    if (crc16_check_result) {
-        printf("crc16_calculate_package CRC16_MODBUS_MODEL check succeed.\n");
-    } else {
-        printf("crc16_calculate_package CRC16_MODBUS_MODEL check fail.\n");
-    }
-
-    crc16_calculate_package(CRC16_CCITT_MODEL, input_data, 12);
-    crc16_result = input_data[11] << 8 | input_data[10];
-    printf("crc16_calculate_package CRC16_CCITT_MODEL result = 0x%04x\n", crc16_result);
-    crc16_check_result = crc16_package_check(CRC16_CCITT_MODEL, input_data, 12);
-    if (crc16_check_result) {
-        printf("crc16_calculate_package CRC16_CCITT_MODEL check succeed.\n");
-    } else {
-        printf("crc16_calculate_package CRC16_CCITT_MODEL check fail.\n");
-    }
-
-    crc16_calculate_package(CRC16_CCITT_FALSE_MODEL, input_data, 12);
-    crc16_result = input_data[11] << 8 | input_data[10];
-    printf("crc16_calculate_package CRC16_CCITT_FALSE_MODEL result = 0x%04x\n", crc16_result);
-    crc16_check_result = crc16_package_check(CRC16_CCITT_FALSE_MODEL, input_data, 12);
-    if (crc16_check_result) {
-        printf("crc16_calculate_package CRC16_CCITT_FALSE_MODEL check succeed.\n");
-    } else {
-        printf("crc16_calculate_package CRC16_CCITT_FALSE_MODEL check fail.\n");
-    }
-
-    crc16_calculate_package(CRC16_X25_MODEL, input_data, 12);
-    crc16_result = input_data[11] << 8 | input_data[10];
-    printf("crc16_calculate_package CRC16_X25_MODEL result = 0x%04x\n", crc16_result);
-    crc16_check_result = crc16_package_check(CRC16_X25_MODEL, input_data, 12);
-    if (crc16_check_result) {
-        printf("crc16_calculate_package CRC16_X25_MODEL check succeed.\n");
-    } else {
-        printf("crc16_calculate_package CRC16_X25_MODEL check fail.\n");
-    }
-
-    crc16_calculate_package(CRC16_XMODEM_MODEL, input_data, 12);
-    crc16_result = input_data[11] << 8 | input_data[10];
-    printf("crc16_calculate_package CRC16_XMODEM_MODEL result = 0x%04x\n", crc16_result);
-    crc16_check_result = crc16_package_check(CRC16_XMODEM_MODEL, input_data, 12);
-    if (crc16_check_result) {
-        printf("crc16_calculate_package CRC16_XMODEM_MODEL check succeed.\n");
-    } else {
-        printf("crc16_calculate_package CRC16_XMODEM_MODEL check fail.\n");
-    }
-
-    crc16_calculate_package(CRC16_DNP_MODEL, input_data, 12);
-    crc16_result = input_data[11] << 8 | input_data[10];
-    printf("crc16_calculate_package CRC16_DNP_MODEL result = 0x%04x\n", crc16_result);
-    crc16_check_result = crc16_package_check(CRC16_DNP_MODEL, input_data, 12);
-    if (crc16_check_result) {
-        printf("crc16_calculate_package CRC16_DNP_MODEL check succeed.\n");
-    } else {
-        printf("crc16_calculate_package CRC16_DNP_MODEL check fail.\n");
-    }
-#endif
-
-#if 1
-    uint16_t crc16_result = 0;
-    bool crc16_check_result = false;
-
-    crc16_lookup_table_package(CRC16_IBM_MODEL, input_data, 12);
-    crc16_result = input_data[11] << 8 | input_data[10];
-    printf("crc16_lookup_table_package CRC16_IBM_MODEL result = 0x%04x\n", crc16_result);
-    crc16_check_result = crc16_lookup_table_package_check(CRC16_IBM_MODEL, input_data, 12);
-    if (crc16_check_result) {
-        printf("crc16_calculate_package CRC16_IBM_MODEL check succeed.\n");
-    } else {
-        printf("crc16_calculate_package CRC16_IBM_MODEL check fail.\n");
-    }
-
-    crc16_lookup_table_package(CRC16_MAXIM_MODEL, input_data, 12);
-    crc16_result = input_data[11] << 8 | input_data[10];
-    printf("crc16_lookup_table_package CRC16_MAXIM_MODEL result = 0x%04x\n", crc16_result);
-    crc16_check_result = crc16_lookup_table_package_check(CRC16_MAXIM_MODEL, input_data, 12);
-    if (crc16_check_result) {
-        printf("crc16_calculate_package CRC16_MAXIM_MODEL check succeed.\n");
-    } else {
-        printf("crc16_calculate_package CRC16_MAXIM_MODEL check fail.\n");
-    }
-
-    crc16_lookup_table_package(CRC16_USB_MODEL, input_data, 12);
-    crc16_result = input_data[11] << 8 | input_data[10];
-    printf("crc16_lookup_table_package CRC16_USB_MODEL result = 0x%04x\n", crc16_result);
-    crc16_check_result = crc16_lookup_table_package_check(CRC16_USB_MODEL, input_data, 12);
-    if (crc16_check_result) {
-        printf("crc16_calculate_package CRC16_USB_MODEL check succeed.\n");
-    } else {
-        printf("crc16_calculate_package CRC16_USB_MODEL check fail.\n");
-    }
-
-    crc16_lookup_table_package(CRC16_MODBUS_MODEL, input_data, 12);
-    crc16_result = input_data[11] << 8 | input_data[10];
-    printf("crc16_lookup_table_package CRC16_MODBUS_MODEL result = 0x%04x\n", crc16_result);
-    crc16_check_result = crc16_lookup_table_package_check(CRC16_MODBUS_MODEL, input_data, 12);
-    if (crc16_check_result) {
-        printf("crc16_calculate_package CRC16_MODBUS_MODEL check succeed.\n");
-    } else {
-        printf("crc16_calculate_package CRC16_MODBUS_MODEL check fail.\n");
-    }
-
-    crc16_lookup_table_package(CRC16_CCITT_MODEL, input_data, 12);
-    crc16_result = input_data[11] << 8 | input_data[10];
-    printf("crc16_lookup_table_package CRC16_CCITT_MODEL result = 0x%04x\n", crc16_result);
-    crc16_check_result = crc16_lookup_table_package_check(CRC16_CCITT_MODEL, input_data, 12);
-    if (crc16_check_result) {
-        printf("crc16_calculate_package CRC16_CCITT_MODEL check succeed.\n");
-    } else {
-        printf("crc16_calculate_package CRC16_CCITT_MODEL check fail.\n");
-    }
-
-    crc16_lookup_table_package(CRC16_CCITT_FALSE_MODEL, input_data, 12);
-    crc16_result = input_data[11] << 8 | input_data[10];
-    printf("crc16_lookup_table_package CRC16_CCITT_FALSE_MODEL result = 0x%04x\n", crc16_result);
-    crc16_check_result = crc16_lookup_table_package_check(CRC16_CCITT_FALSE_MODEL, input_data, 12);
-    if (crc16_check_result) {
-        printf("crc16_calculate_package CRC16_CCITT_FALSE_MODEL check succeed.\n");
-    } else {
-        printf("crc16_calculate_package CRC16_CCITT_FALSE_MODEL check fail.\n");
-    }
-
-    crc16_lookup_table_package(CRC16_X25_MODEL, input_data, 12);
-    crc16_result = input_data[11] << 8 | input_data[10];
-    printf("crc16_lookup_table_package CRC16_X25_MODEL result = 0x%04x\n", crc16_result);
-    crc16_check_result = crc16_lookup_table_package_check(CRC16_X25_MODEL, input_data, 12);
-    if (crc16_check_result) {
-        printf("crc16_calculate_package CRC16_X25_MODEL check succeed.\n");
-    } else {
-        printf("crc16_calculate_package CRC16_X25_MODEL check fail.\n");
-    }
-
-    crc16_lookup_table_package(CRC16_XMODEM_MODEL, input_data, 12);
-    crc16_result = input_data[11] << 8 | input_data[10];
-    printf("crc16_lookup_table_package CRC16_XMODEM_MODEL result = 0x%04x\n", crc16_result);
-    crc16_check_result = crc16_lookup_table_package_check(CRC16_XMODEM_MODEL, input_data, 12);
-    if (crc16_check_result) {
-        printf("crc16_calculate_package CRC16_XMODEM_MODEL check succeed.\n");
-    } else {
-        printf("crc16_calculate_package CRC16_XMODEM_MODEL check fail.\n");
-    }
-
-    crc16_lookup_table_package(CRC16_DNP_MODEL, input_data, 12);
-    crc16_result = input_data[11] << 8 | input_data[10];
-    printf("crc16_lookup_table_package CRC16_DNP_MODEL result = 0x%04x\n", crc16_result);
-    crc16_check_result = crc16_lookup_table_package_check(CRC16_DNP_MODEL, input_data, 12);
-    if (crc16_check_result) {
-        printf("crc16_calculate_package CRC16_DNP_MODEL check succeed.\n");
-    } else {
-        printf("crc16_calculate_package CRC16_DNP_MODEL check fail.\n");
-    }
-#endif
-    return 0;
-}
-
-static void print_crc16_table(CRC16_reference_model_e model) {
-    uint16_t crc16_result = 0;
-    uint8_t i = 0;
-    switch (model)
-    {
-    case CRC16_IBM_MODEL:
-        printf("/* Reference Model:CRC16_IBM_MODEL */\n");
-        printf("static const uint16_t CRC16_IBM_MODEL_TABLE[256] = {\n");
-        break;
-
-    case CRC16_MAXIM_MODEL:
-        printf("/* Reference Model:CRC16_MAXIM_MODEL */\n");
-        printf("static const uint16_t CRC16_MAXIM_MODEL_TABLE[256] = {\n");
-        break;
-
-    case CRC16_USB_MODEL:
-        printf("/* Reference Model:CRC16_USB_MODEL */\n");
-        printf("static const uint16_t CRC16_USB_MODEL_TABLE[256] = {\n");
-        break;
-
-    case CRC16_MODBUS_MODEL:
-        printf("/* Reference Model:CRC16_MODBUS_MODEL */\n");
-        printf("const uint16_t CRC16_MODBUS_MODEL_TABLE[256] = {\n");
-        break;
-
-    case CRC16_CCITT_MODEL:
-        printf("/* Reference Model:CRC16_CCITT_MODEL */\n");
-        printf("static const uint16_t CRC16_CCITT_MODEL_TABLE[256] = {\n");
-        break;
-
-    case CRC16_CCITT_FALSE_MODEL:
-        printf("/* Reference Model:CRC16_CCITT_FALSE_MODEL */\n");
-        printf("static const uint16_t CRC16_CCITT_FALSE_MODEL_TABLE[256] = {\n");
-        break;
-
-    case CRC16_X25_MODEL:
-        printf("/* Reference Model:CRC16_X25_MODEL */\n");
-        printf("static const uint16_t CRC16_X25_MODEL_TABLE[256] = {\n");
-        break;
-
-    case CRC16_XMODEM_MODEL:
-        printf("/* Reference Model:CRC16_XMODEM_MODEL */\n");
-        printf("static const uint16_t CRC16_XMODEM_MODEL_TABLE[256] = {\n");
-        break;
-
-    case CRC16_DNP_MODEL:
-        printf("/* Reference Model:CRC16_DNP_MODEL */\n");
-        printf("static const uint16_t CRC16_DNP_MODEL_TABLE[256] = {\n");
-        break;
-
-    default:
-        break;
-    }
-    for (int j = 0; j <= 0xFF; j++, i++) {
-        if (crc16_param[model].input_inversion == true && crc16_param[model].output_inversion == true) {
-            crc16_result = crc16_calculate_mirror_mode(model, &i, 1);
-        } else {
-            crc16_result = crc16_calculate(model, &i, 1);
-        }
-        if (i % 16 == 0) {
-            printf("    ");
-        } else {
-            printf(" ");
-        }
-        printf("0x%04X", crc16_result);
-        if (i != 0xFF) {
-            printf(",");
-        }
-        if ((i + 1) % 16 == 0) {
-            printf("\n");
-        }
-    }
-    printf("};\n");
-}
-#endif
+/**
+ * @file crc16.c
+ * @brief Cyclic Redundancy Check (CRC16)
+ * @copyright Copyright (c) 2023
+ *
+ * Change Logs:
+ * Data             Author                          Notes
+ * 2023-04-23       vector(vector_qiu@163.com)      first version
+ *
+ */
+#include "crc16.h"
+#include "../crc_config/crc_config.h"
+#include "../../checksum_stats/checksum_stats.h"
+#include "../../checksum_copy/checksum_copy.h"
+#include <assert.h>
+#include <string.h>
+
+/* 16 entry nibble tables, two lookups per byte: 32 bytes per model instead of 512 */
+// #define CRC16_USE_NIBBLE_TABLE
+#ifndef CRC16_USE_NIBBLE_TABLE
+#if CRC16_MODELS & CRC16_IBM_MODEL_BIT
+const uint16_t CRC16_IBM_MODEL_TABLE[256] = {
+    0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241, 0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
+    0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40, 0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
+    0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40, 0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
+    0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641, 0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040,
+    0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240, 0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441,
+    0x3C00, 0xFCC1, 0xFD81, 0x3D40, 0xFF01, 0x3FC0, 0x3E80, 0xFE41, 0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
+    0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41, 0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
+    0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640, 0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041,
+    0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240, 0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
+    0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41, 0xAA01, 0x6AC0, 0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840,
+    0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41, 0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40,
+    0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1, 0xB681, 0x7640, 0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
+    0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241, 0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440,
+    0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40, 0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
+    0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40, 0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
+    0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641, 0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040
+};
+#endif
+/* Reference Model:CRC16_MAXIM_MODEL */
+#if CRC16_MODELS & CRC16_MAXIM_MODEL_BIT
+const uint16_t CRC16_MAXIM_MODEL_TABLE[256] = {
+    0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241, 0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
+    0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40, 0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
+    0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40, 0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
+    0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641, 0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040,
+    0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240, 0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441,
+    0x3C00, 0xFCC1, 0xFD81, 0x3D40, 0xFF01, 0x3FC0, 0x3E80, 0xFE41, 0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
+    0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41, 0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
+    0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640, 0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041,
+    0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240, 0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
+    0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41, 0xAA01, 0x6AC0, 0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840,
+    0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41, 0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40,
+    0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1, 0xB681, 0x7640, 0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
+    0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241, 0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440,
+    0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40, 0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
+    0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40, 0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
+    0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641, 0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040
+};
+#endif
+/* Reference Model:CRC16_USB_MODEL */
+#if CRC16_MODELS & CRC16_USB_MODEL_BIT
+const uint16_t CRC16_USB_MODEL_TABLE[256] = {
+    0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241, 0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
+    0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40, 0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
+    0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40, 0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
+    0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641, 0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040,
+    0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240, 0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441,
+    0x3C00, 0xFCC1, 0xFD81, 0x3D40, 0xFF01, 0x3FC0, 0x3E80, 0xFE41, 0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
+    0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41, 0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
+    0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640, 0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041,
+    0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240, 0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
+    0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41, 0xAA01, 0x6AC0, 0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840,
+    0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41, 0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40,
+    0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1, 0xB681, 0x7640, 0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
+    0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241, 0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440,
+    0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40, 0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
+    0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40, 0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
+    0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641, 0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040
+};
+#endif
+/* Reference Model:CRC16_MODBUS_MODEL */
+#if CRC16_MODELS & CRC16_MODBUS_MODEL_BIT
+const uint16_t CRC16_MODBUS_MODEL_TABLE[256] = {
+    0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241, 0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
+    0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40, 0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
+    0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40, 0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
+    0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641, 0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040,
+    0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240, 0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441,
+    0x3C00, 0xFCC1, 0xFD81, 0x3D40, 0xFF01, 0x3FC0, 0x3E80, 0xFE41, 0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
+    0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41, 0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
+    0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640, 0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041,
+    0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240, 0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
+    0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41, 0xAA01, 0x6AC0, 0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840,
+    0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41, 0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40,
+    0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1, 0xB681, 0x7640, 0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
+    0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241, 0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440,
+    0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40, 0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
+    0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40, 0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
+    0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641, 0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040
+};
+#endif
+/* Reference Model:CRC16_CCITT_MODEL */
+#if CRC16_MODELS & CRC16_CCITT_MODEL_BIT
+const uint16_t CRC16_CCITT_MODEL_TABLE[256] = {
+    0x0000, 0x1189, 0x2312, 0x329B, 0x4624, 0x57AD, 0x6536, 0x74BF, 0x8C48, 0x9DC1, 0xAF5A, 0xBED3, 0xCA6C, 0xDBE5, 0xE97E, 0xF8F7,
+    0x1081, 0x0108, 0x3393, 0x221A, 0x56A5, 0x472C, 0x75B7, 0x643E, 0x9CC9, 0x8D40, 0xBFDB, 0xAE52, 0xDAED, 0xCB64, 0xF9FF, 0xE876,
+    0x2102, 0x308B, 0x0210, 0x1399, 0x6726, 0x76AF, 0x4434, 0x55BD, 0xAD4A, 0xBCC3, 0x8E58, 0x9FD1, 0xEB6E, 0xFAE7, 0xC87C, 0xD9F5,
+    0x3183, 0x200A, 0x1291, 0x0318, 0x77A7, 0x662E, 0x54B5, 0x453C, 0xBDCB, 0xAC42, 0x9ED9, 0x8F50, 0xFBEF, 0xEA66, 0xD8FD, 0xC974,
+    0x4204, 0x538D, 0x6116, 0x709F, 0x0420, 0x15A9, 0x2732, 0x36BB, 0xCE4C, 0xDFC5, 0xED5E, 0xFCD7, 0x8868, 0x99E1, 0xAB7A, 0xBAF3,
+    0x5285, 0x430C, 0x7197, 0x601E, 0x14A1, 0x0528, 0x37B3, 0x263A, 0xDECD, 0xCF44, 0xFDDF, 0xEC56, 0x98E9, 0x8960, 0xBBFB, 0xAA72,
+    0x6306, 0x728F, 0x4014, 0x519D, 0x2522, 0x34AB, 0x0630, 0x17B9, 0xEF4E, 0xFEC7, 0xCC5C, 0xDDD5, 0xA96A, 0xB8E3, 0x8A78, 0x9BF1,
+    0x7387, 0x620E, 0x5095, 0x411C, 0x35A3, 0x242A, 0x16B1, 0x0738, 0xFFCF, 0xEE46, 0xDCDD, 0xCD54, 0xB9EB, 0xA862, 0x9AF9, 0x8B70,
+    0x8408, 0x9581, 0xA71A, 0xB693, 0xC22C, 0xD3A5, 0xE13E, 0xF0B7, 0x0840, 0x19C9, 0x2B52, 0x3ADB, 0x4E64, 0x5FED, 0x6D76, 0x7CFF,
+    0x9489, 0x8500, 0xB79B, 0xA612, 0xD2AD, 0xC324, 0xF1BF, 0xE036, 0x18C1, 0x0948, 0x3BD3, 0x2A5A, 0x5EE5, 0x4F6C, 0x7DF7, 0x6C7E,
+    0xA50A, 0xB483, 0x8618, 0x9791, 0xE32E, 0xF2A7, 0xC03C, 0xD1B5, 0x2942, 0x38CB, 0x0A50, 0x1BD9, 0x6F66, 0x7EEF, 0x4C74, 0x5DFD,
+    0xB58B, 0xA402, 0x9699, 0x8710, 0xF3AF, 0xE226, 0xD0BD, 0xC134, 0x39C3, 0x284A, 0x1AD1, 0x0B58, 0x7FE7, 0x6E6E, 0x5CF5, 0x4D7C,
+    0xC60C, 0xD785, 0xE51E, 0xF497, 0x8028, 0x91A1, 0xA33A, 0xB2B3, 0x4A44, 0x5BCD, 0x6956, 0x78DF, 0x0C60, 0x1DE9, 0x2F72, 0x3EFB,
+    0xD68D, 0xC704, 0xF59F, 0xE416, 0x90A9, 0x8120, 0xB3BB, 0xA232, 0x5AC5, 0x4B4C, 0x79D7, 0x685E, 0x1CE1, 0x0D68, 0x3FF3, 0x2E7A,
+    0xE70E, 0xF687, 0xC41C, 0xD595, 0xA12A, 0xB0A3, 0x8238, 0x93B1, 0x6B46, 0x7ACF, 0x4854, 0x59DD, 0x2D62, 0x3CEB, 0x0E70, 0x1FF9,
+    0xF78F, 0xE606, 0xD49D, 0xC514, 0xB1AB, 0xA022, 0x92B9, 0x8330, 0x7BC7, 0x6A4E, 0x58D5, 0x495C, 0x3DE3, 0x2C6A, 0x1EF1, 0x0F78
+};
+#endif
+/* Reference Model:CRC16_CCITT_FALSE_MODEL */
+#if CRC16_MODELS & CRC16_CCITT_FALSE_MODEL_BIT
+const uint16_t CRC16_CCITT_FALSE_MODEL_TABLE[256] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7, 0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+    0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6, 0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+    0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485, 0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+    0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4, 0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+    0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823, 0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+    0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12, 0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+    0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41, 0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+    0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70, 0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+    0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F, 0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+    0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E, 0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+    0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D, 0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+    0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C, 0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+    0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB, 0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+    0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A, 0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+    0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9, 0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+    0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8, 0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0
+};
+#endif
+/* Reference Model:CRC16_X25_MODEL */
+#if CRC16_MODELS & CRC16_X25_MODEL_BIT
+const uint16_t CRC16_X25_MODEL_TABLE[256] = {
+    0x0000, 0x1189, 0x2312, 0x329B, 0x4624, 0x57AD, 0x6536, 0x74BF, 0x8C48, 0x9DC1, 0xAF5A, 0xBED3, 0xCA6C, 0xDBE5, 0xE97E, 0xF8F7,
+    0x1081, 0x0108, 0x3393, 0x221A, 0x56A5, 0x472C, 0x75B7, 0x643E, 0x9CC9, 0x8D40, 0xBFDB, 0xAE52, 0xDAED, 0xCB64, 0xF9FF, 0xE876,
+    0x2102, 0x308B, 0x0210, 0x1399, 0x6726, 0x76AF, 0x4434, 0x55BD, 0xAD4A, 0xBCC3, 0x8E58, 0x9FD1, 0xEB6E, 0xFAE7, 0xC87C, 0xD9F5,
+    0x3183, 0x200A, 0x1291, 0x0318, 0x77A7, 0x662E, 0x54B5, 0x453C, 0xBDCB, 0xAC42, 0x9ED9, 0x8F50, 0xFBEF, 0xEA66, 0xD8FD, 0xC974,
+    0x4204, 0x538D, 0x6116, 0x709F, 0x0420, 0x15A9, 0x2732, 0x36BB, 0xCE4C, 0xDFC5, 0xED5E, 0xFCD7, 0x8868, 0x99E1, 0xAB7A, 0xBAF3,
+    0x5285, 0x430C, 0x7197, 0x601E, 0x14A1, 0x0528, 0x37B3, 0x263A, 0xDECD, 0xCF44, 0xFDDF, 0xEC56, 0x98E9, 0x8960, 0xBBFB, 0xAA72,
+    0x6306, 0x728F, 0x4014, 0x519D, 0x2522, 0x34AB, 0x0630, 0x17B9, 0xEF4E, 0xFEC7, 0xCC5C, 0xDDD5, 0xA96A, 0xB8E3, 0x8A78, 0x9BF1,
+    0x7387, 0x620E, 0x5095, 0x411C, 0x35A3, 0x242A, 0x16B1, 0x0738, 0xFFCF, 0xEE46, 0xDCDD, 0xCD54, 0xB9EB, 0xA862, 0x9AF9, 0x8B70,
+    0x8408, 0x9581, 0xA71A, 0xB693, 0xC22C, 0xD3A5, 0xE13E, 0xF0B7, 0x0840, 0x19C9, 0x2B52, 0x3ADB, 0x4E64, 0x5FED, 0x6D76, 0x7CFF,
+    0x9489, 0x8500, 0xB79B, 0xA612, 0xD2AD, 0xC324, 0xF1BF, 0xE036, 0x18C1, 0x0948, 0x3BD3, 0x2A5A, 0x5EE5, 0x4F6C, 0x7DF7, 0x6C7E,
+    0xA50A, 0xB483, 0x8618, 0x9791, 0xE32E, 0xF2A7, 0xC03C, 0xD1B5, 0x2942, 0x38CB, 0x0A50, 0x1BD9, 0x6F66, 0x7EEF, 0x4C74, 0x5DFD,
+    0xB58B, 0xA402, 0x9699, 0x8710, 0xF3AF, 0xE226, 0xD0BD, 0xC134, 0x39C3, 0x284A, 0x1AD1, 0x0B58, 0x7FE7, 0x6E6E, 0x5CF5, 0x4D7C,
+    0xC60C, 0xD785, 0xE51E, 0xF497, 0x8028, 0x91A1, 0xA33A, 0xB2B3, 0x4A44, 0x5BCD, 0x6956, 0x78DF, 0x0C60, 0x1DE9, 0x2F72, 0x3EFB,
+    0xD68D, 0xC704, 0xF59F, 0xE416, 0x90A9, 0x8120, 0xB3BB, 0xA232, 0x5AC5, 0x4B4C, 0x79D7, 0x685E, 0x1CE1, 0x0D68, 0x3FF3, 0x2E7A,
+    0xE70E, 0xF687, 0xC41C, 0xD595, 0xA12A, 0xB0A3, 0x8238, 0x93B1, 0x6B46, 0x7ACF, 0x4854, 0x59DD, 0x2D62, 0x3CEB, 0x0E70, 0x1FF9,
+    0xF78F, 0xE606, 0xD49D, 0xC514, 0xB1AB, 0xA022, 0x92B9, 0x8330, 0x7BC7, 0x6A4E, 0x58D5, 0x495C, 0x3DE3, 0x2C6A, 0x1EF1, 0x0F78
+};
+#endif
+/* Reference Model:CRC16_XMODEM_MODEL */
+#if CRC16_MODELS & CRC16_XMODEM_MODEL_BIT
+const uint16_t CRC16_XMODEM_MODEL_TABLE[256] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7, 0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+    0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6, 0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+    0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485, 0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+    0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4, 0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+    0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823, 0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+    0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12, 0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+    0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41, 0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+    0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70, 0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+    0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F, 0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+    0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E, 0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+    0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D, 0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+    0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C, 0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+    0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB, 0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+    0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A, 0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+    0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9, 0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+    0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8, 0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0
+};
+#endif
+/* Reference Model:CRC16_DNP_MODEL */
+#if CRC16_MODELS & CRC16_DNP_MODEL_BIT
+const uint16_t CRC16_DNP_MODEL_TABLE[256] = {
+    0x0000, 0x365E, 0x6CBC, 0x5AE2, 0xD978, 0xEF26, 0xB5C4, 0x839A, 0xFF89, 0xC9D7, 0x9335, 0xA56B, 0x26F1, 0x10AF, 0x4A4D, 0x7C13,
+    0xB26B, 0x8435, 0xDED7, 0xE889, 0x6B13, 0x5D4D, 0x07AF, 0x31F1, 0x4DE2, 0x7BBC, 0x215E, 0x1700, 0x949A, 0xA2C4, 0xF826, 0xCE78,
+    0x29AF, 0x1FF1, 0x4513, 0x734D, 0xF0D7, 0xC689, 0x9C6B, 0xAA35, 0xD626, 0xE078, 0xBA9A, 0x8CC4, 0x0F5E, 0x3900, 0x63E2, 0x55BC,
+    0x9BC4, 0xAD9A, 0xF778, 0xC126, 0x42BC, 0x74E2, 0x2E00, 0x185E, 0x644D, 0x5213, 0x08F1, 0x3EAF, 0xBD35, 0x8B6B, 0xD189, 0xE7D7,
+    0x535E, 0x6500, 0x3FE2, 0x09BC, 0x8A26, 0xBC78, 0xE69A, 0xD0C4, 0xACD7, 0x9A89, 0xC06B, 0xF635, 0x75AF, 0x43F1, 0x1913, 0x2F4D,
+    0xE135, 0xD76B, 0x8D89, 0xBBD7, 0x384D, 0x0E13, 0x54F1, 0x62AF, 0x1EBC, 0x28E2, 0x7200, 0x445E, 0xC7C4, 0xF19A, 0xAB78, 0x9D26,
+    0x7AF1, 0x4CAF, 0x164D, 0x2013, 0xA389, 0x95D7, 0xCF35, 0xF96B, 0x8578, 0xB326, 0xE9C4, 0xDF9A, 0x5C00, 0x6A5E, 0x30BC, 0x06E2,
+    0xC89A, 0xFEC4, 0xA426, 0x9278, 0x11E2, 0x27BC, 0x7D5E, 0x4B00, 0x3713, 0x014D, 0x5BAF, 0x6DF1, 0xEE6B, 0xD835, 0x82D7, 0xB489,
+    0xA6BC, 0x90E2, 0xCA00, 0xFC5E, 0x7FC4, 0x499A, 0x1378, 0x2526, 0x5935, 0x6F6B, 0x3589, 0x03D7, 0x804D, 0xB613, 0xECF1, 0xDAAF,
+    0x14D7, 0x2289, 0x786B, 0x4E35, 0xCDAF, 0xFBF1, 0xA113, 0x974D, 0xEB5E, 0xDD00, 0x87E2, 0xB1BC, 0x3226, 0x0478, 0x5E9A, 0x68C4,
+    0x8F13, 0xB94D, 0xE3AF, 0xD5F1, 0x566B, 0x6035, 0x3AD7, 0x0C89, 0x709A, 0x46C4, 0x1C26, 0x2A78, 0xA9E2, 0x9FBC, 0xC55E, 0xF300,
+    0x3D78, 0x0B26, 0x51C4, 0x679A, 0xE400, 0xD25E, 0x88BC, 0xBEE2, 0xC2F1, 0xF4AF, 0xAE4D, 0x9813, 0x1B89, 0x2DD7, 0x7735, 0x416B,
+    0xF5E2, 0xC3BC, 0x995E, 0xAF00, 0x2C9A, 0x1AC4, 0x4026, 0x7678, 0x0A6B, 0x3C35, 0x66D7, 0x5089, 0xD313, 0xE54D, 0xBFAF, 0x89F1,
+    0x4789, 0x71D7, 0x2B35, 0x1D6B, 0x9EF1, 0xA8AF, 0xF24D, 0xC413, 0xB800, 0x8E5E, 0xD4BC, 0xE2E2, 0x6178, 0x5726, 0x0DC4, 0x3B9A,
+    0xDC4D, 0xEA13, 0xB0F1, 0x86AF, 0x0535, 0x336B, 0x6989, 0x5FD7, 0x23C4, 0x159A, 0x4F78, 0x7926, 0xFABC, 0xCCE2, 0x9600, 0xA05E,
+    0x6E26, 0x5878, 0x029A, 0x34C4, 0xB75E, 0x8100, 0xDBE2, 0xEDBC, 0x91AF, 0xA7F1, 0xFD13, 0xCB4D, 0x48D7, 0x7E89, 0x246B, 0x1235
+};
+#endif
+static const uint16_t *const CRC16_TABLE[CRC16_NONE_MODEL] = {
+#if CRC16_MODELS & CRC16_IBM_MODEL_BIT
+    CRC16_IBM_MODEL_TABLE,
+#else
+    NULL,
+#endif
+#if CRC16_MODELS & CRC16_MAXIM_MODEL_BIT
+    CRC16_MAXIM_MODEL_TABLE,
+#else
+    NULL,
+#endif
+#if CRC16_MODELS & CRC16_USB_MODEL_BIT
+    CRC16_USB_MODEL_TABLE,
+#else
+    NULL,
+#endif
+#if CRC16_MODELS & CRC16_MODBUS_MODEL_BIT
+    CRC16_MODBUS_MODEL_TABLE,
+#else
+    NULL,
+#endif
+#if CRC16_MODELS & CRC16_CCITT_MODEL_BIT
+    CRC16_CCITT_MODEL_TABLE,
+#else
+    NULL,
+#endif
+#if CRC16_MODELS & CRC16_CCITT_FALSE_MODEL_BIT
+    CRC16_CCITT_FALSE_MODEL_TABLE,
+#else
+    NULL,
+#endif
+#if CRC16_MODELS & CRC16_X25_MODEL_BIT
+    CRC16_X25_MODEL_TABLE,
+#else
+    NULL,
+#endif
+#if CRC16_MODELS & CRC16_XMODEM_MODEL_BIT
+    CRC16_XMODEM_MODEL_TABLE,
+#else
+    NULL,
+#endif
+#if CRC16_MODELS & CRC16_DNP_MODEL_BIT
+    CRC16_DNP_MODEL_TABLE,
+#else
+    NULL,
+#endif
+};
+#endif
+/* Reference Model:CRC16_IBM_MODEL, CRC16_MAXIM_MODEL, CRC16_USB_MODEL, CRC16_MODBUS_MODEL */
+static const uint16_t CRC16_8005_REFLECTED_NIBBLE_TABLE[16] = {
+    0x0000, 0xCC01, 0xD801, 0x1400, 0xF001, 0x3C00, 0x2800, 0xE401, 0xA001, 0x6C00, 0x7800, 0xB401, 0x5000, 0x9C01, 0x8801, 0x4400
+};
+/* Reference Model:CRC16_CCITT_MODEL, CRC16_X25_MODEL */
+static const uint16_t CRC16_1021_REFLECTED_NIBBLE_TABLE[16] = {
+    0x0000, 0x1081, 0x2102, 0x3183, 0x4204, 0x5285, 0x6306, 0x7387, 0x8408, 0x9489, 0xA50A, 0xB58B, 0xC60C, 0xD68D, 0xE70E, 0xF78F
+};
+/* Reference Model:CRC16_CCITT_FALSE_MODEL, CRC16_XMODEM_MODEL */
+static const uint16_t CRC16_1021_NORMAL_NIBBLE_TABLE[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7, 0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+/* Reference Model:CRC16_DNP_MODEL */
+static const uint16_t CRC16_3D65_REFLECTED_NIBBLE_TABLE[16] = {
+    0x0000, 0xB26B, 0x29AF, 0x9BC4, 0x535E, 0xE135, 0x7AF1, 0xC89A, 0xA6BC, 0x14D7, 0x8F13, 0x3D78, 0xF5E2, 0x4789, 0xDC4D, 0x6E26
+};
+static const uint16_t *const CRC16_NIBBLE_TABLE[CRC16_NONE_MODEL] = {
+    CRC16_8005_REFLECTED_NIBBLE_TABLE,   // Reference Model:CRC16_IBM_MODEL
+    CRC16_8005_REFLECTED_NIBBLE_TABLE,   // Reference Model:CRC16_MAXIM_MODEL
+    CRC16_8005_REFLECTED_NIBBLE_TABLE,   // Reference Model:CRC16_USB_MODEL
+    CRC16_8005_REFLECTED_NIBBLE_TABLE,   // Reference Model:CRC16_MODBUS_MODEL
+    CRC16_1021_REFLECTED_NIBBLE_TABLE,   // Reference Model:CRC16_CCITT_MODEL
+    CRC16_1021_NORMAL_NIBBLE_TABLE,      // Reference Model:CRC16_CCITT_FALSE_MODEL
+    CRC16_1021_REFLECTED_NIBBLE_TABLE,   // Reference Model:CRC16_X25_MODEL
+    CRC16_1021_NORMAL_NIBBLE_TABLE,      // Reference Model:CRC16_XMODEM_MODEL
+    CRC16_3D65_REFLECTED_NIBBLE_TABLE,   // Reference Model:CRC16_DNP_MODEL
+};
+
+/* http://www.ip33.com/crc.html */
+/* polynomial discard MSB or LSB because they are always 1 */
+typedef struct {
+    uint16_t initial_value;
+    uint16_t result_xor_value;
+    uint16_t polynomial;
+    bool input_inversion;
+    bool output_inversion;
+} crc16_param_t;
+
+// #define PRINT_TABLE
+#ifndef PRINT_TABLE
+static crc16_param_t crc16_param[] = {
+    {0x0000, 0x0000, 0x8005, true, true},       // Reference Model:CRC16_IBM_MODEL
+    {0x0000, 0xFFFF, 0x8005, true, true},       // Reference Model:CRC16_MAXIM_MODEL
+    {0xFFFF, 0xFFFF, 0x8005, true, true},       // Reference Model:CRC16_USB_MODEL
+    {0xFFFF, 0x0000, 0x8005, true, true},       // Reference Model:CRC16_MODBUS_MODEL
+    {0x0000, 0x0000, 0x1021, true, true},       // Reference Model:CRC16_CCITT_MODEL
+    {0xFFFF, 0x0000, 0x1021, false, false},     // Reference Model:CRC16_CCITT_FALSE_MODEL
+    {0xFFFF, 0xFFFF, 0x1021, true, true},       // Reference Model:CRC16_X25_MODEL
+    {0x0000, 0x0000, 0x1021, false, false},     // Reference Model:CRC16_XMODEM_MODEL
+    {0x0000, 0xFFFF, 0x3D65, true, true},       // Reference Model:CRC16_DNP_MODEL
+};
+#else
+/* Generate table usage */
+static crc16_param_t crc16_param[] = {
+    {0x0000, 0x0000, 0x8005, true, true},       // Reference Model:CRC16_IBM_MODEL
+    {0x0000, 0x0000, 0x8005, true, true},       // Reference Model:CRC16_MAXIM_MODEL
+    {0x0000, 0x0000, 0x8005, true, true},       // Reference Model:CRC16_USB_MODEL
+    {0x0000, 0x0000, 0x8005, true, true},       // Reference Model:CRC16_MODBUS_MODEL
+    {0x0000, 0x0000, 0x1021, true, true},       // Reference Model:CRC16_CCITT_MODEL
+    {0x0000, 0x0000, 0x1021, false, false},     // Reference Model:CRC16_CCITT_FALSE_MODEL
+    {0x0000, 0x0000, 0x1021, true, true},       // Reference Model:CRC16_X25_MODEL
+    {0x0000, 0x0000, 0x1021, false, false},     // Reference Model:CRC16_XMODEM_MODEL
+    {0x0000, 0x0000, 0x3D65, true, true},       // Reference Model:CRC16_DNP_MODEL
+};
+#endif
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_bitreverse32)
+#define CRC16_BUILTIN_BITREVERSE32
+#endif
+#endif
+
+/**
+ * @brief uint32_t type bit reverse, uses the target's bit reverse instruction where there is one
+ *
+ * @param data Data to be reversed
+ * @return uint32_t The reversed data
+ */
+static inline uint32_t u32_bit_reverse(uint32_t data) {
+#if defined(CRC16_BUILTIN_BITREVERSE32)
+    return __builtin_bitreverse32(data);
+#elif defined(__GNUC__) && defined(__aarch64__)
+    __asm__("rbit %w0, %w1" : "=r"(data) : "r"(data));
+    return data;
+#elif defined(__GNUC__) && defined(__arm__) && defined(__ARM_ARCH) && (__ARM_ARCH >= 7) && !defined(__ARM_ARCH_8M_BASE__)
+    __asm__("rbit %0, %1" : "=r"(data) : "r"(data));
+    return data;
+#else
+    data = ((data >> 1) & 0x55555555) | ((data & 0x55555555) << 1);
+    data = ((data >> 2) & 0x33333333) | ((data & 0x33333333) << 2);
+    data = ((data >> 4) & 0x0F0F0F0F) | ((data & 0x0F0F0F0F) << 4);
+    data = ((data >> 8) & 0x00FF00FF) | ((data & 0x00FF00FF) << 8);
+    return (data >> 16) | (data << 16);
+#endif
+}
+
+/**
+ * @brief uint8_t type data inversion
+ *
+ * @param data Data to be reversed
+ * @return uint8_t The reversed data
+ */
+static uint8_t u8_data_inversion(uint8_t data) {
+    return (uint8_t)(u32_bit_reverse(data) >> 24);
+}
+
+/**
+ * @brief uint16_t type data inversion
+ *
+ * @param data Data to be reversed
+ * @return uint16_t The reversed data
+ */
+static uint16_t u16_data_inversion(uint16_t data) {
+    return (uint16_t)(u32_bit_reverse(data) >> 16);
+}
+
+#ifndef CRC_NO_BITWISE
+/**
+ * @brief Calculates the 16 bit wide CRC of an input data of a given length bit by bit.
+ *
+ * @param param CRC16 reference model
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint16_t CRC16 result
+ */
+static uint16_t crc16_bitwise_calculate(CRC16_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC16_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    CHECKSUM_STATS_BEGIN(stats_start);
+    uint16_t crc16;
+    uint16_t polynomial;
+
+    if (crc16_param[model].input_inversion) {
+        /* reflected domain: the register holds the bit reversed CRC and data enters at the LSB,
+           so neither the input bytes nor the register need reversing per byte */
+        crc16 = u16_data_inversion(crc16_param[model].initial_value);
+        polynomial = u16_data_inversion(crc16_param[model].polynomial);
+        for (size_t i = 0; i < length; i++) {
+            crc16 ^= *input_data++;
+            for (uint8_t j = 0; j < 8; j++) {
+                crc16 = (uint16_t)((crc16 >> 1) ^ (polynomial & (0u - (crc16 & 1u))));
+            }
+        }
+        if (!crc16_param[model].output_inversion) {
+            crc16 = u16_data_inversion(crc16);
+        }
+    } else {
+        crc16 = crc16_param[model].initial_value;
+        polynomial = crc16_param[model].polynomial;
+        for (size_t i = 0; i < length; i++) {
+            crc16 ^= (uint16_t)*input_data++ << 8;
+            for (uint8_t j = 0; j < 8; j++) {
+                crc16 = (uint16_t)((crc16 << 1) ^ (polynomial & (0u - (crc16 >> 15))));
+            }
+        }
+        if (crc16_param[model].output_inversion) {
+            crc16 = u16_data_inversion(crc16);
+        }
+    }
+
+    crc16 ^= crc16_param[model].result_xor_value;
+    CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC16, model, CHECKSUM_STATS_BITWISE, length, stats_start);
+    return crc16;
+}
+#endif
+
+/**
+ * @brief The mirror mode computes the 16-bit wide CRC of the input data of a given length.
+ *
+ * @param param CRC16 reference model
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint16_t CRC16 result
+ */
+uint16_t crc16_calculate_mirror_mode(CRC16_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC16_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    CHECKSUM_STATS_BEGIN(stats_start);
+    uint16_t crc16 = crc16_param[model].initial_value;
+    uint16_t polynomial = u16_data_inversion(crc16_param[model].polynomial);
+    uint8_t data;
+
+    for (size_t i = 0; i < length; i++) {
+        data = *input_data++;
+        if (!crc16_param[model].input_inversion) {
+            data = u8_data_inversion(data);
+        }
+        crc16 ^= data;
+        for (uint8_t j = 0; j < 8; j++) {
+            if (crc16 & 0x0001) {
+                crc16 >>= 1;
+                crc16 ^= polynomial; //  polynomial discard MSB or LSB because they are always 1, don't need to compute
+            } else {
+                crc16 >>= 1;
+            }
+
+        }
+    }
+
+    if (!crc16_param[model].output_inversion) {
+        crc16 = u16_data_inversion(crc16);
+    }
+
+    crc16 ^= crc16_param[model].result_xor_value;
+    CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC16, model, CHECKSUM_STATS_MIRROR, length, stats_start);
+    return crc16;
+}
+
+/**
+ * @brief CRC16 calculation method group package
+ *
+ * @param param CRC16 reference model
+ * @param input_data Packets of CRC16 to be computed, last byte of the array holds the CRC16 result
+ * @param length Length of the CRC16 packet
+ */
+void crc16_calculate_package(CRC16_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC16_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    uint16_t crc16_result = 0;
+    crc16_result = crc16_calculate(model, input_data, length - 2);
+
+    *(input_data + length - 2) = crc16_result & 0xFF;
+    *(input_data + length - 1) = (crc16_result >> 8) & 0xFF;
+}
+
+/**
+ * @brief Runs the CRC16 register over the input with the model's nibble table.
+ *
+ * @param model CRC16 reference model
+ * @param crc CRC16 register, initial value included and result xor value excluded
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint16_t CRC16 register
+ */
+static uint16_t crc16_nibble_table_update(CRC16_reference_model_e model, uint16_t crc, uint8_t *input_data, size_t length) {
+    const uint16_t *table = CRC16_NIBBLE_TABLE[model];
+    uint8_t *p = input_data;
+
+    if (crc16_param[model].input_inversion) {
+        for (size_t i = 0; i < length; i++) {
+            crc = (crc >> 4) ^ table[(crc ^ *p) & 0x0F];
+            crc = (crc >> 4) ^ table[(crc ^ (*p++ >> 4)) & 0x0F];
+        }
+    } else {
+        for (size_t i = 0; i < length; i++) {
+            crc = (crc << 4) ^ table[((crc >> 12) ^ (*p >> 4)) & 0x0F];
+            crc = (crc << 4) ^ table[((crc >> 12) ^ *p++) & 0x0F];
+        }
+    }
+
+    return crc;
+}
+
+/* failed lookup table checks are counted against the tables, whichever kernel ran */
+#ifdef CRC16_USE_NIBBLE_TABLE
+#define CRC16_STATS_LOOKUP CHECKSUM_STATS_NIBBLE
+#else
+#define CRC16_STATS_LOOKUP CHECKSUM_STATS_TABLE
+#endif
+
+/**
+ * @brief Runs the CRC16 register over the input with the model's lookup table.
+ *
+ * @param model CRC16 reference model
+ * @param crc CRC16 register, initial value included and result xor value excluded
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint16_t CRC16 register
+ */
+static uint16_t crc16_lookup_table_update(CRC16_reference_model_e model, uint16_t crc, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(CRC16_MODEL_ENABLED(model));
+
+    CHECKSUM_STATS_BEGIN(stats_start);
+#ifdef CRC16_USE_NIBBLE_TABLE
+    crc = crc16_nibble_table_update(model, crc, input_data, length);
+    CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC16, model, CHECKSUM_STATS_NIBBLE, length, stats_start);
+    return crc;
+#else
+    uint8_t *p = input_data;
+    switch (model)
+    {
+#if CRC16_MODELS & CRC16_IBM_MODEL_BIT
+    case CRC16_IBM_MODEL:
+        for (size_t i = 0; i < length; i++) {
+            crc = (crc >> 8) ^ CRC16_IBM_MODEL_TABLE[(crc ^ *p++) & 0xFF];
+        }
+        break;
+#endif
+
+#if CRC16_MODELS & CRC16_MAXIM_MODEL_BIT
+    case CRC16_MAXIM_MODEL:
+        for (size_t i = 0; i < length; i++) {
+            crc = (crc >> 8) ^ CRC16_MAXIM_MODEL_TABLE[(crc ^ *p++) & 0xFF];
+        }
+        break;
+#endif
+
+#if CRC16_MODELS & CRC16_USB_MODEL_BIT
+    case CRC16_USB_MODEL:
+        for (size_t i = 0; i < length; i++) {
+            crc = (crc >> 8) ^ CRC16_USB_MODEL_TABLE[(crc ^ *p++) & 0xFF];
+        }
+        break;
+#endif
+
+#if CRC16_MODELS & CRC16_MODBUS_MODEL_BIT
+    case CRC16_MODBUS_MODEL:
+        for (size_t i = 0; i < length; i++) {
+            crc = (crc >> 8) ^ CRC16_MODBUS_MODEL_TABLE[(crc ^ *p++) & 0xFF];
+        }
+        break;
+#endif
+
+#if CRC16_MODELS & CRC16_CCITT_MODEL_BIT
+    case CRC16_CCITT_MODEL:
+        for (size_t i = 0; i < length; i++) {
+            crc = (crc >> 8) ^ CRC16_CCITT_MODEL_TABLE[(crc ^ *p++) & 0xFF];
+        }
+        break;
+#endif
+
+#if CRC16_MODELS & CRC16_CCITT_FALSE_MODEL_BIT
+    case CRC16_CCITT_FALSE_MODEL:
+        for (size_t i = 0; i < length; i++) {
+            crc = (crc << 8) ^ CRC16_CCITT_FALSE_MODEL_TABLE[((crc >> 8) ^ (*p++))];
+        }
+        break;
+#endif
+
+#if CRC16_MODELS & CRC16_X25_MODEL_BIT
+    case CRC16_X25_MODEL:
+        for (size_t i = 0; i < length; i++) {
+            crc = (crc >> 8) ^ CRC16_X25_MODEL_TABLE[(crc ^ *p++) & 0xFF];
+        }
+        break;
+#endif
+
+#if CRC16_MODELS & CRC16_XMODEM_MODEL_BIT
+    case CRC16_XMODEM_MODEL:
+        for (size_t i = 0; i < length; i++) {
+            crc = (crc << 8) ^ CRC16_XMODEM_MODEL_TABLE[((crc >> 8) ^ (*p++))];
+        }
+        break;
+#endif
+
+#if CRC16_MODELS & CRC16_DNP_MODEL_BIT
+    case CRC16_DNP_MODEL:
+        for (size_t i = 0; i < length; i++) {
+            crc = (crc >> 8) ^ CRC16_DNP_MODEL_TABLE[(crc ^ *p++) & 0xFF];
+        }
+        break;
+#endif
+
+    default:
+        break;
+    }
+
+    CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC16, model, CHECKSUM_STATS_TABLE, length, stats_start);
+    return crc;
+#endif
+}
+
+/**
+ * @brief Generates the byte table of a model from its polynomial, whatever the build keeps in flash
+ *
+ * @param model CRC16 reference model
+ * @param table Table to fill
+ */
+static void crc16_byte_table_generate(CRC16_reference_model_e model, uint16_t table[256]) {
+    bool reflected = crc16_param[model].input_inversion;
+    uint16_t polynomial = crc16_param[model].polynomial;
+    uint16_t crc;
+
+    if (reflected) {
+        polynomial = u16_data_inversion(polynomial);
+    }
+    for (int i = 0; i < 256; i++) {
+        crc = reflected ? (uint16_t)i : (uint16_t)(i << 8);
+        for (int bit = 0; bit < 8; bit++) {
+            if (reflected) {
+                crc = (crc & 0x0001) ? (uint16_t)((crc >> 1) ^ polynomial) : (uint16_t)(crc >> 1);
+            } else {
+                crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ polynomial) : (uint16_t)(crc << 1);
+            }
+        }
+        table[i] = crc;
+    }
+}
+
+#ifndef CRC_NO_SLICING
+/* Slicing tables generated from crc16_param on first use: entry i of table k is the CRC16
+   register after byte i followed by k zero bytes, table 0 being the byte table. 4 KiB per
+   model, rows only for the models compiled in. */
+static uint16_t crc16_slice_table[CRC_MODEL_COUNT(CRC16_MODELS)][8][256];
+static bool crc16_slice_table_ready[CRC_MODEL_COUNT(CRC16_MODELS)];
+
+/* shorter inputs run byte by byte in the lookup table functions */
+#define CRC16_SLICE_MIN_LENGTH 16
+
+/**
+ * @brief Generates the slicing tables of a model from its polynomial
+ *
+ * @param model CRC16 reference model
+ */
+static void crc16_slice_table_init(CRC16_reference_model_e model) {
+    uint16_t (*t)[256] = crc16_slice_table[CRC16_MODEL_SLOT(model)];
+    bool reflected = crc16_param[model].input_inversion;
+    uint16_t crc;
+
+    crc16_byte_table_generate(model, t[0]);
+    /* one more zero byte through the byte table */
+    for (int k = 1; k < 8; k++) {
+        for (int i = 0; i < 256; i++) {
+            crc = t[k - 1][i];
+            t[k][i] = reflected ? (uint16_t)((crc >> 8) ^ t[0][crc & 0xFF]) : (uint16_t)((crc << 8) ^ t[0][crc >> 8]);
+        }
+    }
+    /* generating is idempotent, racing first users write the same values */
+#if defined(__GNUC__)
+    __atomic_store_n(&crc16_slice_table_ready[CRC16_MODEL_SLOT(model)], true, __ATOMIC_RELEASE);
+#else
+    crc16_slice_table_ready[CRC16_MODEL_SLOT(model)] = true;
+#endif
+}
+
+/**
+ * @brief Runs the CRC16 register over the input four or eight bytes at a time (slicing-by-4/8).
+ *
+ * @param model CRC16 reference model
+ * @param crc CRC16 register, initial value included and result xor value excluded
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @param slices Bytes per step, 4 or 8
+ * @return uint16_t CRC16 register
+ */
+static uint16_t crc16_slice_update(CRC16_reference_model_e model, uint16_t crc, uint8_t *input_data, size_t length, int slices) {
+    /* parameter checkout */
+    assert(CRC16_MODEL_ENABLED(model));
+
+    CHECKSUM_STATS_BEGIN(stats_start);
+#if defined(__GNUC__)
+    if (!__atomic_load_n(&crc16_slice_table_ready[CRC16_MODEL_SLOT(model)], __ATOMIC_ACQUIRE)) {
+#else
+    if (!crc16_slice_table_ready[CRC16_MODEL_SLOT(model)]) {
+#endif
+        crc16_slice_table_init(model);
+    }
+
+    const uint16_t (*t)[256] = (const uint16_t (*)[256])crc16_slice_table[CRC16_MODEL_SLOT(model)];
+    uint8_t *p = input_data;
+    size_t n = length;
+    uint16_t x;
+
+    /* the two register bytes meet the first two input bytes, the rest go through their own table */
+    if (crc16_param[model].input_inversion) {
+        if (slices == 8) {
+            for (; n >= 8; n -= 8, p += 8) {
+                x = crc ^ (uint16_t)(p[0] | (p[1] << 8));
+                crc = t[7][x & 0xFF] ^ t[6][x >> 8] ^ t[5][p[2]] ^ t[4][p[3]] ^
+                      t[3][p[4]] ^ t[2][p[5]] ^ t[1][p[6]] ^ t[0][p[7]];
+            }
+        }
+        for (; n >= 4; n -= 4, p += 4) {
+            x = crc ^ (uint16_t)(p[0] | (p[1] << 8));
+            crc = t[3][x & 0xFF] ^ t[2][x >> 8] ^ t[1][p[2]] ^ t[0][p[3]];
+        }
+        for (; n > 0; n--) {
+            crc = (crc >> 8) ^ t[0][(crc ^ *p++) & 0xFF];
+        }
+    } else {
+        if (slices == 8) {
+            for (; n >= 8; n -= 8, p += 8) {
+                x = crc ^ (uint16_t)((p[0] << 8) | p[1]);
+                crc = t[7][x >> 8] ^ t[6][x & 0xFF] ^ t[5][p[2]] ^ t[4][p[3]] ^
+                      t[3][p[4]] ^ t[2][p[5]] ^ t[1][p[6]] ^ t[0][p[7]];
+            }
+        }
+        for (; n >= 4; n -= 4, p += 4) {
+            x = crc ^ (uint16_t)((p[0] << 8) | p[1]);
+            crc = t[3][x >> 8] ^ t[2][x & 0xFF] ^ t[1][p[2]] ^ t[0][p[3]];
+        }
+        for (; n > 0; n--) {
+            crc = (uint16_t)(crc << 8) ^ t[0][((crc >> 8) ^ *p++) & 0xFF];
+        }
+    }
+
+    CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC16, model, CHECKSUM_STATS_SLICING, length, stats_start);
+    return crc;
+}
+#else
+/**
+ * @brief Built without slicing: the slicing kernels run the lookup table
+ *
+ * @param model CRC16 reference model
+ * @param crc CRC16 register, initial value included and result xor value excluded
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @param slices Ignored
+ * @return uint16_t CRC16 register
+ */
+static uint16_t crc16_slice_update(CRC16_reference_model_e model, uint16_t crc, uint8_t *input_data, size_t length, int slices) {
+    (void)slices;
+    return crc16_lookup_table_update(model, crc, input_data, length);
+}
+#endif /* CRC_NO_SLICING */
+
+/**
+ * @brief Runs the CRC16 register over the input with the lookup tables: slicing-by-8 from
+ *        CRC16_SLICE_MIN_LENGTH bytes, byte by byte below or when built for nibble tables.
+ *
+ * @param model CRC16 reference model
+ * @param crc CRC16 register, initial value included and result xor value excluded
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint16_t CRC16 register
+ */
+static uint16_t crc16_table_update(CRC16_reference_model_e model, uint16_t crc, uint8_t *input_data, size_t length) {
+#if !defined(CRC16_USE_NIBBLE_TABLE) && !defined(CRC_NO_SLICING)
+    if (length >= CRC16_SLICE_MIN_LENGTH) {
+        return crc16_slice_update(model, crc, input_data, length, 8);
+    }
+#endif
+    return crc16_lookup_table_update(model, crc, input_data, length);
+}
+
+/**
+ * @brief Calculates the 16 bit wide CRC of an input data of a given length with the model's lookup table.
+ *
+ * @param model CRC16 reference model
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint16_t CRC16 result
+ */
+static uint16_t crc16_lookup_table_calculate(CRC16_reference_model_e model, uint8_t *input_data, size_t length) {
+    return crc16_table_update(model, crc16_param[model].initial_value, input_data, length) ^ crc16_param[model].result_xor_value;
+}
+
+/* Lengths from which crc16_calculate switches to each kernel, per model; 0 leaves the kernel unused,
+   so everything runs bitwise until crc16_route_set or the autotuner sets thresholds */
+static size_t crc16_route_threshold[CRC16_NONE_MODEL][CRC16_KERNEL_NONE];
+
+#ifdef CHECKSUM_STATS
+static const checksum_stats_implementation_e crc16_kernel_stats[CRC16_KERNEL_NONE] = {
+    CHECKSUM_STATS_BITWISE, CHECKSUM_STATS_NIBBLE, CRC16_STATS_LOOKUP, CHECKSUM_STATS_SLICING, CHECKSUM_STATS_SLICING,
+};
+#endif
+
+/**
+ * @brief Picks the kernel for a length: the last one whose threshold the length reaches
+ *
+ * @param model CRC16 reference model
+ * @param length Input length
+ * @return crc16_kernel_e Kernel
+ */
+static inline crc16_kernel_e crc16_route(CRC16_reference_model_e model, size_t length) {
+    crc16_kernel_e kernel = CRC16_KERNEL_BITWISE;
+    for (int k = CRC16_KERNEL_BITWISE + 1; k < CRC16_KERNEL_NONE; k++) {
+        if (crc16_route_threshold[model][k] != 0 && length >= crc16_route_threshold[model][k]) {
+            kernel = (crc16_kernel_e)k;
+        }
+    }
+    return kernel;
+}
+
+/**
+ * @brief Tells whether a kernel can run a model on this build and CPU
+ *
+ * @param model CRC16 reference model
+ * @param kernel CRC16 kernel
+ * @return true The kernel can be routed to
+ * @return false It would fall back to another kernel
+ */
+bool crc16_kernel_available(CRC16_reference_model_e model, crc16_kernel_e kernel) {
+    /* parameter checkout */
+    assert(model < CRC16_NONE_MODEL);
+
+    /* a model left out of CRC16_MODELS has no kernel at all */
+    if (!CRC16_MODEL_ENABLED(model)) {
+        return false;
+    }
+#ifdef CRC_NO_SLICING
+    if (kernel == CRC16_KERNEL_SLICE4 || kernel == CRC16_KERNEL_SLICE8) {
+        return false;
+    }
+#endif
+    return kernel < CRC16_KERNEL_NONE;
+}
+
+/**
+ * @brief Calculates the 16 bit wide CRC of an input data of a given length with a chosen kernel.
+ *
+ * @param model CRC16 reference model
+ * @param kernel CRC16 kernel
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint16_t CRC16 result
+ */
+uint16_t crc16_kernel_calculate(CRC16_reference_model_e model, crc16_kernel_e kernel, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC16_NONE_MODEL);
+    assert(kernel < CRC16_KERNEL_NONE);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    switch (kernel)
+    {
+    case CRC16_KERNEL_NIBBLE:
+        return crc16_nibble_table_update(model, crc16_param[model].initial_value, input_data, length) ^ crc16_param[model].result_xor_value;
+
+    case CRC16_KERNEL_TABLE:
+        return crc16_lookup_table_update(model, crc16_param[model].initial_value, input_data, length) ^ crc16_param[model].result_xor_value;
+
+    case CRC16_KERNEL_SLICE4:
+        return crc16_slice_update(model, crc16_param[model].initial_value, input_data, length, 4) ^ crc16_param[model].result_xor_value;
+
+    case CRC16_KERNEL_SLICE8:
+        return crc16_slice_update(model, crc16_param[model].initial_value, input_data, length, 8) ^ crc16_param[model].result_xor_value;
+
+    default:
+#ifdef CRC_NO_BITWISE
+        return crc16_lookup_table_calculate(model, input_data, length);
+#else
+        return crc16_bitwise_calculate(model, input_data, length);
+#endif
+    }
+}
+
+/**
+ * @brief Sets the lengths from which crc16_calculate runs each kernel of a model. Not thread safe,
+ *        meant for start up before the CRC16 functions are in use.
+ *
+ * @param model CRC16 reference model
+ * @param threshold Shortest length per kernel, 0 for never; the bitwise entry is ignored and
+ *                  kernels not available are left unused
+ */
+void crc16_route_set(CRC16_reference_model_e model, const size_t threshold[CRC16_KERNEL_NONE]) {
+    /* parameter checkout */
+    assert(model < CRC16_NONE_MODEL);
+    assert(threshold != NULL);
+
+    crc16_route_threshold[model][CRC16_KERNEL_BITWISE] = 0;
+    for (int k = CRC16_KERNEL_BITWISE + 1; k < CRC16_KERNEL_NONE; k++) {
+        crc16_route_threshold[model][k] = crc16_kernel_available(model, (crc16_kernel_e)k) ? threshold[k] : 0;
+    }
+}
+
+/**
+ * @brief Gets the lengths from which crc16_calculate runs each kernel of a model
+ *
+ * @param model CRC16 reference model
+ * @param threshold Shortest length per kernel, 0 for never
+ */
+void crc16_route_get(CRC16_reference_model_e model, size_t threshold[CRC16_KERNEL_NONE]) {
+    /* parameter checkout */
+    assert(model < CRC16_NONE_MODEL);
+    assert(threshold != NULL);
+
+    for (int k = 0; k < CRC16_KERNEL_NONE; k++) {
+        threshold[k] = crc16_route_threshold[model][k];
+    }
+}
+
+/**
+ * @brief Gets the initial and result xor values of a model, as the CRC catalogues give them
+ *
+ * @param model CRC16 reference model
+ * @param initial_value Register before the message
+ * @param result_xor_value Xored onto the register at the end
+ */
+void crc16_param_get(CRC16_reference_model_e model, uint16_t *initial_value, uint16_t *result_xor_value) {
+    /* parameter checkout */
+    assert(model < CRC16_NONE_MODEL);
+    assert(initial_value != NULL);
+    assert(result_xor_value != NULL);
+
+    *initial_value = crc16_param[model].initial_value;
+    *result_xor_value = crc16_param[model].result_xor_value;
+}
+
+/**
+ * @brief Calculates the 16 bit wide CRC of an input data of a given length, with the kernel
+ *        routed for the length (bit by bit unless thresholds were set).
+ *
+ * @param param CRC16 reference model
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint16_t CRC16 result
+ */
+uint16_t crc16_calculate(CRC16_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC16_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    return crc16_kernel_calculate(model, crc16_route(model, length), input_data, length);
+}
+
+/**
+ * @brief CRC16 lookup table package
+ *
+ * @param param CRC16 reference model
+ * @param input_data Packets of CRC16 to be computed, last byte of the array holds the CRC16 result
+ * @param length Length of the CRC16 packet
+ */
+void crc16_lookup_table_package(CRC16_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC16_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    uint16_t crc16_result = 0;
+    crc16_result = crc16_lookup_table_calculate(model, input_data, length - 2);
+
+    *(input_data + length - 2) = crc16_result & 0xFF;
+    *(input_data + length - 1) = (crc16_result >> 8) & 0xFF;
+}
+
+/**
+ * @brief CRC16 calculation method package check
+ *
+ * @param param CRC16 reference model
+ * @param input_data CRC16 packages to check
+ * @param length Length of the CRC8 packet
+ * @return true CRC16 checks succeed
+ * @return false CRC16 checks fails
+ */
+bool crc16_package_check(CRC16_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC16_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    uint16_t crc16_actual_value = ((uint16_t)(*(input_data + length - 1) << 8) | (*(input_data + length - 2)));
+    uint16_t crc16_result = 0;
+    crc16_result = crc16_calculate(model, input_data, length - 2);
+    if (crc16_result != crc16_actual_value) {
+        CHECKSUM_STATS_FAILURE(CHECKSUM_STATS_CRC16, model, crc16_kernel_stats[crc16_route(model, length - 2)]);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief CRC8 lookup table packages check
+ *
+ * @param param CRC8 reference model
+ * @param input_data CRC8 packages to check
+ * @param length Length of the CRC8 packet
+ * @return true CRC8 checks succeed
+ * @return false CRC8 checks fails
+ */
+bool crc16_lookup_table_package_check(CRC16_reference_model_e model, uint8_t *input_data, size_t length) {
+    assert(model <= CRC16_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    uint16_t crc16_result = 0;
+    uint16_t crc16_actual_value = ((uint16_t)(*(input_data + length - 1) << 8) | (*(input_data + length - 2)));
+    crc16_result = crc16_lookup_table_calculate(model, input_data, length - 2);
+
+    if (crc16_result != crc16_actual_value) {
+        CHECKSUM_STATS_FAILURE(CHECKSUM_STATS_CRC16, model, CRC16_STATS_LOOKUP);
+        return false;
+    }
+    return true;
+}
+
+/* packages crc16_package_check_batch runs side by side, so the table loads of one
+   package overlap the dependent chain of the others */
+#define CRC16_BATCH_LANES 4
+
+/**
+ * @brief Runs four CRC16 registers over the same number of bytes of four inputs, interleaved.
+ *
+ * @param model CRC16 reference model
+ * @param crc CRC16 registers, initial value included and result xor value excluded
+ * @param input Inputs of the four registers
+ * @param length Bytes of each input
+ */
+static void crc16_table_update_lanes(CRC16_reference_model_e model, uint16_t crc[CRC16_BATCH_LANES],
+                                     uint8_t *const input[CRC16_BATCH_LANES], size_t length) {
+#ifdef CRC16_USE_NIBBLE_TABLE
+    for (int lane = 0; lane < CRC16_BATCH_LANES; lane++) {
+        crc[lane] = crc16_nibble_table_update(model, crc[lane], input[lane], length);
+    }
+#else
+    const uint16_t *table = CRC16_TABLE[model];
+    uint16_t crc0 = crc[0], crc1 = crc[1], crc2 = crc[2], crc3 = crc[3];
+    const uint8_t *p0 = input[0], *p1 = input[1], *p2 = input[2], *p3 = input[3];
+
+    assert(table != NULL);
+    if (!crc16_param[model].input_inversion) {
+        for (size_t i = 0; i < length; i++) {
+            crc0 = (uint16_t)(crc0 << 8) ^ table[(crc0 >> 8) ^ p0[i]];
+            crc1 = (uint16_t)(crc1 << 8) ^ table[(crc1 >> 8) ^ p1[i]];
+            crc2 = (uint16_t)(crc2 << 8) ^ table[(crc2 >> 8) ^ p2[i]];
+            crc3 = (uint16_t)(crc3 << 8) ^ table[(crc3 >> 8) ^ p3[i]];
+        }
+    } else {
+        for (size_t i = 0; i < length; i++) {
+            crc0 = (crc0 >> 8) ^ table[(crc0 ^ p0[i]) & 0xFF];
+            crc1 = (crc1 >> 8) ^ table[(crc1 ^ p1[i]) & 0xFF];
+            crc2 = (crc2 >> 8) ^ table[(crc2 ^ p2[i]) & 0xFF];
+            crc3 = (crc3 >> 8) ^ table[(crc3 ^ p3[i]) & 0xFF];
+        }
+    }
+    crc[0] = crc0;
+    crc[1] = crc1;
+    crc[2] = crc2;
+    crc[3] = crc3;
+#endif
+}
+
+/**
+ * @brief Checks a batch of CRC16 packages of any lengths, such as the datagrams of one receive call:
+ *        four packages at a time run side by side over their common length with the lookup table,
+ *        then each finishes alone. The result of each package is that of crc16_lookup_table_package_check.
+ *
+ * @param model CRC16 reference model
+ * @param packages CRC16 packages to check
+ * @param lengths Length of each CRC16 package, the CRC16 in the last two bytes, more than two
+ * @param count Number of packages
+ * @param valid (count + 63) / 64 words, bit i % 64 of word i / 64 set when package i checks
+ */
+void crc16_package_check_batch(CRC16_reference_model_e model, uint8_t *const *packages, const size_t *lengths,
+                               size_t count, uint64_t *valid) {
+    /* parameter checkout */
+    assert(model < CRC16_NONE_MODEL);
+    assert(packages != NULL || count == 0);
+    assert(lengths != NULL || count == 0);
+    assert(valid != NULL || count == 0);
+
+    const uint16_t initial_value = crc16_param[model].initial_value;
+    const uint16_t result_xor_value = crc16_param[model].result_xor_value;
+    uint16_t crc[CRC16_BATCH_LANES];
+    size_t i = 0;
+
+    memset(valid, 0, (count + 63) / 64 * sizeof(uint64_t));
+    for (; i < count; i += CRC16_BATCH_LANES) {
+        size_t lanes = (count - i < CRC16_BATCH_LANES) ? count - i : CRC16_BATCH_LANES;
+        size_t common = 0;
+
+        for (size_t lane = 0; lane < CRC16_BATCH_LANES; lane++) {
+            crc[lane] = initial_value;
+        }
+        if (lanes == CRC16_BATCH_LANES) {
+            common = lengths[i] - 2;
+            for (size_t lane = 1; lane < CRC16_BATCH_LANES; lane++) {
+                assert(lengths[i + lane] > 2);
+                if (lengths[i + lane] - 2 < common) {
+                    common = lengths[i + lane] - 2;
+                }
+            }
+            CHECKSUM_STATS_BEGIN(stats_start);
+            crc16_table_update_lanes(model, crc, packages + i, common);
+            CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC16, model, CRC16_STATS_LOOKUP, CRC16_BATCH_LANES * common, stats_start);
+        }
+
+        for (size_t lane = 0; lane < lanes; lane++) {
+            uint8_t *input_data = packages[i + lane];
+            size_t length = lengths[i + lane];
+            assert(input_data != NULL);
+            assert(length > 2);
+
+            if (length - 2 > common) {
+                crc[lane] = crc16_lookup_table_update(model, crc[lane], input_data + common, length - 2 - common);
+            }
+            uint16_t crc16_actual_value = ((uint16_t)(*(input_data + length - 1) << 8) | (*(input_data + length - 2)));
+            if ((uint16_t)(crc[lane] ^ result_xor_value) == crc16_actual_value) {
+                valid[(i + lane) / 64] |= (uint64_t)1 << ((i + lane) % 64);
+            } else {
+                CHECKSUM_STATS_FAILURE(CHECKSUM_STATS_CRC16, model, CRC16_STATS_LOOKUP);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Starts a streaming CRC16 computation
+ *
+ * @param ctx CRC16 streaming context
+ * @param model CRC16 reference model
+ */
+void crc16_init(crc16_ctx *ctx, CRC16_reference_model_e model) {
+    /* parameter checkout */
+    assert(ctx != NULL);
+    assert(model < CRC16_NONE_MODEL);
+
+    ctx->model = model;
+    ctx->crc = crc16_param[model].initial_value;
+}
+
+/**
+ * @brief Adds input data to a streaming CRC16 computation, with the model's lookup table
+ *
+ * @param ctx CRC16 streaming context
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ */
+void crc16_update(crc16_ctx *ctx, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(ctx != NULL);
+    assert(input_data != NULL || length == 0);
+
+    ctx->crc = crc16_table_update(ctx->model, ctx->crc, input_data, length);
+}
+
+/**
+ * @brief Copies input data and adds it to a streaming CRC16 computation in one pass, such as a payload
+ *        into its frame buffer: every chunk is checksummed while it sits in the L1 cache and copied
+ *        from there, with non-temporal stores for long copies
+ *
+ * @param ctx CRC16 streaming context
+ * @param destination Destination, not overlapping the source
+ * @param source Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ */
+void crc16_copy(crc16_ctx *ctx, uint8_t *destination, const uint8_t *source, size_t length) {
+    /* parameter checkout */
+    assert(ctx != NULL);
+    assert((destination != NULL && source != NULL) || length == 0);
+
+    bool nontemporal = length >= CHECKSUM_COPY_NONTEMPORAL;
+    while (length > 0) {
+        size_t chunk = (length < CHECKSUM_COPY_CHUNK) ? length : CHECKSUM_COPY_CHUNK;
+        ctx->crc = crc16_table_update(ctx->model, ctx->crc, (uint8_t *)source, chunk);
+        checksum_copy_chunk(destination, source, chunk, nontemporal);
+        destination += chunk;
+        source += chunk;
+        length -= chunk;
+    }
+    checksum_copy_fence(nontemporal);
+}
+
+/**
+ * @brief Finishes a streaming CRC16 computation
+ *
+ * @param ctx CRC16 streaming context
+ * @return uint16_t CRC16 result, the same as crc16_calculate over all the input data
+ */
+uint16_t crc16_final(crc16_ctx *ctx) {
+    /* parameter checkout */
+    assert(ctx != NULL);
+
+    return (ctx->crc ^ crc16_param[ctx->model].result_xor_value);
+}
+
+/**
+ * @brief Syndrome of a single flipped bit in a frame, independent of the frame content.
+ *
+ * @param model CRC16 reference model
+ * @param scratch Zeroed buffer of at least length - 2 bytes, left zeroed on return
+ * @param length Length of the CRC16 packet
+ * @param position Bit position, byte index * 8 + bit index (LSB = 0)
+ * @return uint16_t The syndrome, calculated CRC16 xor received CRC16
+ */
+static uint16_t crc16_bit_syndrome(CRC16_reference_model_e model, uint8_t *scratch, size_t length, size_t position) {
+    size_t index = position >> 3;
+    uint8_t bit = position & 0x07;
+    uint16_t syndrome;
+
+    /* CRC16 bytes are received low byte first */
+    if (index >= length - 2) {
+        return (uint16_t)(1u << (bit + 8 * (index - (length - 2))));
+    }
+    scratch[index] ^= (uint8_t)(1u << bit);
+    syndrome = crc16_calculate(model, scratch, length - 2);
+    scratch[index] ^= (uint8_t)(1u << bit);
+    return syndrome ^ crc16_calculate(model, scratch, length - 2);
+}
+
+/**
+ * @brief Build the syndrome table used to repair frames of one model and one length
+ *
+ * Every single bit error gives a distinct syndrome as long as the polynomial's Hamming
+ * distance is at least 3 for this frame length, every double bit error as long as it
+ * is at least 5. The table is only filled with the error patterns the distance allows.
+ *
+ * @param table Table to fill, about 256 KiB
+ * @param model CRC16 reference model
+ * @param length Length of the CRC16 packets to repair, 3 to CRC16_CORRECTION_MAX_LENGTH
+ * @return true At least single bit errors can be repaired
+ * @return false The frame is too long for the polynomial to locate errors
+ */
+bool crc16_correction_table_init(crc16_correction_table_t *table, CRC16_reference_model_e model, size_t length) {
+    /* parameter checkout */
+    assert(table != NULL);
+    assert(model < CRC16_NONE_MODEL);
+    assert(length > 2 && length <= CRC16_CORRECTION_MAX_LENGTH);
+
+    uint8_t scratch[CRC16_CORRECTION_MAX_LENGTH] = {0};
+    uint16_t single[CRC16_CORRECTION_MAX_LENGTH * 8];
+    size_t bits = length * 8;
+
+    table->model = model;
+    table->length = length;
+    table->correctable_bits = 0;
+    memset(table->syndrome, 0, sizeof(table->syndrome));
+
+    /* single bit errors: distance >= 3 */
+    for (size_t i = 0; i < bits; i++) {
+        single[i] = crc16_bit_syndrome(model, scratch, length, i);
+        if (single[i] == 0 || table->syndrome[single[i]] != 0) {
+            memset(table->syndrome, 0, sizeof(table->syndrome));
+            return false;
+        }
+        table->syndrome[single[i]] = (uint32_t)(i + 1);
+    }
+    table->correctable_bits = 1;
+
+    /* double bit errors: distance >= 5 */
+    for (size_t i = 0; i < bits; i++) {
+        for (size_t j = i + 1; j < bits; j++) {
+            uint16_t syndrome = single[i] ^ single[j];
+            if (syndrome == 0 || table->syndrome[syndrome] != 0) {
+                for (size_t k = 0; k < 65536; k++) {
+                    if (table->syndrome[k] >> 16) {
+                        table->syndrome[k] = 0;
+                    }
+                }
+                return true;
+            }
+            table->syndrome[syndrome] = (uint32_t)(i + 1) | ((uint32_t)(j + 1) << 16);
+        }
+    }
+    table->correctable_bits = 2;
+
+    return true;
+}
+
+/**
+ * @brief CRC16 lookup table package check, repairing the bit errors the syndrome table can locate
+ *
+ * @param table Syndrome table built for the model and length of the package
+ * @param input_data CRC16 packages to check, repaired in place
+ * @param length Length of the CRC16 packet
+ * @param correction_count Number of bits flipped back, may be NULL
+ * @return true CRC16 checks succeed, possibly after repair
+ * @return false CRC16 checks fails and the error can't be located
+ */
+bool crc16_package_correct(const crc16_correction_table_t *table, uint8_t *input_data, size_t length, uint8_t *correction_count) {
+    /* parameter checkout */
+    assert(table != NULL);
+    assert(input_data != NULL);
+    assert(length == table->length);
+
+    uint16_t crc16_actual_value = ((uint16_t)(*(input_data + length - 1) << 8) | (*(input_data + length - 2)));
+    uint16_t syndrome = crc16_lookup_table_calculate(table->model, input_data, length - 2) ^ crc16_actual_value;
+    uint32_t positions = table->syndrome[syndrome];
+    uint8_t count = 0;
+
+    if (syndrome != 0) {
+        if (positions == 0) {
+            if (correction_count != NULL) {
+                *correction_count = 0;
+            }
+            return false;
+        }
+        for (; positions != 0; positions >>= 16) {
+            uint16_t position = (uint16_t)(positions & 0xFFFF) - 1;
+            input_data[position >> 3] ^= (uint8_t)(1u << (position & 0x07));
+            count++;
+        }
+    }
+
+    if (correction_count != NULL) {
+        *correction_count = count;
+    }
+    return true;
+}
+
+/* one byte step of the CRC16 register with a model's byte table */
+static inline uint16_t crc16_window_step(const uint16_t *step, bool reflected, uint16_t crc, uint8_t data) {
+    return reflected ? (uint16_t)((crc >> 8) ^ step[(crc ^ data) & 0xFF])
+                     : (uint16_t)((crc << 8) ^ step[((crc >> 8) ^ data) & 0xFF]);
+}
+
+/**
+ * @brief Build the sliding window table for frames of one model and one length
+ *
+ * The register is linear in the data once the initial value is split off: the window
+ * register runs from 0, a byte leaving the window contributes what it would after the
+ * length - 2 payload bytes behind it, and the initial value is added back at the end.
+ *
+ * @param table Table to fill
+ * @param model CRC16 reference model
+ * @param length Length of the CRC16 packets to scan for, at least 3
+ */
+void crc16_window_table_init(crc16_window_table_t *table, CRC16_reference_model_e model, size_t length) {
+    /* parameter checkout */
+    assert(table != NULL);
+    assert(model < CRC16_NONE_MODEL);
+    assert(length > 2);
+
+    bool reflected = crc16_param[model].input_inversion;
+    size_t payload = length - 2;
+    uint16_t crc;
+
+    crc16_byte_table_generate(model, table->step);
+    table->model = model;
+    table->length = length;
+
+    /* a single bit byte followed by the payload's worth of zero bytes, the rest by linearity */
+    table->leave[0] = 0;
+    for (int bit = 0; bit < 8; bit++) {
+        crc = crc16_window_step(table->step, reflected, 0, (uint8_t)(1u << bit));
+        for (size_t i = 0; i < payload; i++) {
+            crc = crc16_window_step(table->step, reflected, crc, 0);
+        }
+        table->leave[1u << bit] = crc;
+    }
+    for (int i = 1; i < 256; i++) {
+        table->leave[i] = table->leave[i & (i - 1)] ^ table->leave[i & -i];
+    }
+
+    crc = crc16_param[model].initial_value;
+    for (size_t i = 0; i < payload; i++) {
+        crc = crc16_window_step(table->step, reflected, crc, 0);
+    }
+    table->initial = crc ^ crc16_param[model].result_xor_value;
+}
+
+/**
+ * @brief Window register of the payload of the frame starting at input_data
+ *
+ * @param table Sliding window table
+ * @param input_data At least table->length - 2 bytes
+ * @return uint16_t Window register, see crc16_window_result
+ */
+uint16_t crc16_window_start(const crc16_window_table_t *table, const uint8_t *input_data) {
+    /* parameter checkout */
+    assert(table != NULL);
+    assert(input_data != NULL);
+
+    bool reflected = crc16_param[table->model].input_inversion;
+    uint16_t crc = 0;
+
+    for (size_t i = 0; i < table->length - 2; i++) {
+        crc = crc16_window_step(table->step, reflected, crc, input_data[i]);
+    }
+    return crc;
+}
+
+/**
+ * @brief Slides the window one byte on
+ *
+ * @param table Sliding window table
+ * @param crc Window register
+ * @param leaving First payload byte of the window
+ * @param entering Byte following the payload
+ * @return uint16_t Window register of the payload one byte on
+ */
+uint16_t crc16_window_roll(const crc16_window_table_t *table, uint16_t crc, uint8_t leaving, uint8_t entering) {
+    return crc16_window_step(table->step, crc16_param[table->model].input_inversion, crc, entering) ^ table->leave[leaving];
+}
+
+/**
+ * @brief CRC16 of the payload in the window
+ *
+ * @param table Sliding window table
+ * @param crc Window register
+ * @return uint16_t The same as crc16_calculate over the window's payload
+ */
+uint16_t crc16_window_result(const crc16_window_table_t *table, uint16_t crc) {
+    return crc ^ table->initial;
+}
+
+/**
+ * @brief Finds the frames of table->length bytes with a valid trailing CRC16 at any offset of a
+ *        byte stream, as after line noise on a serial link: O(1) per offset instead of a
+ *        crc16_package_check at each one.
+ *
+ * @param table Sliding window table of the frame model and length
+ * @param input_data Byte stream
+ * @param length Stream length
+ * @param offsets Offsets of the frames found, in increasing order
+ * @param max_offsets Size of offsets, the scan stops once it is full
+ * @return size_t Number of offsets stored
+ */
+size_t crc16_frame_scan(const crc16_window_table_t *table, const uint8_t *input_data, size_t length, size_t *offsets, size_t max_offsets) {
+    /* parameter checkout */
+    assert(table != NULL);
+    assert(input_data != NULL || length == 0);
+    assert(offsets != NULL || max_offsets == 0);
+
+    CHECKSUM_STATS_BEGIN(stats_start);
+    const uint16_t *step = table->step;
+    const uint16_t *leave = table->leave;
+    const size_t payload = table->length - 2;
+    size_t found = 0;
+
+    if (length < table->length || max_offsets == 0) {
+        return 0;
+    }
+
+    uint16_t crc = crc16_window_start(table, input_data);
+    size_t last = length - table->length;
+    /* the model is fixed for the whole scan, so is the direction of the register */
+    if (crc16_param[table->model].input_inversion) {
+        for (size_t i = 0;; i++) {
+            const uint8_t *p = input_data + i + payload;
+            if ((uint16_t)(crc ^ table->initial) == (uint16_t)(p[0] | (p[1] << 8))) {
+                offsets[found++] = i;
+                if (found == max_offsets) {
+                    break;
+                }
+            }
+            if (i == last) {
+                break;
+            }
+            crc = (uint16_t)((crc >> 8) ^ step[(crc ^ p[0]) & 0xFF] ^ leave[input_data[i]]);
+        }
+    } else {
+        for (size_t i = 0;; i++) {
+            const uint8_t *p = input_data + i + payload;
+            if ((uint16_t)(crc ^ table->initial) == (uint16_t)(p[0] | (p[1] << 8))) {
+                offsets[found++] = i;
+                if (found == max_offsets) {
+                    break;
+                }
+            }
+            if (i == last) {
+                break;
+            }
+            crc = (uint16_t)((crc << 8) ^ step[((crc >> 8) ^ p[0]) & 0xFF] ^ leave[input_data[i]]);
+        }
+    }
+
+    CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC16, table->model, CHECKSUM_STATS_TABLE, length, stats_start);
+    return found;
+}
+
+#ifndef CHECKSUM_NO_MAIN
+#define TEST
+#endif
+#ifdef TEST
+#include <stdio.h>
+#include <stdlib.h>
+#ifndef CRC16_USE_NIBBLE_TABLE
+#include "../crc_fixed/crc_fixed.h"
+
+/* fixed length functions of every model at the shortest, a Modbus sized and the longest payload */
+#define CRC16_FIXED_TEST_DEFINE(prefix, model) \
+    CRC16_FIXED_DEFINE(prefix##_1, model, 1) \
+    CRC16_FIXED_DEFINE(prefix##_6, model, 6) \
+    CRC16_FIXED_DEFINE(prefix##_32, model, 32)
+CRC16_FIXED_TEST_DEFINE(fixed_ibm, CRC16_IBM)
+CRC16_FIXED_TEST_DEFINE(fixed_maxim, CRC16_MAXIM)
+CRC16_FIXED_TEST_DEFINE(fixed_usb, CRC16_USB)
+CRC16_FIXED_TEST_DEFINE(fixed_modbus, CRC16_MODBUS)
+CRC16_FIXED_TEST_DEFINE(fixed_ccitt, CRC16_CCITT)
+CRC16_FIXED_TEST_DEFINE(fixed_ccitt_false, CRC16_CCITT_FALSE)
+CRC16_FIXED_TEST_DEFINE(fixed_x25, CRC16_X25)
+CRC16_FIXED_TEST_DEFINE(fixed_xmodem, CRC16_XMODEM)
+CRC16_FIXED_TEST_DEFINE(fixed_dnp, CRC16_DNP)
+
+/* the three lengths of one model against crc16_calculate, then package, check and a flipped bit */
+#define CRC16_FIXED_TEST(prefix, model) \
+    do { \
+        uint8_t frame[34] = {0}; \
+        bool succeed = true; \
+        for (size_t i = 0; i < sizeof(frame); i++) { \
+            frame[i] = (uint8_t)(i * 37 + 11); \
+        } \
+        succeed &= prefix##_1_calculate(frame) == crc16_calculate(model, frame, 1); \
+        succeed &= prefix##_6_calculate(frame) == crc16_calculate(model, frame, 6); \
+        succeed &= prefix##_32_calculate(frame) == crc16_calculate(model, frame, 32); \
+        prefix##_32_package(frame); \
+        succeed &= prefix##_32_check(frame) && crc16_lookup_table_package_check(model, frame, 34); \
+        frame[5] ^= 0x10; \
+        succeed &= !prefix##_32_check(frame); \
+        printf("%s fixed length check %s\n", #model, succeed ? "succeed." : "fail."); \
+    } while (0)
+
+#endif
+
+/* packages of the batch check, an odd count leaving a partial group */
+#define BATCH_TEST_COUNT 203
+#define BATCH_TEST_MAX 300
+
+static void print_crc16_table(CRC16_reference_model_e model);
+
+int main() {
+    uint8_t input_data[12] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x08};
+#if 0
+    uint16_t crc16_ibm_model = crc16_calculate(CRC16_IBM_MODEL, input_data, 10);
+    uint16_t crc16_maxim_model = crc16_calculate(CRC16_MAXIM_MODEL, input_data, 10);
+    uint16_t crc16_usb_model = crc16_calculate(CRC16_USB_MODEL, input_data, 10);
+    uint16_t crc16_modbus_model = crc16_calculate(CRC16_MODBUS_MODEL, input_data, 10);
+    uint16_t crc16_ccitt_model = crc16_calculate(CRC16_CCITT_MODEL, input_data, 10);
+    uint16_t crc16_ccitt_false_model = crc16_calculate(CRC16_CCITT_FALSE_MODEL, input_data, 10);
+    uint16_t crc16_x25_model = crc16_calculate(CRC16_X25_MODEL, input_data, 10);
+    uint16_t crc16_xmodem_model = crc16_calculate(CRC16_XMODEM_MODEL, input_data, 10);
+    uint16_t crc16_dnp_model = crc16_calculate(CRC16_DNP_MODEL, input_data, 10);
+
+    uint16_t mirror_crc16_ibm_model = crc16_calculate_mirror_mode(CRC16_IBM_MODEL, input_data, 10);
+    uint16_t mirror_crc16_maxim_model = crc16_calculate_mirror_mode(CRC16_MAXIM_MODEL, input_data, 10);
+    uint16_t mirror_crc16_usb_model = crc16_calculate_mirror_mode(CRC16_USB_MODEL, input_data, 10);
+    uint16_t mirror_crc16_modbus_model = crc16_calculate_mirror_mode(CRC16_MODBUS_MODEL, input_data, 10);
+    uint16_t mirror_crc16_ccitt_model = crc16_calculate_mirror_mode(CRC16_CCITT_MODEL, input_data, 10);
+    uint16_t mirror_crc16_ccitt_false_model = crc16_calculate_mirror_mode(CRC16_CCITT_FALSE_MODEL, input_data, 10);
+    uint16_t mirror_crc16_x25_model = crc16_calculate_mirror_mode(CRC16_X25_MODEL, input_data, 10);
+    uint16_t mirror_crc16_xmodem_model = crc16_calculate_mirror_mode(CRC16_XMODEM_MODEL, input_data, 10);
+    uint16_t mirror_crc16_dnp_model = crc16_calculate_mirror_mode(CRC16_DNP_MODEL, input_data, 10);
+
+    printf("---------------------------crc16_calculate result-----------------------\n");
+    printf("crc16_ibm_model result = 0x%04x\n", crc16_ibm_model);
+    printf("crc16_maxim_model result = 0x%04x\n", crc16_maxim_model);
+    printf("crc16_usb_model result = 0x%04x\n", crc16_usb_model);
+    printf("crc16_modbus_model result = 0x%04x\n", crc16_modbus_model);
+    printf("crc16_ccitt_model result = 0x%04x\n", crc16_ccitt_model);
+    printf("crc16_ccitt_false_model result = 0x%04x\n", crc16_ccitt_false_model);
+    printf("crc16_x25_model result = 0x%04x\n", crc16_x25_model);
+    printf("crc16_xmodem_model result = 0x%04x\n", crc16_xmodem_model);
+    printf("crc16_dnp_model result = 0x%04x\n", crc16_dnp_model);
+
+
+    printf("---------------------crc16_calculate_mirror_mode result------------------\n");
+    printf("mirror_crc16_ibm_model result = 0x%04x\n", mirror_crc16_ibm_model);
+    printf("mirror_crc16_maxim_model result = 0x%04x\n", mirror_crc16_maxim_model);
+    printf("mirror_crc16_usb_model result = 0x%04x\n", mirror_crc16_usb_model);
+    printf("mirror_crc16_modbus_model result = 0x%04x\n", mirror_crc16_modbus_model);
+    printf("mirror_crc16_ccitt_model result = 0x%04x\n", mirror_crc16_ccitt_model);
+    printf("mirror_crc16_ccitt_false_model result = 0x%04x\n", mirror_crc16_ccitt_false_model);
+    printf("mirror_crc16_x25_model result = 0x%04x\n", mirror_crc16_x25_model);
+    printf("mirror_crc16_xmodem_model result = 0x%04x\n", mirror_crc16_xmodem_model);
+    printf("mirror_crc16_dnp_model result = 0x%04x\n", mirror_crc16_dnp_model);
+#endif
+
+#if 0
+    print_crc16_table(CRC16_IBM_MODEL);
+    print_crc16_table(CRC16_MAXIM_MODEL);
+    print_crc16_table(CRC16_USB_MODEL);
+    print_crc16_table(CRC16_MODBUS_MODEL);
+    print_crc16_table(CRC16_CCITT_MODEL);
+    print_crc16_table(CRC16_CCITT_FALSE_MODEL);
+    print_crc16_table(CRC16_X25_MODEL);
+    print_crc16_table(CRC16_XMODEM_MODEL);
+    print_crc16_table(CRC16_DNP_MODEL);
+#endif
+#if 0
+    uint16_t crc16_result = 0;
+    bool crc16_check_result = false;
+    printf("data:[");
+    for (int i; i < sizeof(input_data)/sizeof(input_data[0]); i++) {
+        printf("0x%02x, ", input_data[i]);
+    }
+    printf("]\n");
+
+    crc16_calculate_package(CRC16_IBM_MODEL, input_data, 12);
+    crc16_result = input_data[11] << 8 | input_data[10];
+    printf("crc16_calculate_package CRC16_IBM_MODEL result = 0x%04x\n", crc16_result);
+    crc16_check_result = crc16_package_check(CRC16_IBM_MODEL, input_data, 12);
+    if (crc16_check_result) {
+        printf("crc16_calculate_package CRC16_IBM_MODEL check succeed.\n");
+    } else {
+        printf("crc16_calculate_package CRC16_IBM_MODEL check fail.\n");
+    }
+
+    crc16_calculate_package(CRC16_MAXIM_MODEL, input_data, 12);
+    crc16_result = input_data[11] << 8 | input_data[10];
+    printf("crc16_calculate_package CRC16_MAXIM_MODEL result = 0x%04x\n", crc16_result);
+    crc16_check_result = crc16_package_check(CRC16_MAXIM_MODEL, input_data, 12);
+    if (crc16_check_result) {
+        printf("crc16_calculate_package CRC16_MAXIM_MODEL check succeed.\n");
+    } else {
+        printf("crc16_calculate_package CRC16_MAXIM_MODEL check fail.\n");
+    }
+
+    crc16_calculate_package(CRC16_USB_MODEL, input_data, 12);
+    crc16_result = input_data[11] << 8 | input_data[10];
+    printf("crc16_calculate_package CRC16_USB_MODEL result = 0x%04x\n", crc16_result);
+    crc16_check_result = crc16_package_check(CRC16_USB_MODEL, input_data, 12);
+    if (crc16_check_result) {
+        printf("crc16_calculate_package CRC16_USB_MODEL check succeed.\n");
+    } else {
+        printf("crc16_calculate_package CRC16_USB_MODEL check fail.\n");
+    }
+
+    crc16_calculate_package(CRC16_MODBUS_MODEL, input_data, 12);
+    crc16_result = input_data[11] << 8 | input_data[10];
+    printf("crc16_calculate_package CRC16_MODBUS_MODEL result = 0x%04x\n", crc16_result);
+    crc16_check_result = crc16_package_check(CRC16_MODBUS_MODEL, input_data, 12);
+    if (crc16_check_result) {
+        printf("crc16_calculate_package CRC16_MODBUS_MODEL check succeed.\n");
+    } else {
+        printf("crc16_calculate_package CRC16_MODBUS_MODEL check fail.\n");
+    }
+
+    crc16_calculate_package(CRC16_CCITT_MODEL, input_data, 12);
+    crc16_result = input_data[11] << 8 | input_data[10];
+    printf("crc16_calculate_package CRC16_CCITT_MODEL result = 0x%04x\n", crc16_result);
+    crc16_check_result = crc16_package_check(CRC16_CCITT_MODEL, input_data, 12);
+    if (crc16_check_result) {
+        printf("crc16_calculate_package CRC16_CCITT_MODEL check succeed.\n");
+    } else {
+        printf("crc16_calculate_package CRC16_CCITT_MODEL check fail.\n");
+    }
+
+    crc16_calculate_package(CRC16_CCITT_FALSE_MODEL, input_data, 12);
+    crc16_result = input_data[11] << 8 | input_data[10];
+    printf("crc16_calculate_package CRC16_CCITT_FALSE_MODEL result = 0x%04x\n", crc16_result);
+    crc16_check_result = crc16_package_check(CRC16_CCITT_FALSE_MODEL, input_data, 12);
+    if (crc16_check_result) {
+        printf("crc16_calculate_package CRC16_CCITT_FALSE_MODEL check succeed.\n");
+    } else {
+        printf("crc16_calculate_package CRC16_CCITT_FALSE_MODEL check fail.\n");
+    }
+
+    crc16_calculate_package(CRC16_X25_MODEL, input_data, 12);
+    crc16_result = input_data[11] << 8 | input_data[10];
+    printf("crc16_calculate_package CRC16_X25_MODEL result = 0x%04x\n", crc16_result);
+    crc16_check_result = crc16_package_check(CRC16_X25_MODEL, input_data, 12);
+    if (crc16_check_result) {
+        printf("crc16_calculate_package CRC16_X25_MODEL check succeed.\n");
+    } else {
+        printf("crc16_calculate_package CRC16_X25_MODEL check fail.\n");
+    }
+
+    crc16_calculate_package(CRC16_XMODEM_MODEL, input_data, 12);
+    crc16_result = input_data[11] << 8 | input_data[10];
+    printf("crc16_calculate_package CRC16_XMODEM_MODEL result = 0x%04x\n", crc16_result);
+    crc16_check_result = crc16_package_check(CRC16_XMODEM_MODEL, input_data, 12);
+    if (crc16_check_result) {
+        printf("crc16_calculate_package CRC16_XMODEM_MODEL check succeed.\n");
+    } else {
+        printf("crc16_calculate_package CRC16_XMODEM_MODEL check fail.\n");
+    }
+
+    crc16_calculate_package(CRC16_DNP_MODEL, input_data, 12);
+    crc16_result = input_data[11] << 8 | input_data[10];
+    printf("crc16_calculate_package CRC16_DNP_MODEL result = 0x%04x\n", crc16_result);
+    crc16_check_result = crc16_package_check(CRC16_DNP_MODEL, input_data, 12);
+    if (crc16_check_result) {
+        printf("crc16_calculate_package CRC16_DNP_MODEL check succeed.\n");
+    } else {
+        printf("crc16_calculate_package CRC16_DNP_MODEL check fail.\n");
+    }
+#endif
+
+#if 1
+    uint16_t crc16_result = 0;
+    bool crc16_check_result = false;
+
+    crc16_lookup_table_package(CRC16_IBM_MODEL, input_data, 12);
+    crc16_result = input_data[11] << 8 | input_data[10];
+    printf("crc16_lookup_table_package CRC16_IBM_MODEL result = 0x%04x\n", crc16_result);
+    crc16_check_result = crc16_lookup_table_package_check(CRC16_IBM_MODEL, input_data, 12);
+    if (crc16_check_result) {
+        printf("crc16_calculate_package CRC16_IBM_MODEL check succeed.\n");
+    } else {
+        printf("crc16_calculate_package CRC16_IBM_MODEL check fail.\n");
+    }
+
+    crc16_lookup_table_package(CRC16_MAXIM_MODEL, input_data, 12);
+    crc16_result = input_data[11] << 8 | input_data[10];
+    printf("crc16_lookup_table_package CRC16_MAXIM_MODEL result = 0x%04x\n", crc16_result);
+    crc16_check_result = crc16_lookup_table_package_check(CRC16_MAXIM_MODEL, input_data, 12);
+    if (crc16_check_result) {
+        printf("crc16_calculate_package CRC16_MAXIM_MODEL check succeed.\n");
+    } else {
+        printf("crc16_calculate_package CRC16_MAXIM_MODEL check fail.\n");
+    }
+
+    crc16_lookup_table_package(CRC16_USB_MODEL, input_data, 12);
+    crc16_result = input_data[11] << 8 | input_data[10];
+    printf("crc16_lookup_table_package CRC16_USB_MODEL result = 0x%04x\n", crc16_result);
+    crc16_check_result = crc16_lookup_table_package_check(CRC16_USB_MODEL, input_data, 12);
+    if (crc16_check_result) {
+        printf("crc16_calculate_package CRC16_USB_MODEL check succeed.\n");
+    } else {
+        printf("crc16_calculate_package CRC16_USB_MODEL check fail.\n");
+    }
+
+    crc16_lookup_table_package(CRC16_MODBUS_MODEL, input_data, 12);
+    crc16_result = input_data[11] << 8 | input_data[10];
+    printf("crc16_lookup_table_package CRC16_MODBUS_MODEL result = 0x%04x\n", crc16_result);
+    crc16_check_result = crc16_lookup_table_package_check(CRC16_MODBUS_MODEL, input_data, 12);
+    if (crc16_check_result) {
+        printf("crc16_calculate_package CRC16_MODBUS_MODEL check succeed.\n");
+    } else {
+        printf("crc16_calculate_package CRC16_MODBUS_MODEL check fail.\n");
+    }
+
+    crc16_lookup_table_package(CRC16_CCITT_MODEL, input_data, 12);
+    crc16_result = input_data[11] << 8 | input_data[10];
+    printf("crc16_lookup_table_package CRC16_CCITT_MODEL result = 0x%04x\n", crc16_result);
+    crc16_check_result = crc16_lookup_table_package_check(CRC16_CCITT_MODEL, input_data, 12);
+    if (crc16_check_result) {
+        printf("crc16_calculate_package CRC16_CCITT_MODEL check succeed.\n");
+    } else {
+        printf("crc16_calculate_package CRC16_CCITT_MODEL check fail.\n");
+    }
+
+    crc16_lookup_table_package(CRC16_CCITT_FALSE_MODEL, input_data, 12);
+    crc16_result = input_data[11] << 8 | input_data[10];
+    printf("crc16_lookup_table_package CRC16_CCITT_FALSE_MODEL result = 0x%04x\n", crc16_result);
+    crc16_check_result = crc16_lookup_table_package_check(CRC16_CCITT_FALSE_MODEL, input_data, 12);
+    if (crc16_check_result) {
+        printf("crc16_calculate_package CRC16_CCITT_FALSE_MODEL check succeed.\n");
+    } else {
+        printf("crc16_calculate_package CRC16_CCITT_FALSE_MODEL check fail.\n");
+    }
+
+    crc16_lookup_table_package(CRC16_X25_MODEL, input_data, 12);
+    crc16_result = input_data[11] << 8 | input_data[10];
+    printf("crc16_lookup_table_package CRC16_X25_MODEL result = 0x%04x\n", crc16_result);
+    crc16_check_result = crc16_lookup_table_package_check(CRC16_X25_MODEL, input_data, 12);
+    if (crc16_check_result) {
+        printf("crc16_calculate_package CRC16_X25_MODEL check succeed.\n");
+    } else {
+        printf("crc16_calculate_package CRC16_X25_MODEL check fail.\n");
+    }
+
+    crc16_lookup_table_package(CRC16_XMODEM_MODEL, input_data, 12);
+    crc16_result = input_data[11] << 8 | input_data[10];
+    printf("crc16_lookup_table_package CRC16_XMODEM_MODEL result = 0x%04x\n", crc16_result);
+    crc16_check_result = crc16_lookup_table_package_check(CRC16_XMODEM_MODEL, input_data, 12);
+    if (crc16_check_result) {
+        printf("crc16_calculate_package CRC16_XMODEM_MODEL check succeed.\n");
+    } else {
+        printf("crc16_calculate_package CRC16_XMODEM_MODEL check fail.\n");
+    }
+
+    crc16_lookup_table_package(CRC16_DNP_MODEL, input_data, 12);
+    crc16_result = input_data[11] << 8 | input_data[10];
+    printf("crc16_lookup_table_package CRC16_DNP_MODEL result = 0x%04x\n", crc16_result);
+    crc16_check_result = crc16_lookup_table_package_check(CRC16_DNP_MODEL, input_data, 12);
+    if (crc16_check_result) {
+        printf("crc16_calculate_package CRC16_DNP_MODEL check succeed.\n");
+    } else {
+        printf("crc16_calculate_package CRC16_DNP_MODEL check fail.\n");
+    }
+#endif
+#if 1
+    static crc16_correction_table_t correction_table;
+    uint8_t correction_count = 0;
+
+    printf("---------CRC16 error correction-----------\n");
+    crc16_lookup_table_package(CRC16_MODBUS_MODEL, input_data, 12);
+    if (crc16_correction_table_init(&correction_table, CRC16_MODBUS_MODEL, 12)) {
+        printf("CRC16_MODBUS_MODEL corrects up to %d bit errors in 12 byte frames.\n", correction_table.correctable_bits);
+        input_data[3] ^= 0x10;
+        crc16_check_result = crc16_package_correct(&correction_table, input_data, 12, &correction_count);
+        if (crc16_check_result && crc16_lookup_table_package_check(CRC16_MODBUS_MODEL, input_data, 12)) {
+            printf("CRC16_MODBUS_MODEL correct succeed, %d bit repaired.\n", correction_count);
+        } else {
+            printf("CRC16_MODBUS_MODEL correct fail.\n");
+        }
+    }
+
+    crc16_lookup_table_package(CRC16_DNP_MODEL, input_data, 12);
+    if (crc16_correction_table_init(&correction_table, CRC16_DNP_MODEL, 12)) {
+        printf("CRC16_DNP_MODEL corrects up to %d bit errors in 12 byte frames.\n", correction_table.correctable_bits);
+        input_data[0] ^= 0x01;
+        input_data[11] ^= 0x80;
+        crc16_check_result = crc16_package_correct(&correction_table, input_data, 12, &correction_count);
+        if (crc16_check_result && crc16_lookup_table_package_check(CRC16_DNP_MODEL, input_data, 12)) {
+            printf("CRC16_DNP_MODEL correct succeed, %d bit repaired.\n", correction_count);
+        } else {
+            printf("CRC16_DNP_MODEL correct fail.\n");
+        }
+    }
+#endif
+#if 1
+    printf("---------CRC16 nibble table-----------\n");
+    uint8_t nibble_data[64];
+    memset(nibble_data, 0x5A, sizeof(nibble_data));
+    crc16_lookup_table_package(CRC16_IBM_MODEL, nibble_data, sizeof(nibble_data));
+    if (crc16_kernel_calculate(CRC16_IBM_MODEL, CRC16_KERNEL_NIBBLE, nibble_data, sizeof(nibble_data) - 2) == crc16_calculate(CRC16_IBM_MODEL, nibble_data, sizeof(nibble_data) - 2) &&
+        crc16_lookup_table_package_check(CRC16_IBM_MODEL, nibble_data, sizeof(nibble_data))) {
+        printf("CRC16_IBM_MODEL nibble table check succeed.\n");
+    } else {
+        printf("CRC16_IBM_MODEL nibble table check fail.\n");
+    }
+    memset(nibble_data, 0x5A, sizeof(nibble_data));
+    crc16_lookup_table_package(CRC16_MAXIM_MODEL, nibble_data, sizeof(nibble_data));
+    if (crc16_kernel_calculate(CRC16_MAXIM_MODEL, CRC16_KERNEL_NIBBLE, nibble_data, sizeof(nibble_data) - 2) == crc16_calculate(CRC16_MAXIM_MODEL, nibble_data, sizeof(nibble_data) - 2) &&
+        crc16_lookup_table_package_check(CRC16_MAXIM_MODEL, nibble_data, sizeof(nibble_data))) {
+        printf("CRC16_MAXIM_MODEL nibble table check succeed.\n");
+    } else {
+        printf("CRC16_MAXIM_MODEL nibble table check fail.\n");
+    }
+    memset(nibble_data, 0x5A, sizeof(nibble_data));
+    crc16_lookup_table_package(CRC16_USB_MODEL, nibble_data, sizeof(nibble_data));
+    if (crc16_kernel_calculate(CRC16_USB_MODEL, CRC16_KERNEL_NIBBLE, nibble_data, sizeof(nibble_data) - 2) == crc16_calculate(CRC16_USB_MODEL, nibble_data, sizeof(nibble_data) - 2) &&
+        crc16_lookup_table_package_check(CRC16_USB_MODEL, nibble_data, sizeof(nibble_data))) {
+        printf("CRC16_USB_MODEL nibble table check succeed.\n");
+    } else {
+        printf("CRC16_USB_MODEL nibble table check fail.\n");
+    }
+    memset(nibble_data, 0x5A, sizeof(nibble_data));
+    crc16_lookup_table_package(CRC16_MODBUS_MODEL, nibble_data, sizeof(nibble_data));
+    if (crc16_kernel_calculate(CRC16_MODBUS_MODEL, CRC16_KERNEL_NIBBLE, nibble_data, sizeof(nibble_data) - 2) == crc16_calculate(CRC16_MODBUS_MODEL, nibble_data, sizeof(nibble_data) - 2) &&
+        crc16_lookup_table_package_check(CRC16_MODBUS_MODEL, nibble_data, sizeof(nibble_data))) {
+        printf("CRC16_MODBUS_MODEL nibble table check succeed.\n");
+    } else {
+        printf("CRC16_MODBUS_MODEL nibble table check fail.\n");
+    }
+    memset(nibble_data, 0x5A, sizeof(nibble_data));
+    crc16_lookup_table_package(CRC16_CCITT_MODEL, nibble_data, sizeof(nibble_data));
+    if (crc16_kernel_calculate(CRC16_CCITT_MODEL, CRC16_KERNEL_NIBBLE, nibble_data, sizeof(nibble_data) - 2) == crc16_calculate(CRC16_CCITT_MODEL, nibble_data, sizeof(nibble_data) - 2) &&
+        crc16_lookup_table_package_check(CRC16_CCITT_MODEL, nibble_data, sizeof(nibble_data))) {
+        printf("CRC16_CCITT_MODEL nibble table check succeed.\n");
+    } else {
+        printf("CRC16_CCITT_MODEL nibble table check fail.\n");
+    }
+    memset(nibble_data, 0x5A, sizeof(nibble_data));
+    crc16_lookup_table_package(CRC16_CCITT_FALSE_MODEL, nibble_data, sizeof(nibble_data));
+    if (crc16_kernel_calculate(CRC16_CCITT_FALSE_MODEL, CRC16_KERNEL_NIBBLE, nibble_data, sizeof(nibble_data) - 2) == crc16_calculate(CRC16_CCITT_FALSE_MODEL, nibble_data, sizeof(nibble_data) - 2) &&
+        crc16_lookup_table_package_check(CRC16_CCITT_FALSE_MODEL, nibble_data, sizeof(nibble_data))) {
+        printf("CRC16_CCITT_FALSE_MODEL nibble table check succeed.\n");
+    } else {
+        printf("CRC16_CCITT_FALSE_MODEL nibble table check fail.\n");
+    }
+    memset(nibble_data, 0x5A, sizeof(nibble_data));
+    crc16_lookup_table_package(CRC16_X25_MODEL, nibble_data, sizeof(nibble_data));
+    if (crc16_kernel_calculate(CRC16_X25_MODEL, CRC16_KERNEL_NIBBLE, nibble_data, sizeof(nibble_data) - 2) == crc16_calculate(CRC16_X25_MODEL, nibble_data, sizeof(nibble_data) - 2) &&
+        crc16_lookup_table_package_check(CRC16_X25_MODEL, nibble_data, sizeof(nibble_data))) {
+        printf("CRC16_X25_MODEL nibble table check succeed.\n");
+    } else {
+        printf("CRC16_X25_MODEL nibble table check fail.\n");
+    }
+    memset(nibble_data, 0x5A, sizeof(nibble_data));
+    crc16_lookup_table_package(CRC16_XMODEM_MODEL, nibble_data, sizeof(nibble_data));
+    if (crc16_kernel_calculate(CRC16_XMODEM_MODEL, CRC16_KERNEL_NIBBLE, nibble_data, sizeof(nibble_data) - 2) == crc16_calculate(CRC16_XMODEM_MODEL, nibble_data, sizeof(nibble_data) - 2) &&
+        crc16_lookup_table_package_check(CRC16_XMODEM_MODEL, nibble_data, sizeof(nibble_data))) {
+        printf("CRC16_XMODEM_MODEL nibble table check succeed.\n");
+    } else {
+        printf("CRC16_XMODEM_MODEL nibble table check fail.\n");
+    }
+    memset(nibble_data, 0x5A, sizeof(nibble_data));
+    crc16_lookup_table_package(CRC16_DNP_MODEL, nibble_data, sizeof(nibble_data));
+    if (crc16_kernel_calculate(CRC16_DNP_MODEL, CRC16_KERNEL_NIBBLE, nibble_data, sizeof(nibble_data) - 2) == crc16_calculate(CRC16_DNP_MODEL, nibble_data, sizeof(nibble_data) - 2) &&
+        crc16_lookup_table_package_check(CRC16_DNP_MODEL, nibble_data, sizeof(nibble_data))) {
+        printf("CRC16_DNP_MODEL nibble table check succeed.\n");
+    } else {
+        printf("CRC16_DNP_MODEL nibble table check fail.\n");
+    }
+#endif
+
+#if 1
+    /* slicing against the bit by bit reference: every model, lengths around the 4 and 8 byte
+       steps, unaligned starts, and streaming updates split inside a step */
+    printf("---------CRC16 slicing-----------\n");
+    {
+        static const char *slicing_name[CRC16_NONE_MODEL] = {
+            "CRC16_IBM_MODEL", "CRC16_MAXIM_MODEL", "CRC16_USB_MODEL", "CRC16_MODBUS_MODEL", "CRC16_CCITT_MODEL",
+            "CRC16_CCITT_FALSE_MODEL", "CRC16_X25_MODEL", "CRC16_XMODEM_MODEL", "CRC16_DNP_MODEL"};
+        uint8_t slicing_data[80];
+        for (size_t i = 0; i < sizeof(slicing_data); i++) {
+            slicing_data[i] = (uint8_t)(i * 29 + 3);
+        }
+        for (int m = 0; m < CRC16_NONE_MODEL; m++) {
+            bool succeed = true;
+            for (size_t offset = 0; offset < 8; offset++) {
+                for (size_t length = 1; length + offset <= sizeof(slicing_data); length++) {
+                    uint16_t reference = crc16_kernel_calculate((CRC16_reference_model_e)m, CRC16_KERNEL_BITWISE, slicing_data + offset, length);
+                    succeed &= crc16_kernel_calculate((CRC16_reference_model_e)m, CRC16_KERNEL_SLICE4, slicing_data + offset, length) == reference;
+                    succeed &= crc16_kernel_calculate((CRC16_reference_model_e)m, CRC16_KERNEL_SLICE8, slicing_data + offset, length) == reference;
+                    succeed &= crc16_lookup_table_calculate((CRC16_reference_model_e)m, slicing_data + offset, length) == reference;
+                }
+            }
+            crc16_ctx ctx;
+            crc16_init(&ctx, (CRC16_reference_model_e)m);
+            crc16_update(&ctx, slicing_data, 3);
+            crc16_update(&ctx, slicing_data + 3, 61);
+            crc16_update(&ctx, slicing_data + 64, 16);
+            succeed &= crc16_final(&ctx) == crc16_calculate((CRC16_reference_model_e)m, slicing_data, sizeof(slicing_data));
+            printf("%s slicing-by-4/8 check %s\n", slicing_name[m], succeed ? "succeed." : "fail.");
+        }
+    }
+#endif
+
+#if 1
+    /* the scanner against crc16_lookup_table_package_check at every offset of a noisy stream with planted frames */
+    printf("---------CRC16 frame scan-----------\n");
+    {
+        static const char *scan_name[CRC16_NONE_MODEL] = {
+            "CRC16_IBM_MODEL", "CRC16_MAXIM_MODEL", "CRC16_USB_MODEL", "CRC16_MODBUS_MODEL", "CRC16_CCITT_MODEL",
+            "CRC16_CCITT_FALSE_MODEL", "CRC16_X25_MODEL", "CRC16_XMODEM_MODEL", "CRC16_DNP_MODEL"};
+        static const size_t scan_length[] = {3, 12, 64};
+        static crc16_window_table_t window_table;
+        static uint8_t stream[2048];
+        static size_t offsets[2048];
+        for (int m = 0; m < CRC16_NONE_MODEL; m++) {
+            bool succeed = true;
+            for (size_t l = 0; l < sizeof(scan_length) / sizeof(scan_length[0]); l++) {
+                size_t frame_length = scan_length[l], expected = 0, found;
+                srand((unsigned int)(m * 16 + l));
+                for (size_t i = 0; i < sizeof(stream); i++) {
+                    stream[i] = (uint8_t)rand();
+                }
+                for (size_t at = 5; at + frame_length <= sizeof(stream); at += frame_length + (size_t)rand() % 97) {
+                    crc16_lookup_table_package((CRC16_reference_model_e)m, stream + at, frame_length);
+                }
+                crc16_window_table_init(&window_table, (CRC16_reference_model_e)m, frame_length);
+                found = crc16_frame_scan(&window_table, stream, sizeof(stream), offsets, sizeof(offsets) / sizeof(offsets[0]));
+                uint16_t crc = crc16_window_start(&window_table, stream);
+                for (size_t i = 0; i + frame_length <= sizeof(stream); i++) {
+                    if (i > 0) {
+                        crc = crc16_window_roll(&window_table, crc, stream[i - 1], stream[i + frame_length - 3]);
+                    }
+                    succeed &= crc16_window_result(&window_table, crc) ==
+                               crc16_calculate((CRC16_reference_model_e)m, stream + i, frame_length - 2);
+                    if (crc16_lookup_table_package_check((CRC16_reference_model_e)m, stream + i, frame_length)) {
+                        succeed &= expected < found && offsets[expected] == i;
+                        expected++;
+                    }
+                }
+                succeed &= found == expected && expected > 0;
+                /* a full offsets array stops the scan */
+                succeed &= crc16_frame_scan(&window_table, stream, sizeof(stream), offsets, 1) == 1;
+            }
+            printf("%s frame scan check %s\n", scan_name[m], succeed ? "succeed." : "fail.");
+        }
+    }
+#endif
+
+#if 1
+    printf("---------CRC16 package check batch-----------\n");
+    static uint8_t batch_data[BATCH_TEST_COUNT][BATCH_TEST_MAX];
+    static uint8_t *batch_packages[BATCH_TEST_COUNT];
+    static size_t batch_lengths[BATCH_TEST_COUNT];
+    uint64_t batch_valid[(BATCH_TEST_COUNT + 63) / 64];
+    const char *batch_model_name[CRC16_NONE_MODEL] = {
+        "CRC16_IBM_MODEL", "CRC16_MAXIM_MODEL", "CRC16_USB_MODEL", "CRC16_MODBUS_MODEL", "CRC16_CCITT_MODEL",
+        "CRC16_CCITT_FALSE_MODEL", "CRC16_X25_MODEL", "CRC16_XMODEM_MODEL", "CRC16_DNP_MODEL",
+    };
+
+    for (CRC16_reference_model_e model = CRC16_IBM_MODEL; model < CRC16_NONE_MODEL; model++) {
+        bool batch_succeed = true;
+        uint32_t seed = 12345;
+
+        /* ragged lengths and every seventh package damaged */
+        for (size_t i = 0; i < BATCH_TEST_COUNT; i++) {
+            seed = seed * 1103515245u + 12345u;
+            batch_lengths[i] = 3 + (seed >> 8) % (BATCH_TEST_MAX - 3);
+            batch_packages[i] = batch_data[i];
+            for (size_t j = 0; j < batch_lengths[i]; j++) {
+                batch_data[i][j] = (uint8_t)(seed >> (j % 24));
+            }
+            crc16_lookup_table_package(model, batch_data[i], batch_lengths[i]);
+            if (i % 7 == 3) {
+                batch_data[i][(seed >> 4) % batch_lengths[i]] ^= 0x10;
+            }
+        }
+        crc16_package_check_batch(model, batch_packages, batch_lengths, BATCH_TEST_COUNT, batch_valid);
+        for (size_t i = 0; i < BATCH_TEST_COUNT; i++) {
+            bool expected = crc16_lookup_table_package_check(model, batch_packages[i], batch_lengths[i]);
+            if (expected != (i % 7 != 3) || expected != ((batch_valid[i / 64] >> (i % 64)) & 1)) {
+                batch_succeed = false;
+            }
+        }
+        printf("%s package check batch %s.\n", batch_model_name[model], batch_succeed ? "succeed" : "fail");
+    }
+#endif
+
+#if 1
+#ifndef CRC16_USE_NIBBLE_TABLE
+    printf("---------CRC16 fixed length-----------\n");
+    CRC16_FIXED_TEST(fixed_ibm, CRC16_IBM_MODEL);
+    CRC16_FIXED_TEST(fixed_maxim, CRC16_MAXIM_MODEL);
+    CRC16_FIXED_TEST(fixed_usb, CRC16_USB_MODEL);
+    CRC16_FIXED_TEST(fixed_modbus, CRC16_MODBUS_MODEL);
+    CRC16_FIXED_TEST(fixed_ccitt, CRC16_CCITT_MODEL);
+    CRC16_FIXED_TEST(fixed_ccitt_false, CRC16_CCITT_FALSE_MODEL);
+    CRC16_FIXED_TEST(fixed_x25, CRC16_X25_MODEL);
+    CRC16_FIXED_TEST(fixed_xmodem, CRC16_XMODEM_MODEL);
+    CRC16_FIXED_TEST(fixed_dnp, CRC16_DNP_MODEL);
+#endif
+#endif
+
+#if 1
+    printf("---------CRC16 copy-----------\n");
+    /* two pieces per copy, into a misaligned destination; the longest one past the non-temporal threshold */
+    static uint8_t copy_source[2 * 1024 * 1024 + 7];
+    static uint8_t copy_destination[sizeof(copy_source) + 1];
+    const size_t copy_length[] = {0, 1, 7, 4096, 4097, 10000, sizeof(copy_source)};
+    bool copy_succeed = true;
+
+    for (size_t i = 0; i < sizeof(copy_source); i++) {
+        copy_source[i] = (uint8_t)((i * 2654435761u) >> 13);
+    }
+    for (CRC16_reference_model_e model = CRC16_IBM_MODEL; model < CRC16_NONE_MODEL; model++) {
+        for (size_t i = 0; i < sizeof(copy_length) / sizeof(copy_length[0]); i++) {
+            crc16_ctx ctx, copy_ctx;
+            size_t first = copy_length[i] / 3;
+
+            memset(copy_destination, 0, sizeof(copy_destination));
+            crc16_init(&ctx, model);
+            crc16_update(&ctx, copy_source, copy_length[i]);
+            crc16_init(&copy_ctx, model);
+            crc16_copy(&copy_ctx, copy_destination + 1, copy_source, first);
+            crc16_copy(&copy_ctx, copy_destination + 1 + first, copy_source + first, copy_length[i] - first);
+            if (crc16_final(&ctx) != crc16_final(&copy_ctx) || memcmp(copy_destination + 1, copy_source, copy_length[i]) != 0) {
+                copy_succeed = false;
+            }
+        }
+    }
+    printf("crc16_copy check %s.\n", copy_succeed ? "succeed" : "fail");
+#endif
+    return 0;
+}
+
+static void print_crc16_table(CRC16_reference_model_e model) {
+    uint16_t crc16_result = 0;
+    uint8_t i = 0;
+    switch (model)
+    {
+    case CRC16_IBM_MODEL:
+        printf("/* Reference Model:CRC16_IBM_MODEL */\n");
+        printf("static const uint16_t CRC16_IBM_MODEL_TABLE[256] = {\n");
+        break;
+
+    case CRC16_MAXIM_MODEL:
+        printf("/* Reference Model:CRC16_MAXIM_MODEL */\n");
+        printf("static const uint16_t CRC16_MAXIM_MODEL_TABLE[256] = {\n");
+        break;
+
+    case CRC16_USB_MODEL:
+        printf("/* Reference Model:CRC16_USB_MODEL */\n");
+        printf("static const uint16_t CRC16_USB_MODEL_TABLE[256] = {\n");
+        break;
+
+    case CRC16_MODBUS_MODEL:
+        printf("/* Reference Model:CRC16_MODBUS_MODEL */\n");
+        printf("const uint16_t CRC16_MODBUS_MODEL_TABLE[256] = {\n");
+        break;
+
+    case CRC16_CCITT_MODEL:
+        printf("/* Reference Model:CRC16_CCITT_MODEL */\n");
+        printf("static const uint16_t CRC16_CCITT_MODEL_TABLE[256] = {\n");
+        break;
+
+    case CRC16_CCITT_FALSE_MODEL:
+        printf("/* Reference Model:CRC16_CCITT_FALSE_MODEL */\n");
+        printf("static const uint16_t CRC16_CCITT_FALSE_MODEL_TABLE[256] = {\n");
+        break;
+
+    case CRC16_X25_MODEL:
+        printf("/* Reference Model:CRC16_X25_MODEL */\n");
+        printf("static const uint16_t CRC16_X25_MODEL_TABLE[256] = {\n");
+        break;
+
+    case CRC16_XMODEM_MODEL:
+        printf("/* Reference Model:CRC16_XMODEM_MODEL */\n");
+        printf("static const uint16_t CRC16_XMODEM_MODEL_TABLE[256] = {\n");
+        break;
+
+    case CRC16_DNP_MODEL:
+        printf("/* Reference Model:CRC16_DNP_MODEL */\n");
+        printf("static const uint16_t CRC16_DNP_MODEL_TABLE[256] = {\n");
+        break;
+
+    default:
+        break;
+    }
+    for (int j = 0; j <= 0xFF; j++, i++) {
+        if (crc16_param[model].input_inversion == true && crc16_param[model].output_inversion == true) {
+            crc16_result = crc16_calculate_mirror_mode(model, &i, 1);
+        } else {
+            crc16_result = crc16_calculate(model, &i, 1);
+        }
+        if (i % 16 == 0) {
+            printf("    ");
+        } else {
+            printf(" ");
+        }
+        printf("0x%04X", crc16_result);
+        if (i != 0xFF) {
+            printf(",");
+        }
+        if ((i + 1) % 16 == 0) {
+            printf("\n");
+        }
+    }
+    printf("};\n");
+}
+#endif
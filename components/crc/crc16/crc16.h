@@ -1,35 +1,91 @@
-#ifndef __CRC16_H__
-#define __CRC16_H__
-
-#include <stdint.h>
-#include <stdbool.h>
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-typedef enum {
-    CRC16_IBM_MODEL = 0,
-    CRC16_MAXIM_MODEL,
-    CRC16_USB_MODEL,
-    CRC16_MODBUS_MODEL,
-    CRC16_CCITT_MODEL,
-    CRC16_CCITT_FALSE_MODEL,
-    CRC16_X25_MODEL,
-    CRC16_XMODEM_MODEL,
-    CRC16_DNP_MODEL,
-    CRC16_NONE_MODEL,
-}CRC16_reference_model_e;
-
-uint16_t crc16_calculate(CRC16_reference_model_e model, uint8_t *input_data, size_t length);
-uint16_t crc16_calculate_mirror_mode(CRC16_reference_model_e model, uint8_t *input_data, size_t length);
-void crc16_calculate_package(CRC16_reference_model_e model, uint8_t *input_data, size_t length);
-void crc16_lookup_table_package(CRC16_reference_model_e model, uint8_t *input_data, size_t length);
-bool crc16_package_check(CRC16_reference_model_e model, uint8_t *input_data, size_t length);
-bool crc16_lookup_table_package_check(CRC16_reference_model_e model, uint8_t *input_data, size_t length);
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif
+#ifndef __CRC16_H__
+#define __CRC16_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    CRC16_IBM_MODEL = 0,
+    CRC16_MAXIM_MODEL,
+    CRC16_USB_MODEL,
+    CRC16_MODBUS_MODEL,
+    CRC16_CCITT_MODEL,
+    CRC16_CCITT_FALSE_MODEL,
+    CRC16_X25_MODEL,
+    CRC16_XMODEM_MODEL,
+    CRC16_DNP_MODEL,
+    CRC16_NONE_MODEL,
+}CRC16_reference_model_e;
+
+/* Kernels crc16_calculate routes between by length, see crc16_route_set */
+typedef enum {
+    CRC16_KERNEL_BITWISE = 0, /* bit by bit, the reference */
+    CRC16_KERNEL_NIBBLE,      /* 16 entry table, two lookups per byte */
+    CRC16_KERNEL_TABLE,       /* 256 entry table, the 16 entry one with CRC16_USE_NIBBLE_TABLE */
+    CRC16_KERNEL_SLICE4,      /* four bytes per step, tables generated from the model parameters */
+    CRC16_KERNEL_SLICE8,      /* eight bytes per step */
+    CRC16_KERNEL_NONE,
+} crc16_kernel_e;
+
+/* Streaming CRC16 computation, the same result as crc16_calculate over all the updates joined */
+typedef struct {
+    CRC16_reference_model_e model;
+    uint16_t crc;                /* CRC16 register, result xor value not yet applied */
+} crc16_ctx;
+
+/* longest frame (CRC16 included) a correction table can be built for */
+#define CRC16_CORRECTION_MAX_LENGTH 256
+
+/* Syndrome table for repairing damaged frames of one model and one frame length */
+typedef struct {
+    CRC16_reference_model_e model;
+    size_t length;                  /* frame length the table was built for, CRC16 included */
+    uint8_t correctable_bits;       /* 0: detection only, 1: single bit errors, 2: single and double bit errors */
+    uint32_t syndrome[65536];       /* syndrome -> bit positions + 1 of the flipped bits, low and high half word */
+} crc16_correction_table_t;
+
+/* Sliding window CRC16 over frames of one model and one length: the register of the window's
+   payload is rolled one byte at a time, the leaving byte taken out with one table lookup */
+typedef struct {
+    CRC16_reference_model_e model;
+    size_t length;                  /* frame length the table was built for, CRC16 included */
+    uint16_t initial;               /* initial value carried through the payload, xored with the result xor value */
+    uint16_t step[256];             /* byte table of the model */
+    uint16_t leave[256];            /* register contribution of the byte leaving the window */
+} crc16_window_table_t;
+
+uint16_t crc16_calculate(CRC16_reference_model_e model, uint8_t *input_data, size_t length);
+uint16_t crc16_calculate_mirror_mode(CRC16_reference_model_e model, uint8_t *input_data, size_t length);
+void crc16_calculate_package(CRC16_reference_model_e model, uint8_t *input_data, size_t length);
+void crc16_lookup_table_package(CRC16_reference_model_e model, uint8_t *input_data, size_t length);
+bool crc16_package_check(CRC16_reference_model_e model, uint8_t *input_data, size_t length);
+bool crc16_lookup_table_package_check(CRC16_reference_model_e model, uint8_t *input_data, size_t length);
+void crc16_package_check_batch(CRC16_reference_model_e model, uint8_t *const *packages, const size_t *lengths,
+                               size_t count, uint64_t *valid);
+void crc16_init(crc16_ctx *ctx, CRC16_reference_model_e model);
+void crc16_update(crc16_ctx *ctx, uint8_t *input_data, size_t length);
+void crc16_copy(crc16_ctx *ctx, uint8_t *destination, const uint8_t *source, size_t length);
+uint16_t crc16_final(crc16_ctx *ctx);
+bool crc16_kernel_available(CRC16_reference_model_e model, crc16_kernel_e kernel);
+uint16_t crc16_kernel_calculate(CRC16_reference_model_e model, crc16_kernel_e kernel, uint8_t *input_data, size_t length);
+void crc16_route_set(CRC16_reference_model_e model, const size_t threshold[CRC16_KERNEL_NONE]);
+void crc16_route_get(CRC16_reference_model_e model, size_t threshold[CRC16_KERNEL_NONE]);
+void crc16_param_get(CRC16_reference_model_e model, uint16_t *initial_value, uint16_t *result_xor_value);
+bool crc16_correction_table_init(crc16_correction_table_t *table, CRC16_reference_model_e model, size_t length);
+bool crc16_package_correct(const crc16_correction_table_t *table, uint8_t *input_data, size_t length, uint8_t *correction_count);
+void crc16_window_table_init(crc16_window_table_t *table, CRC16_reference_model_e model, size_t length);
+uint16_t crc16_window_start(const crc16_window_table_t *table, const uint8_t *input_data);
+uint16_t crc16_window_roll(const crc16_window_table_t *table, uint16_t crc, uint8_t leaving, uint8_t entering);
+uint16_t crc16_window_result(const crc16_window_table_t *table, uint16_t crc);
+size_t crc16_frame_scan(const crc16_window_table_t *table, const uint8_t *input_data, size_t length, size_t *offsets, size_t max_offsets);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
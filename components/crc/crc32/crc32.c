@@ -1,493 +1,1326 @@
-/**
- * @file crc32.c
- * @brief Cyclic Redundancy Check (CRC32)
- * @copyright Copyright (c) 2023
- *
- * Change Logs:
- * Data             Author                          Notes
- * 2023-04-24       vector(vector_qiu@323.com)      first version
- *
- */
-#include "crc32.h"
-#include <assert.h>
-
-/* Reference Model:CRC32_MODEL */
-static const uint32_t CRC32_MODEL_TABLE[256] = {
-    0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
-    0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
-    0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
-    0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
-    0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172, 0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
-    0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
-    0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
-    0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924, 0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
-    0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
-    0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
-    0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E, 0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
-    0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
-    0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
-    0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0, 0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
-    0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
-    0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
-    0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A, 0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
-    0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
-    0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
-    0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC, 0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
-    0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
-    0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
-    0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236, 0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
-    0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
-    0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
-    0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38, 0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
-    0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
-    0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
-    0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2, 0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
-    0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
-    0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
-    0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
-};
-/* Reference Model:CRC32_MPEG2_MODEL */
-static const uint32_t CRC32_MPEG2_MODEL_TABLE[256] = {
-    0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9, 0x130476DC, 0x17C56B6B, 0x1A864DB2, 0x1E475005,
-    0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61, 0x350C9B64, 0x31CD86D3, 0x3C8EA00A, 0x384FBDBD,
-    0x4C11DB70, 0x48D0C6C7, 0x4593E01E, 0x4152FDA9, 0x5F15ADAC, 0x5BD4B01B, 0x569796C2, 0x52568B75,
-    0x6A1936C8, 0x6ED82B7F, 0x639B0DA6, 0x675A1011, 0x791D4014, 0x7DDC5DA3, 0x709F7B7A, 0x745E66CD,
-    0x9823B6E0, 0x9CE2AB57, 0x91A18D8E, 0x95609039, 0x8B27C03C, 0x8FE6DD8B, 0x82A5FB52, 0x8664E6E5,
-    0xBE2B5B58, 0xBAEA46EF, 0xB7A96036, 0xB3687D81, 0xAD2F2D84, 0xA9EE3033, 0xA4AD16EA, 0xA06C0B5D,
-    0xD4326D90, 0xD0F37027, 0xDDB056FE, 0xD9714B49, 0xC7361B4C, 0xC3F706FB, 0xCEB42022, 0xCA753D95,
-    0xF23A8028, 0xF6FB9D9F, 0xFBB8BB46, 0xFF79A6F1, 0xE13EF6F4, 0xE5FFEB43, 0xE8BCCD9A, 0xEC7DD02D,
-    0x34867077, 0x30476DC0, 0x3D044B19, 0x39C556AE, 0x278206AB, 0x23431B1C, 0x2E003DC5, 0x2AC12072,
-    0x128E9DCF, 0x164F8078, 0x1B0CA6A1, 0x1FCDBB16, 0x018AEB13, 0x054BF6A4, 0x0808D07D, 0x0CC9CDCA,
-    0x7897AB07, 0x7C56B6B0, 0x71159069, 0x75D48DDE, 0x6B93DDDB, 0x6F52C06C, 0x6211E6B5, 0x66D0FB02,
-    0x5E9F46BF, 0x5A5E5B08, 0x571D7DD1, 0x53DC6066, 0x4D9B3063, 0x495A2DD4, 0x44190B0D, 0x40D816BA,
-    0xACA5C697, 0xA864DB20, 0xA527FDF9, 0xA1E6E04E, 0xBFA1B04B, 0xBB60ADFC, 0xB6238B25, 0xB2E29692,
-    0x8AAD2B2F, 0x8E6C3698, 0x832F1041, 0x87EE0DF6, 0x99A95DF3, 0x9D684044, 0x902B669D, 0x94EA7B2A,
-    0xE0B41DE7, 0xE4750050, 0xE9362689, 0xEDF73B3E, 0xF3B06B3B, 0xF771768C, 0xFA325055, 0xFEF34DE2,
-    0xC6BCF05F, 0xC27DEDE8, 0xCF3ECB31, 0xCBFFD686, 0xD5B88683, 0xD1799B34, 0xDC3ABDED, 0xD8FBA05A,
-    0x690CE0EE, 0x6DCDFD59, 0x608EDB80, 0x644FC637, 0x7A089632, 0x7EC98B85, 0x738AAD5C, 0x774BB0EB,
-    0x4F040D56, 0x4BC510E1, 0x46863638, 0x42472B8F, 0x5C007B8A, 0x58C1663D, 0x558240E4, 0x51435D53,
-    0x251D3B9E, 0x21DC2629, 0x2C9F00F0, 0x285E1D47, 0x36194D42, 0x32D850F5, 0x3F9B762C, 0x3B5A6B9B,
-    0x0315D626, 0x07D4CB91, 0x0A97ED48, 0x0E56F0FF, 0x1011A0FA, 0x14D0BD4D, 0x19939B94, 0x1D528623,
-    0xF12F560E, 0xF5EE4BB9, 0xF8AD6D60, 0xFC6C70D7, 0xE22B20D2, 0xE6EA3D65, 0xEBA91BBC, 0xEF68060B,
-    0xD727BBB6, 0xD3E6A601, 0xDEA580D8, 0xDA649D6F, 0xC423CD6A, 0xC0E2D0DD, 0xCDA1F604, 0xC960EBB3,
-    0xBD3E8D7E, 0xB9FF90C9, 0xB4BCB610, 0xB07DABA7, 0xAE3AFBA2, 0xAAFBE615, 0xA7B8C0CC, 0xA379DD7B,
-    0x9B3660C6, 0x9FF77D71, 0x92B45BA8, 0x9675461F, 0x8832161A, 0x8CF30BAD, 0x81B02D74, 0x857130C3,
-    0x5D8A9099, 0x594B8D2E, 0x5408ABF7, 0x50C9B640, 0x4E8EE645, 0x4A4FFBF2, 0x470CDD2B, 0x43CDC09C,
-    0x7B827D21, 0x7F436096, 0x7200464F, 0x76C15BF8, 0x68860BFD, 0x6C47164A, 0x61043093, 0x65C52D24,
-    0x119B4BE9, 0x155A565E, 0x18197087, 0x1CD86D30, 0x029F3D35, 0x065E2082, 0x0B1D065B, 0x0FDC1BEC,
-    0x3793A651, 0x3352BBE6, 0x3E119D3F, 0x3AD08088, 0x2497D08D, 0x2056CD3A, 0x2D15EBE3, 0x29D4F654,
-    0xC5A92679, 0xC1683BCE, 0xCC2B1D17, 0xC8EA00A0, 0xD6AD50A5, 0xD26C4D12, 0xDF2F6BCB, 0xDBEE767C,
-    0xE3A1CBC1, 0xE760D676, 0xEA23F0AF, 0xEEE2ED18, 0xF0A5BD1D, 0xF464A0AA, 0xF9278673, 0xFDE69BC4,
-    0x89B8FD09, 0x8D79E0BE, 0x803AC667, 0x84FBDBD0, 0x9ABC8BD5, 0x9E7D9662, 0x933EB0BB, 0x97FFAD0C,
-    0xAFB010B1, 0xAB710D06, 0xA6322BDF, 0xA2F33668, 0xBCB4666D, 0xB8757BDA, 0xB5365D03, 0xB1F740B4
-};
-
-/* http://www.ip33.com/crc.html */
-/* polynomial discard MSB or LSB because they are always 1 */
-typedef struct {
-    uint32_t initial_value;
-    uint32_t result_xor_value;
-    uint32_t polynomial;
-    bool input_inversion;
-    bool output_inversion;
-} crc32_param_t;
-
-// #define PRINT_TABLE
-#ifndef PRINT_TABLE
-static crc32_param_t crc32_param[] = {
-    {0xFFFFFFFF, 0xFFFFFFFF, 0x04C11DB7, true, true},           // Reference Model:CRC32_MODEL
-    {0xFFFFFFFF, 0x00000000, 0x04C11DB7, false, false},         // Reference Model:CRC32_MPEG2_MODEL
-};
-#else
-/* Generate table usage */
-static crc32_param_t crc32_param[] = {
-    {0x00000000, 0x00000000, 0x04C11DB7, true, true},           // Reference Model:CRC32_MODEL
-    {0x00000000, 0x00000000, 0x04C11DB7, false, false},         // Reference Model:CRC32_MPEG2_MODEL
-};
-#endif
-
-/**
- * @brief uint8_t type data inversion
- *
- * @param data Data to be reversed
- * @return uint8_t The reversed data
- */
-static uint8_t u8_data_inversion(uint8_t data) {
-    uint8_t result = 0;
-    for (uint8_t i = 0; i < 8; i++) {
-        result <<= 1;
-        result |= (data >> i) & 0x01;
-    }
-    return result;
-}
-
-/**
- * @brief uint32_t type data inversion
- *
- * @param data Data to be reversed
- * @return uint32_t The reversed data
- */
-static uint32_t u32_data_inversion(uint32_t data) {
-    uint32_t result = 0;
-    for (uint8_t i = 0; i < 32; i++) {
-        result <<= 1;
-        result |= (data >> i) & 0x0001;
-    }
-    return result;
-}
-
-/**
- * @brief Calculates the 32 bit wide CRC of an input data of a given length.
- *
- * @param param CRC32 reference model
- * @param input_data Input uint8 t type array data
- * @param length Input uint8 t type array length
- * @return uint32_t CRC32 result
- */
-uint32_t crc32_calculate(CRC32_reference_model_e model, uint8_t *input_data, size_t length) {
-    /* parameter checkout */
-    assert(model < CRC32_NONE_MODEL);
-    assert(input_data != NULL);
-    assert(length > 0);
-
-    uint32_t crc32 = crc32_param[model].initial_value;
-    uint32_t polynomial = crc32_param[model].polynomial;
-    uint8_t data;
-
-    for (size_t i = 0; i < length; i++) {
-        data = *input_data++;
-        if (crc32_param[model].input_inversion) {
-            data = u8_data_inversion(data);
-        }
-        crc32 ^= (uint32_t)data << 24;
-        for (uint8_t j = 0; j < 8; j++) {
-            if (crc32 & 0x80000000) {
-                crc32 <<= 1;
-                crc32 ^= polynomial; //  polynomial discard MSB or LSB because they are always 1, don't need to compute
-            } else {
-                crc32 <<= 1;
-            }
-
-        }
-    }
-
-    if (crc32_param[model].output_inversion) {
-        crc32 = u32_data_inversion(crc32);
-    }
-
-    return (crc32 ^ crc32_param[model].result_xor_value);
-}
-
-/**
- * @brief The mirror mode computes the 32-bit wide CRC of the input data of a given length.
- *
- * @param param CRC32 reference model
- * @param input_data Input uint8 t type array data
- * @param length Input uint8 t type array length
- * @return uint32_t CRC32 result
- */
-uint32_t crc32_calculate_mirror_mode(CRC32_reference_model_e model, uint8_t *input_data, size_t length) {
-    /* parameter checkout */
-    assert(model < CRC32_NONE_MODEL);
-    assert(input_data != NULL);
-    assert(length > 0);
-
-    uint32_t crc32 = crc32_param[model].initial_value;
-    uint32_t polynomial = u32_data_inversion(crc32_param[model].polynomial);
-    uint8_t data;
-
-    for (size_t i = 0; i < length; i++) {
-        data = *input_data++;
-        if (!crc32_param[model].input_inversion) {
-            data = u8_data_inversion(data);
-        }
-        crc32 ^= data;
-        for (uint8_t j = 0; j < 8; j++) {
-            if (crc32 & 0x00000001) {
-                crc32 >>= 1;
-                crc32 ^= polynomial; //  polynomial discard MSB or LSB because they are always 1, don't need to compute
-            } else {
-                crc32 >>= 1;
-            }
-
-        }
-    }
-
-    if (!crc32_param[model].output_inversion) {
-        crc32 = u32_data_inversion(crc32);
-    }
-
-    return (crc32 ^ crc32_param[model].result_xor_value);
-}
-
-/**
- * @brief CRC32 calculation method group package
- *
- * @param param CRC32 reference model
- * @param input_data Packets of CRC32 to be computed, last byte of the array holds the CRC32 result
- * @param length Length of the CRC32 packet
- */
-void crc32_calculate_package(CRC32_reference_model_e model, uint8_t *input_data, size_t length) {
-    /* parameter checkout */
-    assert(model < CRC32_NONE_MODEL);
-    assert(input_data != NULL);
-    assert(length > 0);
-
-    uint32_t crc32_result = 0;
-    if (crc32_param[model].input_inversion == true && crc32_param[model].output_inversion == true) {
-        crc32_result = crc32_calculate_mirror_mode(model, input_data, length - 4);
-    } else {
-        crc32_result = crc32_calculate(model, input_data, length - 4);
-    }
-
-    *(input_data + length - 4) = crc32_result & 0xFF;
-    *(input_data + length - 3) = (crc32_result >> 8) & 0xFF;
-    *(input_data + length - 2) = (crc32_result >> 16) & 0xFF;
-    *(input_data + length - 1) = (crc32_result >> 24) & 0xFF;
-}
-
-/**
- * @brief CRC32 lookup table package
- *
- * @param param CRC32 reference model
- * @param input_data Packets of CRC32 to be computed, last byte of the array holds the CRC32 result
- * @param length Length of the CRC32 packet
- */
-void crc32_lookup_table_package(CRC32_reference_model_e model, uint8_t *input_data, size_t length) {
-    /* parameter checkout */
-    assert(model < CRC32_NONE_MODEL);
-    assert(input_data != NULL);
-    assert(length > 0);
-
-    uint32_t crc32_result = 0;
-    uint8_t *p = input_data;
-    if (p != NULL) {
-        switch (model)
-        {
-        case CRC32_MODEL:
-            crc32_result = crc32_param[model].initial_value;
-            for (size_t i = 0; i < length - 4; i++) {
-                crc32_result = (crc32_result >> 8) ^ CRC32_MODEL_TABLE[(crc32_result ^ *p++) & 0xFF];
-            }
-            crc32_result ^= crc32_param[model].result_xor_value;
-            break;
-
-        case CRC32_MPEG2_MODEL:
-            crc32_result = crc32_param[model].initial_value;
-            for (size_t i = 0; i < length - 4; i++) {
-                crc32_result = (crc32_result << 8) ^ CRC32_MPEG2_MODEL_TABLE[(crc32_result >> 24) ^ *p++];
-            }
-            crc32_result ^= crc32_param[model].result_xor_value;
-            break;
-
-        default:
-            break;
-        }
-    }
-
-    *(input_data + length - 4) = crc32_result & 0xFF;
-    *(input_data + length - 3) = (crc32_result >> 8) & 0xFF;
-    *(input_data + length - 2) = (crc32_result >> 16) & 0xFF;
-    *(input_data + length - 1) = (crc32_result >> 24) & 0xFF;
-}
-
-/**
- * @brief CRC32 calculation method package check
- *
- * @param param CRC32 reference model
- * @param input_data CRC32 packages to check
- * @param length Length of the CRC8 packet
- * @return true CRC32 checks succeed
- * @return false CRC32 checks fails
- */
-bool crc32_package_check(CRC32_reference_model_e model, uint8_t *input_data, size_t length) {
-    /* parameter checkout */
-    assert(model < CRC32_NONE_MODEL);
-    assert(input_data != NULL);
-    assert(length > 0);
-
-    uint32_t crc32_actual_value = ((uint32_t)*(input_data + length - 1) << 24) | ((uint32_t)*(input_data + length - 2) << 16) | \
-                                    (uint32_t)(*(input_data + length - 3) << 8) | *(input_data + length - 4);
-    uint32_t crc32_result = 0;
-    if (crc32_param[model].input_inversion == true && crc32_param[model].output_inversion == true) {
-        crc32_result = crc32_calculate_mirror_mode(model, input_data, length - 4);
-    } else {
-        crc32_result = crc32_calculate(model, input_data, length - 4);
-    }
-    if (crc32_result != crc32_actual_value) {
-        return false;
-    }
-    return true;
-}
-
-/**
- * @brief CRC32 lookup table packages check
- *
- * @param param CRC32 reference model
- * @param input_data CRC32 packages to check
- * @param length Length of the CRC32 packet
- * @return true CRC32 checks succeed
- * @return false CRC32 checks fails
- */
-bool crc32_lookup_table_package_check(CRC32_reference_model_e model, uint8_t *input_data, size_t length) {
-    assert(model <= CRC32_NONE_MODEL);
-    assert(input_data != NULL);
-    assert(length > 0);
-
-    uint32_t crc32_result = 0;
-    uint32_t crc32_actual_value = ((uint32_t)*(input_data + length - 1) << 24) | ((uint32_t)*(input_data + length - 2) << 16) | \
-                                    (uint32_t)(*(input_data + length - 3) << 8) | *(input_data + length - 4);
-    uint8_t *p = input_data;
-    switch (model)
-    {
-    case CRC32_MODEL:
-        crc32_result = crc32_param[model].initial_value;
-        for (size_t i = 0; i < length - 4; i++) {
-            crc32_result = (crc32_result >> 8) ^ CRC32_MODEL_TABLE[(crc32_result ^ *p++) & 0xFF];
-        }
-        crc32_result ^= crc32_param[model].result_xor_value;
-        break;
-
-    case CRC32_MPEG2_MODEL:
-        crc32_result = crc32_param[model].initial_value;
-        for (size_t i = 0; i < length - 4; i++) {
-            crc32_result = (crc32_result << 8) ^ CRC32_MPEG2_MODEL_TABLE[(crc32_result >> 24) ^ *p++];
-        }
-        crc32_result ^= crc32_param[model].result_xor_value;
-        break;
-
-    default:
-        break;
-    }
-
-    if (crc32_result != crc32_actual_value) {
-        return false;
-    }
-    return true;
-}
-
-#define TEST
-#ifdef TEST
-#include <stdio.h>
-
-static void print_crc32_table(CRC32_reference_model_e model);
-
-int main() {
-    uint8_t input_data[14] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x08};
-#if 0
-    uint32_t crc32_model = crc32_calculate(CRC32_MODEL, input_data, 10);
-    uint32_t crc32_mpeg2_model = crc32_calculate(CRC32_MPEG2_MODEL, input_data, 10);
-
-    uint32_t mirror_crc32_model = crc32_calculate_mirror_mode(CRC32_MODEL, input_data, 10);
-    uint32_t mirror_crc32_mpeg2_model = crc32_calculate_mirror_mode(CRC32_MPEG2_MODEL, input_data, 10);
-
-    printf("---------------------------crc32_calculate result-----------------------\n");
-    printf("crc32_model result = 0x%08x\n", crc32_model);
-    printf("crc32_mpeg2_model result = 0x%08x\n", crc32_mpeg2_model);
-
-    printf("---------------------crc32_calculate_mirror_mode result------------------\n");
-    printf("mirror_crc32_model result = 0x%08x\n", mirror_crc32_model);
-    printf("mirror_crc32_mpeg2_model result = 0x%08x\n", mirror_crc32_mpeg2_model);
-#endif
-
-#if 0
-    print_crc32_table(CRC32_MODEL);
-    print_crc32_table(CRC32_MPEG2_MODEL);
-#endif
-#if 0
-    uint32_t crc32_result = 0;
-    bool crc32_check_result = false;
-    printf("data:[");
-    for (int i; i < sizeof(input_data)/sizeof(input_data[0]); i++) {
-        printf("0x%02x, ", input_data[i]);
-    }
-    printf("]\n");
-
-    crc32_calculate_package(CRC32_MODEL, input_data, 14);
-    crc32_result = (input_data[13] << 24) | (input_data[12] << 16) | (input_data[11] << 8) | input_data[10];
-    printf("crc32_calculate_package CRC32_MODEL result = 0x%08x\n", crc32_result);
-    crc32_check_result = crc32_package_check(CRC32_MODEL, input_data, 14);
-    if (crc32_check_result) {
-        printf("crc32_calculate_package CRC32_MODEL check succeed.\n");
-    } else {
-        printf("crc32_calculate_package CRC32_MODEL check fail.\n");
-    }
-
-    crc32_calculate_package(CRC32_MPEG2_MODEL, input_data, 14);
-    crc32_result = (input_data[13] << 24) | (input_data[12] << 16) | (input_data[11] << 8) | input_data[10];
-    printf("crc32_calculate_package CRC32_MPEG2_MODEL result = 0x%08x\n", crc32_result);
-    crc32_check_result = crc32_package_check(CRC32_MPEG2_MODEL, input_data, 14);
-    if (crc32_check_result) {
-        printf("crc32_calculate_package CRC32_MPEG2_MODEL check succeed.\n");
-    } else {
-        printf("crc32_calculate_package CRC32_MPEG2_MODEL check fail.\n");
-    }
-#endif
-
-#if 0
-    uint32_t crc32_result = 0;
-    bool crc32_check_result = false;
-
-    crc32_lookup_table_package(CRC32_MODEL, input_data, 14);
-    crc32_result = (input_data[13] << 24) | (input_data[12] << 16) | (input_data[11] << 8) | input_data[10];
-    printf("crc32_lookup_table_package CRC32_MODEL result = 0x%04x\n", crc32_result);
-    crc32_check_result = crc32_lookup_table_package_check(CRC32_MODEL, input_data, 14);
-    if (crc32_check_result) {
-        printf("crc32_calculate_package CRC32_MODEL check succeed.\n");
-    } else {
-        printf("crc32_calculate_package CRC32_MODEL check fail.\n");
-    }
-
-    crc32_lookup_table_package(CRC32_MPEG2_MODEL, input_data, 14);
-    crc32_result = (input_data[13] << 24) | (input_data[12] << 16) | (input_data[11] << 8) | input_data[10];
-    printf("crc32_lookup_table_package CRC32_MPEG2_MODEL result = 0x%04x\n", crc32_result);
-    crc32_check_result = crc32_lookup_table_package_check(CRC32_MPEG2_MODEL, input_data, 14);
-    if (crc32_check_result) {
-        printf("crc32_calculate_package CRC32_MPEG2_MODEL check succeed.\n");
-    } else {
-        printf("crc32_calculate_package CRC32_MPEG2_MODEL check fail.\n");
-    }
-#endif
-    return 0;
-}
-
-static void print_crc32_table(CRC32_reference_model_e model) {
-    uint32_t crc32_result = 0;
-    uint8_t i = 0;
-    switch (model)
-    {
-    case CRC32_MODEL:
-        printf("/* Reference Model:CRC32_MODEL */\n");
-        printf("static const uint32_t CRC32_MODEL_TABLE[256] = {\n");
-        break;
-
-    case CRC32_MPEG2_MODEL:
-        printf("/* Reference Model:CRC32_MPEG2_MODEL */\n");
-        printf("static const uint32_t CRC32_MPEG2_MODEL_TABLE[256] = {\n");
-        break;
-
-    default:
-        break;
-    }
-    for (int j = 0; j <= 0xFF; j++, i++) {
-        if (crc32_param[model].input_inversion == true && crc32_param[model].output_inversion == true) {
-            crc32_result = crc32_calculate_mirror_mode(model, &i, 1);
-        } else {
-            crc32_result = crc32_calculate(model, &i, 1);
-        }
-        if (i % 8 == 0) {
-            printf("    ");
-        } else {
-            printf(" ");
-        }
-        printf("0x%08X", crc32_result);
-        if (i != 0xFF) {
-            printf(",");
-        }
-        if ((i + 1) % 8 == 0) {
-            printf("\n");
-        }
-    }
-    printf("};\n");
-}
-#endif
+/**
+ * @file crc32.c
+ * @brief Cyclic Redundancy Check (CRC32)
+ * @copyright Copyright (c) 2023
+ *
+ * Change Logs:
+ * Data             Author                          Notes
+ * 2023-04-24       vector(vector_qiu@323.com)      first version
+ *
+ */
+#include "crc32.h"
+#include "../crc_config/crc_config.h"
+#include "../../checksum_stats/checksum_stats.h"
+#include "../../checksum_copy/checksum_copy.h"
+#include <assert.h>
+#include <string.h>
+
+/* 16 entry nibble tables, two lookups per byte: 64 bytes per model instead of 1024 */
+// #define CRC32_USE_NIBBLE_TABLE
+#ifndef CRC32_USE_NIBBLE_TABLE
+#if CRC32_MODELS & CRC32_MODEL_BIT
+/* Reference Model:CRC32_MODEL */
+static const uint32_t CRC32_MODEL_TABLE[256] = {
+    0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535, 0x9E6495A3,
+    0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD, 0xE7B82D07, 0x90BF1D91,
+    0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D, 0x6DDDE4EB, 0xF4D4B551, 0x83D385C7,
+    0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC, 0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5,
+    0x3B6E20C8, 0x4C69105E, 0xD56041E4, 0xA2677172, 0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B,
+    0x35B5A8FA, 0x42B2986C, 0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59,
+    0x26D930AC, 0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
+    0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924, 0x2F6F7C87, 0x58684C11, 0xC1611DAB, 0xB6662D3D,
+    0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5, 0xE8B8D433,
+    0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D, 0x91646C97, 0xE6635C01,
+    0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E, 0x6C0695ED, 0x1B01A57B, 0x8208F4C1, 0xF50FC457,
+    0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C, 0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65,
+    0x4DB26158, 0x3AB551CE, 0xA3BC0074, 0xD4BB30E2, 0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB,
+    0x4369E96A, 0x346ED9FC, 0xAD678846, 0xDA60B8D0, 0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9,
+    0x5005713C, 0x270241AA, 0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
+    0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81, 0xB7BD5C3B, 0xC0BA6CAD,
+    0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A, 0xEAD54739, 0x9DD277AF, 0x04DB2615, 0x73DC1683,
+    0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D, 0x0A00AE27, 0x7D079EB1,
+    0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D, 0x806567CB, 0x196C3671, 0x6E6B06E7,
+    0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC, 0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5,
+    0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4, 0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B,
+    0xD80D2BDA, 0xAF0A1B4C, 0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79,
+    0xCB61B38C, 0xBC66831A, 0x256FD2A0, 0x5268E236, 0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
+    0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B, 0x5BDEAE1D,
+    0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F, 0x72076785, 0x05005713,
+    0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38, 0x92D28E9B, 0xE5D5BE0D, 0x7CDCEFB7, 0x0BDBDF21,
+    0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E, 0x81BE16CD, 0xF6B9265B, 0x6FB077E1, 0x18B74777,
+    0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C, 0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45,
+    0xA00AE278, 0xD70DD2EE, 0x4E048354, 0x3903B3C2, 0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB,
+    0xAED16A4A, 0xD9D65ADC, 0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9,
+    0xBDBDF21C, 0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
+    0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B, 0x2D02EF8D
+};
+#endif
+#if CRC32_MODELS & CRC32_MPEG2_MODEL_BIT
+/* Reference Model:CRC32_MPEG2_MODEL */
+static const uint32_t CRC32_MPEG2_MODEL_TABLE[256] = {
+    0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9, 0x130476DC, 0x17C56B6B, 0x1A864DB2, 0x1E475005,
+    0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61, 0x350C9B64, 0x31CD86D3, 0x3C8EA00A, 0x384FBDBD,
+    0x4C11DB70, 0x48D0C6C7, 0x4593E01E, 0x4152FDA9, 0x5F15ADAC, 0x5BD4B01B, 0x569796C2, 0x52568B75,
+    0x6A1936C8, 0x6ED82B7F, 0x639B0DA6, 0x675A1011, 0x791D4014, 0x7DDC5DA3, 0x709F7B7A, 0x745E66CD,
+    0x9823B6E0, 0x9CE2AB57, 0x91A18D8E, 0x95609039, 0x8B27C03C, 0x8FE6DD8B, 0x82A5FB52, 0x8664E6E5,
+    0xBE2B5B58, 0xBAEA46EF, 0xB7A96036, 0xB3687D81, 0xAD2F2D84, 0xA9EE3033, 0xA4AD16EA, 0xA06C0B5D,
+    0xD4326D90, 0xD0F37027, 0xDDB056FE, 0xD9714B49, 0xC7361B4C, 0xC3F706FB, 0xCEB42022, 0xCA753D95,
+    0xF23A8028, 0xF6FB9D9F, 0xFBB8BB46, 0xFF79A6F1, 0xE13EF6F4, 0xE5FFEB43, 0xE8BCCD9A, 0xEC7DD02D,
+    0x34867077, 0x30476DC0, 0x3D044B19, 0x39C556AE, 0x278206AB, 0x23431B1C, 0x2E003DC5, 0x2AC12072,
+    0x128E9DCF, 0x164F8078, 0x1B0CA6A1, 0x1FCDBB16, 0x018AEB13, 0x054BF6A4, 0x0808D07D, 0x0CC9CDCA,
+    0x7897AB07, 0x7C56B6B0, 0x71159069, 0x75D48DDE, 0x6B93DDDB, 0x6F52C06C, 0x6211E6B5, 0x66D0FB02,
+    0x5E9F46BF, 0x5A5E5B08, 0x571D7DD1, 0x53DC6066, 0x4D9B3063, 0x495A2DD4, 0x44190B0D, 0x40D816BA,
+    0xACA5C697, 0xA864DB20, 0xA527FDF9, 0xA1E6E04E, 0xBFA1B04B, 0xBB60ADFC, 0xB6238B25, 0xB2E29692,
+    0x8AAD2B2F, 0x8E6C3698, 0x832F1041, 0x87EE0DF6, 0x99A95DF3, 0x9D684044, 0x902B669D, 0x94EA7B2A,
+    0xE0B41DE7, 0xE4750050, 0xE9362689, 0xEDF73B3E, 0xF3B06B3B, 0xF771768C, 0xFA325055, 0xFEF34DE2,
+    0xC6BCF05F, 0xC27DEDE8, 0xCF3ECB31, 0xCBFFD686, 0xD5B88683, 0xD1799B34, 0xDC3ABDED, 0xD8FBA05A,
+    0x690CE0EE, 0x6DCDFD59, 0x608EDB80, 0x644FC637, 0x7A089632, 0x7EC98B85, 0x738AAD5C, 0x774BB0EB,
+    0x4F040D56, 0x4BC510E1, 0x46863638, 0x42472B8F, 0x5C007B8A, 0x58C1663D, 0x558240E4, 0x51435D53,
+    0x251D3B9E, 0x21DC2629, 0x2C9F00F0, 0x285E1D47, 0x36194D42, 0x32D850F5, 0x3F9B762C, 0x3B5A6B9B,
+    0x0315D626, 0x07D4CB91, 0x0A97ED48, 0x0E56F0FF, 0x1011A0FA, 0x14D0BD4D, 0x19939B94, 0x1D528623,
+    0xF12F560E, 0xF5EE4BB9, 0xF8AD6D60, 0xFC6C70D7, 0xE22B20D2, 0xE6EA3D65, 0xEBA91BBC, 0xEF68060B,
+    0xD727BBB6, 0xD3E6A601, 0xDEA580D8, 0xDA649D6F, 0xC423CD6A, 0xC0E2D0DD, 0xCDA1F604, 0xC960EBB3,
+    0xBD3E8D7E, 0xB9FF90C9, 0xB4BCB610, 0xB07DABA7, 0xAE3AFBA2, 0xAAFBE615, 0xA7B8C0CC, 0xA379DD7B,
+    0x9B3660C6, 0x9FF77D71, 0x92B45BA8, 0x9675461F, 0x8832161A, 0x8CF30BAD, 0x81B02D74, 0x857130C3,
+    0x5D8A9099, 0x594B8D2E, 0x5408ABF7, 0x50C9B640, 0x4E8EE645, 0x4A4FFBF2, 0x470CDD2B, 0x43CDC09C,
+    0x7B827D21, 0x7F436096, 0x7200464F, 0x76C15BF8, 0x68860BFD, 0x6C47164A, 0x61043093, 0x65C52D24,
+    0x119B4BE9, 0x155A565E, 0x18197087, 0x1CD86D30, 0x029F3D35, 0x065E2082, 0x0B1D065B, 0x0FDC1BEC,
+    0x3793A651, 0x3352BBE6, 0x3E119D3F, 0x3AD08088, 0x2497D08D, 0x2056CD3A, 0x2D15EBE3, 0x29D4F654,
+    0xC5A92679, 0xC1683BCE, 0xCC2B1D17, 0xC8EA00A0, 0xD6AD50A5, 0xD26C4D12, 0xDF2F6BCB, 0xDBEE767C,
+    0xE3A1CBC1, 0xE760D676, 0xEA23F0AF, 0xEEE2ED18, 0xF0A5BD1D, 0xF464A0AA, 0xF9278673, 0xFDE69BC4,
+    0x89B8FD09, 0x8D79E0BE, 0x803AC667, 0x84FBDBD0, 0x9ABC8BD5, 0x9E7D9662, 0x933EB0BB, 0x97FFAD0C,
+    0xAFB010B1, 0xAB710D06, 0xA6322BDF, 0xA2F33668, 0xBCB4666D, 0xB8757BDA, 0xB5365D03, 0xB1F740B4
+};
+#endif
+#if CRC32_MODELS & CRC32C_MODEL_BIT
+/* Reference Model:CRC32C_MODEL */
+static const uint32_t CRC32C_MODEL_TABLE[256] = {
+    0x00000000, 0xF26B8303, 0xE13B70F7, 0x1350F3F4, 0xC79A971F, 0x35F1141C, 0x26A1E7E8, 0xD4CA64EB,
+    0x8AD958CF, 0x78B2DBCC, 0x6BE22838, 0x9989AB3B, 0x4D43CFD0, 0xBF284CD3, 0xAC78BF27, 0x5E133C24,
+    0x105EC76F, 0xE235446C, 0xF165B798, 0x030E349B, 0xD7C45070, 0x25AFD373, 0x36FF2087, 0xC494A384,
+    0x9A879FA0, 0x68EC1CA3, 0x7BBCEF57, 0x89D76C54, 0x5D1D08BF, 0xAF768BBC, 0xBC267848, 0x4E4DFB4B,
+    0x20BD8EDE, 0xD2D60DDD, 0xC186FE29, 0x33ED7D2A, 0xE72719C1, 0x154C9AC2, 0x061C6936, 0xF477EA35,
+    0xAA64D611, 0x580F5512, 0x4B5FA6E6, 0xB93425E5, 0x6DFE410E, 0x9F95C20D, 0x8CC531F9, 0x7EAEB2FA,
+    0x30E349B1, 0xC288CAB2, 0xD1D83946, 0x23B3BA45, 0xF779DEAE, 0x05125DAD, 0x1642AE59, 0xE4292D5A,
+    0xBA3A117E, 0x4851927D, 0x5B016189, 0xA96AE28A, 0x7DA08661, 0x8FCB0562, 0x9C9BF696, 0x6EF07595,
+    0x417B1DBC, 0xB3109EBF, 0xA0406D4B, 0x522BEE48, 0x86E18AA3, 0x748A09A0, 0x67DAFA54, 0x95B17957,
+    0xCBA24573, 0x39C9C670, 0x2A993584, 0xD8F2B687, 0x0C38D26C, 0xFE53516F, 0xED03A29B, 0x1F682198,
+    0x5125DAD3, 0xA34E59D0, 0xB01EAA24, 0x42752927, 0x96BF4DCC, 0x64D4CECF, 0x77843D3B, 0x85EFBE38,
+    0xDBFC821C, 0x2997011F, 0x3AC7F2EB, 0xC8AC71E8, 0x1C661503, 0xEE0D9600, 0xFD5D65F4, 0x0F36E6F7,
+    0x61C69362, 0x93AD1061, 0x80FDE395, 0x72966096, 0xA65C047D, 0x5437877E, 0x4767748A, 0xB50CF789,
+    0xEB1FCBAD, 0x197448AE, 0x0A24BB5A, 0xF84F3859, 0x2C855CB2, 0xDEEEDFB1, 0xCDBE2C45, 0x3FD5AF46,
+    0x7198540D, 0x83F3D70E, 0x90A324FA, 0x62C8A7F9, 0xB602C312, 0x44694011, 0x5739B3E5, 0xA55230E6,
+    0xFB410CC2, 0x092A8FC1, 0x1A7A7C35, 0xE811FF36, 0x3CDB9BDD, 0xCEB018DE, 0xDDE0EB2A, 0x2F8B6829,
+    0x82F63B78, 0x709DB87B, 0x63CD4B8F, 0x91A6C88C, 0x456CAC67, 0xB7072F64, 0xA457DC90, 0x563C5F93,
+    0x082F63B7, 0xFA44E0B4, 0xE9141340, 0x1B7F9043, 0xCFB5F4A8, 0x3DDE77AB, 0x2E8E845F, 0xDCE5075C,
+    0x92A8FC17, 0x60C37F14, 0x73938CE0, 0x81F80FE3, 0x55326B08, 0xA759E80B, 0xB4091BFF, 0x466298FC,
+    0x1871A4D8, 0xEA1A27DB, 0xF94AD42F, 0x0B21572C, 0xDFEB33C7, 0x2D80B0C4, 0x3ED04330, 0xCCBBC033,
+    0xA24BB5A6, 0x502036A5, 0x4370C551, 0xB11B4652, 0x65D122B9, 0x97BAA1BA, 0x84EA524E, 0x7681D14D,
+    0x2892ED69, 0xDAF96E6A, 0xC9A99D9E, 0x3BC21E9D, 0xEF087A76, 0x1D63F975, 0x0E330A81, 0xFC588982,
+    0xB21572C9, 0x407EF1CA, 0x532E023E, 0xA145813D, 0x758FE5D6, 0x87E466D5, 0x94B49521, 0x66DF1622,
+    0x38CC2A06, 0xCAA7A905, 0xD9F75AF1, 0x2B9CD9F2, 0xFF56BD19, 0x0D3D3E1A, 0x1E6DCDEE, 0xEC064EED,
+    0xC38D26C4, 0x31E6A5C7, 0x22B65633, 0xD0DDD530, 0x0417B1DB, 0xF67C32D8, 0xE52CC12C, 0x1747422F,
+    0x49547E0B, 0xBB3FFD08, 0xA86F0EFC, 0x5A048DFF, 0x8ECEE914, 0x7CA56A17, 0x6FF599E3, 0x9D9E1AE0,
+    0xD3D3E1AB, 0x21B862A8, 0x32E8915C, 0xC083125F, 0x144976B4, 0xE622F5B7, 0xF5720643, 0x07198540,
+    0x590AB964, 0xAB613A67, 0xB831C993, 0x4A5A4A90, 0x9E902E7B, 0x6CFBAD78, 0x7FAB5E8C, 0x8DC0DD8F,
+    0xE330A81A, 0x115B2B19, 0x020BD8ED, 0xF0605BEE, 0x24AA3F05, 0xD6C1BC06, 0xC5914FF2, 0x37FACCF1,
+    0x69E9F0D5, 0x9B8273D6, 0x88D28022, 0x7AB90321, 0xAE7367CA, 0x5C18E4C9, 0x4F48173D, 0xBD23943E,
+    0xF36E6F75, 0x0105EC76, 0x12551F82, 0xE03E9C81, 0x34F4F86A, 0xC69F7B69, 0xD5CF889D, 0x27A40B9E,
+    0x79B737BA, 0x8BDCB4B9, 0x988C474D, 0x6AE7C44E, 0xBE2DA0A5, 0x4C4623A6, 0x5F16D052, 0xAD7D5351
+};
+#endif
+/* byte tables by model, NULL for the models left out of the build */
+static const uint32_t *const CRC32_TABLE[CRC32_NONE_MODEL] = {
+#if CRC32_MODELS & CRC32_MODEL_BIT
+    CRC32_MODEL_TABLE,
+#else
+    NULL,
+#endif
+#if CRC32_MODELS & CRC32_MPEG2_MODEL_BIT
+    CRC32_MPEG2_MODEL_TABLE,
+#else
+    NULL,
+#endif
+#if CRC32_MODELS & CRC32C_MODEL_BIT
+    CRC32C_MODEL_TABLE,
+#else
+    NULL,
+#endif
+};
+#endif
+/* Reference Model:CRC32_MODEL */
+static const uint32_t CRC32_04C11DB7_REFLECTED_NIBBLE_TABLE[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+};
+/* Reference Model:CRC32_MPEG2_MODEL */
+static const uint32_t CRC32_04C11DB7_NORMAL_NIBBLE_TABLE[16] = {
+    0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9, 0x130476DC, 0x17C56B6B, 0x1A864DB2, 0x1E475005,
+    0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61, 0x350C9B64, 0x31CD86D3, 0x3C8EA00A, 0x384FBDBD
+};
+/* Reference Model:CRC32C_MODEL */
+static const uint32_t CRC32_1EDC6F41_REFLECTED_NIBBLE_TABLE[16] = {
+    0x00000000, 0x105EC76F, 0x20BD8EDE, 0x30E349B1, 0x417B1DBC, 0x5125DAD3, 0x61C69362, 0x7198540D,
+    0x82F63B78, 0x92A8FC17, 0xA24BB5A6, 0xB21572C9, 0xC38D26C4, 0xD3D3E1AB, 0xE330A81A, 0xF36E6F75
+};
+static const uint32_t *const CRC32_NIBBLE_TABLE[CRC32_NONE_MODEL] = {
+    CRC32_04C11DB7_REFLECTED_NIBBLE_TABLE,   // Reference Model:CRC32_MODEL
+    CRC32_04C11DB7_NORMAL_NIBBLE_TABLE,      // Reference Model:CRC32_MPEG2_MODEL
+    CRC32_1EDC6F41_REFLECTED_NIBBLE_TABLE,   // Reference Model:CRC32C_MODEL
+};
+
+/* http://www.ip33.com/crc.html */
+/* polynomial discard MSB or LSB because they are always 1 */
+typedef struct {
+    uint32_t initial_value;
+    uint32_t result_xor_value;
+    uint32_t polynomial;
+    bool input_inversion;
+    bool output_inversion;
+} crc32_param_t;
+
+// #define PRINT_TABLE
+#ifndef PRINT_TABLE
+static crc32_param_t crc32_param[] = {
+    {0xFFFFFFFF, 0xFFFFFFFF, 0x04C11DB7, true, true},           // Reference Model:CRC32_MODEL
+    {0xFFFFFFFF, 0x00000000, 0x04C11DB7, false, false},         // Reference Model:CRC32_MPEG2_MODEL
+    {0xFFFFFFFF, 0xFFFFFFFF, 0x1EDC6F41, true, true},           // Reference Model:CRC32C_MODEL
+};
+#else
+/* Generate table usage */
+static crc32_param_t crc32_param[] = {
+    {0x00000000, 0x00000000, 0x04C11DB7, true, true},           // Reference Model:CRC32_MODEL
+    {0x00000000, 0x00000000, 0x04C11DB7, false, false},         // Reference Model:CRC32_MPEG2_MODEL
+    {0x00000000, 0x00000000, 0x1EDC6F41, true, true},           // Reference Model:CRC32C_MODEL
+};
+#endif
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_bitreverse32)
+#define CRC32_BUILTIN_BITREVERSE32
+#endif
+#endif
+
+/**
+ * @brief uint32_t type bit reverse, uses the target's bit reverse instruction where there is one
+ *
+ * @param data Data to be reversed
+ * @return uint32_t The reversed data
+ */
+static inline uint32_t u32_bit_reverse(uint32_t data) {
+#if defined(CRC32_BUILTIN_BITREVERSE32)
+    return __builtin_bitreverse32(data);
+#elif defined(__GNUC__) && defined(__aarch64__)
+    __asm__("rbit %w0, %w1" : "=r"(data) : "r"(data));
+    return data;
+#elif defined(__GNUC__) && defined(__arm__) && defined(__ARM_ARCH) && (__ARM_ARCH >= 7) && !defined(__ARM_ARCH_8M_BASE__)
+    __asm__("rbit %0, %1" : "=r"(data) : "r"(data));
+    return data;
+#else
+    data = ((data >> 1) & 0x55555555) | ((data & 0x55555555) << 1);
+    data = ((data >> 2) & 0x33333333) | ((data & 0x33333333) << 2);
+    data = ((data >> 4) & 0x0F0F0F0F) | ((data & 0x0F0F0F0F) << 4);
+    data = ((data >> 8) & 0x00FF00FF) | ((data & 0x00FF00FF) << 8);
+    return (data >> 16) | (data << 16);
+#endif
+}
+
+/**
+ * @brief uint8_t type data inversion
+ *
+ * @param data Data to be reversed
+ * @return uint8_t The reversed data
+ */
+static uint8_t u8_data_inversion(uint8_t data) {
+    return (uint8_t)(u32_bit_reverse(data) >> 24);
+}
+
+/**
+ * @brief uint32_t type data inversion
+ *
+ * @param data Data to be reversed
+ * @return uint32_t The reversed data
+ */
+static uint32_t u32_data_inversion(uint32_t data) {
+    return u32_bit_reverse(data);
+}
+
+#ifndef CRC_NO_BITWISE
+/**
+ * @brief Calculates the 32 bit wide CRC of an input data of a given length bit by bit.
+ *
+ * @param param CRC32 reference model
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint32_t CRC32 result
+ */
+static uint32_t crc32_bitwise_calculate(CRC32_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC32_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    CHECKSUM_STATS_BEGIN(stats_start);
+    uint32_t crc32;
+    uint32_t polynomial;
+
+    if (crc32_param[model].input_inversion) {
+        /* reflected domain: the register holds the bit reversed CRC and data enters at the LSB,
+           so neither the input bytes nor the register need reversing per byte */
+        crc32 = u32_data_inversion(crc32_param[model].initial_value);
+        polynomial = u32_data_inversion(crc32_param[model].polynomial);
+        for (size_t i = 0; i < length; i++) {
+            crc32 ^= *input_data++;
+            for (uint8_t j = 0; j < 8; j++) {
+                crc32 = (uint32_t)((crc32 >> 1) ^ (polynomial & (0u - (crc32 & 1u))));
+            }
+        }
+        if (!crc32_param[model].output_inversion) {
+            crc32 = u32_data_inversion(crc32);
+        }
+    } else {
+        crc32 = crc32_param[model].initial_value;
+        polynomial = crc32_param[model].polynomial;
+        for (size_t i = 0; i < length; i++) {
+            crc32 ^= (uint32_t)*input_data++ << 24;
+            for (uint8_t j = 0; j < 8; j++) {
+                crc32 = (uint32_t)((crc32 << 1) ^ (polynomial & (0u - (crc32 >> 31))));
+            }
+        }
+        if (crc32_param[model].output_inversion) {
+            crc32 = u32_data_inversion(crc32);
+        }
+    }
+
+    crc32 ^= crc32_param[model].result_xor_value;
+    CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC32, model, CHECKSUM_STATS_BITWISE, length, stats_start);
+    return crc32;
+}
+#endif
+
+/**
+ * @brief The mirror mode computes the 32-bit wide CRC of the input data of a given length.
+ *
+ * @param param CRC32 reference model
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint32_t CRC32 result
+ */
+uint32_t crc32_calculate_mirror_mode(CRC32_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC32_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    CHECKSUM_STATS_BEGIN(stats_start);
+    uint32_t crc32 = crc32_param[model].initial_value;
+    uint32_t polynomial = u32_data_inversion(crc32_param[model].polynomial);
+    uint8_t data;
+
+    for (size_t i = 0; i < length; i++) {
+        data = *input_data++;
+        if (!crc32_param[model].input_inversion) {
+            data = u8_data_inversion(data);
+        }
+        crc32 ^= data;
+        for (uint8_t j = 0; j < 8; j++) {
+            if (crc32 & 0x00000001) {
+                crc32 >>= 1;
+                crc32 ^= polynomial; //  polynomial discard MSB or LSB because they are always 1, don't need to compute
+            } else {
+                crc32 >>= 1;
+            }
+
+        }
+    }
+
+    if (!crc32_param[model].output_inversion) {
+        crc32 = u32_data_inversion(crc32);
+    }
+
+    crc32 ^= crc32_param[model].result_xor_value;
+    CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC32, model, CHECKSUM_STATS_MIRROR, length, stats_start);
+    return crc32;
+}
+
+/**
+ * @brief CRC32 calculation method group package
+ *
+ * @param param CRC32 reference model
+ * @param input_data Packets of CRC32 to be computed, last byte of the array holds the CRC32 result
+ * @param length Length of the CRC32 packet
+ */
+void crc32_calculate_package(CRC32_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC32_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    uint32_t crc32_result = 0;
+    crc32_result = crc32_calculate(model, input_data, length - 4);
+
+    *(input_data + length - 4) = crc32_result & 0xFF;
+    *(input_data + length - 3) = (crc32_result >> 8) & 0xFF;
+    *(input_data + length - 2) = (crc32_result >> 16) & 0xFF;
+    *(input_data + length - 1) = (crc32_result >> 24) & 0xFF;
+}
+
+/* CRC32C_MODEL uses the SSE4.2 crc32 instruction when the CPU has it, checked once at run time */
+// #define CRC32_NO_HARDWARE
+#if !defined(CRC32_NO_HARDWARE) && defined(__GNUC__) && defined(__x86_64__)
+#define CRC32C_HARDWARE
+#include <nmmintrin.h>
+#include <wmmintrin.h>
+#include <string.h>
+
+/* bytes per lane of the 3-way interleaved kernel, long blocks first, then short ones */
+#define CRC32C_LONG 8192
+#define CRC32C_SHORT 256
+
+/* x^(8n-33) mod P (reflected), multiplying a CRC by one of them appends n zero bytes */
+#define CRC32C_SHIFT_LONG 0x54A86326        /* n = CRC32C_LONG */
+#define CRC32C_SHIFT_LONG2 0x1DC403CC       /* n = 2 * CRC32C_LONG */
+#define CRC32C_SHIFT_SHORT 0xB9E02B86       /* n = CRC32C_SHORT */
+#define CRC32C_SHIFT_SHORT2 0xDD7E3B0C      /* n = 2 * CRC32C_SHORT */
+
+static int crc32c_hardware = -1;
+
+/**
+ * @brief Checks once whether the CPU has the crc32 (SSE4.2) and carry-less multiply (PCLMUL) instructions
+ *
+ * @return true The hardware kernel can be used
+ * @return false Use the tables
+ */
+static bool crc32c_hardware_supported(void) {
+    if (crc32c_hardware < 0) {
+        __builtin_cpu_init();
+        crc32c_hardware = __builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("pclmul");
+    }
+    return crc32c_hardware;
+}
+
+/**
+ * @brief Shifts a CRC over n zero bytes: a carry-less multiply by x^(8n-33) mod P,
+ *        reduced back to 32 bits by the crc32 instruction
+ *
+ * @param crc CRC register
+ * @param shift CRC32C_SHIFT_* constant of n
+ * @return uint32_t The shifted CRC register
+ */
+__attribute__((target("sse4.2,pclmul")))
+static inline uint32_t crc32c_hardware_shift(uint32_t crc, uint32_t shift) {
+    __m128i product = _mm_clmulepi64_si128(_mm_cvtsi32_si128((int)crc), _mm_cvtsi32_si128((int)shift), 0x00);
+    return (uint32_t)_mm_crc32_u64(0, (uint64_t)_mm_cvtsi128_si64(product));
+}
+
+/**
+ * @brief Runs the CRC32C register over the input with the crc32 instruction. The
+ *        instruction has a latency of three cycles and a throughput of one, so three
+ *        independent lanes run over adjacent thirds of each block and are merged
+ *        by shifting the first two over the data that followed them.
+ *
+ * @param crc CRC register, initial value included and result xor value excluded
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint32_t CRC register
+ */
+__attribute__((target("sse4.2,pclmul")))
+static uint32_t crc32c_hardware_calculate(uint32_t crc, uint8_t *input_data, size_t length) {
+    uint8_t *p = input_data;
+    uint64_t crc0, crc1, crc2, word0, word1, word2;
+
+    while (length > 0 && ((uintptr_t)p & 7) != 0) {
+        crc = _mm_crc32_u8(crc, *p++);
+        length--;
+    }
+
+    while (length >= 3 * CRC32C_LONG) {
+        crc0 = crc;
+        crc1 = 0;
+        crc2 = 0;
+        for (size_t i = 0; i < CRC32C_LONG; i += 8) {
+            memcpy(&word0, p + i, 8);
+            memcpy(&word1, p + CRC32C_LONG + i, 8);
+            memcpy(&word2, p + 2 * CRC32C_LONG + i, 8);
+            crc0 = _mm_crc32_u64(crc0, word0);
+            crc1 = _mm_crc32_u64(crc1, word1);
+            crc2 = _mm_crc32_u64(crc2, word2);
+        }
+        crc = crc32c_hardware_shift((uint32_t)crc0, CRC32C_SHIFT_LONG2) ^
+              crc32c_hardware_shift((uint32_t)crc1, CRC32C_SHIFT_LONG) ^ (uint32_t)crc2;
+        p += 3 * CRC32C_LONG;
+        length -= 3 * CRC32C_LONG;
+    }
+
+    while (length >= 3 * CRC32C_SHORT) {
+        crc0 = crc;
+        crc1 = 0;
+        crc2 = 0;
+        for (size_t i = 0; i < CRC32C_SHORT; i += 8) {
+            memcpy(&word0, p + i, 8);
+            memcpy(&word1, p + CRC32C_SHORT + i, 8);
+            memcpy(&word2, p + 2 * CRC32C_SHORT + i, 8);
+            crc0 = _mm_crc32_u64(crc0, word0);
+            crc1 = _mm_crc32_u64(crc1, word1);
+            crc2 = _mm_crc32_u64(crc2, word2);
+        }
+        crc = crc32c_hardware_shift((uint32_t)crc0, CRC32C_SHIFT_SHORT2) ^
+              crc32c_hardware_shift((uint32_t)crc1, CRC32C_SHIFT_SHORT) ^ (uint32_t)crc2;
+        p += 3 * CRC32C_SHORT;
+        length -= 3 * CRC32C_SHORT;
+    }
+
+    crc0 = crc;
+    while (length >= 8) {
+        memcpy(&word0, p, 8);
+        crc0 = _mm_crc32_u64(crc0, word0);
+        p += 8;
+        length -= 8;
+    }
+    crc = (uint32_t)crc0;
+
+    while (length > 0) {
+        crc = _mm_crc32_u8(crc, *p++);
+        length--;
+    }
+
+    return crc;
+}
+#endif
+
+/**
+ * @brief Runs the CRC32 register over the input with the model's nibble table.
+ *
+ * @param model CRC32 reference model
+ * @param crc CRC32 register, initial value included and result xor value excluded
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint32_t CRC32 register
+ */
+static uint32_t crc32_nibble_table_update(CRC32_reference_model_e model, uint32_t crc, uint8_t *input_data, size_t length) {
+    const uint32_t *table = CRC32_NIBBLE_TABLE[model];
+    uint8_t *p = input_data;
+
+    if (crc32_param[model].input_inversion) {
+        for (size_t i = 0; i < length; i++) {
+            crc = (crc >> 4) ^ table[(crc ^ *p) & 0x0F];
+            crc = (crc >> 4) ^ table[(crc ^ (*p++ >> 4)) & 0x0F];
+        }
+    } else {
+        for (size_t i = 0; i < length; i++) {
+            crc = (crc << 4) ^ table[((crc >> 28) ^ (*p >> 4)) & 0x0F];
+            crc = (crc << 4) ^ table[((crc >> 28) ^ *p++) & 0x0F];
+        }
+    }
+
+    return crc;
+}
+
+/* failed lookup table checks are counted against the tables, whichever kernel ran */
+#ifdef CRC32_USE_NIBBLE_TABLE
+#define CRC32_STATS_LOOKUP CHECKSUM_STATS_NIBBLE
+#else
+#define CRC32_STATS_LOOKUP CHECKSUM_STATS_TABLE
+#endif
+
+/**
+ * @brief Runs the CRC32 register over the input with the model's software lookup table.
+ *
+ * @param model CRC32 reference model
+ * @param crc CRC32 register, initial value included and result xor value excluded
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint32_t CRC32 register
+ */
+static uint32_t crc32_table_update(CRC32_reference_model_e model, uint32_t crc, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(CRC32_MODEL_ENABLED(model));
+
+    CHECKSUM_STATS_BEGIN(stats_start);
+#ifdef CRC32_USE_NIBBLE_TABLE
+    crc = crc32_nibble_table_update(model, crc, input_data, length);
+    CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC32, model, CHECKSUM_STATS_NIBBLE, length, stats_start);
+    return crc;
+#else
+    uint8_t *p = input_data;
+    switch (model)
+    {
+#if CRC32_MODELS & CRC32_MODEL_BIT
+    case CRC32_MODEL:
+        for (size_t i = 0; i < length; i++) {
+            crc = (crc >> 8) ^ CRC32_MODEL_TABLE[(crc ^ *p++) & 0xFF];
+        }
+        break;
+#endif
+
+#if CRC32_MODELS & CRC32_MPEG2_MODEL_BIT
+    case CRC32_MPEG2_MODEL:
+        for (size_t i = 0; i < length; i++) {
+            crc = (crc << 8) ^ CRC32_MPEG2_MODEL_TABLE[(crc >> 24) ^ *p++];
+        }
+        break;
+#endif
+
+#if CRC32_MODELS & CRC32C_MODEL_BIT
+    case CRC32C_MODEL:
+        for (size_t i = 0; i < length; i++) {
+            crc = (crc >> 8) ^ CRC32C_MODEL_TABLE[(crc ^ *p++) & 0xFF];
+        }
+        break;
+#endif
+
+    default:
+        break;
+    }
+
+    CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC32, model, CHECKSUM_STATS_TABLE, length, stats_start);
+    return crc;
+#endif
+}
+
+/**
+ * @brief Runs the CRC32 register over the input with the model's lookup table, or the
+ *        crc32 instruction for CRC32C_MODEL when the CPU has it.
+ *
+ * @param model CRC32 reference model
+ * @param crc CRC32 register, initial value included and result xor value excluded
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint32_t CRC32 register
+ */
+static uint32_t crc32_lookup_table_update(CRC32_reference_model_e model, uint32_t crc, uint8_t *input_data, size_t length) {
+#ifdef CRC32C_HARDWARE
+    if (model == CRC32C_MODEL && crc32c_hardware_supported()) {
+        CHECKSUM_STATS_BEGIN(stats_start);
+        crc = crc32c_hardware_calculate(crc, input_data, length);
+        CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC32, model, CHECKSUM_STATS_HARDWARE, length, stats_start);
+        return crc;
+    }
+#endif
+    return crc32_table_update(model, crc, input_data, length);
+}
+
+/**
+ * @brief Calculates the 32 bit wide CRC of an input data of a given length with the model's lookup table.
+ *
+ * @param model CRC32 reference model
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint32_t CRC32 result
+ */
+static uint32_t crc32_lookup_table_calculate(CRC32_reference_model_e model, uint8_t *input_data, size_t length) {
+    return crc32_lookup_table_update(model, crc32_param[model].initial_value, input_data, length) ^ crc32_param[model].result_xor_value;
+}
+
+/* Lengths from which crc32_calculate switches to each kernel, per model; 0 leaves the kernel unused,
+   so everything runs bitwise until crc32_route_set or the autotuner sets thresholds */
+static size_t crc32_route_threshold[CRC32_NONE_MODEL][CRC32_KERNEL_NONE];
+
+#ifdef CHECKSUM_STATS
+static const checksum_stats_implementation_e crc32_kernel_stats[CRC32_KERNEL_NONE] = {
+    CHECKSUM_STATS_BITWISE, CHECKSUM_STATS_NIBBLE, CRC32_STATS_LOOKUP, CHECKSUM_STATS_HARDWARE,
+};
+#endif
+
+/**
+ * @brief Picks the kernel for a length: the last one whose threshold the length reaches
+ *
+ * @param model CRC32 reference model
+ * @param length Input length
+ * @return crc32_kernel_e Kernel
+ */
+static inline crc32_kernel_e crc32_route(CRC32_reference_model_e model, size_t length) {
+    crc32_kernel_e kernel = CRC32_KERNEL_BITWISE;
+    for (int k = CRC32_KERNEL_BITWISE + 1; k < CRC32_KERNEL_NONE; k++) {
+        if (crc32_route_threshold[model][k] != 0 && length >= crc32_route_threshold[model][k]) {
+            kernel = (crc32_kernel_e)k;
+        }
+    }
+    return kernel;
+}
+
+/**
+ * @brief Tells whether a kernel can run a model on this build and CPU
+ *
+ * @param model CRC32 reference model
+ * @param kernel CRC32 kernel
+ * @return true The kernel can be routed to
+ * @return false It would fall back to another kernel
+ */
+bool crc32_kernel_available(CRC32_reference_model_e model, crc32_kernel_e kernel) {
+    /* parameter checkout */
+    assert(model < CRC32_NONE_MODEL);
+
+    /* a model left out of CRC32_MODELS has no kernel at all */
+    if (!CRC32_MODEL_ENABLED(model)) {
+        return false;
+    }
+    if (kernel == CRC32_KERNEL_HARDWARE) {
+#ifdef CRC32C_HARDWARE
+        return model == CRC32C_MODEL && crc32c_hardware_supported();
+#else
+        return false;
+#endif
+    }
+    return kernel < CRC32_KERNEL_NONE;
+}
+
+/**
+ * @brief Calculates the 32 bit wide CRC of an input data of a given length with a chosen kernel.
+ *
+ * @param model CRC32 reference model
+ * @param kernel CRC32 kernel
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint32_t CRC32 result
+ */
+uint32_t crc32_kernel_calculate(CRC32_reference_model_e model, crc32_kernel_e kernel, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC32_NONE_MODEL);
+    assert(kernel < CRC32_KERNEL_NONE);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    switch (kernel)
+    {
+    case CRC32_KERNEL_NIBBLE:
+        return crc32_nibble_table_update(model, crc32_param[model].initial_value, input_data, length) ^ crc32_param[model].result_xor_value;
+
+    case CRC32_KERNEL_TABLE:
+        return crc32_table_update(model, crc32_param[model].initial_value, input_data, length) ^ crc32_param[model].result_xor_value;
+
+    case CRC32_KERNEL_HARDWARE:
+        return crc32_lookup_table_calculate(model, input_data, length);
+
+    default:
+#ifdef CRC_NO_BITWISE
+        return crc32_lookup_table_calculate(model, input_data, length);
+#else
+        return crc32_bitwise_calculate(model, input_data, length);
+#endif
+    }
+}
+
+/**
+ * @brief Sets the lengths from which crc32_calculate runs each kernel of a model. Not thread safe,
+ *        meant for start up before the CRC32 functions are in use.
+ *
+ * @param model CRC32 reference model
+ * @param threshold Shortest length per kernel, 0 for never; the bitwise entry is ignored and
+ *                  kernels not available are left unused
+ */
+void crc32_route_set(CRC32_reference_model_e model, const size_t threshold[CRC32_KERNEL_NONE]) {
+    /* parameter checkout */
+    assert(model < CRC32_NONE_MODEL);
+    assert(threshold != NULL);
+
+    crc32_route_threshold[model][CRC32_KERNEL_BITWISE] = 0;
+    for (int k = CRC32_KERNEL_BITWISE + 1; k < CRC32_KERNEL_NONE; k++) {
+        crc32_route_threshold[model][k] = crc32_kernel_available(model, (crc32_kernel_e)k) ? threshold[k] : 0;
+    }
+}
+
+/**
+ * @brief Gets the lengths from which crc32_calculate runs each kernel of a model
+ *
+ * @param model CRC32 reference model
+ * @param threshold Shortest length per kernel, 0 for never
+ */
+void crc32_route_get(CRC32_reference_model_e model, size_t threshold[CRC32_KERNEL_NONE]) {
+    /* parameter checkout */
+    assert(model < CRC32_NONE_MODEL);
+    assert(threshold != NULL);
+
+    for (int k = 0; k < CRC32_KERNEL_NONE; k++) {
+        threshold[k] = crc32_route_threshold[model][k];
+    }
+}
+
+/**
+ * @brief Gets the initial and result xor values of a model, as the CRC catalogues give them
+ *
+ * @param model CRC32 reference model
+ * @param initial_value Register before the message
+ * @param result_xor_value Xored onto the register at the end
+ */
+void crc32_param_get(CRC32_reference_model_e model, uint32_t *initial_value, uint32_t *result_xor_value) {
+    /* parameter checkout */
+    assert(model < CRC32_NONE_MODEL);
+    assert(initial_value != NULL);
+    assert(result_xor_value != NULL);
+
+    *initial_value = crc32_param[model].initial_value;
+    *result_xor_value = crc32_param[model].result_xor_value;
+}
+
+/**
+ * @brief Calculates the 32 bit wide CRC of an input data of a given length, with the kernel
+ *        routed for the length (bit by bit unless thresholds were set).
+ *
+ * @param param CRC32 reference model
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint32_t CRC32 result
+ */
+uint32_t crc32_calculate(CRC32_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC32_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    return crc32_kernel_calculate(model, crc32_route(model, length), input_data, length);
+}
+
+/**
+ * @brief CRC32 lookup table package
+ *
+ * @param param CRC32 reference model
+ * @param input_data Packets of CRC32 to be computed, last byte of the array holds the CRC32 result
+ * @param length Length of the CRC32 packet
+ */
+void crc32_lookup_table_package(CRC32_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC32_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    uint32_t crc32_result = 0;
+    crc32_result = crc32_lookup_table_calculate(model, input_data, length - 4);
+
+    *(input_data + length - 4) = crc32_result & 0xFF;
+    *(input_data + length - 3) = (crc32_result >> 8) & 0xFF;
+    *(input_data + length - 2) = (crc32_result >> 16) & 0xFF;
+    *(input_data + length - 1) = (crc32_result >> 24) & 0xFF;
+}
+
+/**
+ * @brief CRC32 calculation method package check
+ *
+ * @param param CRC32 reference model
+ * @param input_data CRC32 packages to check
+ * @param length Length of the CRC8 packet
+ * @return true CRC32 checks succeed
+ * @return false CRC32 checks fails
+ */
+bool crc32_package_check(CRC32_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC32_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    uint32_t crc32_actual_value = ((uint32_t)*(input_data + length - 1) << 24) | ((uint32_t)*(input_data + length - 2) << 16) | \
+                                    (uint32_t)(*(input_data + length - 3) << 8) | *(input_data + length - 4);
+    uint32_t crc32_result = 0;
+    crc32_result = crc32_calculate(model, input_data, length - 4);
+    if (crc32_result != crc32_actual_value) {
+        CHECKSUM_STATS_FAILURE(CHECKSUM_STATS_CRC32, model, crc32_kernel_stats[crc32_route(model, length - 4)]);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief CRC32 lookup table packages check
+ *
+ * @param param CRC32 reference model
+ * @param input_data CRC32 packages to check
+ * @param length Length of the CRC32 packet
+ * @return true CRC32 checks succeed
+ * @return false CRC32 checks fails
+ */
+bool crc32_lookup_table_package_check(CRC32_reference_model_e model, uint8_t *input_data, size_t length) {
+    assert(model <= CRC32_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    uint32_t crc32_result = 0;
+    uint32_t crc32_actual_value = ((uint32_t)*(input_data + length - 1) << 24) | ((uint32_t)*(input_data + length - 2) << 16) | \
+                                    (uint32_t)(*(input_data + length - 3) << 8) | *(input_data + length - 4);
+    crc32_result = crc32_lookup_table_calculate(model, input_data, length - 4);
+
+    if (crc32_result != crc32_actual_value) {
+        CHECKSUM_STATS_FAILURE(CHECKSUM_STATS_CRC32, model, CRC32_STATS_LOOKUP);
+        return false;
+    }
+    return true;
+}
+
+/* packages crc32_package_check_batch runs side by side, so the table loads of one
+   package overlap the dependent chain of the others */
+#define CRC32_BATCH_LANES 4
+
+/**
+ * @brief Runs four CRC32 registers over the same number of bytes of four inputs, interleaved.
+ *
+ * @param model CRC32 reference model
+ * @param crc CRC32 registers, initial value included and result xor value excluded
+ * @param input Inputs of the four registers
+ * @param length Bytes of each input
+ */
+static void crc32_table_update_lanes(CRC32_reference_model_e model, uint32_t crc[CRC32_BATCH_LANES],
+                                     uint8_t *const input[CRC32_BATCH_LANES], size_t length) {
+#ifdef CRC32_USE_NIBBLE_TABLE
+    for (int lane = 0; lane < CRC32_BATCH_LANES; lane++) {
+        crc[lane] = crc32_nibble_table_update(model, crc[lane], input[lane], length);
+    }
+#else
+    const uint32_t *table = CRC32_TABLE[model];
+    uint32_t crc0 = crc[0], crc1 = crc[1], crc2 = crc[2], crc3 = crc[3];
+    const uint8_t *p0 = input[0], *p1 = input[1], *p2 = input[2], *p3 = input[3];
+
+    assert(table != NULL);
+    if (model == CRC32_MPEG2_MODEL) {
+        for (size_t i = 0; i < length; i++) {
+            crc0 = (crc0 << 8) ^ table[(crc0 >> 24) ^ p0[i]];
+            crc1 = (crc1 << 8) ^ table[(crc1 >> 24) ^ p1[i]];
+            crc2 = (crc2 << 8) ^ table[(crc2 >> 24) ^ p2[i]];
+            crc3 = (crc3 << 8) ^ table[(crc3 >> 24) ^ p3[i]];
+        }
+    } else {
+        for (size_t i = 0; i < length; i++) {
+            crc0 = (crc0 >> 8) ^ table[(crc0 ^ p0[i]) & 0xFF];
+            crc1 = (crc1 >> 8) ^ table[(crc1 ^ p1[i]) & 0xFF];
+            crc2 = (crc2 >> 8) ^ table[(crc2 ^ p2[i]) & 0xFF];
+            crc3 = (crc3 >> 8) ^ table[(crc3 ^ p3[i]) & 0xFF];
+        }
+    }
+    crc[0] = crc0;
+    crc[1] = crc1;
+    crc[2] = crc2;
+    crc[3] = crc3;
+#endif
+}
+
+#ifdef CRC32C_HARDWARE
+/**
+ * @brief Runs four CRC32C registers over the same number of bytes of four inputs with the
+ *        crc32 instruction, one independent chain per input to cover its three cycle latency.
+ *
+ * @param crc CRC32C registers, initial value included and result xor value excluded
+ * @param input Inputs of the four registers
+ * @param length Bytes of each input
+ */
+__attribute__((target("sse4.2")))
+static void crc32c_hardware_lanes(uint32_t crc[CRC32_BATCH_LANES], uint8_t *const input[CRC32_BATCH_LANES], size_t length) {
+    uint64_t crc0 = crc[0], crc1 = crc[1], crc2 = crc[2], crc3 = crc[3], word0, word1, word2, word3;
+    const uint8_t *p0 = input[0], *p1 = input[1], *p2 = input[2], *p3 = input[3];
+    size_t i = 0;
+
+    for (; i + 8 <= length; i += 8) {
+        memcpy(&word0, p0 + i, 8);
+        memcpy(&word1, p1 + i, 8);
+        memcpy(&word2, p2 + i, 8);
+        memcpy(&word3, p3 + i, 8);
+        crc0 = _mm_crc32_u64(crc0, word0);
+        crc1 = _mm_crc32_u64(crc1, word1);
+        crc2 = _mm_crc32_u64(crc2, word2);
+        crc3 = _mm_crc32_u64(crc3, word3);
+    }
+    for (; i < length; i++) {
+        crc0 = _mm_crc32_u8((uint32_t)crc0, p0[i]);
+        crc1 = _mm_crc32_u8((uint32_t)crc1, p1[i]);
+        crc2 = _mm_crc32_u8((uint32_t)crc2, p2[i]);
+        crc3 = _mm_crc32_u8((uint32_t)crc3, p3[i]);
+    }
+    crc[0] = (uint32_t)crc0;
+    crc[1] = (uint32_t)crc1;
+    crc[2] = (uint32_t)crc2;
+    crc[3] = (uint32_t)crc3;
+}
+#endif
+
+/**
+ * @brief Checks a batch of CRC32 packages of any lengths, such as the datagrams of one receive call:
+ *        four packages at a time run side by side over their common length with the lookup table
+ *        (or the crc32 instruction for CRC32C_MODEL), then each finishes alone.
+ *        The result of each package is that of crc32_lookup_table_package_check.
+ *
+ * @param model CRC32 reference model
+ * @param packages CRC32 packages to check
+ * @param lengths Length of each CRC32 package, the CRC32 in the last four bytes, more than four
+ * @param count Number of packages
+ * @param valid (count + 63) / 64 words, bit i % 64 of word i / 64 set when package i checks
+ */
+void crc32_package_check_batch(CRC32_reference_model_e model, uint8_t *const *packages, const size_t *lengths,
+                               size_t count, uint64_t *valid) {
+    /* parameter checkout */
+    assert(model < CRC32_NONE_MODEL);
+    assert(packages != NULL || count == 0);
+    assert(lengths != NULL || count == 0);
+    assert(valid != NULL || count == 0);
+
+    const uint32_t initial_value = crc32_param[model].initial_value;
+    const uint32_t result_xor_value = crc32_param[model].result_xor_value;
+    uint32_t crc[CRC32_BATCH_LANES];
+    size_t i = 0;
+
+    memset(valid, 0, (count + 63) / 64 * sizeof(uint64_t));
+    for (; i < count; i += CRC32_BATCH_LANES) {
+        size_t lanes = (count - i < CRC32_BATCH_LANES) ? count - i : CRC32_BATCH_LANES;
+        size_t common = 0;
+
+        for (size_t lane = 0; lane < CRC32_BATCH_LANES; lane++) {
+            crc[lane] = initial_value;
+        }
+        if (lanes == CRC32_BATCH_LANES) {
+            common = lengths[i] - 4;
+            for (size_t lane = 1; lane < CRC32_BATCH_LANES; lane++) {
+                assert(lengths[i + lane] > 4);
+                if (lengths[i + lane] - 4 < common) {
+                    common = lengths[i + lane] - 4;
+                }
+            }
+            CHECKSUM_STATS_BEGIN(stats_start);
+#ifdef CRC32C_HARDWARE
+            if (model == CRC32C_MODEL && crc32c_hardware_supported()) {
+                crc32c_hardware_lanes(crc, packages + i, common);
+                CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC32, model, CHECKSUM_STATS_HARDWARE, CRC32_BATCH_LANES * common, stats_start);
+            } else
+#endif
+            {
+                crc32_table_update_lanes(model, crc, packages + i, common);
+                CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC32, model, CRC32_STATS_LOOKUP, CRC32_BATCH_LANES * common, stats_start);
+            }
+        }
+
+        for (size_t lane = 0; lane < lanes; lane++) {
+            uint8_t *input_data = packages[i + lane];
+            size_t length = lengths[i + lane];
+            assert(input_data != NULL);
+            assert(length > 4);
+
+            if (length - 4 > common) {
+                crc[lane] = crc32_lookup_table_update(model, crc[lane], input_data + common, length - 4 - common);
+            }
+            uint32_t crc32_actual_value = ((uint32_t)*(input_data + length - 1) << 24) | ((uint32_t)*(input_data + length - 2) << 16) | \
+                                            (uint32_t)(*(input_data + length - 3) << 8) | *(input_data + length - 4);
+            if ((crc[lane] ^ result_xor_value) == crc32_actual_value) {
+                valid[(i + lane) / 64] |= (uint64_t)1 << ((i + lane) % 64);
+            } else {
+                CHECKSUM_STATS_FAILURE(CHECKSUM_STATS_CRC32, model, CRC32_STATS_LOOKUP);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Starts a streaming CRC32 computation
+ *
+ * @param ctx CRC32 streaming context
+ * @param model CRC32 reference model
+ */
+void crc32_init(crc32_ctx *ctx, CRC32_reference_model_e model) {
+    /* parameter checkout */
+    assert(ctx != NULL);
+    assert(model < CRC32_NONE_MODEL);
+
+    ctx->model = model;
+    ctx->crc = crc32_param[model].initial_value;
+}
+
+/**
+ * @brief Adds input data to a streaming CRC32 computation, with the model's lookup table
+ *
+ * @param ctx CRC32 streaming context
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ */
+void crc32_update(crc32_ctx *ctx, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(ctx != NULL);
+    assert(input_data != NULL || length == 0);
+
+    ctx->crc = crc32_lookup_table_update(ctx->model, ctx->crc, input_data, length);
+}
+
+/**
+ * @brief Copies input data and adds it to a streaming CRC32 computation in one pass, such as a payload
+ *        into its frame buffer: every chunk is checksummed while it sits in the L1 cache and copied
+ *        from there, with non-temporal stores for long copies
+ *
+ * @param ctx CRC32 streaming context
+ * @param destination Destination, not overlapping the source
+ * @param source Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ */
+void crc32_copy(crc32_ctx *ctx, uint8_t *destination, const uint8_t *source, size_t length) {
+    /* parameter checkout */
+    assert(ctx != NULL);
+    assert((destination != NULL && source != NULL) || length == 0);
+
+    bool nontemporal = length >= CHECKSUM_COPY_NONTEMPORAL;
+    while (length > 0) {
+        size_t chunk = (length < CHECKSUM_COPY_CHUNK) ? length : CHECKSUM_COPY_CHUNK;
+        ctx->crc = crc32_lookup_table_update(ctx->model, ctx->crc, (uint8_t *)source, chunk);
+        checksum_copy_chunk(destination, source, chunk, nontemporal);
+        destination += chunk;
+        source += chunk;
+        length -= chunk;
+    }
+    checksum_copy_fence(nontemporal);
+}
+
+/**
+ * @brief Finishes a streaming CRC32 computation
+ *
+ * @param ctx CRC32 streaming context
+ * @return uint32_t CRC32 result, the same as crc32_calculate over all the input data
+ */
+uint32_t crc32_final(crc32_ctx *ctx) {
+    /* parameter checkout */
+    assert(ctx != NULL);
+
+    return (ctx->crc ^ crc32_param[ctx->model].result_xor_value);
+}
+
+#ifndef CHECKSUM_NO_MAIN
+#define TEST
+#endif
+#ifdef TEST
+#include <stdio.h>
+#include <string.h>
+
+static void print_crc32_table(CRC32_reference_model_e model);
+
+/* CRC32C buffer, large enough for the long interleaved blocks */
+#define CRC32C_TEST_BYTES (128 * 1024)
+#define CRC32C_TEST_LONG 8192
+/* ragged packages of the batch check */
+#define BATCH_TEST_COUNT 203
+#define BATCH_TEST_MAX 300
+
+int main() {
+    uint8_t input_data[14] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x08};
+#if 0
+    uint32_t crc32_model = crc32_calculate(CRC32_MODEL, input_data, 10);
+    uint32_t crc32_mpeg2_model = crc32_calculate(CRC32_MPEG2_MODEL, input_data, 10);
+
+    uint32_t mirror_crc32_model = crc32_calculate_mirror_mode(CRC32_MODEL, input_data, 10);
+    uint32_t mirror_crc32_mpeg2_model = crc32_calculate_mirror_mode(CRC32_MPEG2_MODEL, input_data, 10);
+
+    printf("---------------------------crc32_calculate result-----------------------\n");
+    printf("crc32_model result = 0x%08x\n", crc32_model);
+    printf("crc32_mpeg2_model result = 0x%08x\n", crc32_mpeg2_model);
+
+    printf("---------------------crc32_calculate_mirror_mode result------------------\n");
+    printf("mirror_crc32_model result = 0x%08x\n", mirror_crc32_model);
+    printf("mirror_crc32_mpeg2_model result = 0x%08x\n", mirror_crc32_mpeg2_model);
+#endif
+
+#if 0
+    print_crc32_table(CRC32_MODEL);
+    print_crc32_table(CRC32_MPEG2_MODEL);
+#endif
+#if 0
+    uint32_t crc32_result = 0;
+    bool crc32_check_result = false;
+    printf("data:[");
+    for (int i; i < sizeof(input_data)/sizeof(input_data[0]); i++) {
+        printf("0x%02x, ", input_data[i]);
+    }
+    printf("]\n");
+
+    crc32_calculate_package(CRC32_MODEL, input_data, 14);
+    crc32_result = (input_data[13] << 24) | (input_data[12] << 16) | (input_data[11] << 8) | input_data[10];
+    printf("crc32_calculate_package CRC32_MODEL result = 0x%08x\n", crc32_result);
+    crc32_check_result = crc32_package_check(CRC32_MODEL, input_data, 14);
+    if (crc32_check_result) {
+        printf("crc32_calculate_package CRC32_MODEL check succeed.\n");
+    } else {
+        printf("crc32_calculate_package CRC32_MODEL check fail.\n");
+    }
+
+    crc32_calculate_package(CRC32_MPEG2_MODEL, input_data, 14);
+    crc32_result = (input_data[13] << 24) | (input_data[12] << 16) | (input_data[11] << 8) | input_data[10];
+    printf("crc32_calculate_package CRC32_MPEG2_MODEL result = 0x%08x\n", crc32_result);
+    crc32_check_result = crc32_package_check(CRC32_MPEG2_MODEL, input_data, 14);
+    if (crc32_check_result) {
+        printf("crc32_calculate_package CRC32_MPEG2_MODEL check succeed.\n");
+    } else {
+        printf("crc32_calculate_package CRC32_MPEG2_MODEL check fail.\n");
+    }
+#endif
+
+#if 0
+    uint32_t crc32_result = 0;
+    bool crc32_check_result = false;
+
+    crc32_lookup_table_package(CRC32_MODEL, input_data, 14);
+    crc32_result = (input_data[13] << 24) | (input_data[12] << 16) | (input_data[11] << 8) | input_data[10];
+    printf("crc32_lookup_table_package CRC32_MODEL result = 0x%04x\n", crc32_result);
+    crc32_check_result = crc32_lookup_table_package_check(CRC32_MODEL, input_data, 14);
+    if (crc32_check_result) {
+        printf("crc32_calculate_package CRC32_MODEL check succeed.\n");
+    } else {
+        printf("crc32_calculate_package CRC32_MODEL check fail.\n");
+    }
+
+    crc32_lookup_table_package(CRC32_MPEG2_MODEL, input_data, 14);
+    crc32_result = (input_data[13] << 24) | (input_data[12] << 16) | (input_data[11] << 8) | input_data[10];
+    printf("crc32_lookup_table_package CRC32_MPEG2_MODEL result = 0x%04x\n", crc32_result);
+    crc32_check_result = crc32_lookup_table_package_check(CRC32_MPEG2_MODEL, input_data, 14);
+    if (crc32_check_result) {
+        printf("crc32_calculate_package CRC32_MPEG2_MODEL check succeed.\n");
+    } else {
+        printf("crc32_calculate_package CRC32_MPEG2_MODEL check fail.\n");
+    }
+#endif
+#if 1
+    printf("---------CRC32 nibble table-----------\n");
+    uint8_t nibble_data[64];
+    memset(nibble_data, 0x5A, sizeof(nibble_data));
+    crc32_lookup_table_package(CRC32_MODEL, nibble_data, sizeof(nibble_data));
+    if (crc32_kernel_calculate(CRC32_MODEL, CRC32_KERNEL_NIBBLE, nibble_data, sizeof(nibble_data) - 4) == crc32_calculate(CRC32_MODEL, nibble_data, sizeof(nibble_data) - 4) &&
+        crc32_lookup_table_package_check(CRC32_MODEL, nibble_data, sizeof(nibble_data))) {
+        printf("CRC32_MODEL nibble table check succeed.\n");
+    } else {
+        printf("CRC32_MODEL nibble table check fail.\n");
+    }
+    memset(nibble_data, 0x5A, sizeof(nibble_data));
+    crc32_lookup_table_package(CRC32_MPEG2_MODEL, nibble_data, sizeof(nibble_data));
+    if (crc32_kernel_calculate(CRC32_MPEG2_MODEL, CRC32_KERNEL_NIBBLE, nibble_data, sizeof(nibble_data) - 4) == crc32_calculate(CRC32_MPEG2_MODEL, nibble_data, sizeof(nibble_data) - 4) &&
+        crc32_lookup_table_package_check(CRC32_MPEG2_MODEL, nibble_data, sizeof(nibble_data))) {
+        printf("CRC32_MPEG2_MODEL nibble table check succeed.\n");
+    } else {
+        printf("CRC32_MPEG2_MODEL nibble table check fail.\n");
+    }
+#endif
+
+#if 1
+    printf("---------CRC32C-----------\n");
+    static uint8_t crc32c_data[CRC32C_TEST_BYTES];
+    uint8_t check_data[] = "123456789";
+    bool crc32c_succeed = true;
+
+    for (size_t i = 0; i < CRC32C_TEST_BYTES; i++) {
+        crc32c_data[i] = (uint8_t)((i * 2654435761u) >> 13);
+    }
+    if (crc32_lookup_table_calculate(CRC32C_MODEL, check_data, 9) != 0xE3069283 ||
+        crc32_calculate(CRC32C_MODEL, check_data, 9) != 0xE3069283) {
+        crc32c_succeed = false;
+    }
+    /* every kernel stage and alignment against the bitwise engine */
+    for (size_t length = 1; length < 3 * 3 * CRC32C_TEST_LONG; length = length * 3 / 2 + 1) {
+        for (size_t offset = 0; offset < 8; offset += 3) {
+            if (crc32_lookup_table_calculate(CRC32C_MODEL, crc32c_data + offset, length) !=
+                crc32_calculate(CRC32C_MODEL, crc32c_data + offset, length)) {
+                crc32c_succeed = false;
+            }
+        }
+    }
+    printf("CRC32C_MODEL check %s.\n", crc32c_succeed ? "succeed" : "fail");
+#endif
+
+#if 1
+    printf("---------CRC32 package check batch-----------\n");
+    static uint8_t batch_data[BATCH_TEST_COUNT][BATCH_TEST_MAX];
+    static uint8_t *batch_packages[BATCH_TEST_COUNT];
+    static size_t batch_lengths[BATCH_TEST_COUNT];
+    uint64_t batch_valid[(BATCH_TEST_COUNT + 63) / 64];
+    const char *model_name[CRC32_NONE_MODEL] = {"CRC32_MODEL", "CRC32_MPEG2_MODEL", "CRC32C_MODEL"};
+
+    for (CRC32_reference_model_e model = CRC32_MODEL; model < CRC32_NONE_MODEL; model++) {
+        bool batch_succeed = true;
+        uint32_t seed = 12345;
+
+        /* ragged lengths and every seventh package damaged, the odd count leaves a partial group */
+        for (size_t i = 0; i < BATCH_TEST_COUNT; i++) {
+            seed = seed * 1103515245u + 12345u;
+            batch_lengths[i] = 5 + (seed >> 8) % (BATCH_TEST_MAX - 5);
+            batch_packages[i] = batch_data[i];
+            for (size_t j = 0; j < batch_lengths[i]; j++) {
+                batch_data[i][j] = (uint8_t)(seed >> (j % 24));
+            }
+            crc32_lookup_table_package(model, batch_data[i], batch_lengths[i]);
+            if (i % 7 == 3) {
+                batch_data[i][(seed >> 4) % batch_lengths[i]] ^= 0x10;
+            }
+        }
+        crc32_package_check_batch(model, batch_packages, batch_lengths, BATCH_TEST_COUNT, batch_valid);
+        for (size_t i = 0; i < BATCH_TEST_COUNT; i++) {
+            bool expected = crc32_lookup_table_package_check(model, batch_packages[i], batch_lengths[i]);
+            if (expected != (i % 7 != 3) || expected != ((batch_valid[i / 64] >> (i % 64)) & 1)) {
+                batch_succeed = false;
+            }
+        }
+        printf("%s package check batch %s.\n", model_name[model], batch_succeed ? "succeed" : "fail");
+    }
+#endif
+
+#if 1
+    printf("---------CRC32 copy-----------\n");
+    /* two pieces per copy, into a misaligned destination; the longest one past the non-temporal threshold */
+    static uint8_t copy_source[2 * 1024 * 1024 + 7];
+    static uint8_t copy_destination[sizeof(copy_source) + 1];
+    const size_t copy_length[] = {0, 1, 7, 4096, 4097, 10000, sizeof(copy_source)};
+    bool copy_succeed = true;
+
+    for (size_t i = 0; i < sizeof(copy_source); i++) {
+        copy_source[i] = (uint8_t)((i * 2654435761u) >> 13);
+    }
+    for (CRC32_reference_model_e model = CRC32_MODEL; model < CRC32_NONE_MODEL; model++) {
+        for (size_t i = 0; i < sizeof(copy_length) / sizeof(copy_length[0]); i++) {
+            crc32_ctx ctx, copy_ctx;
+            size_t first = copy_length[i] / 3;
+
+            memset(copy_destination, 0, sizeof(copy_destination));
+            crc32_init(&ctx, model);
+            crc32_update(&ctx, copy_source, copy_length[i]);
+            crc32_init(&copy_ctx, model);
+            crc32_copy(&copy_ctx, copy_destination + 1, copy_source, first);
+            crc32_copy(&copy_ctx, copy_destination + 1 + first, copy_source + first, copy_length[i] - first);
+            if (crc32_final(&ctx) != crc32_final(&copy_ctx) || memcmp(copy_destination + 1, copy_source, copy_length[i]) != 0) {
+                copy_succeed = false;
+            }
+        }
+    }
+    printf("crc32_copy check %s.\n", copy_succeed ? "succeed" : "fail");
+#endif
+    return 0;
+}
+
+static void print_crc32_table(CRC32_reference_model_e model) {
+    uint32_t crc32_result = 0;
+    uint8_t i = 0;
+    switch (model)
+    {
+    case CRC32_MODEL:
+        printf("/* Reference Model:CRC32_MODEL */\n");
+        printf("static const uint32_t CRC32_MODEL_TABLE[256] = {\n");
+        break;
+
+    case CRC32_MPEG2_MODEL:
+        printf("/* Reference Model:CRC32_MPEG2_MODEL */\n");
+        printf("static const uint32_t CRC32_MPEG2_MODEL_TABLE[256] = {\n");
+        break;
+
+    case CRC32C_MODEL:
+        printf("/* Reference Model:CRC32C_MODEL */\n");
+        printf("static const uint32_t CRC32C_MODEL_TABLE[256] = {\n");
+        break;
+
+    default:
+        break;
+    }
+    for (int j = 0; j <= 0xFF; j++, i++) {
+        if (crc32_param[model].input_inversion == true && crc32_param[model].output_inversion == true) {
+            crc32_result = crc32_calculate_mirror_mode(model, &i, 1);
+        } else {
+            crc32_result = crc32_calculate(model, &i, 1);
+        }
+        if (i % 8 == 0) {
+            printf("    ");
+        } else {
+            printf(" ");
+        }
+        printf("0x%08X", crc32_result);
+        if (i != 0xFF) {
+            printf(",");
+        }
+        if ((i + 1) % 8 == 0) {
+            printf("\n");
+        }
+    }
+    printf("};\n");
+}
+#endif
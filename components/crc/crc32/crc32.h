@@ -1,28 +1,56 @@
-#ifndef __CRC32_H__
-#define __CRC32_H__
-
-#include <stdint.h>
-#include <stdbool.h>
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-typedef enum {
-    CRC32_MODEL = 0,
-    CRC32_MPEG2_MODEL,
-    CRC32_NONE_MODEL,
-}CRC32_reference_model_e;
-
-uint32_t crc32_calculate(CRC32_reference_model_e model, uint8_t *input_data, size_t length);
-uint32_t crc32_calculate_mirror_mode(CRC32_reference_model_e model, uint8_t *input_data, size_t length);
-void crc32_calculate_package(CRC32_reference_model_e model, uint8_t *input_data, size_t length);
-void crc32_lookup_table_package(CRC32_reference_model_e model, uint8_t *input_data, size_t length);
-bool crc32_package_check(CRC32_reference_model_e model, uint8_t *input_data, size_t length);
-bool crc32_lookup_table_package_check(CRC32_reference_model_e model, uint8_t *input_data, size_t length);
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif /* __CRC32_H__ */
+#ifndef __CRC32_H__
+#define __CRC32_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    CRC32_MODEL = 0,
+    CRC32_MPEG2_MODEL,
+    CRC32C_MODEL,
+    CRC32_NONE_MODEL,
+}CRC32_reference_model_e;
+
+/* Kernels crc32_calculate routes between by length, see crc32_route_set */
+typedef enum {
+    CRC32_KERNEL_BITWISE = 0, /* bit by bit, the reference */
+    CRC32_KERNEL_NIBBLE,      /* 16 entry table, two lookups per byte */
+    CRC32_KERNEL_TABLE,       /* 256 entry table, the 16 entry one with CRC32_USE_NIBBLE_TABLE */
+    CRC32_KERNEL_HARDWARE,    /* SSE4.2 crc32 instruction, CRC32C_MODEL only */
+    CRC32_KERNEL_NONE,
+} crc32_kernel_e;
+
+/* Streaming CRC32 computation, the same result as crc32_calculate over all the updates joined */
+typedef struct {
+    CRC32_reference_model_e model;
+    uint32_t crc;                /* CRC32 register, result xor value not yet applied */
+} crc32_ctx;
+
+uint32_t crc32_calculate(CRC32_reference_model_e model, uint8_t *input_data, size_t length);
+uint32_t crc32_calculate_mirror_mode(CRC32_reference_model_e model, uint8_t *input_data, size_t length);
+void crc32_calculate_package(CRC32_reference_model_e model, uint8_t *input_data, size_t length);
+void crc32_lookup_table_package(CRC32_reference_model_e model, uint8_t *input_data, size_t length);
+bool crc32_package_check(CRC32_reference_model_e model, uint8_t *input_data, size_t length);
+bool crc32_lookup_table_package_check(CRC32_reference_model_e model, uint8_t *input_data, size_t length);
+void crc32_package_check_batch(CRC32_reference_model_e model, uint8_t *const *packages, const size_t *lengths,
+                               size_t count, uint64_t *valid);
+void crc32_init(crc32_ctx *ctx, CRC32_reference_model_e model);
+void crc32_update(crc32_ctx *ctx, uint8_t *input_data, size_t length);
+void crc32_copy(crc32_ctx *ctx, uint8_t *destination, const uint8_t *source, size_t length);
+uint32_t crc32_final(crc32_ctx *ctx);
+bool crc32_kernel_available(CRC32_reference_model_e model, crc32_kernel_e kernel);
+uint32_t crc32_kernel_calculate(CRC32_reference_model_e model, crc32_kernel_e kernel, uint8_t *input_data, size_t length);
+void crc32_route_set(CRC32_reference_model_e model, const size_t threshold[CRC32_KERNEL_NONE]);
+void crc32_route_get(CRC32_reference_model_e model, size_t threshold[CRC32_KERNEL_NONE]);
+void crc32_param_get(CRC32_reference_model_e model, uint32_t *initial_value, uint32_t *result_xor_value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CRC32_H__ */
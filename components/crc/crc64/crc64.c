@@ -0,0 +1,1154 @@
+/**
+ * @file crc64.c
+ * @brief Cyclic Redundancy Check (CRC64)
+ * @copyright Copyright (c) 2023
+ */
+#include "crc64.h"
+#include "../crc_config/crc_config.h"
+#include "../../checksum_stats/checksum_stats.h"
+#include "../../checksum_copy/checksum_copy.h"
+#include <assert.h>
+#include <string.h>
+
+#if CRC64_MODELS & CRC64_ECMA182_MODEL_BIT
+/* Reference Model:CRC64_ECMA182_MODEL */
+static const uint64_t CRC64_ECMA182_MODEL_TABLE[256] = {
+    0x0000000000000000ULL, 0x42F0E1EBA9EA3693ULL, 0x85E1C3D753D46D26ULL, 0xC711223CFA3E5BB5ULL,
+    0x493366450E42ECDFULL, 0x0BC387AEA7A8DA4CULL, 0xCCD2A5925D9681F9ULL, 0x8E224479F47CB76AULL,
+    0x9266CC8A1C85D9BEULL, 0xD0962D61B56FEF2DULL, 0x17870F5D4F51B498ULL, 0x5577EEB6E6BB820BULL,
+    0xDB55AACF12C73561ULL, 0x99A54B24BB2D03F2ULL, 0x5EB4691841135847ULL, 0x1C4488F3E8F96ED4ULL,
+    0x663D78FF90E185EFULL, 0x24CD9914390BB37CULL, 0xE3DCBB28C335E8C9ULL, 0xA12C5AC36ADFDE5AULL,
+    0x2F0E1EBA9EA36930ULL, 0x6DFEFF5137495FA3ULL, 0xAAEFDD6DCD770416ULL, 0xE81F3C86649D3285ULL,
+    0xF45BB4758C645C51ULL, 0xB6AB559E258E6AC2ULL, 0x71BA77A2DFB03177ULL, 0x334A9649765A07E4ULL,
+    0xBD68D2308226B08EULL, 0xFF9833DB2BCC861DULL, 0x388911E7D1F2DDA8ULL, 0x7A79F00C7818EB3BULL,
+    0xCC7AF1FF21C30BDEULL, 0x8E8A101488293D4DULL, 0x499B3228721766F8ULL, 0x0B6BD3C3DBFD506BULL,
+    0x854997BA2F81E701ULL, 0xC7B97651866BD192ULL, 0x00A8546D7C558A27ULL, 0x4258B586D5BFBCB4ULL,
+    0x5E1C3D753D46D260ULL, 0x1CECDC9E94ACE4F3ULL, 0xDBFDFEA26E92BF46ULL, 0x990D1F49C77889D5ULL,
+    0x172F5B3033043EBFULL, 0x55DFBADB9AEE082CULL, 0x92CE98E760D05399ULL, 0xD03E790CC93A650AULL,
+    0xAA478900B1228E31ULL, 0xE8B768EB18C8B8A2ULL, 0x2FA64AD7E2F6E317ULL, 0x6D56AB3C4B1CD584ULL,
+    0xE374EF45BF6062EEULL, 0xA1840EAE168A547DULL, 0x66952C92ECB40FC8ULL, 0x2465CD79455E395BULL,
+    0x3821458AADA7578FULL, 0x7AD1A461044D611CULL, 0xBDC0865DFE733AA9ULL, 0xFF3067B657990C3AULL,
+    0x711223CFA3E5BB50ULL, 0x33E2C2240A0F8DC3ULL, 0xF4F3E018F031D676ULL, 0xB60301F359DBE0E5ULL,
+    0xDA050215EA6C212FULL, 0x98F5E3FE438617BCULL, 0x5FE4C1C2B9B84C09ULL, 0x1D14202910527A9AULL,
+    0x93366450E42ECDF0ULL, 0xD1C685BB4DC4FB63ULL, 0x16D7A787B7FAA0D6ULL, 0x5427466C1E109645ULL,
+    0x4863CE9FF6E9F891ULL, 0x0A932F745F03CE02ULL, 0xCD820D48A53D95B7ULL, 0x8F72ECA30CD7A324ULL,
+    0x0150A8DAF8AB144EULL, 0x43A04931514122DDULL, 0x84B16B0DAB7F7968ULL, 0xC6418AE602954FFBULL,
+    0xBC387AEA7A8DA4C0ULL, 0xFEC89B01D3679253ULL, 0x39D9B93D2959C9E6ULL, 0x7B2958D680B3FF75ULL,
+    0xF50B1CAF74CF481FULL, 0xB7FBFD44DD257E8CULL, 0x70EADF78271B2539ULL, 0x321A3E938EF113AAULL,
+    0x2E5EB66066087D7EULL, 0x6CAE578BCFE24BEDULL, 0xABBF75B735DC1058ULL, 0xE94F945C9C3626CBULL,
+    0x676DD025684A91A1ULL, 0x259D31CEC1A0A732ULL, 0xE28C13F23B9EFC87ULL, 0xA07CF2199274CA14ULL,
+    0x167FF3EACBAF2AF1ULL, 0x548F120162451C62ULL, 0x939E303D987B47D7ULL, 0xD16ED1D631917144ULL,
+    0x5F4C95AFC5EDC62EULL, 0x1DBC74446C07F0BDULL, 0xDAAD56789639AB08ULL, 0x985DB7933FD39D9BULL,
+    0x84193F60D72AF34FULL, 0xC6E9DE8B7EC0C5DCULL, 0x01F8FCB784FE9E69ULL, 0x43081D5C2D14A8FAULL,
+    0xCD2A5925D9681F90ULL, 0x8FDAB8CE70822903ULL, 0x48CB9AF28ABC72B6ULL, 0x0A3B7B1923564425ULL,
+    0x70428B155B4EAF1EULL, 0x32B26AFEF2A4998DULL, 0xF5A348C2089AC238ULL, 0xB753A929A170F4ABULL,
+    0x3971ED50550C43C1ULL, 0x7B810CBBFCE67552ULL, 0xBC902E8706D82EE7ULL, 0xFE60CF6CAF321874ULL,
+    0xE224479F47CB76A0ULL, 0xA0D4A674EE214033ULL, 0x67C58448141F1B86ULL, 0x253565A3BDF52D15ULL,
+    0xAB1721DA49899A7FULL, 0xE9E7C031E063ACECULL, 0x2EF6E20D1A5DF759ULL, 0x6C0603E6B3B7C1CAULL,
+    0xF6FAE5C07D3274CDULL, 0xB40A042BD4D8425EULL, 0x731B26172EE619EBULL, 0x31EBC7FC870C2F78ULL,
+    0xBFC9838573709812ULL, 0xFD39626EDA9AAE81ULL, 0x3A28405220A4F534ULL, 0x78D8A1B9894EC3A7ULL,
+    0x649C294A61B7AD73ULL, 0x266CC8A1C85D9BE0ULL, 0xE17DEA9D3263C055ULL, 0xA38D0B769B89F6C6ULL,
+    0x2DAF4F0F6FF541ACULL, 0x6F5FAEE4C61F773FULL, 0xA84E8CD83C212C8AULL, 0xEABE6D3395CB1A19ULL,
+    0x90C79D3FEDD3F122ULL, 0xD2377CD44439C7B1ULL, 0x15265EE8BE079C04ULL, 0x57D6BF0317EDAA97ULL,
+    0xD9F4FB7AE3911DFDULL, 0x9B041A914A7B2B6EULL, 0x5C1538ADB04570DBULL, 0x1EE5D94619AF4648ULL,
+    0x02A151B5F156289CULL, 0x4051B05E58BC1E0FULL, 0x87409262A28245BAULL, 0xC5B073890B687329ULL,
+    0x4B9237F0FF14C443ULL, 0x0962D61B56FEF2D0ULL, 0xCE73F427ACC0A965ULL, 0x8C8315CC052A9FF6ULL,
+    0x3A80143F5CF17F13ULL, 0x7870F5D4F51B4980ULL, 0xBF61D7E80F251235ULL, 0xFD913603A6CF24A6ULL,
+    0x73B3727A52B393CCULL, 0x31439391FB59A55FULL, 0xF652B1AD0167FEEAULL, 0xB4A25046A88DC879ULL,
+    0xA8E6D8B54074A6ADULL, 0xEA16395EE99E903EULL, 0x2D071B6213A0CB8BULL, 0x6FF7FA89BA4AFD18ULL,
+    0xE1D5BEF04E364A72ULL, 0xA3255F1BE7DC7CE1ULL, 0x64347D271DE22754ULL, 0x26C49CCCB40811C7ULL,
+    0x5CBD6CC0CC10FAFCULL, 0x1E4D8D2B65FACC6FULL, 0xD95CAF179FC497DAULL, 0x9BAC4EFC362EA149ULL,
+    0x158E0A85C2521623ULL, 0x577EEB6E6BB820B0ULL, 0x906FC95291867B05ULL, 0xD29F28B9386C4D96ULL,
+    0xCEDBA04AD0952342ULL, 0x8C2B41A1797F15D1ULL, 0x4B3A639D83414E64ULL, 0x09CA82762AAB78F7ULL,
+    0x87E8C60FDED7CF9DULL, 0xC51827E4773DF90EULL, 0x020905D88D03A2BBULL, 0x40F9E43324E99428ULL,
+    0x2CFFE7D5975E55E2ULL, 0x6E0F063E3EB46371ULL, 0xA91E2402C48A38C4ULL, 0xEBEEC5E96D600E57ULL,
+    0x65CC8190991CB93DULL, 0x273C607B30F68FAEULL, 0xE02D4247CAC8D41BULL, 0xA2DDA3AC6322E288ULL,
+    0xBE992B5F8BDB8C5CULL, 0xFC69CAB42231BACFULL, 0x3B78E888D80FE17AULL, 0x7988096371E5D7E9ULL,
+    0xF7AA4D1A85996083ULL, 0xB55AACF12C735610ULL, 0x724B8ECDD64D0DA5ULL, 0x30BB6F267FA73B36ULL,
+    0x4AC29F2A07BFD00DULL, 0x08327EC1AE55E69EULL, 0xCF235CFD546BBD2BULL, 0x8DD3BD16FD818BB8ULL,
+    0x03F1F96F09FD3CD2ULL, 0x41011884A0170A41ULL, 0x86103AB85A2951F4ULL, 0xC4E0DB53F3C36767ULL,
+    0xD8A453A01B3A09B3ULL, 0x9A54B24BB2D03F20ULL, 0x5D45907748EE6495ULL, 0x1FB5719CE1045206ULL,
+    0x919735E51578E56CULL, 0xD367D40EBC92D3FFULL, 0x1476F63246AC884AULL, 0x568617D9EF46BED9ULL,
+    0xE085162AB69D5E3CULL, 0xA275F7C11F7768AFULL, 0x6564D5FDE549331AULL, 0x279434164CA30589ULL,
+    0xA9B6706FB8DFB2E3ULL, 0xEB46918411358470ULL, 0x2C57B3B8EB0BDFC5ULL, 0x6EA7525342E1E956ULL,
+    0x72E3DAA0AA188782ULL, 0x30133B4B03F2B111ULL, 0xF7021977F9CCEAA4ULL, 0xB5F2F89C5026DC37ULL,
+    0x3BD0BCE5A45A6B5DULL, 0x79205D0E0DB05DCEULL, 0xBE317F32F78E067BULL, 0xFCC19ED95E6430E8ULL,
+    0x86B86ED5267CDBD3ULL, 0xC4488F3E8F96ED40ULL, 0x0359AD0275A8B6F5ULL, 0x41A94CE9DC428066ULL,
+    0xCF8B0890283E370CULL, 0x8D7BE97B81D4019FULL, 0x4A6ACB477BEA5A2AULL, 0x089A2AACD2006CB9ULL,
+    0x14DEA25F3AF9026DULL, 0x562E43B4931334FEULL, 0x913F6188692D6F4BULL, 0xD3CF8063C0C759D8ULL,
+    0x5DEDC41A34BBEEB2ULL, 0x1F1D25F19D51D821ULL, 0xD80C07CD676F8394ULL, 0x9AFCE626CE85B507ULL
+};
+#endif
+#if CRC64_MODELS & CRC64_XZ_MODEL_BIT
+/* Reference Model:CRC64_XZ_MODEL */
+static const uint64_t CRC64_XZ_MODEL_TABLE[256] = {
+    0x0000000000000000ULL, 0xB32E4CBE03A75F6FULL, 0xF4843657A840A05BULL, 0x47AA7AE9ABE7FF34ULL,
+    0x7BD0C384FF8F5E33ULL, 0xC8FE8F3AFC28015CULL, 0x8F54F5D357CFFE68ULL, 0x3C7AB96D5468A107ULL,
+    0xF7A18709FF1EBC66ULL, 0x448FCBB7FCB9E309ULL, 0x0325B15E575E1C3DULL, 0xB00BFDE054F94352ULL,
+    0x8C71448D0091E255ULL, 0x3F5F08330336BD3AULL, 0x78F572DAA8D1420EULL, 0xCBDB3E64AB761D61ULL,
+    0x7D9BA13851336649ULL, 0xCEB5ED8652943926ULL, 0x891F976FF973C612ULL, 0x3A31DBD1FAD4997DULL,
+    0x064B62BCAEBC387AULL, 0xB5652E02AD1B6715ULL, 0xF2CF54EB06FC9821ULL, 0x41E11855055BC74EULL,
+    0x8A3A2631AE2DDA2FULL, 0x39146A8FAD8A8540ULL, 0x7EBE1066066D7A74ULL, 0xCD905CD805CA251BULL,
+    0xF1EAE5B551A2841CULL, 0x42C4A90B5205DB73ULL, 0x056ED3E2F9E22447ULL, 0xB6409F5CFA457B28ULL,
+    0xFB374270A266CC92ULL, 0x48190ECEA1C193FDULL, 0x0FB374270A266CC9ULL, 0xBC9D3899098133A6ULL,
+    0x80E781F45DE992A1ULL, 0x33C9CD4A5E4ECDCEULL, 0x7463B7A3F5A932FAULL, 0xC74DFB1DF60E6D95ULL,
+    0x0C96C5795D7870F4ULL, 0xBFB889C75EDF2F9BULL, 0xF812F32EF538D0AFULL, 0x4B3CBF90F69F8FC0ULL,
+    0x774606FDA2F72EC7ULL, 0xC4684A43A15071A8ULL, 0x83C230AA0AB78E9CULL, 0x30EC7C140910D1F3ULL,
+    0x86ACE348F355AADBULL, 0x3582AFF6F0F2F5B4ULL, 0x7228D51F5B150A80ULL, 0xC10699A158B255EFULL,
+    0xFD7C20CC0CDAF4E8ULL, 0x4E526C720F7DAB87ULL, 0x09F8169BA49A54B3ULL, 0xBAD65A25A73D0BDCULL,
+    0x710D64410C4B16BDULL, 0xC22328FF0FEC49D2ULL, 0x85895216A40BB6E6ULL, 0x36A71EA8A7ACE989ULL,
+    0x0ADDA7C5F3C4488EULL, 0xB9F3EB7BF06317E1ULL, 0xFE5991925B84E8D5ULL, 0x4D77DD2C5823B7BAULL,
+    0x64B62BCAEBC387A1ULL, 0xD7986774E864D8CEULL, 0x90321D9D438327FAULL, 0x231C512340247895ULL,
+    0x1F66E84E144CD992ULL, 0xAC48A4F017EB86FDULL, 0xEBE2DE19BC0C79C9ULL, 0x58CC92A7BFAB26A6ULL,
+    0x9317ACC314DD3BC7ULL, 0x2039E07D177A64A8ULL, 0x67939A94BC9D9B9CULL, 0xD4BDD62ABF3AC4F3ULL,
+    0xE8C76F47EB5265F4ULL, 0x5BE923F9E8F53A9BULL, 0x1C4359104312C5AFULL, 0xAF6D15AE40B59AC0ULL,
+    0x192D8AF2BAF0E1E8ULL, 0xAA03C64CB957BE87ULL, 0xEDA9BCA512B041B3ULL, 0x5E87F01B11171EDCULL,
+    0x62FD4976457FBFDBULL, 0xD1D305C846D8E0B4ULL, 0x96797F21ED3F1F80ULL, 0x2557339FEE9840EFULL,
+    0xEE8C0DFB45EE5D8EULL, 0x5DA24145464902E1ULL, 0x1A083BACEDAEFDD5ULL, 0xA9267712EE09A2BAULL,
+    0x955CCE7FBA6103BDULL, 0x267282C1B9C65CD2ULL, 0x61D8F8281221A3E6ULL, 0xD2F6B4961186FC89ULL,
+    0x9F8169BA49A54B33ULL, 0x2CAF25044A02145CULL, 0x6B055FEDE1E5EB68ULL, 0xD82B1353E242B407ULL,
+    0xE451AA3EB62A1500ULL, 0x577FE680B58D4A6FULL, 0x10D59C691E6AB55BULL, 0xA3FBD0D71DCDEA34ULL,
+    0x6820EEB3B6BBF755ULL, 0xDB0EA20DB51CA83AULL, 0x9CA4D8E41EFB570EULL, 0x2F8A945A1D5C0861ULL,
+    0x13F02D374934A966ULL, 0xA0DE61894A93F609ULL, 0xE7741B60E174093DULL, 0x545A57DEE2D35652ULL,
+    0xE21AC88218962D7AULL, 0x5134843C1B317215ULL, 0x169EFED5B0D68D21ULL, 0xA5B0B26BB371D24EULL,
+    0x99CA0B06E7197349ULL, 0x2AE447B8E4BE2C26ULL, 0x6D4E3D514F59D312ULL, 0xDE6071EF4CFE8C7DULL,
+    0x15BB4F8BE788911CULL, 0xA6950335E42FCE73ULL, 0xE13F79DC4FC83147ULL, 0x521135624C6F6E28ULL,
+    0x6E6B8C0F1807CF2FULL, 0xDD45C0B11BA09040ULL, 0x9AEFBA58B0476F74ULL, 0x29C1F6E6B3E0301BULL,
+    0xC96C5795D7870F42ULL, 0x7A421B2BD420502DULL, 0x3DE861C27FC7AF19ULL, 0x8EC62D7C7C60F076ULL,
+    0xB2BC941128085171ULL, 0x0192D8AF2BAF0E1EULL, 0x4638A2468048F12AULL, 0xF516EEF883EFAE45ULL,
+    0x3ECDD09C2899B324ULL, 0x8DE39C222B3EEC4BULL, 0xCA49E6CB80D9137FULL, 0x7967AA75837E4C10ULL,
+    0x451D1318D716ED17ULL, 0xF6335FA6D4B1B278ULL, 0xB199254F7F564D4CULL, 0x02B769F17CF11223ULL,
+    0xB4F7F6AD86B4690BULL, 0x07D9BA1385133664ULL, 0x4073C0FA2EF4C950ULL, 0xF35D8C442D53963FULL,
+    0xCF273529793B3738ULL, 0x7C0979977A9C6857ULL, 0x3BA3037ED17B9763ULL, 0x888D4FC0D2DCC80CULL,
+    0x435671A479AAD56DULL, 0xF0783D1A7A0D8A02ULL, 0xB7D247F3D1EA7536ULL, 0x04FC0B4DD24D2A59ULL,
+    0x3886B22086258B5EULL, 0x8BA8FE9E8582D431ULL, 0xCC0284772E652B05ULL, 0x7F2CC8C92DC2746AULL,
+    0x325B15E575E1C3D0ULL, 0x8175595B76469CBFULL, 0xC6DF23B2DDA1638BULL, 0x75F16F0CDE063CE4ULL,
+    0x498BD6618A6E9DE3ULL, 0xFAA59ADF89C9C28CULL, 0xBD0FE036222E3DB8ULL, 0x0E21AC88218962D7ULL,
+    0xC5FA92EC8AFF7FB6ULL, 0x76D4DE52895820D9ULL, 0x317EA4BB22BFDFEDULL, 0x8250E80521188082ULL,
+    0xBE2A516875702185ULL, 0x0D041DD676D77EEAULL, 0x4AAE673FDD3081DEULL, 0xF9802B81DE97DEB1ULL,
+    0x4FC0B4DD24D2A599ULL, 0xFCEEF8632775FAF6ULL, 0xBB44828A8C9205C2ULL, 0x086ACE348F355AADULL,
+    0x34107759DB5DFBAAULL, 0x873E3BE7D8FAA4C5ULL, 0xC094410E731D5BF1ULL, 0x73BA0DB070BA049EULL,
+    0xB86133D4DBCC19FFULL, 0x0B4F7F6AD86B4690ULL, 0x4CE50583738CB9A4ULL, 0xFFCB493D702BE6CBULL,
+    0xC3B1F050244347CCULL, 0x709FBCEE27E418A3ULL, 0x3735C6078C03E797ULL, 0x841B8AB98FA4B8F8ULL,
+    0xADDA7C5F3C4488E3ULL, 0x1EF430E13FE3D78CULL, 0x595E4A08940428B8ULL, 0xEA7006B697A377D7ULL,
+    0xD60ABFDBC3CBD6D0ULL, 0x6524F365C06C89BFULL, 0x228E898C6B8B768BULL, 0x91A0C532682C29E4ULL,
+    0x5A7BFB56C35A3485ULL, 0xE955B7E8C0FD6BEAULL, 0xAEFFCD016B1A94DEULL, 0x1DD181BF68BDCBB1ULL,
+    0x21AB38D23CD56AB6ULL, 0x9285746C3F7235D9ULL, 0xD52F0E859495CAEDULL, 0x6601423B97329582ULL,
+    0xD041DD676D77EEAAULL, 0x636F91D96ED0B1C5ULL, 0x24C5EB30C5374EF1ULL, 0x97EBA78EC690119EULL,
+    0xAB911EE392F8B099ULL, 0x18BF525D915FEFF6ULL, 0x5F1528B43AB810C2ULL, 0xEC3B640A391F4FADULL,
+    0x27E05A6E926952CCULL, 0x94CE16D091CE0DA3ULL, 0xD3646C393A29F297ULL, 0x604A2087398EADF8ULL,
+    0x5C3099EA6DE60CFFULL, 0xEF1ED5546E415390ULL, 0xA8B4AFBDC5A6ACA4ULL, 0x1B9AE303C601F3CBULL,
+    0x56ED3E2F9E224471ULL, 0xE5C372919D851B1EULL, 0xA26908783662E42AULL, 0x114744C635C5BB45ULL,
+    0x2D3DFDAB61AD1A42ULL, 0x9E13B115620A452DULL, 0xD9B9CBFCC9EDBA19ULL, 0x6A978742CA4AE576ULL,
+    0xA14CB926613CF817ULL, 0x1262F598629BA778ULL, 0x55C88F71C97C584CULL, 0xE6E6C3CFCADB0723ULL,
+    0xDA9C7AA29EB3A624ULL, 0x69B2361C9D14F94BULL, 0x2E184CF536F3067FULL, 0x9D36004B35545910ULL,
+    0x2B769F17CF112238ULL, 0x9858D3A9CCB67D57ULL, 0xDFF2A94067518263ULL, 0x6CDCE5FE64F6DD0CULL,
+    0x50A65C93309E7C0BULL, 0xE388102D33392364ULL, 0xA4226AC498DEDC50ULL, 0x170C267A9B79833FULL,
+    0xDCD7181E300F9E5EULL, 0x6FF954A033A8C131ULL, 0x28532E49984F3E05ULL, 0x9B7D62F79BE8616AULL,
+    0xA707DB9ACF80C06DULL, 0x14299724CC279F02ULL, 0x5383EDCD67C06036ULL, 0xE0ADA17364673F59ULL
+};
+#endif
+#if CRC64_MODELS & CRC64_GO_ISO_MODEL_BIT
+/* Reference Model:CRC64_GO_ISO_MODEL */
+static const uint64_t CRC64_GO_ISO_MODEL_TABLE[256] = {
+    0x0000000000000000ULL, 0x01B0000000000000ULL, 0x0360000000000000ULL, 0x02D0000000000000ULL,
+    0x06C0000000000000ULL, 0x0770000000000000ULL, 0x05A0000000000000ULL, 0x0410000000000000ULL,
+    0x0D80000000000000ULL, 0x0C30000000000000ULL, 0x0EE0000000000000ULL, 0x0F50000000000000ULL,
+    0x0B40000000000000ULL, 0x0AF0000000000000ULL, 0x0820000000000000ULL, 0x0990000000000000ULL,
+    0x1B00000000000000ULL, 0x1AB0000000000000ULL, 0x1860000000000000ULL, 0x19D0000000000000ULL,
+    0x1DC0000000000000ULL, 0x1C70000000000000ULL, 0x1EA0000000000000ULL, 0x1F10000000000000ULL,
+    0x1680000000000000ULL, 0x1730000000000000ULL, 0x15E0000000000000ULL, 0x1450000000000000ULL,
+    0x1040000000000000ULL, 0x11F0000000000000ULL, 0x1320000000000000ULL, 0x1290000000000000ULL,
+    0x3600000000000000ULL, 0x37B0000000000000ULL, 0x3560000000000000ULL, 0x34D0000000000000ULL,
+    0x30C0000000000000ULL, 0x3170000000000000ULL, 0x33A0000000000000ULL, 0x3210000000000000ULL,
+    0x3B80000000000000ULL, 0x3A30000000000000ULL, 0x38E0000000000000ULL, 0x3950000000000000ULL,
+    0x3D40000000000000ULL, 0x3CF0000000000000ULL, 0x3E20000000000000ULL, 0x3F90000000000000ULL,
+    0x2D00000000000000ULL, 0x2CB0000000000000ULL, 0x2E60000000000000ULL, 0x2FD0000000000000ULL,
+    0x2BC0000000000000ULL, 0x2A70000000000000ULL, 0x28A0000000000000ULL, 0x2910000000000000ULL,
+    0x2080000000000000ULL, 0x2130000000000000ULL, 0x23E0000000000000ULL, 0x2250000000000000ULL,
+    0x2640000000000000ULL, 0x27F0000000000000ULL, 0x2520000000000000ULL, 0x2490000000000000ULL,
+    0x6C00000000000000ULL, 0x6DB0000000000000ULL, 0x6F60000000000000ULL, 0x6ED0000000000000ULL,
+    0x6AC0000000000000ULL, 0x6B70000000000000ULL, 0x69A0000000000000ULL, 0x6810000000000000ULL,
+    0x6180000000000000ULL, 0x6030000000000000ULL, 0x62E0000000000000ULL, 0x6350000000000000ULL,
+    0x6740000000000000ULL, 0x66F0000000000000ULL, 0x6420000000000000ULL, 0x6590000000000000ULL,
+    0x7700000000000000ULL, 0x76B0000000000000ULL, 0x7460000000000000ULL, 0x75D0000000000000ULL,
+    0x71C0000000000000ULL, 0x7070000000000000ULL, 0x72A0000000000000ULL, 0x7310000000000000ULL,
+    0x7A80000000000000ULL, 0x7B30000000000000ULL, 0x79E0000000000000ULL, 0x7850000000000000ULL,
+    0x7C40000000000000ULL, 0x7DF0000000000000ULL, 0x7F20000000000000ULL, 0x7E90000000000000ULL,
+    0x5A00000000000000ULL, 0x5BB0000000000000ULL, 0x5960000000000000ULL, 0x58D0000000000000ULL,
+    0x5CC0000000000000ULL, 0x5D70000000000000ULL, 0x5FA0000000000000ULL, 0x5E10000000000000ULL,
+    0x5780000000000000ULL, 0x5630000000000000ULL, 0x54E0000000000000ULL, 0x5550000000000000ULL,
+    0x5140000000000000ULL, 0x50F0000000000000ULL, 0x5220000000000000ULL, 0x5390000000000000ULL,
+    0x4100000000000000ULL, 0x40B0000000000000ULL, 0x4260000000000000ULL, 0x43D0000000000000ULL,
+    0x47C0000000000000ULL, 0x4670000000000000ULL, 0x44A0000000000000ULL, 0x4510000000000000ULL,
+    0x4C80000000000000ULL, 0x4D30000000000000ULL, 0x4FE0000000000000ULL, 0x4E50000000000000ULL,
+    0x4A40000000000000ULL, 0x4BF0000000000000ULL, 0x4920000000000000ULL, 0x4890000000000000ULL,
+    0xD800000000000000ULL, 0xD9B0000000000000ULL, 0xDB60000000000000ULL, 0xDAD0000000000000ULL,
+    0xDEC0000000000000ULL, 0xDF70000000000000ULL, 0xDDA0000000000000ULL, 0xDC10000000000000ULL,
+    0xD580000000000000ULL, 0xD430000000000000ULL, 0xD6E0000000000000ULL, 0xD750000000000000ULL,
+    0xD340000000000000ULL, 0xD2F0000000000000ULL, 0xD020000000000000ULL, 0xD190000000000000ULL,
+    0xC300000000000000ULL, 0xC2B0000000000000ULL, 0xC060000000000000ULL, 0xC1D0000000000000ULL,
+    0xC5C0000000000000ULL, 0xC470000000000000ULL, 0xC6A0000000000000ULL, 0xC710000000000000ULL,
+    0xCE80000000000000ULL, 0xCF30000000000000ULL, 0xCDE0000000000000ULL, 0xCC50000000000000ULL,
+    0xC840000000000000ULL, 0xC9F0000000000000ULL, 0xCB20000000000000ULL, 0xCA90000000000000ULL,
+    0xEE00000000000000ULL, 0xEFB0000000000000ULL, 0xED60000000000000ULL, 0xECD0000000000000ULL,
+    0xE8C0000000000000ULL, 0xE970000000000000ULL, 0xEBA0000000000000ULL, 0xEA10000000000000ULL,
+    0xE380000000000000ULL, 0xE230000000000000ULL, 0xE0E0000000000000ULL, 0xE150000000000000ULL,
+    0xE540000000000000ULL, 0xE4F0000000000000ULL, 0xE620000000000000ULL, 0xE790000000000000ULL,
+    0xF500000000000000ULL, 0xF4B0000000000000ULL, 0xF660000000000000ULL, 0xF7D0000000000000ULL,
+    0xF3C0000000000000ULL, 0xF270000000000000ULL, 0xF0A0000000000000ULL, 0xF110000000000000ULL,
+    0xF880000000000000ULL, 0xF930000000000000ULL, 0xFBE0000000000000ULL, 0xFA50000000000000ULL,
+    0xFE40000000000000ULL, 0xFFF0000000000000ULL, 0xFD20000000000000ULL, 0xFC90000000000000ULL,
+    0xB400000000000000ULL, 0xB5B0000000000000ULL, 0xB760000000000000ULL, 0xB6D0000000000000ULL,
+    0xB2C0000000000000ULL, 0xB370000000000000ULL, 0xB1A0000000000000ULL, 0xB010000000000000ULL,
+    0xB980000000000000ULL, 0xB830000000000000ULL, 0xBAE0000000000000ULL, 0xBB50000000000000ULL,
+    0xBF40000000000000ULL, 0xBEF0000000000000ULL, 0xBC20000000000000ULL, 0xBD90000000000000ULL,
+    0xAF00000000000000ULL, 0xAEB0000000000000ULL, 0xAC60000000000000ULL, 0xADD0000000000000ULL,
+    0xA9C0000000000000ULL, 0xA870000000000000ULL, 0xAAA0000000000000ULL, 0xAB10000000000000ULL,
+    0xA280000000000000ULL, 0xA330000000000000ULL, 0xA1E0000000000000ULL, 0xA050000000000000ULL,
+    0xA440000000000000ULL, 0xA5F0000000000000ULL, 0xA720000000000000ULL, 0xA690000000000000ULL,
+    0x8200000000000000ULL, 0x83B0000000000000ULL, 0x8160000000000000ULL, 0x80D0000000000000ULL,
+    0x84C0000000000000ULL, 0x8570000000000000ULL, 0x87A0000000000000ULL, 0x8610000000000000ULL,
+    0x8F80000000000000ULL, 0x8E30000000000000ULL, 0x8CE0000000000000ULL, 0x8D50000000000000ULL,
+    0x8940000000000000ULL, 0x88F0000000000000ULL, 0x8A20000000000000ULL, 0x8B90000000000000ULL,
+    0x9900000000000000ULL, 0x98B0000000000000ULL, 0x9A60000000000000ULL, 0x9BD0000000000000ULL,
+    0x9FC0000000000000ULL, 0x9E70000000000000ULL, 0x9CA0000000000000ULL, 0x9D10000000000000ULL,
+    0x9480000000000000ULL, 0x9530000000000000ULL, 0x97E0000000000000ULL, 0x9650000000000000ULL,
+    0x9240000000000000ULL, 0x93F0000000000000ULL, 0x9120000000000000ULL, 0x9090000000000000ULL
+};
+#endif
+
+/* http://www.ip33.com/crc.html */
+/* polynomial discard MSB or LSB because they are always 1 */
+typedef struct {
+    uint64_t initial_value;
+    uint64_t result_xor_value;
+    uint64_t polynomial;
+    bool input_inversion;
+    bool output_inversion;
+} crc64_param_t;
+
+// #define PRINT_TABLE
+#ifndef PRINT_TABLE
+static crc64_param_t crc64_param[] = {
+    {0x0000000000000000, 0x0000000000000000, 0x42F0E1EBA9EA3693, false, false},     // Reference Model:CRC64_ECMA182_MODEL
+    {0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x42F0E1EBA9EA3693, true, true},       // Reference Model:CRC64_XZ_MODEL
+    {0xFFFFFFFFFFFFFFFF, 0xFFFFFFFFFFFFFFFF, 0x000000000000001B, true, true},       // Reference Model:CRC64_GO_ISO_MODEL
+};
+#else
+/* Generate table usage */
+static crc64_param_t crc64_param[] = {
+    {0x0000000000000000, 0x0000000000000000, 0x42F0E1EBA9EA3693, false, false},     // Reference Model:CRC64_ECMA182_MODEL
+    {0x0000000000000000, 0x0000000000000000, 0x42F0E1EBA9EA3693, true, true},       // Reference Model:CRC64_XZ_MODEL
+    {0x0000000000000000, 0x0000000000000000, 0x000000000000001B, true, true},       // Reference Model:CRC64_GO_ISO_MODEL
+};
+#endif
+
+/* byte tables by model, NULL for the models left out of the build */
+static const uint64_t *const CRC64_TABLE[CRC64_NONE_MODEL] = {
+#if CRC64_MODELS & CRC64_ECMA182_MODEL_BIT
+    CRC64_ECMA182_MODEL_TABLE,
+#else
+    NULL,
+#endif
+#if CRC64_MODELS & CRC64_XZ_MODEL_BIT
+    CRC64_XZ_MODEL_TABLE,
+#else
+    NULL,
+#endif
+#if CRC64_MODELS & CRC64_GO_ISO_MODEL_BIT
+    CRC64_GO_ISO_MODEL_TABLE,
+#else
+    NULL,
+#endif
+};
+
+/* LOAD_LE64/LOAD_BE64 read a little/big endian 64 bit word from a byte pointer */
+#define LOAD_LE64(p) (((uint64_t)(p)[7] << 56) | ((uint64_t)(p)[6] << 48) | ((uint64_t)(p)[5] << 40) | \
+                      ((uint64_t)(p)[4] << 32) | ((uint64_t)(p)[3] << 24) | ((uint64_t)(p)[2] << 16) | \
+                      ((uint64_t)(p)[1] << 8) | (uint64_t)(p)[0])
+#define LOAD_BE64(p) (((uint64_t)(p)[0] << 56) | ((uint64_t)(p)[1] << 48) | ((uint64_t)(p)[2] << 40) | \
+                      ((uint64_t)(p)[3] << 32) | ((uint64_t)(p)[4] << 24) | ((uint64_t)(p)[5] << 16) | \
+                      ((uint64_t)(p)[6] << 8) | (uint64_t)(p)[7])
+
+#ifndef CRC_NO_SLICING
+/* Slicing-by-8 tables 1..7 (table 0 is the byte table): entry i of table k is the
+   CRC of byte i followed by k zero bytes. 14 KiB per model, so they are generated
+   from the byte table on first use instead of being stored, and only for the models
+   compiled in. */
+static uint64_t crc64_slice_table[CRC_MODEL_COUNT(CRC64_MODELS)][7][256];
+static bool crc64_slice_table_ready[CRC_MODEL_COUNT(CRC64_MODELS)];
+#endif
+
+/* CRC64 models use PCLMULQDQ folding when the CPU has it, checked once at run time */
+// #define CRC64_NO_HARDWARE
+#if !defined(CRC64_NO_HARDWARE) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CRC64_CLMUL
+#include <immintrin.h>
+
+/* shorter inputs are left to slicing-by-8 */
+#define CRC64_CLMUL_MIN_LENGTH 128
+
+/* Folding constants per model, {multiplier of the low, of the high 64 bits} for folding
+   a 128 bit block over 16, 32, 48 and 64 bytes. Normal models: x^(8d) and x^(8d+64) mod P.
+   Reflected models: x^(8d+63) and x^(8d-1) mod P, bit reversed. */
+static const uint64_t CRC64_FOLD_CONSTANT[CRC64_NONE_MODEL][4][2] = {
+    {{0x05F5C3C7EB52FAB6ULL, 0x4EB938A7D257740EULL}, {0x571BEE0A227EF92BULL, 0x44BEF2A201B5200CULL},
+     {0x54819D8713758B2CULL, 0x4A6B90073EB0AF5AULL}, {0x5F6843CA540DF020ULL, 0xDDF4B6981205B83FULL}},     // Reference Model:CRC64_ECMA182_MODEL
+    {{0xE05DD497CA393AE4ULL, 0xDABE95AFC7875F40ULL}, {0x60095B008A9EFA44ULL, 0x3BE653A30FE1AF51ULL},
+     {0xB5EA1AF9C013ACA4ULL, 0x69A35D91C3730254ULL}, {0x6AE3EFBB9DD441F3ULL, 0x081F6054A7842DF4ULL}},     // Reference Model:CRC64_XZ_MODEL
+    {{0x6B70000000000001ULL, 0xF500000000000001ULL}, {0x1B1AB00000000001ULL, 0xA011000000000001ULL},
+     {0x76DB6C7000000001ULL, 0xE145150000000001ULL}, {0x01B001B1B0000001ULL, 0xB100010100000001ULL}},     // Reference Model:CRC64_GO_ISO_MODEL
+};
+
+static int crc64_clmul = -1;
+
+/**
+ * @brief Checks once whether the CPU has the carry-less multiply (PCLMUL) and byte shuffle (SSSE3) instructions
+ *
+ * @return true The folding kernel can be used
+ * @return false Use the tables
+ */
+static bool crc64_clmul_supported(void) {
+    if (crc64_clmul < 0) {
+        __builtin_cpu_init();
+        crc64_clmul = __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3");
+    }
+    return crc64_clmul;
+}
+#endif
+
+/**
+ * @brief uint64_t type bit reverse
+ *
+ * @param data Data to be reversed
+ * @return uint64_t The reversed data
+ */
+static inline uint64_t u64_bit_reverse(uint64_t data) {
+#if defined(__GNUC__) && defined(__aarch64__)
+    __asm__("rbit %0, %1" : "=r"(data) : "r"(data));
+    return data;
+#else
+    data = ((data >> 1) & 0x5555555555555555ULL) | ((data & 0x5555555555555555ULL) << 1);
+    data = ((data >> 2) & 0x3333333333333333ULL) | ((data & 0x3333333333333333ULL) << 2);
+    data = ((data >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((data & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    data = ((data >> 8) & 0x00FF00FF00FF00FFULL) | ((data & 0x00FF00FF00FF00FFULL) << 8);
+    data = ((data >> 16) & 0x0000FFFF0000FFFFULL) | ((data & 0x0000FFFF0000FFFFULL) << 16);
+    return (data >> 32) | (data << 32);
+#endif
+}
+
+/**
+ * @brief uint8_t type data inversion
+ *
+ * @param data Data to be reversed
+ * @return uint8_t The reversed data
+ */
+static uint8_t u8_data_inversion(uint8_t data) {
+    return (uint8_t)(u64_bit_reverse(data) >> 56);
+}
+
+/**
+ * @brief uint64_t type data inversion
+ *
+ * @param data Data to be reversed
+ * @return uint64_t The reversed data
+ */
+static uint64_t u64_data_inversion(uint64_t data) {
+    return u64_bit_reverse(data);
+}
+
+#ifndef CRC_NO_BITWISE
+/**
+ * @brief Calculates the 64 bit wide CRC of an input data of a given length bit by bit.
+ *
+ * @param param CRC64 reference model
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint64_t CRC64 result
+ */
+static uint64_t crc64_bitwise_calculate(CRC64_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC64_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    CHECKSUM_STATS_BEGIN(stats_start);
+    uint64_t crc64;
+    uint64_t polynomial;
+
+    if (crc64_param[model].input_inversion) {
+        /* reflected domain: the register holds the bit reversed CRC and data enters at the LSB,
+           so neither the input bytes nor the register need reversing per byte */
+        crc64 = u64_data_inversion(crc64_param[model].initial_value);
+        polynomial = u64_data_inversion(crc64_param[model].polynomial);
+        for (size_t i = 0; i < length; i++) {
+            crc64 ^= *input_data++;
+            for (uint8_t j = 0; j < 8; j++) {
+                crc64 = (crc64 >> 1) ^ (polynomial & (0u - (crc64 & 1u)));
+            }
+        }
+        if (!crc64_param[model].output_inversion) {
+            crc64 = u64_data_inversion(crc64);
+        }
+    } else {
+        crc64 = crc64_param[model].initial_value;
+        polynomial = crc64_param[model].polynomial;
+        for (size_t i = 0; i < length; i++) {
+            crc64 ^= (uint64_t)*input_data++ << 56;
+            for (uint8_t j = 0; j < 8; j++) {
+                crc64 = (crc64 << 1) ^ (polynomial & ((uint64_t)0 - (crc64 >> 63)));
+            }
+        }
+        if (crc64_param[model].output_inversion) {
+            crc64 = u64_data_inversion(crc64);
+        }
+    }
+
+    crc64 ^= crc64_param[model].result_xor_value;
+    CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC64, model, CHECKSUM_STATS_BITWISE, length, stats_start);
+    return crc64;
+}
+#endif
+
+/**
+ * @brief The mirror mode computes the 64-bit wide CRC of the input data of a given length.
+ *
+ * @param param CRC64 reference model
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint64_t CRC64 result
+ */
+uint64_t crc64_calculate_mirror_mode(CRC64_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC64_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    CHECKSUM_STATS_BEGIN(stats_start);
+    uint64_t crc64 = crc64_param[model].initial_value;
+    uint64_t polynomial = u64_data_inversion(crc64_param[model].polynomial);
+    uint8_t data;
+
+    for (size_t i = 0; i < length; i++) {
+        data = *input_data++;
+        if (!crc64_param[model].input_inversion) {
+            data = u8_data_inversion(data);
+        }
+        crc64 ^= data;
+        for (uint8_t j = 0; j < 8; j++) {
+            if (crc64 & 0x0000000000000001) {
+                crc64 >>= 1;
+                crc64 ^= polynomial; //  polynomial discard MSB or LSB because they are always 1, don't need to compute
+            } else {
+                crc64 >>= 1;
+            }
+
+        }
+    }
+
+    if (!crc64_param[model].output_inversion) {
+        crc64 = u64_data_inversion(crc64);
+    }
+
+    crc64 ^= crc64_param[model].result_xor_value;
+    CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC64, model, CHECKSUM_STATS_MIRROR, length, stats_start);
+    return crc64;
+}
+
+/**
+ * @brief CRC64 calculation method group package
+ *
+ * @param param CRC64 reference model
+ * @param input_data Packets of CRC64 to be computed, last byte of the array holds the CRC64 result
+ * @param length Length of the CRC64 packet
+ */
+void crc64_calculate_package(CRC64_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC64_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 8);
+
+    uint64_t crc64_result = 0;
+    crc64_result = crc64_calculate(model, input_data, length - 8);
+
+    for (uint8_t i = 0; i < 8; i++) {
+        *(input_data + length - 8 + i) = (crc64_result >> (8 * i)) & 0xFF;
+    }
+}
+
+/**
+ * @brief Runs the CRC64 register over the input with the model's byte table.
+ *
+ * @param model CRC64 reference model
+ * @param crc CRC register, initial value included and result xor value excluded
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint64_t CRC register
+ */
+static uint64_t crc64_byte_table_update(CRC64_reference_model_e model, uint64_t crc, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(CRC64_MODEL_ENABLED(model));
+
+    const uint64_t *table = CRC64_TABLE[model];
+    uint8_t *p = input_data;
+
+    if (crc64_param[model].input_inversion) {
+        for (size_t i = 0; i < length; i++) {
+            crc = (crc >> 8) ^ table[(crc ^ *p++) & 0xFF];
+        }
+    } else {
+        for (size_t i = 0; i < length; i++) {
+            crc = (crc << 8) ^ table[(crc >> 56) ^ *p++];
+        }
+    }
+
+    return crc;
+}
+
+#ifndef CRC_NO_SLICING
+/**
+ * @brief Generates the slicing-by-8 tables of a model from its byte table
+ *
+ * @param model CRC64 reference model
+ */
+static void crc64_slice_table_init(CRC64_reference_model_e model) {
+    const uint64_t *table = CRC64_TABLE[model];
+    uint64_t crc;
+
+    for (int i = 0; i < 256; i++) {
+        crc = table[i];
+        for (int k = 0; k < 7; k++) {
+            if (crc64_param[model].input_inversion) {
+                crc = (crc >> 8) ^ table[crc & 0xFF];
+            } else {
+                crc = (crc << 8) ^ table[crc >> 56];
+            }
+            crc64_slice_table[CRC64_MODEL_SLOT(model)][k][i] = crc;
+        }
+    }
+    /* generating is idempotent, racing first users write the same values */
+#if defined(__GNUC__)
+    __atomic_store_n(&crc64_slice_table_ready[CRC64_MODEL_SLOT(model)], true, __ATOMIC_RELEASE);
+#else
+    crc64_slice_table_ready[CRC64_MODEL_SLOT(model)] = true;
+#endif
+}
+
+/**
+ * @brief Runs the CRC64 register over the input eight bytes at a time (slicing-by-8).
+ *
+ * @param model CRC64 reference model
+ * @param crc CRC register, initial value included and result xor value excluded
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint64_t CRC register
+ */
+static uint64_t crc64_slice8_update(CRC64_reference_model_e model, uint64_t crc, uint8_t *input_data, size_t length) {
+#if defined(__GNUC__)
+    if (!__atomic_load_n(&crc64_slice_table_ready[CRC64_MODEL_SLOT(model)], __ATOMIC_ACQUIRE)) {
+#else
+    if (!crc64_slice_table_ready[CRC64_MODEL_SLOT(model)]) {
+#endif
+        crc64_slice_table_init(model);
+    }
+
+    const uint64_t *t0 = CRC64_TABLE[model];
+    const uint64_t (*t)[256] = crc64_slice_table[CRC64_MODEL_SLOT(model)];
+    uint8_t *p = input_data;
+
+    if (crc64_param[model].input_inversion) {
+        for (; length >= 8; length -= 8, p += 8) {
+            crc ^= LOAD_LE64(p);
+            crc = t[6][crc & 0xFF] ^ t[5][(crc >> 8) & 0xFF] ^ t[4][(crc >> 16) & 0xFF] ^
+                  t[3][(crc >> 24) & 0xFF] ^ t[2][(crc >> 32) & 0xFF] ^ t[1][(crc >> 40) & 0xFF] ^
+                  t[0][(crc >> 48) & 0xFF] ^ t0[crc >> 56];
+        }
+    } else {
+        for (; length >= 8; length -= 8, p += 8) {
+            crc ^= LOAD_BE64(p);
+            crc = t[6][crc >> 56] ^ t[5][(crc >> 48) & 0xFF] ^ t[4][(crc >> 40) & 0xFF] ^
+                  t[3][(crc >> 32) & 0xFF] ^ t[2][(crc >> 24) & 0xFF] ^ t[1][(crc >> 16) & 0xFF] ^
+                  t[0][(crc >> 8) & 0xFF] ^ t0[crc & 0xFF];
+        }
+    }
+
+    return crc64_byte_table_update(model, crc, p, length);
+}
+#else
+/**
+ * @brief Built without slicing: the slicing kernel runs the byte table
+ *
+ * @param model CRC64 reference model
+ * @param crc CRC register, initial value included and result xor value excluded
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint64_t CRC register
+ */
+static uint64_t crc64_slice8_update(CRC64_reference_model_e model, uint64_t crc, uint8_t *input_data, size_t length) {
+    return crc64_byte_table_update(model, crc, input_data, length);
+}
+#endif /* CRC_NO_SLICING */
+
+#ifdef CRC64_CLMUL
+/**
+ * @brief Folds a 128 bit block over the given distance: a carry-less multiply of
+ *        each half by x^distance mod P, the halves' products added together
+ */
+__attribute__((target("ssse3,pclmul")))
+static inline __m128i crc64_clmul_fold(__m128i block, __m128i constant) {
+    return _mm_xor_si128(_mm_clmulepi64_si128(block, constant, 0x00), _mm_clmulepi64_si128(block, constant, 0x11));
+}
+
+/**
+ * @brief Runs the CRC64 register over the input by PCLMULQDQ folding. Four 128 bit
+ *        accumulators fold forward over 64 bytes per round, then into one, which is
+ *        folded over the remaining 16 byte blocks. The last block and the tail are
+ *        finished with the byte table, so no Barrett reduction is needed.
+ *
+ * @param model CRC64 reference model
+ * @param crc CRC register, initial value included and result xor value excluded
+ * @param input_data Input uint8 t type array data, at least 64 bytes
+ * @param length Input uint8 t type array length
+ * @return uint64_t CRC register
+ */
+__attribute__((target("ssse3,pclmul")))
+static uint64_t crc64_clmul_update(CRC64_reference_model_e model, uint64_t crc, uint8_t *input_data, size_t length) {
+    const uint64_t (*k)[2] = CRC64_FOLD_CONSTANT[model];
+    const __m128i fold16 = _mm_loadu_si128((const __m128i *)k[0]);
+    const __m128i fold32 = _mm_loadu_si128((const __m128i *)k[1]);
+    const __m128i fold48 = _mm_loadu_si128((const __m128i *)k[2]);
+    const __m128i fold64 = _mm_loadu_si128((const __m128i *)k[3]);
+    /* normal models read the message big endian, the first byte becoming the top of the block */
+    const __m128i order = crc64_param[model].input_inversion ?
+                          _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15) :
+                          _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    uint8_t *p = input_data;
+    uint8_t block[16];
+    __m128i x0, x1, x2, x3;
+
+#define CRC64_CLMUL_LOAD(p) _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(p)), order)
+    x0 = CRC64_CLMUL_LOAD(p);
+    x1 = CRC64_CLMUL_LOAD(p + 16);
+    x2 = CRC64_CLMUL_LOAD(p + 32);
+    x3 = CRC64_CLMUL_LOAD(p + 48);
+    /* the register is added onto the first 64 message bits */
+    if (crc64_param[model].input_inversion) {
+        x0 = _mm_xor_si128(x0, _mm_set_epi64x(0, (long long)crc));
+    } else {
+        x0 = _mm_xor_si128(x0, _mm_set_epi64x((long long)crc, 0));
+    }
+    p += 64;
+    length -= 64;
+
+    while (length >= 64) {
+        x0 = _mm_xor_si128(crc64_clmul_fold(x0, fold64), CRC64_CLMUL_LOAD(p));
+        x1 = _mm_xor_si128(crc64_clmul_fold(x1, fold64), CRC64_CLMUL_LOAD(p + 16));
+        x2 = _mm_xor_si128(crc64_clmul_fold(x2, fold64), CRC64_CLMUL_LOAD(p + 32));
+        x3 = _mm_xor_si128(crc64_clmul_fold(x3, fold64), CRC64_CLMUL_LOAD(p + 48));
+        p += 64;
+        length -= 64;
+    }
+
+    x0 = _mm_xor_si128(_mm_xor_si128(crc64_clmul_fold(x0, fold48), crc64_clmul_fold(x1, fold32)),
+                       _mm_xor_si128(crc64_clmul_fold(x2, fold16), x3));
+    while (length >= 16) {
+        x0 = _mm_xor_si128(crc64_clmul_fold(x0, fold16), CRC64_CLMUL_LOAD(p));
+        p += 16;
+        length -= 16;
+    }
+#undef CRC64_CLMUL_LOAD
+
+    /* the accumulator stands in for the last 16 message bytes, hashed from a zero register */
+    _mm_storeu_si128((__m128i *)block, _mm_shuffle_epi8(x0, order));
+    crc = crc64_slice8_update(model, 0, block, sizeof(block));
+    return crc64_byte_table_update(model, crc, p, length);
+}
+#endif
+
+/* failed lookup table checks are counted against the tables, whichever kernel ran */
+#define CRC64_STATS_LOOKUP CHECKSUM_STATS_SLICING
+
+/**
+ * @brief Runs the CRC64 register over the input with the fastest kernel the CPU and length allow.
+ *
+ * @param model CRC64 reference model
+ * @param crc CRC64 register, initial value included and result xor value excluded
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint64_t CRC64 register
+ */
+static uint64_t crc64_lookup_table_update(CRC64_reference_model_e model, uint64_t crc, uint8_t *input_data, size_t length) {
+    CHECKSUM_STATS_BEGIN(stats_start);
+#ifdef CRC64_CLMUL
+    if (length >= CRC64_CLMUL_MIN_LENGTH && crc64_clmul_supported()) {
+        crc = crc64_clmul_update(model, crc, input_data, length);
+        CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC64, model, CHECKSUM_STATS_HARDWARE, length, stats_start);
+        return crc;
+    }
+#endif
+    crc = crc64_slice8_update(model, crc, input_data, length);
+    CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC64, model, CHECKSUM_STATS_SLICING, length, stats_start);
+    return crc;
+}
+
+/**
+ * @brief Calculates the 64 bit wide CRC of an input data of a given length with the model's lookup table.
+ *
+ * @param model CRC64 reference model
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint64_t CRC64 result
+ */
+static uint64_t crc64_lookup_table_calculate(CRC64_reference_model_e model, uint8_t *input_data, size_t length) {
+    return crc64_lookup_table_update(model, crc64_param[model].initial_value, input_data, length) ^ crc64_param[model].result_xor_value;
+}
+
+/* Lengths from which crc64_calculate switches to each kernel, per model; 0 leaves the kernel unused,
+   so everything runs bitwise until crc64_route_set or the autotuner sets thresholds */
+static size_t crc64_route_threshold[CRC64_NONE_MODEL][CRC64_KERNEL_NONE];
+
+#ifdef CHECKSUM_STATS
+static const checksum_stats_implementation_e crc64_kernel_stats[CRC64_KERNEL_NONE] = {
+    CHECKSUM_STATS_BITWISE, CHECKSUM_STATS_SLICING, CHECKSUM_STATS_HARDWARE,
+};
+#endif
+
+/**
+ * @brief Picks the kernel for a length: the last one whose threshold the length reaches
+ *
+ * @param model CRC64 reference model
+ * @param length Input length
+ * @return crc64_kernel_e Kernel
+ */
+static inline crc64_kernel_e crc64_route(CRC64_reference_model_e model, size_t length) {
+    crc64_kernel_e kernel = CRC64_KERNEL_BITWISE;
+    for (int k = CRC64_KERNEL_BITWISE + 1; k < CRC64_KERNEL_NONE; k++) {
+        if (crc64_route_threshold[model][k] != 0 && length >= crc64_route_threshold[model][k]) {
+            kernel = (crc64_kernel_e)k;
+        }
+    }
+    return kernel;
+}
+
+/**
+ * @brief Tells whether a kernel can run a model on this build and CPU
+ *
+ * @param model CRC64 reference model
+ * @param kernel CRC64 kernel
+ * @return true The kernel can be routed to
+ * @return false It would fall back to another kernel
+ */
+bool crc64_kernel_available(CRC64_reference_model_e model, crc64_kernel_e kernel) {
+    /* parameter checkout */
+    assert(model < CRC64_NONE_MODEL);
+
+    /* a model left out of CRC64_MODELS has no kernel at all */
+    if (!CRC64_MODEL_ENABLED(model)) {
+        return false;
+    }
+    if (kernel == CRC64_KERNEL_CLMUL) {
+#ifdef CRC64_CLMUL
+        return crc64_clmul_supported();
+#else
+        return false;
+#endif
+    }
+    return kernel < CRC64_KERNEL_NONE;
+}
+
+/**
+ * @brief Calculates the 64 bit wide CRC of an input data of a given length with a chosen kernel.
+ *
+ * @param model CRC64 reference model
+ * @param kernel CRC64 kernel
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint64_t CRC64 result
+ */
+uint64_t crc64_kernel_calculate(CRC64_reference_model_e model, crc64_kernel_e kernel, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC64_NONE_MODEL);
+    assert(kernel < CRC64_KERNEL_NONE);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    switch (kernel)
+    {
+    case CRC64_KERNEL_SLICING: {
+        CHECKSUM_STATS_BEGIN(stats_start);
+        uint64_t crc = crc64_slice8_update(model, crc64_param[model].initial_value, input_data, length);
+        CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC64, model, CHECKSUM_STATS_SLICING, length, stats_start);
+        return crc ^ crc64_param[model].result_xor_value;
+    }
+
+    case CRC64_KERNEL_CLMUL:
+        return crc64_lookup_table_calculate(model, input_data, length);
+
+    default:
+#ifdef CRC_NO_BITWISE
+        return crc64_lookup_table_calculate(model, input_data, length);
+#else
+        return crc64_bitwise_calculate(model, input_data, length);
+#endif
+    }
+}
+
+/**
+ * @brief Sets the lengths from which crc64_calculate runs each kernel of a model. Not thread safe,
+ *        meant for start up before the CRC64 functions are in use.
+ *
+ * @param model CRC64 reference model
+ * @param threshold Shortest length per kernel, 0 for never; the bitwise entry is ignored and
+ *                  kernels not available are left unused
+ */
+void crc64_route_set(CRC64_reference_model_e model, const size_t threshold[CRC64_KERNEL_NONE]) {
+    /* parameter checkout */
+    assert(model < CRC64_NONE_MODEL);
+    assert(threshold != NULL);
+
+    crc64_route_threshold[model][CRC64_KERNEL_BITWISE] = 0;
+    for (int k = CRC64_KERNEL_BITWISE + 1; k < CRC64_KERNEL_NONE; k++) {
+        crc64_route_threshold[model][k] = crc64_kernel_available(model, (crc64_kernel_e)k) ? threshold[k] : 0;
+    }
+}
+
+/**
+ * @brief Gets the lengths from which crc64_calculate runs each kernel of a model
+ *
+ * @param model CRC64 reference model
+ * @param threshold Shortest length per kernel, 0 for never
+ */
+void crc64_route_get(CRC64_reference_model_e model, size_t threshold[CRC64_KERNEL_NONE]) {
+    /* parameter checkout */
+    assert(model < CRC64_NONE_MODEL);
+    assert(threshold != NULL);
+
+    for (int k = 0; k < CRC64_KERNEL_NONE; k++) {
+        threshold[k] = crc64_route_threshold[model][k];
+    }
+}
+
+/**
+ * @brief Gets the initial and result xor values of a model, as the CRC catalogues give them
+ *
+ * @param model CRC64 reference model
+ * @param initial_value Register before the message
+ * @param result_xor_value Xored onto the register at the end
+ */
+void crc64_param_get(CRC64_reference_model_e model, uint64_t *initial_value, uint64_t *result_xor_value) {
+    /* parameter checkout */
+    assert(model < CRC64_NONE_MODEL);
+    assert(initial_value != NULL);
+    assert(result_xor_value != NULL);
+
+    *initial_value = crc64_param[model].initial_value;
+    *result_xor_value = crc64_param[model].result_xor_value;
+}
+
+/**
+ * @brief Calculates the 64 bit wide CRC of an input data of a given length, with the kernel
+ *        routed for the length (bit by bit unless thresholds were set).
+ *
+ * @param param CRC64 reference model
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint64_t CRC64 result
+ */
+uint64_t crc64_calculate(CRC64_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC64_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    return crc64_kernel_calculate(model, crc64_route(model, length), input_data, length);
+}
+
+/**
+ * @brief CRC64 lookup table package
+ *
+ * @param param CRC64 reference model
+ * @param input_data Packets of CRC64 to be computed, last byte of the array holds the CRC64 result
+ * @param length Length of the CRC64 packet
+ */
+void crc64_lookup_table_package(CRC64_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC64_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 8);
+
+    uint64_t crc64_result = 0;
+    crc64_result = crc64_lookup_table_calculate(model, input_data, length - 8);
+
+    for (uint8_t i = 0; i < 8; i++) {
+        *(input_data + length - 8 + i) = (crc64_result >> (8 * i)) & 0xFF;
+    }
+}
+
+/**
+ * @brief CRC64 calculation method package check
+ *
+ * @param param CRC64 reference model
+ * @param input_data CRC64 packages to check
+ * @param length Length of the CRC64 packet
+ * @return true CRC64 checks succeed
+ * @return false CRC64 checks fails
+ */
+bool crc64_package_check(CRC64_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC64_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 8);
+
+    uint64_t crc64_actual_value = LOAD_LE64(input_data + length - 8);
+    uint64_t crc64_result = 0;
+    crc64_result = crc64_calculate(model, input_data, length - 8);
+    if (crc64_result != crc64_actual_value) {
+        CHECKSUM_STATS_FAILURE(CHECKSUM_STATS_CRC64, model, crc64_kernel_stats[crc64_route(model, length - 8)]);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief CRC64 lookup table packages check
+ *
+ * @param param CRC64 reference model
+ * @param input_data CRC64 packages to check
+ * @param length Length of the CRC64 packet
+ * @return true CRC64 checks succeed
+ * @return false CRC64 checks fails
+ */
+bool crc64_lookup_table_package_check(CRC64_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC64_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 8);
+
+    uint64_t crc64_actual_value = LOAD_LE64(input_data + length - 8);
+    uint64_t crc64_result = crc64_lookup_table_calculate(model, input_data, length - 8);
+
+    if (crc64_result != crc64_actual_value) {
+        CHECKSUM_STATS_FAILURE(CHECKSUM_STATS_CRC64, model, CRC64_STATS_LOOKUP);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Starts a streaming CRC64 computation
+ *
+ * @param ctx CRC64 streaming context
+ * @param model CRC64 reference model
+ */
+void crc64_init(crc64_ctx *ctx, CRC64_reference_model_e model) {
+    /* parameter checkout */
+    assert(ctx != NULL);
+    assert(model < CRC64_NONE_MODEL);
+
+    ctx->model = model;
+    ctx->crc = crc64_param[model].initial_value;
+}
+
+/**
+ * @brief Adds input data to a streaming CRC64 computation, with the model's lookup table
+ *
+ * @param ctx CRC64 streaming context
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ */
+void crc64_update(crc64_ctx *ctx, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(ctx != NULL);
+    assert(input_data != NULL || length == 0);
+
+    ctx->crc = crc64_lookup_table_update(ctx->model, ctx->crc, input_data, length);
+}
+
+/**
+ * @brief Copies input data and adds it to a streaming CRC64 computation in one pass, such as a payload
+ *        into its frame buffer: every chunk is checksummed while it sits in the L1 cache and copied
+ *        from there, with non-temporal stores for long copies
+ *
+ * @param ctx CRC64 streaming context
+ * @param destination Destination, not overlapping the source
+ * @param source Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ */
+void crc64_copy(crc64_ctx *ctx, uint8_t *destination, const uint8_t *source, size_t length) {
+    /* parameter checkout */
+    assert(ctx != NULL);
+    assert((destination != NULL && source != NULL) || length == 0);
+
+    bool nontemporal = length >= CHECKSUM_COPY_NONTEMPORAL;
+    while (length > 0) {
+        size_t chunk = (length < CHECKSUM_COPY_CHUNK) ? length : CHECKSUM_COPY_CHUNK;
+        ctx->crc = crc64_lookup_table_update(ctx->model, ctx->crc, (uint8_t *)source, chunk);
+        checksum_copy_chunk(destination, source, chunk, nontemporal);
+        destination += chunk;
+        source += chunk;
+        length -= chunk;
+    }
+    checksum_copy_fence(nontemporal);
+}
+
+/**
+ * @brief Finishes a streaming CRC64 computation
+ *
+ * @param ctx CRC64 streaming context
+ * @return uint64_t CRC64 result, the same as crc64_calculate over all the input data
+ */
+uint64_t crc64_final(crc64_ctx *ctx) {
+    /* parameter checkout */
+    assert(ctx != NULL);
+
+    return (ctx->crc ^ crc64_param[ctx->model].result_xor_value);
+}
+
+#ifndef CHECKSUM_NO_MAIN
+#define TEST
+#endif
+#ifdef TEST
+#include <stdio.h>
+
+static void print_crc64_table(CRC64_reference_model_e model);
+
+/* kernel check buffer, the longest length plus the largest offset */
+#define TEST_BYTES (4096 + 16)
+
+typedef uint64_t (*crc64_update_t)(CRC64_reference_model_e model, uint64_t crc, uint8_t *input_data, size_t length);
+
+static const char *crc64_model_name[CRC64_NONE_MODEL] = {
+    "CRC64_ECMA182_MODEL",
+    "CRC64_XZ_MODEL",
+    "CRC64_GO_ISO_MODEL",
+};
+
+static uint64_t crc64_update_calculate(CRC64_reference_model_e model, crc64_update_t update, uint8_t *input_data, size_t length) {
+    return update(model, crc64_param[model].initial_value, input_data, length) ^ crc64_param[model].result_xor_value;
+}
+
+int main() {
+    static uint8_t data[TEST_BYTES];
+
+    for (size_t i = 0; i < TEST_BYTES; i++) {
+        data[i] = (uint8_t)((i * 2654435761u) >> 13);
+    }
+
+#if 0
+    print_crc64_table(CRC64_ECMA182_MODEL);
+    print_crc64_table(CRC64_XZ_MODEL);
+    print_crc64_table(CRC64_GO_ISO_MODEL);
+#endif
+
+#if 1
+    printf("---------CRC64 check-----------\n");
+    uint8_t check_data[] = "123456789";
+    const uint64_t check_value[CRC64_NONE_MODEL] = {0x6C40DF5F0B497347, 0x995DC9BBDF1939FA, 0xB90956C775A41001};
+    for (int model = 0; model < CRC64_NONE_MODEL; model++) {
+        bool succeed = crc64_calculate(model, check_data, 9) == check_value[model] &&
+                       crc64_calculate_mirror_mode(model, check_data, 9) == check_value[model] &&
+                       crc64_lookup_table_calculate(model, check_data, 9) == check_value[model];
+        /* every kernel, length and alignment against the bitwise engine */
+        for (size_t length = 1; length < 4096; length = length * 5 / 4 + 1) {
+            for (size_t offset = 0; offset < 16; offset += 5) {
+                uint64_t crc64 = crc64_calculate(model, data + offset, length);
+                if (crc64_update_calculate(model, crc64_byte_table_update, data + offset, length) != crc64 ||
+                    crc64_update_calculate(model, crc64_slice8_update, data + offset, length) != crc64 ||
+                    crc64_lookup_table_calculate(model, data + offset, length) != crc64) {
+                    succeed = false;
+                }
+#ifdef CRC64_CLMUL
+                if (length >= 64 && crc64_clmul_supported() &&
+                    crc64_update_calculate(model, crc64_clmul_update, data + offset, length) != crc64) {
+                    succeed = false;
+                }
+#endif
+            }
+        }
+        crc64_lookup_table_package(model, data, 100);
+        succeed = succeed && crc64_package_check(model, data, 100) && crc64_lookup_table_package_check(model, data, 100);
+        data[50] ^= 0x01;
+        succeed = succeed && !crc64_lookup_table_package_check(model, data, 100);
+        data[50] ^= 0x01;
+        printf("%s check %s.\n", crc64_model_name[model], succeed ? "succeed" : "fail");
+    }
+#endif
+
+#if 1
+    printf("---------CRC64 copy-----------\n");
+    /* two pieces per copy, into a misaligned destination; the longest one past the non-temporal threshold */
+    static uint8_t copy_source[2 * 1024 * 1024 + 7];
+    static uint8_t copy_destination[sizeof(copy_source) + 1];
+    const size_t copy_length[] = {0, 1, 7, 4096, 4097, 10000, sizeof(copy_source)};
+    bool copy_succeed = true;
+
+    for (size_t i = 0; i < sizeof(copy_source); i++) {
+        copy_source[i] = (uint8_t)((i * 2654435761u) >> 13);
+    }
+    for (CRC64_reference_model_e model = CRC64_ECMA182_MODEL; model < CRC64_NONE_MODEL; model++) {
+        for (size_t i = 0; i < sizeof(copy_length) / sizeof(copy_length[0]); i++) {
+            crc64_ctx ctx, copy_ctx;
+            size_t first = copy_length[i] / 3;
+
+            memset(copy_destination, 0, sizeof(copy_destination));
+            crc64_init(&ctx, model);
+            crc64_update(&ctx, copy_source, copy_length[i]);
+            crc64_init(&copy_ctx, model);
+            crc64_copy(&copy_ctx, copy_destination + 1, copy_source, first);
+            crc64_copy(&copy_ctx, copy_destination + 1 + first, copy_source + first, copy_length[i] - first);
+            if (crc64_final(&ctx) != crc64_final(&copy_ctx) || memcmp(copy_destination + 1, copy_source, copy_length[i]) != 0) {
+                copy_succeed = false;
+            }
+        }
+    }
+    printf("crc64_copy check %s.\n", copy_succeed ? "succeed" : "fail");
+#endif
+    return 0;
+}
+
+static void print_crc64_table(CRC64_reference_model_e model) {
+    uint64_t crc64_result = 0;
+    uint8_t i = 0;
+    switch (model)
+    {
+    case CRC64_ECMA182_MODEL:
+        printf("/* Reference Model:CRC64_ECMA182_MODEL */\n");
+        printf("static const uint64_t CRC64_ECMA182_MODEL_TABLE[256] = {\n");
+        break;
+
+    case CRC64_XZ_MODEL:
+        printf("/* Reference Model:CRC64_XZ_MODEL */\n");
+        printf("static const uint64_t CRC64_XZ_MODEL_TABLE[256] = {\n");
+        break;
+
+    case CRC64_GO_ISO_MODEL:
+        printf("/* Reference Model:CRC64_GO_ISO_MODEL */\n");
+        printf("static const uint64_t CRC64_GO_ISO_MODEL_TABLE[256] = {\n");
+        break;
+
+    default:
+        break;
+    }
+    for (int j = 0; j <= 0xFF; j++, i++) {
+        if (crc64_param[model].input_inversion == true && crc64_param[model].output_inversion == true) {
+            crc64_result = crc64_calculate_mirror_mode(model, &i, 1);
+        } else {
+            crc64_result = crc64_calculate(model, &i, 1);
+        }
+        if (i % 4 == 0) {
+            printf("    ");
+        } else {
+            printf(" ");
+        }
+        printf("0x%016llXULL", (unsigned long long)crc64_result);
+        if (i != 0xFF) {
+            printf(",");
+        }
+        if ((i + 1) % 4 == 0) {
+            printf("\n");
+        }
+    }
+    printf("};\n");
+}
+#endif
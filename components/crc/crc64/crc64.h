@@ -0,0 +1,53 @@
+#ifndef __CRC64_H__
+#define __CRC64_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    CRC64_ECMA182_MODEL = 0,
+    CRC64_XZ_MODEL,
+    CRC64_GO_ISO_MODEL,
+    CRC64_NONE_MODEL,
+}CRC64_reference_model_e;
+
+/* Kernels crc64_calculate routes between by length, see crc64_route_set */
+typedef enum {
+    CRC64_KERNEL_BITWISE = 0, /* bit by bit, the reference */
+    CRC64_KERNEL_SLICING,     /* slicing-by-8 tables */
+    CRC64_KERNEL_CLMUL,       /* PCLMULQDQ folding, slicing below CRC64_CLMUL_MIN_LENGTH */
+    CRC64_KERNEL_NONE,
+} crc64_kernel_e;
+
+/* Streaming CRC64 computation, the same result as crc64_calculate over all the updates joined */
+typedef struct {
+    CRC64_reference_model_e model;
+    uint64_t crc;                /* CRC64 register, result xor value not yet applied */
+} crc64_ctx;
+
+uint64_t crc64_calculate(CRC64_reference_model_e model, uint8_t *input_data, size_t length);
+uint64_t crc64_calculate_mirror_mode(CRC64_reference_model_e model, uint8_t *input_data, size_t length);
+void crc64_calculate_package(CRC64_reference_model_e model, uint8_t *input_data, size_t length);
+void crc64_lookup_table_package(CRC64_reference_model_e model, uint8_t *input_data, size_t length);
+bool crc64_package_check(CRC64_reference_model_e model, uint8_t *input_data, size_t length);
+bool crc64_lookup_table_package_check(CRC64_reference_model_e model, uint8_t *input_data, size_t length);
+void crc64_init(crc64_ctx *ctx, CRC64_reference_model_e model);
+void crc64_update(crc64_ctx *ctx, uint8_t *input_data, size_t length);
+void crc64_copy(crc64_ctx *ctx, uint8_t *destination, const uint8_t *source, size_t length);
+uint64_t crc64_final(crc64_ctx *ctx);
+bool crc64_kernel_available(CRC64_reference_model_e model, crc64_kernel_e kernel);
+uint64_t crc64_kernel_calculate(CRC64_reference_model_e model, crc64_kernel_e kernel, uint8_t *input_data, size_t length);
+void crc64_route_set(CRC64_reference_model_e model, const size_t threshold[CRC64_KERNEL_NONE]);
+void crc64_route_get(CRC64_reference_model_e model, size_t threshold[CRC64_KERNEL_NONE]);
+void crc64_param_get(CRC64_reference_model_e model, uint64_t *initial_value, uint64_t *result_xor_value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CRC64_H__ */
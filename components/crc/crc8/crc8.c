@@ -1,556 +1,1895 @@
-/**
- * @file crc8.c
- * @brief Cyclic Redundancy Check (CRC8)
- * @copyright Copyright (c) 2023
- *
- * Change Logs:
- * Data             Author                          Notes
- * 2023-04-19       vector(vector_qiu@163.com)      first version
- *
- */
-#include "crc8.h"
-#include <assert.h>
-
-/* 低空间占用可以使用4BIT table查表 */
-/* Reference Model:CRC8 */
-static const uint8_t CRC8_8BIT_TABLE[256] = {
-    0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D,
-    0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65, 0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D,
-    0xE0, 0xE7, 0xEE, 0xE9, 0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD,
-    0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1, 0xB4, 0xB3, 0xBA, 0xBD,
-    0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2, 0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA,
-    0xB7, 0xB0, 0xB9, 0xBE, 0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A,
-    0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0D, 0x0A,
-    0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42, 0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A,
-    0x89, 0x8E, 0x87, 0x80, 0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4,
-    0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8, 0xDD, 0xDA, 0xD3, 0xD4,
-    0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C, 0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44,
-    0x19, 0x1E, 0x17, 0x10, 0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34,
-    0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F, 0x6A, 0x6D, 0x64, 0x63,
-    0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B, 0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13,
-    0xAE, 0xA9, 0xA0, 0xA7, 0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83,
-    0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF, 0xFA, 0xFD, 0xF4, 0xF3
-};
-/* Reference Model:CRC8_ITU_MODEL */
-static const uint8_t CRC8_8BIT_ITU_TABLE[256] = {
-    0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D,
-    0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65, 0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D,
-    0xE0, 0xE7, 0xEE, 0xE9, 0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD,
-    0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1, 0xB4, 0xB3, 0xBA, 0xBD,
-    0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2, 0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA,
-    0xB7, 0xB0, 0xB9, 0xBE, 0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A,
-    0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0D, 0x0A,
-    0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42, 0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A,
-    0x89, 0x8E, 0x87, 0x80, 0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4,
-    0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8, 0xDD, 0xDA, 0xD3, 0xD4,
-    0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C, 0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44,
-    0x19, 0x1E, 0x17, 0x10, 0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34,
-    0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F, 0x6A, 0x6D, 0x64, 0x63,
-    0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B, 0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13,
-    0xAE, 0xA9, 0xA0, 0xA7, 0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83,
-    0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF, 0xFA, 0xFD, 0xF4, 0xF3
-};
-/* Reference Model:CRC8_ROHC_MODEL */
-static const uint8_t CRC8_8BIT_ROHC_TABLE[256] = {
-    0x00, 0x91, 0xE3, 0x72, 0x07, 0x96, 0xE4, 0x75, 0x0E, 0x9F, 0xED, 0x7C, 0x09, 0x98, 0xEA, 0x7B,
-    0x1C, 0x8D, 0xFF, 0x6E, 0x1B, 0x8A, 0xF8, 0x69, 0x12, 0x83, 0xF1, 0x60, 0x15, 0x84, 0xF6, 0x67,
-    0x38, 0xA9, 0xDB, 0x4A, 0x3F, 0xAE, 0xDC, 0x4D, 0x36, 0xA7, 0xD5, 0x44, 0x31, 0xA0, 0xD2, 0x43,
-    0x24, 0xB5, 0xC7, 0x56, 0x23, 0xB2, 0xC0, 0x51, 0x2A, 0xBB, 0xC9, 0x58, 0x2D, 0xBC, 0xCE, 0x5F,
-    0x70, 0xE1, 0x93, 0x02, 0x77, 0xE6, 0x94, 0x05, 0x7E, 0xEF, 0x9D, 0x0C, 0x79, 0xE8, 0x9A, 0x0B,
-    0x6C, 0xFD, 0x8F, 0x1E, 0x6B, 0xFA, 0x88, 0x19, 0x62, 0xF3, 0x81, 0x10, 0x65, 0xF4, 0x86, 0x17,
-    0x48, 0xD9, 0xAB, 0x3A, 0x4F, 0xDE, 0xAC, 0x3D, 0x46, 0xD7, 0xA5, 0x34, 0x41, 0xD0, 0xA2, 0x33,
-    0x54, 0xC5, 0xB7, 0x26, 0x53, 0xC2, 0xB0, 0x21, 0x5A, 0xCB, 0xB9, 0x28, 0x5D, 0xCC, 0xBE, 0x2F,
-    0xE0, 0x71, 0x03, 0x92, 0xE7, 0x76, 0x04, 0x95, 0xEE, 0x7F, 0x0D, 0x9C, 0xE9, 0x78, 0x0A, 0x9B,
-    0xFC, 0x6D, 0x1F, 0x8E, 0xFB, 0x6A, 0x18, 0x89, 0xF2, 0x63, 0x11, 0x80, 0xF5, 0x64, 0x16, 0x87,
-    0xD8, 0x49, 0x3B, 0xAA, 0xDF, 0x4E, 0x3C, 0xAD, 0xD6, 0x47, 0x35, 0xA4, 0xD1, 0x40, 0x32, 0xA3,
-    0xC4, 0x55, 0x27, 0xB6, 0xC3, 0x52, 0x20, 0xB1, 0xCA, 0x5B, 0x29, 0xB8, 0xCD, 0x5C, 0x2E, 0xBF,
-    0x90, 0x01, 0x73, 0xE2, 0x97, 0x06, 0x74, 0xE5, 0x9E, 0x0F, 0x7D, 0xEC, 0x99, 0x08, 0x7A, 0xEB,
-    0x8C, 0x1D, 0x6F, 0xFE, 0x8B, 0x1A, 0x68, 0xF9, 0x82, 0x13, 0x61, 0xF0, 0x85, 0x14, 0x66, 0xF7,
-    0xA8, 0x39, 0x4B, 0xDA, 0xAF, 0x3E, 0x4C, 0xDD, 0xA6, 0x37, 0x45, 0xD4, 0xA1, 0x30, 0x42, 0xD3,
-    0xB4, 0x25, 0x57, 0xC6, 0xB3, 0x22, 0x50, 0xC1, 0xBA, 0x2B, 0x59, 0xC8, 0xBD, 0x2C, 0x5E, 0xCF
-};
-/* Reference Model:CRC8_MAXIM_MODEL */
-static const uint8_t CRC8_8BIT_MAXIM_TABLE[256] = {
-    0x00, 0x5E, 0xBC, 0xE2, 0x61, 0x3F, 0xDD, 0x83, 0xC2, 0x9C, 0x7E, 0x20, 0xA3, 0xFD, 0x1F, 0x41,
-    0x9D, 0xC3, 0x21, 0x7F, 0xFC, 0xA2, 0x40, 0x1E, 0x5F, 0x01, 0xE3, 0xBD, 0x3E, 0x60, 0x82, 0xDC,
-    0x23, 0x7D, 0x9F, 0xC1, 0x42, 0x1C, 0xFE, 0xA0, 0xE1, 0xBF, 0x5D, 0x03, 0x80, 0xDE, 0x3C, 0x62,
-    0xBE, 0xE0, 0x02, 0x5C, 0xDF, 0x81, 0x63, 0x3D, 0x7C, 0x22, 0xC0, 0x9E, 0x1D, 0x43, 0xA1, 0xFF,
-    0x46, 0x18, 0xFA, 0xA4, 0x27, 0x79, 0x9B, 0xC5, 0x84, 0xDA, 0x38, 0x66, 0xE5, 0xBB, 0x59, 0x07,
-    0xDB, 0x85, 0x67, 0x39, 0xBA, 0xE4, 0x06, 0x58, 0x19, 0x47, 0xA5, 0xFB, 0x78, 0x26, 0xC4, 0x9A,
-    0x65, 0x3B, 0xD9, 0x87, 0x04, 0x5A, 0xB8, 0xE6, 0xA7, 0xF9, 0x1B, 0x45, 0xC6, 0x98, 0x7A, 0x24,
-    0xF8, 0xA6, 0x44, 0x1A, 0x99, 0xC7, 0x25, 0x7B, 0x3A, 0x64, 0x86, 0xD8, 0x5B, 0x05, 0xE7, 0xB9,
-    0x8C, 0xD2, 0x30, 0x6E, 0xED, 0xB3, 0x51, 0x0F, 0x4E, 0x10, 0xF2, 0xAC, 0x2F, 0x71, 0x93, 0xCD,
-    0x11, 0x4F, 0xAD, 0xF3, 0x70, 0x2E, 0xCC, 0x92, 0xD3, 0x8D, 0x6F, 0x31, 0xB2, 0xEC, 0x0E, 0x50,
-    0xAF, 0xF1, 0x13, 0x4D, 0xCE, 0x90, 0x72, 0x2C, 0x6D, 0x33, 0xD1, 0x8F, 0x0C, 0x52, 0xB0, 0xEE,
-    0x32, 0x6C, 0x8E, 0xD0, 0x53, 0x0D, 0xEF, 0xB1, 0xF0, 0xAE, 0x4C, 0x12, 0x91, 0xCF, 0x2D, 0x73,
-    0xCA, 0x94, 0x76, 0x28, 0xAB, 0xF5, 0x17, 0x49, 0x08, 0x56, 0xB4, 0xEA, 0x69, 0x37, 0xD5, 0x8B,
-    0x57, 0x09, 0xEB, 0xB5, 0x36, 0x68, 0x8A, 0xD4, 0x95, 0xCB, 0x29, 0x77, 0xF4, 0xAA, 0x48, 0x16,
-    0xE9, 0xB7, 0x55, 0x0B, 0x88, 0xD6, 0x34, 0x6A, 0x2B, 0x75, 0x97, 0xC9, 0x4A, 0x14, 0xF6, 0xA8,
-    0x74, 0x2A, 0xC8, 0x96, 0x15, 0x4B, 0xA9, 0xF7, 0xB6, 0xE8, 0x0A, 0x54, 0xD7, 0x89, 0x6B, 0x35
-};
-
-/* http://www.ip33.com/crc.html */
-/* polynomial discard MSB or LSB because they are always 1 */
-typedef struct {
-    uint8_t initial_value;
-    uint8_t result_xor_value;
-    uint8_t polynomial;
-    bool input_inversion;
-    bool output_inversion;
-} crc8_param_t;
-
-// #define PRINT_TABLE
-#ifndef PRINT_TABLE
-static crc8_param_t crc8_param[] = {
-    {0x00, 0x00, 0x07, false, false},       // Reference Model:CRC8
-    {0x00, 0x55, 0x07, false, false},       // Reference Model:CRC8_ITU
-    {0xFF, 0x00, 0x07, true, true},         // Reference Model:CRC8_ROHC
-    {0x00, 0x00, 0x31, true, true},         // Reference Model:CRC8_MAXIM
-};
-#else
-/* Generate table usage */
-static crc8_param_t crc8_param[] = {
-    {0x00, 0x00, 0x07, false, false},       // Reference Model:CRC8
-    {0x00, 0x00, 0x07, false, false},       // Reference Model:CRC8_ITU
-    {0x00, 0x00, 0x07, true, true},         // Reference Model:CRC8_ROHC
-    {0x00, 0x00, 0x31, true, true},         // Reference Model:CRC8_MAXIM
-};
-#endif
-/**
- * @brief uint8_t type data inversion
- *
- * @param data Data to be reversed
- * @return uint8_t The reversed data
- */
-static uint8_t data_inversion(uint8_t data) {
-    uint8_t result = 0;
-    for (uint8_t i = 0; i < 8; i++) {
-        result <<= 1;
-        result |= (data >> i) & 0x01;
-    }
-    return result;
-}
-
-/**
- * @brief Calculates the 8 bit wide CRC of an input data of a given length.
- *
- * @param param CRC8 reference model
- * @param input_data Input uint8 t type array data
- * @param length Input uint8 t type array length
- * @return uint8_t CRC8 result
- */
-uint8_t crc8_calculate(CRC8_reference_model_e model, uint8_t *input_data, size_t length) {
-    /* parameter checkout */
-    assert(model < CRC8_NONE_MODEL);
-    assert(input_data != NULL);
-    assert(length > 0);
-
-    uint8_t crc8 = crc8_param[model].initial_value;
-    uint8_t polynomial = crc8_param[model].polynomial;
-    uint8_t data;
-
-    for (size_t i = 0; i < length; i++) {
-        data = *input_data++;
-        if (crc8_param[model].input_inversion) {
-            data = data_inversion(data);
-        }
-        crc8 ^= data;
-        for (uint8_t j = 0; j < 8; j++) {
-            if (crc8 & 0x80) {
-                crc8 <<= 1;
-                crc8 ^= polynomial; //  polynomial discard MSB or LSB because they are always 1, don't need to compute
-            } else {
-                crc8 <<= 1;
-            }
-
-        }
-    }
-
-    if (crc8_param[model].output_inversion) {
-        crc8 = data_inversion(crc8);
-    }
-
-    return (crc8 ^ crc8_param[model].result_xor_value);
-}
-
-/**
- * @brief The mirror mode computes the 8-bit wide CRC of the input data of a given length.
- *
- * @param param CRC8 reference model
- * @param input_data Input uint8 t type array data
- * @param length Input uint8 t type array length
- * @return uint8_t CRC8 result
- */
-uint8_t crc8_calculate_mirror_mode(CRC8_reference_model_e model, uint8_t *input_data, size_t length) {
-    /* parameter checkout */
-    assert(model < CRC8_NONE_MODEL);
-    assert(input_data != NULL);
-    assert(length > 0);
-
-    uint8_t crc8 = crc8_param[model].initial_value;
-    uint8_t polynomial = data_inversion(crc8_param[model].polynomial);
-    uint8_t data;
-
-    for (size_t i = 0; i < length; i++) {
-        data = *input_data++;
-        if (!crc8_param[model].input_inversion) {
-            data = data_inversion(data);
-        }
-        crc8 ^= data;
-        for (uint8_t j = 0; j < 8; j++) {
-            if (crc8 & 0x01) {
-                crc8 >>= 1;
-                crc8 ^= polynomial; //  polynomial discard MSB or LSB because they are always 1, don't need to compute
-            } else {
-                crc8 >>= 1;
-            }
-
-        }
-    }
-
-    if (!crc8_param[model].output_inversion) {
-        crc8 = data_inversion(crc8);
-    }
-
-    return (crc8 ^ crc8_param[model].result_xor_value);
-}
-
-/**
- * @brief CRC8 calculation method group package
- *
- * @param param CRC8 reference model
- * @param input_data Packets of CRC8 to be computed, last byte of the array holds the CRC8 result
- * @param length Length of the CRC8 packet
- */
-void crc8_calculate_package(CRC8_reference_model_e model, uint8_t *input_data, size_t length) {
-    /* parameter checkout */
-    assert(model < CRC8_NONE_MODEL);
-    assert(input_data != NULL);
-    assert(length > 0);
-
-    uint8_t crc8_result = 0;
-    if (crc8_param[model].input_inversion == true && crc8_param[model].output_inversion == true) {
-        crc8_result = crc8_calculate_mirror_mode(model, input_data, length - 1);
-    } else {
-        crc8_result = crc8_calculate(model, input_data, length - 1);
-    }
-    *(input_data + length - 1) = crc8_result & 0xFF;
-}
-
-/**
- * @brief CRC8 lookup table package
- *
- * @param param CRC8 reference model
- * @param input_data Packets of CRC8 to be computed, last byte of the array holds the CRC8 result
- * @param length Length of the CRC8 packet
- */
-void crc8_lookup_table_package(CRC8_reference_model_e model, uint8_t *input_data, size_t length) {
-    /* parameter checkout */
-    assert(model < CRC8_NONE_MODEL);
-    assert(input_data != NULL);
-    assert(length > 0);
-
-    uint8_t crc8_result = 0;
-    uint8_t *p = input_data;
-    if (p != NULL) {
-        switch (model)
-        {
-        case CRC8_MODEL:
-            crc8_result = crc8_param[model].initial_value;
-            for (size_t i = 0; i < length - 1; i++) {
-                crc8_result = CRC8_8BIT_TABLE[(crc8_result ^ (*p++)) & 0xFF];
-            }
-            crc8_result ^= crc8_param[model].result_xor_value;
-            break;
-
-        case CRC8_ITU_MODEL:
-            crc8_result = crc8_param[model].initial_value;
-            for (size_t i = 0; i < length - 1; i++) {
-                crc8_result = CRC8_8BIT_ITU_TABLE[(crc8_result ^ (*p++)) & 0xFF];
-            }
-            crc8_result ^= crc8_param[model].result_xor_value;
-            break;
-
-        case CRC8_ROHC_MODEL:
-            crc8_result = crc8_param[model].initial_value;
-            for (size_t i = 0; i < length - 1; i++) {
-                crc8_result = CRC8_8BIT_ROHC_TABLE[(crc8_result ^ (*p++)) & 0xFF];
-            }
-            crc8_result ^= crc8_param[model].result_xor_value;
-            break;
-
-        case CRC8_MAXIM_MODEL:
-            crc8_result = crc8_param[model].initial_value;
-            for (size_t i = 0; i < length - 1; i++) {
-                crc8_result = CRC8_8BIT_MAXIM_TABLE[(crc8_result ^ (*p++)) & 0xFF];
-            }
-            crc8_result ^= crc8_param[model].result_xor_value;
-            break;
-
-        default:
-            break;
-        }
-    }
-
-    *(input_data + length - 1) = crc8_result & 0xFF;
-}
-
-/**
- * @brief CRC8 calculation method package check
- *
- * @param param CRC8 reference model
- * @param input_data CRC8 packages to check
- * @param length Length of the CRC8 packet
- * @return true CRC8 checks succeed
- * @return false CRC8 checks fails
- */
-bool crc8_package_check(CRC8_reference_model_e model, uint8_t *input_data, size_t length) {
-    /* parameter checkout */
-    assert(model < CRC8_NONE_MODEL);
-    assert(input_data != NULL);
-    assert(length > 0);
-
-    uint8_t crc8_result = 0;
-    crc8_result = crc8_calculate(model, input_data, length - 1);
-    if (crc8_result != *(input_data + length - 1)) {
-        return false;
-    }
-    return true;
-}
-
-/**
- * @brief CRC8 lookup table packages check
- *
- * @param param CRC8 reference model
- * @param input_data CRC8 packages to check
- * @param length Length of the CRC8 packet
- * @return true CRC8 checks succeed
- * @return false CRC8 checks fails
- */
-bool crc8_lookup_table_package_check(CRC8_reference_model_e model, uint8_t *input_data, size_t length) {
-    assert(model < CRC8_NONE_MODEL);
-    assert(input_data != NULL);
-    assert(length > 0);
-
-    uint8_t crc8_result = 0;
-    uint8_t *p = input_data;
-    switch (model)
-    {
-    case CRC8_MODEL:
-        crc8_result = crc8_param[model].initial_value;
-        for (size_t i = 0; i < length - 1; i++) {
-            crc8_result = CRC8_8BIT_TABLE[(crc8_result ^ (*p++)) & 0xFF];
-        }
-        crc8_result ^= crc8_param[model].result_xor_value;
-        break;
-
-    case CRC8_ITU_MODEL:
-        crc8_result = crc8_param[model].initial_value;
-        for (size_t i = 0; i < length - 1; i++) {
-            crc8_result = CRC8_8BIT_ITU_TABLE[(crc8_result ^ (*p++)) & 0xFF];
-        }
-        crc8_result ^= crc8_param[model].result_xor_value;
-        break;
-
-    case CRC8_ROHC_MODEL:
-        crc8_result = crc8_param[model].initial_value;
-        for (size_t i = 0; i < length - 1; i++) {
-            crc8_result = CRC8_8BIT_ROHC_TABLE[(crc8_result ^ (*p++)) & 0xFF];
-        }
-        crc8_result ^= crc8_param[model].result_xor_value;
-        break;
-
-    case CRC8_MAXIM_MODEL:
-        crc8_result = crc8_param[model].initial_value;
-        for (size_t i = 0; i < length - 1; i++) {
-            crc8_result = CRC8_8BIT_MAXIM_TABLE[(crc8_result ^ (*p++)) & 0xFF];
-        }
-        crc8_result ^= crc8_param[model].result_xor_value;
-        break;
-
-    default:
-        break;
-    }
-
-    if (crc8_result != *(input_data + length - 1)) {
-        return false;
-    }
-    return true;
-}
-
-#define TEST
-#ifdef TEST
-#include <stdio.h>
-static void print_crc8_table(CRC8_reference_model_e model);
-
-int main() {
-/* test: crc8_calculate  */
-#if 0
-    uint8_t crc8_result;
-    uint8_t input_data0[8] = {0x03, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08}; // crc8 result: 0x3e
-
-    crc8_result  = crc8_calculate(CRC8_MODEL, input_data0, 1);
-    printf("CRC8_MODEL crc8_result: 0x%x\n", crc8_result);
-
-    crc8_result  = crc8_calculate_mirror_mode(CRC8_MODEL, input_data0, 1);
-    printf("CRC8_MODEL mirror mode crc8_result: 0x%x\n", crc8_result);
-
-    crc8_result  = crc8_calculate(CRC8_ITU_MODEL, input_data0, 1);
-    printf("CRC8_ITU_MODEL crc8_result: 0x%x\n", crc8_result);
-
-    crc8_result  = crc8_calculate_mirror_mode(CRC8_ITU_MODEL, input_data0, 1);
-    printf("CRC8_ITU_MODEL mirror mode crc8_result: 0x%x\n", crc8_result);
-
-    crc8_result  = crc8_calculate(CRC8_ROHC_MODEL, input_data0, 1);
-    printf("CRC8_ROHC_MODEL crc8_result: 0x%x\n", crc8_result);
-
-    crc8_result  = crc8_calculate_mirror_mode(CRC8_ROHC_MODEL, input_data0, 1);
-    printf("CRC8_ROHC_MODEL mirror mode crc8_result: 0x%x\n", crc8_result);
-
-    crc8_result  = crc8_calculate(CRC8_MAXIM_MODEL, input_data0, 1);
-    printf("CRC8_MAXIM_MODEL crc8_result: 0x%x\n", crc8_result);
-
-    crc8_result  = crc8_calculate_mirror_mode(CRC8_MAXIM_MODEL, input_data0, 1);
-    printf("CRC8_MAXIM_MODEL mirror mode crc8_result: 0x%x\n", crc8_result);
-#endif
-
-#if 0 /* printf crc8 8bit table */
-    print_crc8_table(CRC8_MODEL);
-    print_crc8_table(CRC8_ITU_MODEL);
-    print_crc8_table(CRC8_ROHC_MODEL);
-    print_crc8_table(CRC8_MAXIM_MODEL);
-#endif
-
-/* test crc8_calculate_package crc8_package_check */
-#if 1
-    printf("---------CRC8 calculation method-----------\n");
-    bool check_result;
-    uint8_t input_data[9] = {0x01, 0x02, 0x03, 0x05, 0x08, 0x07, 0x06, 0x05};
-
-    crc8_calculate_package(CRC8_MODEL, input_data, 9);
-    printf("CRC8_MODE result: 0x%02x \n", input_data[8]);
-    check_result = crc8_package_check(CRC8_MODEL, input_data, 9);
-    if (check_result) {
-        printf("CRC8_MODEL check succeed!\n");
-    } else {
-        printf("CRC8_MODEL check fails!\n");
-    }
-
-    crc8_calculate_package(CRC8_ITU_MODEL, input_data, 9);
-    printf("CRC8_ITU_MODEL result: 0x%02x \n", input_data[8]);
-    check_result = crc8_package_check(CRC8_ITU_MODEL, input_data, 9);
-    if (check_result) {
-        printf("CRC8_ITU_MODEL check succeed!\n");
-    } else {
-        printf("CRC8_ITU_MODEL check fails!\n");
-    }
-
-    crc8_calculate_package(CRC8_ROHC_MODEL, input_data, 9);
-    printf("CRC8_ROHC_MODEL result: 0x%02x \n", input_data[8]);
-    check_result = crc8_package_check(CRC8_ROHC_MODEL, input_data, 9);
-    if (check_result) {
-        printf("CRC8_ROHC_MODEL check succeed!\n");
-    } else {
-        printf("CRC8_ROHC_MODEL check fails!\n");
-    }
-
-    crc8_calculate_package(CRC8_MAXIM_MODEL, input_data, 9);
-    printf("CRC8_MAXIM_MODEL result: 0x%02x \n", input_data[8]);
-    check_result = crc8_package_check(CRC8_MAXIM_MODEL, input_data, 9);
-    if (check_result) {
-        printf("CRC8_MAXIM_MODEL check succeed!\n");
-    } else {
-        printf("CRC8_MAXIM_MODEL check fails!\n");
-    }
-#endif
-
-#if 1
-    printf("---------CRC8 lookup table-----------\n");
-    bool check_result2;
-    uint8_t input_data2[9] = {0x01, 0x02, 0x03, 0x05, 0x08, 0x07, 0x06, 0x05};
-
-    crc8_lookup_table_package(CRC8_MODEL, input_data2, 9);
-    printf("CRC8_MODEL result: 0x%02x \n", input_data2[8]);
-    check_result2 = crc8_lookup_table_package_check(CRC8_MODEL, input_data2, 9);
-    if (check_result2) {
-        printf("CRC8_MODEL check succeed!\n");
-    } else {
-        printf("CRC8_MODEL check fails!\n");
-    }
-
-    crc8_lookup_table_package(CRC8_ITU_MODEL, input_data2, 9);
-    printf("CRC8_ITU_MODEL result: 0x%02x \n", input_data2[8]);
-    check_result2 = crc8_lookup_table_package_check(CRC8_ITU_MODEL, input_data2, 9);
-    if (check_result2) {
-        printf("CRC8_ITU_MODEL check succeed!\n");
-    } else {
-        printf("CRC8_ITU_MODEL check fails!\n");
-    }
-
-    crc8_lookup_table_package(CRC8_ROHC_MODEL, input_data2, 9);
-    printf("CRC8_ROHC_MODEL result: 0x%02x \n", input_data2[8]);
-    check_result2 = crc8_lookup_table_package_check(CRC8_ROHC_MODEL, input_data2, 9);
-    if (check_result2) {
-        printf("CRC8_ROHC_MODEL check succeed!\n");
-    } else {
-        printf("CRC8_ROHC_MODEL check fails!\n");
-    }
-
-    crc8_lookup_table_package(CRC8_MAXIM_MODEL, input_data2, 9);
-    printf("CRC8_MAXIM_MODEL result: 0x%02x \n", input_data2[8]);
-    check_result2 = crc8_lookup_table_package_check(CRC8_MAXIM_MODEL, input_data2, 9);
-    if (check_result2) {
-        printf("CRC8_MAXIM_MODEL check succeed!\n");
-    } else {
-        printf("CRC8_MAXIM_MODEL check fails!\n");
-    }
-#endif
-    return 0;
-}
-
-static void print_crc8_table(CRC8_reference_model_e model) {
-    uint8_t crc8_result = 0;
-    uint8_t i = 0;
-    switch (model)
-    {
-    case CRC8_MODEL:
-        printf("/* Reference Model:CRC8 */\n");
-        printf("static const uint8_t CRC8_8BIT_TABLE[256] = {\n");
-        break;
-
-    case CRC8_ITU_MODEL:
-        printf("/* Reference Model:CRC8_ITU_MODEL */\n");
-        printf("static const uint8_t CRC8_8BIT_ITU_TABLE[256] = {\n");
-        break;
-
-    case CRC8_ROHC_MODEL:
-        printf("/* Reference Model:CRC8_ROHC_MODEL */\n");
-        printf("static const uint8_t CRC8_8BIT_ROHC_TABLE[256] = {\n");
-        break;
-
-    case CRC8_MAXIM_MODEL:
-        printf("/* Reference Model:CRC8_MAXIM_MODEL */\n");
-        printf("static const uint8_t CRC8_8BIT_MAXIM_TABLE[256] = {\n");
-        break;
-
-    default:
-        break;
-    }
-    for (int j = 0; j <= 0xFF; j++, i++) {
-        crc8_result = crc8_calculate(model, &i, 1);
-        if (i % 16 == 0) {
-            printf("    ");
-        } else {
-            printf(" ");
-        }
-        printf("0x%02X", crc8_result);
-        if (i != 0xFF) {
-            printf(",");
-        }
-        if ((i + 1) % 16 == 0) {
-            printf("\n");
-        }
-    }
-    printf("};\n");
-}
-#endif
+/**
+ * @file crc8.c
+ * @brief Cyclic Redundancy Check (CRC8)
+ * @copyright Copyright (c) 2023
+ *
+ * Change Logs:
+ * Data             Author                          Notes
+ * 2023-04-19       vector(vector_qiu@163.com)      first version
+ *
+ */
+#include "crc8.h"
+#include "../crc_config/crc_config.h"
+#include "../../checksum_stats/checksum_stats.h"
+#include "../../checksum_copy/checksum_copy.h"
+#include <assert.h>
+#include <string.h>
+
+/* 低空间占用可以使用4BIT table查表 */
+/* 16 entry nibble tables, two lookups per byte: 16 bytes per model instead of 256 */
+// #define CRC8_USE_NIBBLE_TABLE
+#ifndef CRC8_USE_NIBBLE_TABLE
+#if CRC8_MODELS & CRC8_MODEL_BIT
+/* Reference Model:CRC8 */
+const uint8_t CRC8_8BIT_TABLE[256] = {
+    0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D,
+    0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65, 0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D,
+    0xE0, 0xE7, 0xEE, 0xE9, 0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD,
+    0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1, 0xB4, 0xB3, 0xBA, 0xBD,
+    0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2, 0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA,
+    0xB7, 0xB0, 0xB9, 0xBE, 0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A,
+    0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0D, 0x0A,
+    0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42, 0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A,
+    0x89, 0x8E, 0x87, 0x80, 0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4,
+    0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8, 0xDD, 0xDA, 0xD3, 0xD4,
+    0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C, 0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44,
+    0x19, 0x1E, 0x17, 0x10, 0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34,
+    0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F, 0x6A, 0x6D, 0x64, 0x63,
+    0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B, 0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13,
+    0xAE, 0xA9, 0xA0, 0xA7, 0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83,
+    0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF, 0xFA, 0xFD, 0xF4, 0xF3
+};
+#endif
+#if CRC8_MODELS & CRC8_ITU_MODEL_BIT
+/* Reference Model:CRC8_ITU_MODEL */
+const uint8_t CRC8_8BIT_ITU_TABLE[256] = {
+    0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D,
+    0x70, 0x77, 0x7E, 0x79, 0x6C, 0x6B, 0x62, 0x65, 0x48, 0x4F, 0x46, 0x41, 0x54, 0x53, 0x5A, 0x5D,
+    0xE0, 0xE7, 0xEE, 0xE9, 0xFC, 0xFB, 0xF2, 0xF5, 0xD8, 0xDF, 0xD6, 0xD1, 0xC4, 0xC3, 0xCA, 0xCD,
+    0x90, 0x97, 0x9E, 0x99, 0x8C, 0x8B, 0x82, 0x85, 0xA8, 0xAF, 0xA6, 0xA1, 0xB4, 0xB3, 0xBA, 0xBD,
+    0xC7, 0xC0, 0xC9, 0xCE, 0xDB, 0xDC, 0xD5, 0xD2, 0xFF, 0xF8, 0xF1, 0xF6, 0xE3, 0xE4, 0xED, 0xEA,
+    0xB7, 0xB0, 0xB9, 0xBE, 0xAB, 0xAC, 0xA5, 0xA2, 0x8F, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9D, 0x9A,
+    0x27, 0x20, 0x29, 0x2E, 0x3B, 0x3C, 0x35, 0x32, 0x1F, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0D, 0x0A,
+    0x57, 0x50, 0x59, 0x5E, 0x4B, 0x4C, 0x45, 0x42, 0x6F, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7D, 0x7A,
+    0x89, 0x8E, 0x87, 0x80, 0x95, 0x92, 0x9B, 0x9C, 0xB1, 0xB6, 0xBF, 0xB8, 0xAD, 0xAA, 0xA3, 0xA4,
+    0xF9, 0xFE, 0xF7, 0xF0, 0xE5, 0xE2, 0xEB, 0xEC, 0xC1, 0xC6, 0xCF, 0xC8, 0xDD, 0xDA, 0xD3, 0xD4,
+    0x69, 0x6E, 0x67, 0x60, 0x75, 0x72, 0x7B, 0x7C, 0x51, 0x56, 0x5F, 0x58, 0x4D, 0x4A, 0x43, 0x44,
+    0x19, 0x1E, 0x17, 0x10, 0x05, 0x02, 0x0B, 0x0C, 0x21, 0x26, 0x2F, 0x28, 0x3D, 0x3A, 0x33, 0x34,
+    0x4E, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5C, 0x5B, 0x76, 0x71, 0x78, 0x7F, 0x6A, 0x6D, 0x64, 0x63,
+    0x3E, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2C, 0x2B, 0x06, 0x01, 0x08, 0x0F, 0x1A, 0x1D, 0x14, 0x13,
+    0xAE, 0xA9, 0xA0, 0xA7, 0xB2, 0xB5, 0xBC, 0xBB, 0x96, 0x91, 0x98, 0x9F, 0x8A, 0x8D, 0x84, 0x83,
+    0xDE, 0xD9, 0xD0, 0xD7, 0xC2, 0xC5, 0xCC, 0xCB, 0xE6, 0xE1, 0xE8, 0xEF, 0xFA, 0xFD, 0xF4, 0xF3
+};
+#endif
+#if CRC8_MODELS & CRC8_ROHC_MODEL_BIT
+/* Reference Model:CRC8_ROHC_MODEL */
+const uint8_t CRC8_8BIT_ROHC_TABLE[256] = {
+    0x00, 0x91, 0xE3, 0x72, 0x07, 0x96, 0xE4, 0x75, 0x0E, 0x9F, 0xED, 0x7C, 0x09, 0x98, 0xEA, 0x7B,
+    0x1C, 0x8D, 0xFF, 0x6E, 0x1B, 0x8A, 0xF8, 0x69, 0x12, 0x83, 0xF1, 0x60, 0x15, 0x84, 0xF6, 0x67,
+    0x38, 0xA9, 0xDB, 0x4A, 0x3F, 0xAE, 0xDC, 0x4D, 0x36, 0xA7, 0xD5, 0x44, 0x31, 0xA0, 0xD2, 0x43,
+    0x24, 0xB5, 0xC7, 0x56, 0x23, 0xB2, 0xC0, 0x51, 0x2A, 0xBB, 0xC9, 0x58, 0x2D, 0xBC, 0xCE, 0x5F,
+    0x70, 0xE1, 0x93, 0x02, 0x77, 0xE6, 0x94, 0x05, 0x7E, 0xEF, 0x9D, 0x0C, 0x79, 0xE8, 0x9A, 0x0B,
+    0x6C, 0xFD, 0x8F, 0x1E, 0x6B, 0xFA, 0x88, 0x19, 0x62, 0xF3, 0x81, 0x10, 0x65, 0xF4, 0x86, 0x17,
+    0x48, 0xD9, 0xAB, 0x3A, 0x4F, 0xDE, 0xAC, 0x3D, 0x46, 0xD7, 0xA5, 0x34, 0x41, 0xD0, 0xA2, 0x33,
+    0x54, 0xC5, 0xB7, 0x26, 0x53, 0xC2, 0xB0, 0x21, 0x5A, 0xCB, 0xB9, 0x28, 0x5D, 0xCC, 0xBE, 0x2F,
+    0xE0, 0x71, 0x03, 0x92, 0xE7, 0x76, 0x04, 0x95, 0xEE, 0x7F, 0x0D, 0x9C, 0xE9, 0x78, 0x0A, 0x9B,
+    0xFC, 0x6D, 0x1F, 0x8E, 0xFB, 0x6A, 0x18, 0x89, 0xF2, 0x63, 0x11, 0x80, 0xF5, 0x64, 0x16, 0x87,
+    0xD8, 0x49, 0x3B, 0xAA, 0xDF, 0x4E, 0x3C, 0xAD, 0xD6, 0x47, 0x35, 0xA4, 0xD1, 0x40, 0x32, 0xA3,
+    0xC4, 0x55, 0x27, 0xB6, 0xC3, 0x52, 0x20, 0xB1, 0xCA, 0x5B, 0x29, 0xB8, 0xCD, 0x5C, 0x2E, 0xBF,
+    0x90, 0x01, 0x73, 0xE2, 0x97, 0x06, 0x74, 0xE5, 0x9E, 0x0F, 0x7D, 0xEC, 0x99, 0x08, 0x7A, 0xEB,
+    0x8C, 0x1D, 0x6F, 0xFE, 0x8B, 0x1A, 0x68, 0xF9, 0x82, 0x13, 0x61, 0xF0, 0x85, 0x14, 0x66, 0xF7,
+    0xA8, 0x39, 0x4B, 0xDA, 0xAF, 0x3E, 0x4C, 0xDD, 0xA6, 0x37, 0x45, 0xD4, 0xA1, 0x30, 0x42, 0xD3,
+    0xB4, 0x25, 0x57, 0xC6, 0xB3, 0x22, 0x50, 0xC1, 0xBA, 0x2B, 0x59, 0xC8, 0xBD, 0x2C, 0x5E, 0xCF
+};
+#endif
+#if CRC8_MODELS & CRC8_MAXIM_MODEL_BIT
+/* Reference Model:CRC8_MAXIM_MODEL */
+const uint8_t CRC8_8BIT_MAXIM_TABLE[256] = {
+    0x00, 0x5E, 0xBC, 0xE2, 0x61, 0x3F, 0xDD, 0x83, 0xC2, 0x9C, 0x7E, 0x20, 0xA3, 0xFD, 0x1F, 0x41,
+    0x9D, 0xC3, 0x21, 0x7F, 0xFC, 0xA2, 0x40, 0x1E, 0x5F, 0x01, 0xE3, 0xBD, 0x3E, 0x60, 0x82, 0xDC,
+    0x23, 0x7D, 0x9F, 0xC1, 0x42, 0x1C, 0xFE, 0xA0, 0xE1, 0xBF, 0x5D, 0x03, 0x80, 0xDE, 0x3C, 0x62,
+    0xBE, 0xE0, 0x02, 0x5C, 0xDF, 0x81, 0x63, 0x3D, 0x7C, 0x22, 0xC0, 0x9E, 0x1D, 0x43, 0xA1, 0xFF,
+    0x46, 0x18, 0xFA, 0xA4, 0x27, 0x79, 0x9B, 0xC5, 0x84, 0xDA, 0x38, 0x66, 0xE5, 0xBB, 0x59, 0x07,
+    0xDB, 0x85, 0x67, 0x39, 0xBA, 0xE4, 0x06, 0x58, 0x19, 0x47, 0xA5, 0xFB, 0x78, 0x26, 0xC4, 0x9A,
+    0x65, 0x3B, 0xD9, 0x87, 0x04, 0x5A, 0xB8, 0xE6, 0xA7, 0xF9, 0x1B, 0x45, 0xC6, 0x98, 0x7A, 0x24,
+    0xF8, 0xA6, 0x44, 0x1A, 0x99, 0xC7, 0x25, 0x7B, 0x3A, 0x64, 0x86, 0xD8, 0x5B, 0x05, 0xE7, 0xB9,
+    0x8C, 0xD2, 0x30, 0x6E, 0xED, 0xB3, 0x51, 0x0F, 0x4E, 0x10, 0xF2, 0xAC, 0x2F, 0x71, 0x93, 0xCD,
+    0x11, 0x4F, 0xAD, 0xF3, 0x70, 0x2E, 0xCC, 0x92, 0xD3, 0x8D, 0x6F, 0x31, 0xB2, 0xEC, 0x0E, 0x50,
+    0xAF, 0xF1, 0x13, 0x4D, 0xCE, 0x90, 0x72, 0x2C, 0x6D, 0x33, 0xD1, 0x8F, 0x0C, 0x52, 0xB0, 0xEE,
+    0x32, 0x6C, 0x8E, 0xD0, 0x53, 0x0D, 0xEF, 0xB1, 0xF0, 0xAE, 0x4C, 0x12, 0x91, 0xCF, 0x2D, 0x73,
+    0xCA, 0x94, 0x76, 0x28, 0xAB, 0xF5, 0x17, 0x49, 0x08, 0x56, 0xB4, 0xEA, 0x69, 0x37, 0xD5, 0x8B,
+    0x57, 0x09, 0xEB, 0xB5, 0x36, 0x68, 0x8A, 0xD4, 0x95, 0xCB, 0x29, 0x77, 0xF4, 0xAA, 0x48, 0x16,
+    0xE9, 0xB7, 0x55, 0x0B, 0x88, 0xD6, 0x34, 0x6A, 0x2B, 0x75, 0x97, 0xC9, 0x4A, 0x14, 0xF6, 0xA8,
+    0x74, 0x2A, 0xC8, 0x96, 0x15, 0x4B, 0xA9, 0xF7, 0xB6, 0xE8, 0x0A, 0x54, 0xD7, 0x89, 0x6B, 0x35
+};
+#endif
+#endif
+/* Reference Model:CRC8_MODEL, CRC8_ITU_MODEL */
+static const uint8_t CRC8_07_NORMAL_NIBBLE_TABLE[16] = {
+    0x00, 0x07, 0x0E, 0x09, 0x1C, 0x1B, 0x12, 0x15, 0x38, 0x3F, 0x36, 0x31, 0x24, 0x23, 0x2A, 0x2D
+};
+/* Reference Model:CRC8_ROHC_MODEL */
+static const uint8_t CRC8_07_REFLECTED_NIBBLE_TABLE[16] = {
+    0x00, 0x1C, 0x38, 0x24, 0x70, 0x6C, 0x48, 0x54, 0xE0, 0xFC, 0xD8, 0xC4, 0x90, 0x8C, 0xA8, 0xB4
+};
+/* Reference Model:CRC8_MAXIM_MODEL */
+static const uint8_t CRC8_31_REFLECTED_NIBBLE_TABLE[16] = {
+    0x00, 0x9D, 0x23, 0xBE, 0x46, 0xDB, 0x65, 0xF8, 0x8C, 0x11, 0xAF, 0x32, 0xCA, 0x57, 0xE9, 0x74
+};
+static const uint8_t *const CRC8_NIBBLE_TABLE[CRC8_NONE_MODEL] = {
+    CRC8_07_NORMAL_NIBBLE_TABLE,      // Reference Model:CRC8_MODEL
+    CRC8_07_NORMAL_NIBBLE_TABLE,      // Reference Model:CRC8_ITU_MODEL
+    CRC8_07_REFLECTED_NIBBLE_TABLE,   // Reference Model:CRC8_ROHC_MODEL
+    CRC8_31_REFLECTED_NIBBLE_TABLE,   // Reference Model:CRC8_MAXIM_MODEL
+};
+
+/* http://www.ip33.com/crc.html */
+/* polynomial discard MSB or LSB because they are always 1 */
+typedef struct {
+    uint8_t initial_value;
+    uint8_t result_xor_value;
+    uint8_t polynomial;
+    bool input_inversion;
+    bool output_inversion;
+} crc8_param_t;
+
+// #define PRINT_TABLE
+#ifndef PRINT_TABLE
+static crc8_param_t crc8_param[] = {
+    {0x00, 0x00, 0x07, false, false},       // Reference Model:CRC8
+    {0x00, 0x55, 0x07, false, false},       // Reference Model:CRC8_ITU
+    {0xFF, 0x00, 0x07, true, true},         // Reference Model:CRC8_ROHC
+    {0x00, 0x00, 0x31, true, true},         // Reference Model:CRC8_MAXIM
+};
+#else
+/* Generate table usage */
+static crc8_param_t crc8_param[] = {
+    {0x00, 0x00, 0x07, false, false},       // Reference Model:CRC8
+    {0x00, 0x00, 0x07, false, false},       // Reference Model:CRC8_ITU
+    {0x00, 0x00, 0x07, true, true},         // Reference Model:CRC8_ROHC
+    {0x00, 0x00, 0x31, true, true},         // Reference Model:CRC8_MAXIM
+};
+#endif
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_bitreverse32)
+#define CRC8_BUILTIN_BITREVERSE32
+#endif
+#endif
+
+/**
+ * @brief uint32_t type bit reverse, uses the target's bit reverse instruction where there is one
+ *
+ * @param data Data to be reversed
+ * @return uint32_t The reversed data
+ */
+static inline uint32_t u32_bit_reverse(uint32_t data) {
+#if defined(CRC8_BUILTIN_BITREVERSE32)
+    return __builtin_bitreverse32(data);
+#elif defined(__GNUC__) && defined(__aarch64__)
+    __asm__("rbit %w0, %w1" : "=r"(data) : "r"(data));
+    return data;
+#elif defined(__GNUC__) && defined(__arm__) && defined(__ARM_ARCH) && (__ARM_ARCH >= 7) && !defined(__ARM_ARCH_8M_BASE__)
+    __asm__("rbit %0, %1" : "=r"(data) : "r"(data));
+    return data;
+#else
+    data = ((data >> 1) & 0x55555555) | ((data & 0x55555555) << 1);
+    data = ((data >> 2) & 0x33333333) | ((data & 0x33333333) << 2);
+    data = ((data >> 4) & 0x0F0F0F0F) | ((data & 0x0F0F0F0F) << 4);
+    data = ((data >> 8) & 0x00FF00FF) | ((data & 0x00FF00FF) << 8);
+    return (data >> 16) | (data << 16);
+#endif
+}
+
+/**
+ * @brief uint8_t type data inversion
+ *
+ * @param data Data to be reversed
+ * @return uint8_t The reversed data
+ */
+static uint8_t data_inversion(uint8_t data) {
+    return (uint8_t)(u32_bit_reverse(data) >> 24);
+}
+
+#ifndef CRC_NO_BITWISE
+/**
+ * @brief Calculates the 8 bit wide CRC of an input data of a given length bit by bit.
+ *
+ * @param param CRC8 reference model
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint8_t CRC8 result
+ */
+static uint8_t crc8_bitwise_calculate(CRC8_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC8_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    CHECKSUM_STATS_BEGIN(stats_start);
+    uint8_t crc8;
+    uint8_t polynomial;
+
+    if (crc8_param[model].input_inversion) {
+        /* reflected domain: the register holds the bit reversed CRC and data enters at the LSB,
+           so neither the input bytes nor the register need reversing per byte */
+        crc8 = data_inversion(crc8_param[model].initial_value);
+        polynomial = data_inversion(crc8_param[model].polynomial);
+        for (size_t i = 0; i < length; i++) {
+            crc8 ^= *input_data++;
+            for (uint8_t j = 0; j < 8; j++) {
+                crc8 = (uint8_t)((crc8 >> 1) ^ (polynomial & (0u - (crc8 & 1u))));
+            }
+        }
+        if (!crc8_param[model].output_inversion) {
+            crc8 = data_inversion(crc8);
+        }
+    } else {
+        crc8 = crc8_param[model].initial_value;
+        polynomial = crc8_param[model].polynomial;
+        for (size_t i = 0; i < length; i++) {
+            crc8 ^= (uint8_t)*input_data++;
+            for (uint8_t j = 0; j < 8; j++) {
+                crc8 = (uint8_t)((crc8 << 1) ^ (polynomial & (0u - (crc8 >> 7))));
+            }
+        }
+        if (crc8_param[model].output_inversion) {
+            crc8 = data_inversion(crc8);
+        }
+    }
+
+    crc8 ^= crc8_param[model].result_xor_value;
+    CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC8, model, CHECKSUM_STATS_BITWISE, length, stats_start);
+    return crc8;
+}
+#endif
+
+/**
+ * @brief The mirror mode computes the 8-bit wide CRC of the input data of a given length.
+ *
+ * @param param CRC8 reference model
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint8_t CRC8 result
+ */
+uint8_t crc8_calculate_mirror_mode(CRC8_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC8_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    CHECKSUM_STATS_BEGIN(stats_start);
+    uint8_t crc8 = crc8_param[model].initial_value;
+    uint8_t polynomial = data_inversion(crc8_param[model].polynomial);
+    uint8_t data;
+
+    for (size_t i = 0; i < length; i++) {
+        data = *input_data++;
+        if (!crc8_param[model].input_inversion) {
+            data = data_inversion(data);
+        }
+        crc8 ^= data;
+        for (uint8_t j = 0; j < 8; j++) {
+            if (crc8 & 0x01) {
+                crc8 >>= 1;
+                crc8 ^= polynomial; //  polynomial discard MSB or LSB because they are always 1, don't need to compute
+            } else {
+                crc8 >>= 1;
+            }
+
+        }
+    }
+
+    if (!crc8_param[model].output_inversion) {
+        crc8 = data_inversion(crc8);
+    }
+
+    crc8 ^= crc8_param[model].result_xor_value;
+    CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC8, model, CHECKSUM_STATS_MIRROR, length, stats_start);
+    return crc8;
+}
+
+/**
+ * @brief CRC8 calculation method group package
+ *
+ * @param param CRC8 reference model
+ * @param input_data Packets of CRC8 to be computed, last byte of the array holds the CRC8 result
+ * @param length Length of the CRC8 packet
+ */
+void crc8_calculate_package(CRC8_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC8_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    uint8_t crc8_result = 0;
+    crc8_result = crc8_calculate(model, input_data, length - 1);
+    *(input_data + length - 1) = crc8_result & 0xFF;
+}
+
+/**
+ * @brief Runs the CRC8 register over the input with the model's nibble table.
+ *
+ * @param model CRC8 reference model
+ * @param crc CRC8 register, initial value included and result xor value excluded
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint8_t CRC8 register
+ */
+static uint8_t crc8_nibble_table_update(CRC8_reference_model_e model, uint8_t crc, uint8_t *input_data, size_t length) {
+    const uint8_t *table = CRC8_NIBBLE_TABLE[model];
+    uint8_t *p = input_data;
+
+    if (crc8_param[model].input_inversion) {
+        for (size_t i = 0; i < length; i++) {
+            crc = (crc >> 4) ^ table[(crc ^ *p) & 0x0F];
+            crc = (crc >> 4) ^ table[(crc ^ (*p++ >> 4)) & 0x0F];
+        }
+    } else {
+        for (size_t i = 0; i < length; i++) {
+            crc = (crc << 4) ^ table[((crc >> 4) ^ (*p >> 4)) & 0x0F];
+            crc = (crc << 4) ^ table[((crc >> 4) ^ *p++) & 0x0F];
+        }
+    }
+
+    return crc;
+}
+
+/* failed lookup table checks are counted against the tables, whichever kernel ran */
+#ifdef CRC8_USE_NIBBLE_TABLE
+#define CRC8_STATS_LOOKUP CHECKSUM_STATS_NIBBLE
+#else
+#define CRC8_STATS_LOOKUP CHECKSUM_STATS_TABLE
+#endif
+
+/**
+ * @brief Runs the CRC8 register over the input with the model's lookup table.
+ *
+ * @param model CRC8 reference model
+ * @param crc CRC8 register, initial value included and result xor value excluded
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint8_t CRC8 register
+ */
+static uint8_t crc8_lookup_table_update(CRC8_reference_model_e model, uint8_t crc, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(CRC8_MODEL_ENABLED(model));
+
+    CHECKSUM_STATS_BEGIN(stats_start);
+#ifdef CRC8_USE_NIBBLE_TABLE
+    crc = crc8_nibble_table_update(model, crc, input_data, length);
+    CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC8, model, CHECKSUM_STATS_NIBBLE, length, stats_start);
+    return crc;
+#else
+    uint8_t *p = input_data;
+    switch (model)
+    {
+#if CRC8_MODELS & CRC8_MODEL_BIT
+    case CRC8_MODEL:
+        for (size_t i = 0; i < length; i++) {
+            crc = CRC8_8BIT_TABLE[(crc ^ (*p++)) & 0xFF];
+        }
+        break;
+#endif
+
+#if CRC8_MODELS & CRC8_ITU_MODEL_BIT
+    case CRC8_ITU_MODEL:
+        for (size_t i = 0; i < length; i++) {
+            crc = CRC8_8BIT_ITU_TABLE[(crc ^ (*p++)) & 0xFF];
+        }
+        break;
+#endif
+
+#if CRC8_MODELS & CRC8_ROHC_MODEL_BIT
+    case CRC8_ROHC_MODEL:
+        for (size_t i = 0; i < length; i++) {
+            crc = CRC8_8BIT_ROHC_TABLE[(crc ^ (*p++)) & 0xFF];
+        }
+        break;
+#endif
+
+#if CRC8_MODELS & CRC8_MAXIM_MODEL_BIT
+    case CRC8_MAXIM_MODEL:
+        for (size_t i = 0; i < length; i++) {
+            crc = CRC8_8BIT_MAXIM_TABLE[(crc ^ (*p++)) & 0xFF];
+        }
+        break;
+#endif
+
+    default:
+        break;
+    }
+
+    CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC8, model, CHECKSUM_STATS_TABLE, length, stats_start);
+    return crc;
+#endif
+}
+
+#ifndef CRC_NO_SLICING
+/* Slicing tables generated from crc8_param on first use: entry i of table k is the CRC8
+   register after byte i followed by k zero bytes, table 0 being the byte table. 2 KiB per
+   model, rows only for the models compiled in. */
+static uint8_t crc8_slice_table[CRC_MODEL_COUNT(CRC8_MODELS)][8][256];
+static bool crc8_slice_table_ready[CRC_MODEL_COUNT(CRC8_MODELS)];
+
+/* shorter inputs run byte by byte in the lookup table functions */
+#define CRC8_SLICE_MIN_LENGTH 16
+
+/* CRC8 models fold 16/32 byte blocks with SSSE3/AVX2 byte shuffles when the CPU has them, checked once at run time */
+// #define CRC8_NO_HARDWARE
+#if !defined(CRC8_NO_HARDWARE) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CRC8_SHUFFLE
+#include <immintrin.h>
+
+/* shorter inputs are left to slicing-by-8 */
+#define CRC8_SHUFFLE_MIN_LENGTH 64
+
+/* Folding over d bytes maps every byte a of a block to the CRC8 register of a followed by
+   d - 1 zero bytes, the same map for every byte position, so a block folds lane by lane.
+   The map is linear: {low nibble, high nibble} 16 entry tables, one PSHUFB each.
+   Distances 16 (SSSE3), 32 (AVX2 and combining its accumulators) and 128 (four AVX2 accumulators). */
+enum {
+    CRC8_FOLD_16 = 0,
+    CRC8_FOLD_32,
+    CRC8_FOLD_128,
+    CRC8_FOLDS,
+};
+static const size_t crc8_fold_distance[CRC8_FOLDS] = {16, 32, 128};
+static uint8_t crc8_fold_table[CRC_MODEL_COUNT(CRC8_MODELS)][CRC8_FOLDS][2][16];
+
+static int crc8_shuffle = -1;
+
+/**
+ * @brief Checks once whether the CPU has the byte shuffle instructions
+ *
+ * @return int 0 none, 1 SSSE3, 2 SSSE3 and AVX2
+ */
+static int crc8_shuffle_supported(void) {
+    if (crc8_shuffle < 0) {
+        __builtin_cpu_init();
+        crc8_shuffle = __builtin_cpu_supports("ssse3") ? (__builtin_cpu_supports("avx2") ? 2 : 1) : 0;
+    }
+    return crc8_shuffle;
+}
+#endif
+
+/**
+ * @brief Generates the slicing tables of a model from its polynomial
+ *
+ * @param model CRC8 reference model
+ */
+static void crc8_slice_table_init(CRC8_reference_model_e model) {
+    uint8_t (*t)[256] = crc8_slice_table[CRC8_MODEL_SLOT(model)];
+    uint8_t polynomial = crc8_param[model].polynomial;
+    uint8_t crc;
+
+    if (crc8_param[model].input_inversion) {
+        polynomial = data_inversion(polynomial);
+    }
+    for (int i = 0; i < 256; i++) {
+        crc = (uint8_t)i;
+        for (int bit = 0; bit < 8; bit++) {
+            if (crc8_param[model].input_inversion) {
+                crc = (crc & 0x01) ? (uint8_t)((crc >> 1) ^ polynomial) : (uint8_t)(crc >> 1);
+            } else {
+                crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ polynomial) : (uint8_t)(crc << 1);
+            }
+        }
+        t[0][i] = crc;
+    }
+    /* one more zero byte: the whole register is shifted out through the byte table */
+    for (int k = 1; k < 8; k++) {
+        for (int i = 0; i < 256; i++) {
+            t[k][i] = t[0][t[k - 1][i]];
+        }
+    }
+#ifdef CRC8_SHUFFLE
+    for (int f = 0; f < CRC8_FOLDS; f++) {
+        for (int i = 0; i < 16; i++) {
+            uint8_t low = t[0][i], high = t[0][i << 4];
+            for (size_t k = 1; k < crc8_fold_distance[f]; k++) {
+                low = t[0][low];
+                high = t[0][high];
+            }
+            crc8_fold_table[CRC8_MODEL_SLOT(model)][f][0][i] = low;
+            crc8_fold_table[CRC8_MODEL_SLOT(model)][f][1][i] = high;
+        }
+    }
+#endif
+    /* generating is idempotent, racing first users write the same values */
+#if defined(__GNUC__)
+    __atomic_store_n(&crc8_slice_table_ready[CRC8_MODEL_SLOT(model)], true, __ATOMIC_RELEASE);
+#else
+    crc8_slice_table_ready[CRC8_MODEL_SLOT(model)] = true;
+#endif
+}
+
+/**
+ * @brief Runs the CRC8 register over the input four or eight bytes at a time (slicing-by-4/8).
+ *
+ * @param model CRC8 reference model
+ * @param crc CRC8 register, initial value included and result xor value excluded
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @param slices Bytes per step, 4 or 8
+ * @return uint8_t CRC8 register
+ */
+static uint8_t crc8_slice_update(CRC8_reference_model_e model, uint8_t crc, uint8_t *input_data, size_t length, int slices) {
+    /* parameter checkout */
+    assert(CRC8_MODEL_ENABLED(model));
+
+    CHECKSUM_STATS_BEGIN(stats_start);
+#if defined(__GNUC__)
+    if (!__atomic_load_n(&crc8_slice_table_ready[CRC8_MODEL_SLOT(model)], __ATOMIC_ACQUIRE)) {
+#else
+    if (!crc8_slice_table_ready[CRC8_MODEL_SLOT(model)]) {
+#endif
+        crc8_slice_table_init(model);
+    }
+
+    const uint8_t (*t)[256] = (const uint8_t (*)[256])crc8_slice_table[CRC8_MODEL_SLOT(model)];
+    uint8_t *p = input_data;
+    size_t n = length;
+
+    /* the register is a single byte, so reflected and normal models slice alike */
+    if (slices == 8) {
+        for (; n >= 8; n -= 8, p += 8) {
+            crc = t[7][crc ^ p[0]] ^ t[6][p[1]] ^ t[5][p[2]] ^ t[4][p[3]] ^
+                  t[3][p[4]] ^ t[2][p[5]] ^ t[1][p[6]] ^ t[0][p[7]];
+        }
+    }
+    for (; n >= 4; n -= 4, p += 4) {
+        crc = t[3][crc ^ p[0]] ^ t[2][p[1]] ^ t[1][p[2]] ^ t[0][p[3]];
+    }
+    for (; n > 0; n--) {
+        crc = t[0][crc ^ *p++];
+    }
+
+    CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC8, model, CHECKSUM_STATS_SLICING, length, stats_start);
+    return crc;
+}
+
+#ifdef CRC8_SHUFFLE
+/**
+ * @brief Folds a 16 byte block over a distance: both nibbles of every byte looked up by PSHUFB
+ */
+__attribute__((target("ssse3")))
+static inline __m128i crc8_shuffle_fold(__m128i block, __m128i low, __m128i high) {
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    return _mm_xor_si128(_mm_shuffle_epi8(low, _mm_and_si128(block, mask)),
+                         _mm_shuffle_epi8(high, _mm_and_si128(_mm_srli_epi16(block, 4), mask)));
+}
+
+/**
+ * @brief Folds a 32 byte block over a distance with VPSHUFB, the 16 entry tables in both lanes
+ */
+__attribute__((target("avx2")))
+static inline __m256i crc8_shuffle_fold256(__m256i block, __m256i low, __m256i high) {
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    return _mm256_xor_si256(_mm256_shuffle_epi8(low, _mm256_and_si256(block, mask)),
+                            _mm256_shuffle_epi8(high, _mm256_and_si256(_mm256_srli_epi16(block, 4), mask)));
+}
+
+/**
+ * @brief Runs the CRC8 register over the folded block and then the tail with the byte table.
+ *        The folded block has the same CRC8 as everything folded into it.
+ */
+static uint8_t crc8_shuffle_finish(const uint8_t (*t)[256], const uint8_t *block, size_t block_length,
+                                   const uint8_t *tail, size_t tail_length) {
+    uint8_t crc = 0;
+    for (size_t i = 0; i < block_length; i++) {
+        crc = t[0][crc ^ block[i]];
+    }
+    for (size_t i = 0; i < tail_length; i++) {
+        crc = t[0][crc ^ tail[i]];
+    }
+    return crc;
+}
+
+/**
+ * @brief Runs the CRC8 register over at least 16 bytes by folding 16 byte blocks with SSSE3
+ *
+ * @param model CRC8 reference model, slicing tables ready
+ * @param crc CRC8 register, initial value included and result xor value excluded
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length, at least 16
+ * @return uint8_t CRC8 register
+ */
+__attribute__((target("ssse3")))
+static uint8_t crc8_shuffle_ssse3_update(CRC8_reference_model_e model, uint8_t crc, uint8_t *input_data, size_t length) {
+    const uint8_t (*fold)[16] = (const uint8_t (*)[16])crc8_fold_table[CRC8_MODEL_SLOT(model)][CRC8_FOLD_16];
+    const __m128i low = _mm_loadu_si128((const __m128i *)fold[0]);
+    const __m128i high = _mm_loadu_si128((const __m128i *)fold[1]);
+    uint8_t *p = input_data;
+    uint8_t block[16];
+
+    /* the register only ever meets the first byte */
+    __m128i x = _mm_xor_si128(_mm_loadu_si128((const __m128i *)p), _mm_cvtsi32_si128(crc));
+    for (p += 16, length -= 16; length >= 16; p += 16, length -= 16) {
+        x = _mm_xor_si128(crc8_shuffle_fold(x, low, high), _mm_loadu_si128((const __m128i *)p));
+    }
+    _mm_storeu_si128((__m128i *)block, x);
+
+    return crc8_shuffle_finish((const uint8_t (*)[256])crc8_slice_table[CRC8_MODEL_SLOT(model)], block, sizeof(block), p, length);
+}
+
+/**
+ * @brief Runs the CRC8 register over at least 128 bytes with four 32 byte AVX2 accumulators
+ *        folding over 128 bytes, then folded into one and on over 32 byte blocks
+ *
+ * @param model CRC8 reference model, slicing tables ready
+ * @param crc CRC8 register, initial value included and result xor value excluded
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length, at least 128
+ * @return uint8_t CRC8 register
+ */
+__attribute__((target("avx2")))
+static uint8_t crc8_shuffle_avx2_update(CRC8_reference_model_e model, uint8_t crc, uint8_t *input_data, size_t length) {
+    const uint8_t (*fold128)[16] = (const uint8_t (*)[16])crc8_fold_table[CRC8_MODEL_SLOT(model)][CRC8_FOLD_128];
+    const uint8_t (*fold32)[16] = (const uint8_t (*)[16])crc8_fold_table[CRC8_MODEL_SLOT(model)][CRC8_FOLD_32];
+    const __m256i low128 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)fold128[0]));
+    const __m256i high128 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)fold128[1]));
+    const __m256i low32 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)fold32[0]));
+    const __m256i high32 = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)fold32[1]));
+    uint8_t *p = input_data;
+    uint8_t block[32];
+
+    __m256i x0 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)p), _mm256_set_epi64x(0, 0, 0, crc));
+    __m256i x1 = _mm256_loadu_si256((const __m256i *)(p + 32));
+    __m256i x2 = _mm256_loadu_si256((const __m256i *)(p + 64));
+    __m256i x3 = _mm256_loadu_si256((const __m256i *)(p + 96));
+    for (p += 128, length -= 128; length >= 128; p += 128, length -= 128) {
+        x0 = _mm256_xor_si256(crc8_shuffle_fold256(x0, low128, high128), _mm256_loadu_si256((const __m256i *)p));
+        x1 = _mm256_xor_si256(crc8_shuffle_fold256(x1, low128, high128), _mm256_loadu_si256((const __m256i *)(p + 32)));
+        x2 = _mm256_xor_si256(crc8_shuffle_fold256(x2, low128, high128), _mm256_loadu_si256((const __m256i *)(p + 64)));
+        x3 = _mm256_xor_si256(crc8_shuffle_fold256(x3, low128, high128), _mm256_loadu_si256((const __m256i *)(p + 96)));
+    }
+
+    /* each accumulator is 32 bytes ahead of the next */
+    x1 = _mm256_xor_si256(x1, crc8_shuffle_fold256(x0, low32, high32));
+    x2 = _mm256_xor_si256(x2, crc8_shuffle_fold256(x1, low32, high32));
+    x3 = _mm256_xor_si256(x3, crc8_shuffle_fold256(x2, low32, high32));
+    for (; length >= 32; p += 32, length -= 32) {
+        x3 = _mm256_xor_si256(crc8_shuffle_fold256(x3, low32, high32), _mm256_loadu_si256((const __m256i *)p));
+    }
+    _mm256_storeu_si256((__m256i *)block, x3);
+
+    return crc8_shuffle_finish((const uint8_t (*)[256])crc8_slice_table[CRC8_MODEL_SLOT(model)], block, sizeof(block), p, length);
+}
+#endif
+#else
+/**
+ * @brief Built without slicing: the slicing kernels run the lookup table
+ *
+ * @param model CRC8 reference model
+ * @param crc CRC8 register, initial value included and result xor value excluded
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @param slices Ignored
+ * @return uint8_t CRC8 register
+ */
+static uint8_t crc8_slice_update(CRC8_reference_model_e model, uint8_t crc, uint8_t *input_data, size_t length, int slices) {
+    (void)slices;
+    return crc8_lookup_table_update(model, crc, input_data, length);
+}
+#endif /* CRC_NO_SLICING */
+
+/**
+ * @brief Runs the CRC8 register over the input with SSSE3/AVX2 folding, slicing-by-8 for short
+ *        inputs or CPUs without the shuffle instructions
+ *
+ * @param model CRC8 reference model
+ * @param crc CRC8 register, initial value included and result xor value excluded
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint8_t CRC8 register
+ */
+static uint8_t crc8_shuffle_update(CRC8_reference_model_e model, uint8_t crc, uint8_t *input_data, size_t length) {
+#ifdef CRC8_SHUFFLE
+    int shuffle = crc8_shuffle_supported();
+    if (shuffle > 0 && length >= 16) {
+        CHECKSUM_STATS_BEGIN(stats_start);
+#if defined(__GNUC__)
+        if (!__atomic_load_n(&crc8_slice_table_ready[CRC8_MODEL_SLOT(model)], __ATOMIC_ACQUIRE)) {
+#else
+        if (!crc8_slice_table_ready[CRC8_MODEL_SLOT(model)]) {
+#endif
+            crc8_slice_table_init(model);
+        }
+        if (shuffle > 1 && length >= 128) {
+            crc = crc8_shuffle_avx2_update(model, crc, input_data, length);
+        } else {
+            crc = crc8_shuffle_ssse3_update(model, crc, input_data, length);
+        }
+        CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC8, model, CHECKSUM_STATS_HARDWARE, length, stats_start);
+        return crc;
+    }
+#endif
+    return crc8_slice_update(model, crc, input_data, length, 8);
+}
+
+/**
+ * @brief Runs the CRC8 register over the input with the lookup tables: byte shuffle folding from
+ *        CRC8_SHUFFLE_MIN_LENGTH bytes where the CPU has it, slicing-by-8 from CRC8_SLICE_MIN_LENGTH
+ *        bytes, byte by byte below or when built for nibble tables.
+ *
+ * @param model CRC8 reference model
+ * @param crc CRC8 register, initial value included and result xor value excluded
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint8_t CRC8 register
+ */
+static uint8_t crc8_table_update(CRC8_reference_model_e model, uint8_t crc, uint8_t *input_data, size_t length) {
+#if !defined(CRC8_USE_NIBBLE_TABLE) && !defined(CRC_NO_SLICING)
+#ifdef CRC8_SHUFFLE
+    if (length >= CRC8_SHUFFLE_MIN_LENGTH) {
+        return crc8_shuffle_update(model, crc, input_data, length);
+    }
+#endif
+    if (length >= CRC8_SLICE_MIN_LENGTH) {
+        return crc8_slice_update(model, crc, input_data, length, 8);
+    }
+#endif
+    return crc8_lookup_table_update(model, crc, input_data, length);
+}
+
+/**
+ * @brief Calculates the 8 bit wide CRC of an input data of a given length with the model's lookup table.
+ *
+ * @param model CRC8 reference model
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint8_t CRC8 result
+ */
+static uint8_t crc8_lookup_table_calculate(CRC8_reference_model_e model, uint8_t *input_data, size_t length) {
+    return crc8_table_update(model, crc8_param[model].initial_value, input_data, length) ^ crc8_param[model].result_xor_value;
+}
+
+/* Lengths from which crc8_calculate switches to each kernel, per model; 0 leaves the kernel unused,
+   so everything runs bitwise until crc8_route_set or the autotuner sets thresholds */
+static size_t crc8_route_threshold[CRC8_NONE_MODEL][CRC8_KERNEL_NONE];
+
+#ifdef CHECKSUM_STATS
+static const checksum_stats_implementation_e crc8_kernel_stats[CRC8_KERNEL_NONE] = {
+    CHECKSUM_STATS_BITWISE, CHECKSUM_STATS_NIBBLE, CRC8_STATS_LOOKUP, CHECKSUM_STATS_SLICING, CHECKSUM_STATS_SLICING, CHECKSUM_STATS_HARDWARE,
+};
+#endif
+
+/**
+ * @brief Picks the kernel for a length: the last one whose threshold the length reaches
+ *
+ * @param model CRC8 reference model
+ * @param length Input length
+ * @return crc8_kernel_e Kernel
+ */
+static inline crc8_kernel_e crc8_route(CRC8_reference_model_e model, size_t length) {
+    crc8_kernel_e kernel = CRC8_KERNEL_BITWISE;
+    for (int k = CRC8_KERNEL_BITWISE + 1; k < CRC8_KERNEL_NONE; k++) {
+        if (crc8_route_threshold[model][k] != 0 && length >= crc8_route_threshold[model][k]) {
+            kernel = (crc8_kernel_e)k;
+        }
+    }
+    return kernel;
+}
+
+/**
+ * @brief Tells whether a kernel can run a model on this build and CPU
+ *
+ * @param model CRC8 reference model
+ * @param kernel CRC8 kernel
+ * @return true The kernel can be routed to
+ * @return false It would fall back to another kernel
+ */
+bool crc8_kernel_available(CRC8_reference_model_e model, crc8_kernel_e kernel) {
+    /* parameter checkout */
+    assert(model < CRC8_NONE_MODEL);
+
+    /* a model left out of CRC8_MODELS has no kernel at all */
+    if (!CRC8_MODEL_ENABLED(model)) {
+        return false;
+    }
+    if (kernel == CRC8_KERNEL_SHUFFLE) {
+#ifdef CRC8_SHUFFLE
+        return crc8_shuffle_supported() > 0;
+#else
+        return false;
+#endif
+    }
+#ifdef CRC_NO_SLICING
+    if (kernel == CRC8_KERNEL_SLICE4 || kernel == CRC8_KERNEL_SLICE8) {
+        return false;
+    }
+#endif
+    return kernel < CRC8_KERNEL_NONE;
+}
+
+/**
+ * @brief Calculates the 8 bit wide CRC of an input data of a given length with a chosen kernel.
+ *
+ * @param model CRC8 reference model
+ * @param kernel CRC8 kernel
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint8_t CRC8 result
+ */
+uint8_t crc8_kernel_calculate(CRC8_reference_model_e model, crc8_kernel_e kernel, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC8_NONE_MODEL);
+    assert(kernel < CRC8_KERNEL_NONE);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    switch (kernel)
+    {
+    case CRC8_KERNEL_NIBBLE:
+        return crc8_nibble_table_update(model, crc8_param[model].initial_value, input_data, length) ^ crc8_param[model].result_xor_value;
+
+    case CRC8_KERNEL_TABLE:
+        return crc8_lookup_table_update(model, crc8_param[model].initial_value, input_data, length) ^ crc8_param[model].result_xor_value;
+
+    case CRC8_KERNEL_SLICE4:
+        return crc8_slice_update(model, crc8_param[model].initial_value, input_data, length, 4) ^ crc8_param[model].result_xor_value;
+
+    case CRC8_KERNEL_SLICE8:
+        return crc8_slice_update(model, crc8_param[model].initial_value, input_data, length, 8) ^ crc8_param[model].result_xor_value;
+
+    case CRC8_KERNEL_SHUFFLE:
+        return crc8_shuffle_update(model, crc8_param[model].initial_value, input_data, length) ^ crc8_param[model].result_xor_value;
+
+    default:
+#ifdef CRC_NO_BITWISE
+        return crc8_lookup_table_calculate(model, input_data, length);
+#else
+        return crc8_bitwise_calculate(model, input_data, length);
+#endif
+    }
+}
+
+/**
+ * @brief Sets the lengths from which crc8_calculate runs each kernel of a model. Not thread safe,
+ *        meant for start up before the CRC8 functions are in use.
+ *
+ * @param model CRC8 reference model
+ * @param threshold Shortest length per kernel, 0 for never; the bitwise entry is ignored and
+ *                  kernels not available are left unused
+ */
+void crc8_route_set(CRC8_reference_model_e model, const size_t threshold[CRC8_KERNEL_NONE]) {
+    /* parameter checkout */
+    assert(model < CRC8_NONE_MODEL);
+    assert(threshold != NULL);
+
+    crc8_route_threshold[model][CRC8_KERNEL_BITWISE] = 0;
+    for (int k = CRC8_KERNEL_BITWISE + 1; k < CRC8_KERNEL_NONE; k++) {
+        crc8_route_threshold[model][k] = crc8_kernel_available(model, (crc8_kernel_e)k) ? threshold[k] : 0;
+    }
+}
+
+/**
+ * @brief Gets the lengths from which crc8_calculate runs each kernel of a model
+ *
+ * @param model CRC8 reference model
+ * @param threshold Shortest length per kernel, 0 for never
+ */
+void crc8_route_get(CRC8_reference_model_e model, size_t threshold[CRC8_KERNEL_NONE]) {
+    /* parameter checkout */
+    assert(model < CRC8_NONE_MODEL);
+    assert(threshold != NULL);
+
+    for (int k = 0; k < CRC8_KERNEL_NONE; k++) {
+        threshold[k] = crc8_route_threshold[model][k];
+    }
+}
+
+/**
+ * @brief Gets the initial and result xor values of a model, as the CRC catalogues give them
+ *
+ * @param model CRC8 reference model
+ * @param initial_value Register before the message
+ * @param result_xor_value Xored onto the register at the end
+ */
+void crc8_param_get(CRC8_reference_model_e model, uint8_t *initial_value, uint8_t *result_xor_value) {
+    /* parameter checkout */
+    assert(model < CRC8_NONE_MODEL);
+    assert(initial_value != NULL);
+    assert(result_xor_value != NULL);
+
+    *initial_value = crc8_param[model].initial_value;
+    *result_xor_value = crc8_param[model].result_xor_value;
+}
+
+/**
+ * @brief Calculates the 8 bit wide CRC of an input data of a given length, with the kernel
+ *        routed for the length (bit by bit unless thresholds were set).
+ *
+ * @param param CRC8 reference model
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint8_t CRC8 result
+ */
+uint8_t crc8_calculate(CRC8_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC8_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    return crc8_kernel_calculate(model, crc8_route(model, length), input_data, length);
+}
+
+/**
+ * @brief CRC8 lookup table package
+ *
+ * @param param CRC8 reference model
+ * @param input_data Packets of CRC8 to be computed, last byte of the array holds the CRC8 result
+ * @param length Length of the CRC8 packet
+ */
+void crc8_lookup_table_package(CRC8_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC8_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    uint8_t crc8_result = 0;
+    crc8_result = crc8_lookup_table_calculate(model, input_data, length - 1);
+
+    *(input_data + length - 1) = crc8_result & 0xFF;
+}
+
+/**
+ * @brief CRC8 calculation method package check
+ *
+ * @param param CRC8 reference model
+ * @param input_data CRC8 packages to check
+ * @param length Length of the CRC8 packet
+ * @return true CRC8 checks succeed
+ * @return false CRC8 checks fails
+ */
+bool crc8_package_check(CRC8_reference_model_e model, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model < CRC8_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    uint8_t crc8_result = 0;
+    crc8_result = crc8_calculate(model, input_data, length - 1);
+    if (crc8_result != *(input_data + length - 1)) {
+        CHECKSUM_STATS_FAILURE(CHECKSUM_STATS_CRC8, model, crc8_kernel_stats[crc8_route(model, length - 1)]);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief CRC8 lookup table packages check
+ *
+ * @param param CRC8 reference model
+ * @param input_data CRC8 packages to check
+ * @param length Length of the CRC8 packet
+ * @return true CRC8 checks succeed
+ * @return false CRC8 checks fails
+ */
+bool crc8_lookup_table_package_check(CRC8_reference_model_e model, uint8_t *input_data, size_t length) {
+    assert(model < CRC8_NONE_MODEL);
+    assert(input_data != NULL);
+    assert(length > 0);
+
+    uint8_t crc8_result = 0;
+    crc8_result = crc8_lookup_table_calculate(model, input_data, length - 1);
+
+    if (crc8_result != *(input_data + length - 1)) {
+        CHECKSUM_STATS_FAILURE(CHECKSUM_STATS_CRC8, model, CRC8_STATS_LOOKUP);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Starts a streaming CRC8 computation
+ *
+ * @param ctx CRC8 streaming context
+ * @param model CRC8 reference model
+ */
+void crc8_init(crc8_ctx *ctx, CRC8_reference_model_e model) {
+    /* parameter checkout */
+    assert(ctx != NULL);
+    assert(model < CRC8_NONE_MODEL);
+
+    ctx->model = model;
+    ctx->crc = crc8_param[model].initial_value;
+}
+
+/**
+ * @brief Adds input data to a streaming CRC8 computation, with the model's lookup table
+ *
+ * @param ctx CRC8 streaming context
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ */
+void crc8_update(crc8_ctx *ctx, uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(ctx != NULL);
+    assert(input_data != NULL || length == 0);
+
+    ctx->crc = crc8_table_update(ctx->model, ctx->crc, input_data, length);
+}
+
+/**
+ * @brief Copies input data and adds it to a streaming CRC8 computation in one pass, such as a payload
+ *        into its frame buffer: every chunk is checksummed while it sits in the L1 cache and copied
+ *        from there, with non-temporal stores for long copies
+ *
+ * @param ctx CRC8 streaming context
+ * @param destination Destination, not overlapping the source
+ * @param source Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ */
+void crc8_copy(crc8_ctx *ctx, uint8_t *destination, const uint8_t *source, size_t length) {
+    /* parameter checkout */
+    assert(ctx != NULL);
+    assert((destination != NULL && source != NULL) || length == 0);
+
+    bool nontemporal = length >= CHECKSUM_COPY_NONTEMPORAL;
+    while (length > 0) {
+        size_t chunk = (length < CHECKSUM_COPY_CHUNK) ? length : CHECKSUM_COPY_CHUNK;
+        ctx->crc = crc8_table_update(ctx->model, ctx->crc, (uint8_t *)source, chunk);
+        checksum_copy_chunk(destination, source, chunk, nontemporal);
+        destination += chunk;
+        source += chunk;
+        length -= chunk;
+    }
+    checksum_copy_fence(nontemporal);
+}
+
+/**
+ * @brief Finishes a streaming CRC8 computation
+ *
+ * @param ctx CRC8 streaming context
+ * @return uint8_t CRC8 result, the same as crc8_calculate over all the input data
+ */
+uint8_t crc8_final(crc8_ctx *ctx) {
+    /* parameter checkout */
+    assert(ctx != NULL);
+
+    return (ctx->crc ^ crc8_param[ctx->model].result_xor_value);
+}
+
+/**
+ * @brief Syndrome of a single flipped bit in a frame, independent of the frame content.
+ *
+ * @param model CRC8 reference model
+ * @param scratch Zeroed buffer of at least length - 1 bytes, left zeroed on return
+ * @param length Length of the CRC8 packet
+ * @param position Bit position, byte index * 8 + bit index (LSB = 0)
+ * @return uint8_t The syndrome, calculated CRC8 xor received CRC8
+ */
+static uint8_t crc8_bit_syndrome(CRC8_reference_model_e model, uint8_t *scratch, size_t length, size_t position) {
+    size_t index = position >> 3;
+    uint8_t bit = position & 0x07;
+    uint8_t syndrome;
+
+    /* the CRC8 byte itself */
+    if (index >= length - 1) {
+        return (uint8_t)(1u << bit);
+    }
+    scratch[index] ^= (uint8_t)(1u << bit);
+    syndrome = crc8_calculate(model, scratch, length - 1);
+    scratch[index] ^= (uint8_t)(1u << bit);
+    return syndrome ^ crc8_calculate(model, scratch, length - 1);
+}
+
+/**
+ * @brief Build the syndrome table used to repair frames of one model and one length
+ *
+ * Every single bit error gives a distinct syndrome as long as the polynomial's Hamming
+ * distance is at least 3 for this frame length, every double bit error as long as it
+ * is at least 5. The table is only filled with the error patterns the distance allows.
+ *
+ * @param table Table to fill, 1 KiB
+ * @param model CRC8 reference model
+ * @param length Length of the CRC8 packets to repair, 2 to CRC8_CORRECTION_MAX_LENGTH
+ * @return true At least single bit errors can be repaired
+ * @return false The frame is too long for the polynomial to locate errors
+ */
+bool crc8_correction_table_init(crc8_correction_table_t *table, CRC8_reference_model_e model, size_t length) {
+    /* parameter checkout */
+    assert(table != NULL);
+    assert(model < CRC8_NONE_MODEL);
+    assert(length > 1 && length <= CRC8_CORRECTION_MAX_LENGTH);
+
+    uint8_t scratch[CRC8_CORRECTION_MAX_LENGTH] = {0};
+    uint8_t single[CRC8_CORRECTION_MAX_LENGTH * 8];
+    size_t bits = length * 8;
+
+    table->model = model;
+    table->length = length;
+    table->correctable_bits = 0;
+    memset(table->syndrome, 0, sizeof(table->syndrome));
+
+    /* single bit errors: distance >= 3 */
+    for (size_t i = 0; i < bits; i++) {
+        single[i] = crc8_bit_syndrome(model, scratch, length, i);
+        if (single[i] == 0 || table->syndrome[single[i]] != 0) {
+            memset(table->syndrome, 0, sizeof(table->syndrome));
+            return false;
+        }
+        table->syndrome[single[i]] = (uint32_t)(i + 1);
+    }
+    table->correctable_bits = 1;
+
+    /* double bit errors: distance >= 5 */
+    for (size_t i = 0; i < bits; i++) {
+        for (size_t j = i + 1; j < bits; j++) {
+            uint8_t syndrome = single[i] ^ single[j];
+            if (syndrome == 0 || table->syndrome[syndrome] != 0) {
+                for (size_t k = 0; k < 256; k++) {
+                    if (table->syndrome[k] >> 16) {
+                        table->syndrome[k] = 0;
+                    }
+                }
+                return true;
+            }
+            table->syndrome[syndrome] = (uint32_t)(i + 1) | ((uint32_t)(j + 1) << 16);
+        }
+    }
+    table->correctable_bits = 2;
+
+    return true;
+}
+
+/**
+ * @brief CRC8 lookup table package check, repairing the bit errors the syndrome table can locate
+ *
+ * @param table Syndrome table built for the model and length of the package
+ * @param input_data CRC8 packages to check, repaired in place
+ * @param length Length of the CRC8 packet
+ * @param correction_count Number of bits flipped back, may be NULL
+ * @return true CRC8 checks succeed, possibly after repair
+ * @return false CRC8 checks fails and the error can't be located
+ */
+bool crc8_package_correct(const crc8_correction_table_t *table, uint8_t *input_data, size_t length, uint8_t *correction_count) {
+    /* parameter checkout */
+    assert(table != NULL);
+    assert(input_data != NULL);
+    assert(length == table->length);
+
+    uint8_t syndrome = crc8_lookup_table_calculate(table->model, input_data, length - 1) ^ *(input_data + length - 1);
+    uint32_t positions = table->syndrome[syndrome];
+    uint8_t count = 0;
+
+    if (syndrome != 0) {
+        if (positions == 0) {
+            if (correction_count != NULL) {
+                *correction_count = 0;
+            }
+            return false;
+        }
+        for (; positions != 0; positions >>= 16) {
+            uint16_t position = (uint16_t)(positions & 0xFFFF) - 1;
+            input_data[position >> 3] ^= (uint8_t)(1u << (position & 0x07));
+            count++;
+        }
+    }
+
+    if (correction_count != NULL) {
+        *correction_count = count;
+    }
+    return true;
+}
+
+/* Bit-sliced batch check: bit plane b of a byte position holds bit b of that byte of 64
+   packages, bit i for package i, so one XOR runs a CRC8 register bit of 64 packages at once */
+#define CRC8_BATCH_LANES 64
+
+/* The byte step crc = table[crc ^ byte] is linear: register bit k after the step is the XOR of
+   the bits b of crc ^ byte whose single bit table entry (table[1 << b]) has bit k set.
+   One mask of those b per k; compile time constants, so the step inlines to plain XORs. */
+static const uint8_t CRC8_BATCH_MATRIX[CRC8_NONE_MODEL][8] = {
+    {0xC1, 0x43, 0x47, 0x8E, 0x1C, 0x38, 0x70, 0xE0},     // Reference Model:CRC8
+    {0xC1, 0x43, 0x47, 0x8E, 0x1C, 0x38, 0x70, 0xE0},     // Reference Model:CRC8_ITU
+    {0x07, 0x0E, 0x1C, 0x38, 0x71, 0xE2, 0xC2, 0x83},     // Reference Model:CRC8_ROHC
+    {0x34, 0x69, 0xD3, 0x93, 0x13, 0x26, 0x4D, 0x9A},     // Reference Model:CRC8_MAXIM
+};
+
+#if defined(__GNUC__)
+#define CRC8_BATCH_INLINE static inline __attribute__((always_inline))
+#define CRC8_BATCH_UNROLL _Pragma("GCC unroll 8")
+#else
+#define CRC8_BATCH_INLINE static inline
+#define CRC8_BATCH_UNROLL
+#endif
+
+/* reads up to 8 bytes as a little endian 64 bit word, missing bytes zero */
+static inline uint64_t crc8_batch_load(const uint8_t *p, size_t bytes) {
+    uint64_t word = 0;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    if (bytes >= 8) {
+        memcpy(&word, p, 8);
+        return word;
+    }
+#endif
+    if (bytes > 8) {
+        bytes = 8;
+    }
+    for (size_t q = 0; q < bytes; q++) {
+        word |= (uint64_t)p[q] << (8 * q);
+    }
+    return word;
+}
+
+/**
+ * @brief Transposes a 64 x 64 bit matrix in place: bit c of word r moves to bit r of word c
+ *
+ * @param a 64 words, word r bit c
+ */
+static void crc8_batch_transpose(uint64_t a[64]) {
+    /* swaps the upper right and lower left j x j blocks of every 2j x 2j block */
+#define CRC8_BATCH_TRANSPOSE_ROUND(j, mask) \
+    for (unsigned int base = 0; base < 64; base += 2 * (j)) { \
+        for (unsigned int k = base; k < base + (j); k++) { \
+            uint64_t t = ((a[k] >> (j)) ^ a[k + (j)]) & (mask); \
+            a[k] ^= t << (j); \
+            a[k + (j)] ^= t; \
+        } \
+    }
+    CRC8_BATCH_TRANSPOSE_ROUND(32, 0x00000000FFFFFFFFULL)
+    CRC8_BATCH_TRANSPOSE_ROUND(16, 0x0000FFFF0000FFFFULL)
+    CRC8_BATCH_TRANSPOSE_ROUND(8, 0x00FF00FF00FF00FFULL)
+    CRC8_BATCH_TRANSPOSE_ROUND(4, 0x0F0F0F0F0F0F0F0FULL)
+    CRC8_BATCH_TRANSPOSE_ROUND(2, 0x3333333333333333ULL)
+    CRC8_BATCH_TRANSPOSE_ROUND(1, 0x5555555555555555ULL)
+#undef CRC8_BATCH_TRANSPOSE_ROUND
+}
+
+/**
+ * @brief One byte step of 64 CRC8 registers, r = matrix * (r ^ d)
+ */
+CRC8_BATCH_INLINE void crc8_batch_step(uint64_t r[8], const uint64_t d[8], const uint8_t matrix[8]) {
+    uint64_t x[8];
+    for (int b = 0; b < 8; b++) {
+        x[b] = r[b] ^ d[b];
+    }
+    CRC8_BATCH_UNROLL
+    for (int k = 0; k < 8; k++) {
+        r[k] = 0;
+        CRC8_BATCH_UNROLL
+        for (int b = 0; b < 8; b++) {
+            if ((matrix[k] >> b) & 1) {
+                r[k] ^= x[b];
+            }
+        }
+    }
+}
+
+/**
+ * @brief Checks up to 64 packages of one length at once
+ *
+ * @param model CRC8 reference model
+ * @param matrix CRC8_BATCH_MATRIX of the model
+ * @param packages First package, the others follow back to back
+ * @param count Number of packages, 1 to 64
+ * @param length Length of each CRC8 package
+ * @return uint64_t Bit i set when package i checks
+ */
+CRC8_BATCH_INLINE uint64_t crc8_batch_check64(CRC8_reference_model_e model, const uint8_t matrix[8],
+                                              const uint8_t *packages, size_t count, size_t length) {
+    uint64_t plane[64], r[8];
+    uint64_t valid = 0;
+
+    for (int k = 0; k < 8; k++) {
+        r[k] = ((crc8_param[model].initial_value >> k) & 1) ? ~0ULL : 0;
+    }
+    for (size_t p = 0; p < length; p += 8) {
+        for (size_t i = 0; i < CRC8_BATCH_LANES; i++) {
+            plane[i] = (i < count) ? crc8_batch_load(packages + i * length + p, length - p) : 0;
+        }
+        /* word 8q + b now holds bit b of byte p + q of every package */
+        crc8_batch_transpose(plane);
+
+        for (size_t q = 0; q < 8 && p + q < length; q++) {
+            const uint64_t *d = &plane[8 * q];
+            if (p + q == length - 1) {
+                uint64_t differ = 0;
+                for (int k = 0; k < 8; k++) {
+                    differ |= r[k] ^ d[k] ^ (((crc8_param[model].result_xor_value >> k) & 1) ? ~0ULL : 0);
+                }
+                valid = ~differ;
+                break;
+            }
+            crc8_batch_step(r, d, matrix);
+        }
+    }
+
+    return (count < CRC8_BATCH_LANES) ? valid & ((1ULL << count) - 1) : valid;
+}
+
+/**
+ * @brief Checks up to 64 packages, the model's step inlined with its constant matrix
+ */
+static uint64_t crc8_batch_check64_model(CRC8_reference_model_e model, const uint8_t *packages, size_t count, size_t length) {
+    switch (model)
+    {
+    case CRC8_MODEL:
+    case CRC8_ITU_MODEL:
+        return crc8_batch_check64(model, CRC8_BATCH_MATRIX[CRC8_MODEL], packages, count, length);
+
+    case CRC8_ROHC_MODEL:
+        return crc8_batch_check64(model, CRC8_BATCH_MATRIX[CRC8_ROHC_MODEL], packages, count, length);
+
+    default:
+        return crc8_batch_check64(model, CRC8_BATCH_MATRIX[CRC8_MAXIM_MODEL], packages, count, length);
+    }
+}
+
+#ifdef CRC8_SHUFFLE
+/**
+ * @brief crc8_batch_transpose on four matrices at once, one per 64 bit lane
+ */
+__attribute__((target("avx2")))
+static void crc8_batch_transpose256(__m256i a[64]) {
+#define CRC8_BATCH_TRANSPOSE_ROUND(j, low) \
+    do { \
+        const __m256i mask = _mm256_set1_epi64x((long long)(low)); \
+        for (unsigned int base = 0; base < 64; base += 2 * (j)) { \
+            for (unsigned int k = base; k < base + (j); k++) { \
+                __m256i t = _mm256_and_si256(_mm256_xor_si256(_mm256_srli_epi64(a[k], (j)), a[k + (j)]), mask); \
+                a[k] = _mm256_xor_si256(a[k], _mm256_slli_epi64(t, (j))); \
+                a[k + (j)] = _mm256_xor_si256(a[k + (j)], t); \
+            } \
+        } \
+    } while (0)
+    CRC8_BATCH_TRANSPOSE_ROUND(32, 0x00000000FFFFFFFFULL);
+    CRC8_BATCH_TRANSPOSE_ROUND(16, 0x0000FFFF0000FFFFULL);
+    CRC8_BATCH_TRANSPOSE_ROUND(8, 0x00FF00FF00FF00FFULL);
+    CRC8_BATCH_TRANSPOSE_ROUND(4, 0x0F0F0F0F0F0F0F0FULL);
+    CRC8_BATCH_TRANSPOSE_ROUND(2, 0x3333333333333333ULL);
+    CRC8_BATCH_TRANSPOSE_ROUND(1, 0x5555555555555555ULL);
+#undef CRC8_BATCH_TRANSPOSE_ROUND
+}
+
+/**
+ * @brief crc8_batch_step of 256 CRC8 registers
+ */
+__attribute__((target("avx2")))
+CRC8_BATCH_INLINE void crc8_batch_step256(__m256i r[8], const __m256i d[8], const uint8_t matrix[8]) {
+    __m256i x[8];
+    for (int b = 0; b < 8; b++) {
+        x[b] = _mm256_xor_si256(r[b], d[b]);
+    }
+    CRC8_BATCH_UNROLL
+    for (int k = 0; k < 8; k++) {
+        r[k] = _mm256_setzero_si256();
+        CRC8_BATCH_UNROLL
+        for (int b = 0; b < 8; b++) {
+            if ((matrix[k] >> b) & 1) {
+                r[k] = _mm256_xor_si256(r[k], x[b]);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Checks 256 packages of one length at once with AVX2, 64 bit lane l holding packages 64l to 64l + 63
+ *
+ * @param model CRC8 reference model
+ * @param matrix CRC8_BATCH_MATRIX of the model
+ * @param packages First package, the others follow back to back
+ * @param length Length of each CRC8 package
+ * @param valid Four words, bit i of word l set when package 64l + i checks
+ */
+__attribute__((target("avx2")))
+CRC8_BATCH_INLINE void crc8_batch_check256(CRC8_reference_model_e model, const uint8_t matrix[8],
+                                           const uint8_t *packages, size_t length, uint64_t valid[4]) {
+    const size_t lane = CRC8_BATCH_LANES * length;
+    __m256i plane[64], r[8];
+
+    for (int k = 0; k < 8; k++) {
+        r[k] = _mm256_set1_epi64x(((crc8_param[model].initial_value >> k) & 1) ? -1LL : 0);
+    }
+    for (size_t p = 0; p < length; p += 8) {
+        const uint8_t *column = packages + p;
+        for (size_t i = 0; i < CRC8_BATCH_LANES; i++, column += length) {
+            plane[i] = _mm256_set_epi64x((long long)crc8_batch_load(column + 3 * lane, length - p),
+                                         (long long)crc8_batch_load(column + 2 * lane, length - p),
+                                         (long long)crc8_batch_load(column + lane, length - p),
+                                         (long long)crc8_batch_load(column, length - p));
+        }
+        crc8_batch_transpose256(plane);
+
+        for (size_t q = 0; q < 8 && p + q < length; q++) {
+            const __m256i *d = &plane[8 * q];
+            if (p + q == length - 1) {
+                __m256i differ = _mm256_setzero_si256();
+                for (int k = 0; k < 8; k++) {
+                    __m256i xorout = _mm256_set1_epi64x(((crc8_param[model].result_xor_value >> k) & 1) ? -1LL : 0);
+                    differ = _mm256_or_si256(differ, _mm256_xor_si256(_mm256_xor_si256(r[k], d[k]), xorout));
+                }
+                _mm256_storeu_si256((__m256i *)valid, _mm256_xor_si256(differ, _mm256_set1_epi64x(-1LL)));
+                break;
+            }
+            crc8_batch_step256(r, d, matrix);
+        }
+    }
+}
+/**
+ * @brief Checks 256 packages, the model's step inlined with its constant matrix
+ */
+__attribute__((target("avx2")))
+static void crc8_batch_check256_model(CRC8_reference_model_e model, const uint8_t *packages, size_t length, uint64_t valid[4]) {
+    switch (model)
+    {
+    case CRC8_MODEL:
+    case CRC8_ITU_MODEL:
+        crc8_batch_check256(model, CRC8_BATCH_MATRIX[CRC8_MODEL], packages, length, valid);
+        break;
+
+    case CRC8_ROHC_MODEL:
+        crc8_batch_check256(model, CRC8_BATCH_MATRIX[CRC8_ROHC_MODEL], packages, length, valid);
+        break;
+
+    default:
+        crc8_batch_check256(model, CRC8_BATCH_MATRIX[CRC8_MAXIM_MODEL], packages, length, valid);
+        break;
+    }
+}
+#endif
+
+/**
+ * @brief Checks a batch of CRC8 packages of the same length, stored back to back, bit-sliced:
+ *        the packages are transposed into bit planes and the CRC8 register runs as XOR logic
+ *        over 64 packages at a time, or 256 with AVX2.
+ *
+ * @param model CRC8 reference model
+ * @param packages CRC8 packages to check, package i at packages + i * length
+ * @param count Number of packages
+ * @param length Length of each CRC8 package, the CRC8 in the last byte
+ * @param valid (count + 63) / 64 words, bit i % 64 of word i / 64 set when package i checks
+ */
+void crc8_package_check_batch(CRC8_reference_model_e model, const uint8_t *packages, size_t count, size_t length, uint64_t *valid) {
+    /* parameter checkout */
+    assert(model < CRC8_NONE_MODEL);
+    assert(packages != NULL);
+    assert(length > 0);
+    assert(valid != NULL);
+
+    CHECKSUM_STATS_BEGIN(stats_start);
+    size_t done = 0;
+#ifdef CRC8_SHUFFLE
+    if (crc8_shuffle_supported() > 1) {
+        for (; count - done >= 4 * CRC8_BATCH_LANES; done += 4 * CRC8_BATCH_LANES) {
+            crc8_batch_check256_model(model, packages + done * length, length, valid + done / CRC8_BATCH_LANES);
+        }
+    }
+#endif
+    for (; done < count; done += CRC8_BATCH_LANES) {
+        size_t lanes = (count - done < CRC8_BATCH_LANES) ? count - done : CRC8_BATCH_LANES;
+        valid[done / CRC8_BATCH_LANES] = crc8_batch_check64_model(model, packages + done * length, lanes, length);
+    }
+
+    CHECKSUM_STATS_RECORD(CHECKSUM_STATS_CRC8, model, CHECKSUM_STATS_BIT_SLICED, count * length, stats_start);
+#ifdef CHECKSUM_STATS
+    for (size_t i = 0; i < count; i++) {
+        if (!((valid[i / CRC8_BATCH_LANES] >> (i % CRC8_BATCH_LANES)) & 1)) {
+            CHECKSUM_STATS_FAILURE(CHECKSUM_STATS_CRC8, model, CHECKSUM_STATS_BIT_SLICED);
+        }
+    }
+#endif
+}
+
+#ifndef CHECKSUM_NO_MAIN
+#define TEST
+#endif
+#ifdef TEST
+#include <stdio.h>
+#ifndef CRC8_USE_NIBBLE_TABLE
+#include "../crc_fixed/crc_fixed.h"
+
+/* fixed length functions of every model at the shortest, a sensor sized and the longest payload */
+#define CRC8_FIXED_TEST_DEFINE(prefix, model) \
+    CRC8_FIXED_DEFINE(prefix##_1, model, 1) \
+    CRC8_FIXED_DEFINE(prefix##_4, model, 4) \
+    CRC8_FIXED_DEFINE(prefix##_32, model, 32)
+CRC8_FIXED_TEST_DEFINE(fixed_crc8, CRC8)
+CRC8_FIXED_TEST_DEFINE(fixed_itu, CRC8_ITU)
+CRC8_FIXED_TEST_DEFINE(fixed_rohc, CRC8_ROHC)
+CRC8_FIXED_TEST_DEFINE(fixed_maxim, CRC8_MAXIM)
+
+/* the three lengths of one model against crc8_calculate, then package, check and a flipped bit */
+#define CRC8_FIXED_TEST(prefix, model) \
+    do { \
+        uint8_t frame[33] = {0}; \
+        bool succeed = true; \
+        for (size_t i = 0; i < sizeof(frame); i++) { \
+            frame[i] = (uint8_t)(i * 37 + 11); \
+        } \
+        succeed &= prefix##_1_calculate(frame) == crc8_calculate(model, frame, 1); \
+        succeed &= prefix##_4_calculate(frame) == crc8_calculate(model, frame, 4); \
+        succeed &= prefix##_32_calculate(frame) == crc8_calculate(model, frame, 32); \
+        prefix##_32_package(frame); \
+        succeed &= prefix##_32_check(frame) && crc8_lookup_table_package_check(model, frame, 33); \
+        frame[5] ^= 0x10; \
+        succeed &= !prefix##_32_check(frame); \
+        printf("%s fixed length check %s\n", #model, succeed ? "succeed." : "fail."); \
+    } while (0)
+
+#endif
+static void print_crc8_table(CRC8_reference_model_e model);
+
+int main() {
+/* test: crc8_calculate  */
+#if 0
+    uint8_t crc8_result;
+    uint8_t input_data0[8] = {0x03, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08}; // crc8 result: 0x3e
+
+    crc8_result  = crc8_calculate(CRC8_MODEL, input_data0, 1);
+    printf("CRC8_MODEL crc8_result: 0x%x\n", crc8_result);
+
+    crc8_result  = crc8_calculate_mirror_mode(CRC8_MODEL, input_data0, 1);
+    printf("CRC8_MODEL mirror mode crc8_result: 0x%x\n", crc8_result);
+
+    crc8_result  = crc8_calculate(CRC8_ITU_MODEL, input_data0, 1);
+    printf("CRC8_ITU_MODEL crc8_result: 0x%x\n", crc8_result);
+
+    crc8_result  = crc8_calculate_mirror_mode(CRC8_ITU_MODEL, input_data0, 1);
+    printf("CRC8_ITU_MODEL mirror mode crc8_result: 0x%x\n", crc8_result);
+
+    crc8_result  = crc8_calculate(CRC8_ROHC_MODEL, input_data0, 1);
+    printf("CRC8_ROHC_MODEL crc8_result: 0x%x\n", crc8_result);
+
+    crc8_result  = crc8_calculate_mirror_mode(CRC8_ROHC_MODEL, input_data0, 1);
+    printf("CRC8_ROHC_MODEL mirror mode crc8_result: 0x%x\n", crc8_result);
+
+    crc8_result  = crc8_calculate(CRC8_MAXIM_MODEL, input_data0, 1);
+    printf("CRC8_MAXIM_MODEL crc8_result: 0x%x\n", crc8_result);
+
+    crc8_result  = crc8_calculate_mirror_mode(CRC8_MAXIM_MODEL, input_data0, 1);
+    printf("CRC8_MAXIM_MODEL mirror mode crc8_result: 0x%x\n", crc8_result);
+#endif
+
+#if 0 /* printf crc8 8bit table */
+    print_crc8_table(CRC8_MODEL);
+    print_crc8_table(CRC8_ITU_MODEL);
+    print_crc8_table(CRC8_ROHC_MODEL);
+    print_crc8_table(CRC8_MAXIM_MODEL);
+#endif
+
+/* test crc8_calculate_package crc8_package_check */
+#if 1
+    printf("---------CRC8 calculation method-----------\n");
+    bool check_result;
+    uint8_t input_data[9] = {0x01, 0x02, 0x03, 0x05, 0x08, 0x07, 0x06, 0x05};
+
+    crc8_calculate_package(CRC8_MODEL, input_data, 9);
+    printf("CRC8_MODE result: 0x%02x \n", input_data[8]);
+    check_result = crc8_package_check(CRC8_MODEL, input_data, 9);
+    if (check_result) {
+        printf("CRC8_MODEL check succeed!\n");
+    } else {
+        printf("CRC8_MODEL check fails!\n");
+    }
+
+    crc8_calculate_package(CRC8_ITU_MODEL, input_data, 9);
+    printf("CRC8_ITU_MODEL result: 0x%02x \n", input_data[8]);
+    check_result = crc8_package_check(CRC8_ITU_MODEL, input_data, 9);
+    if (check_result) {
+        printf("CRC8_ITU_MODEL check succeed!\n");
+    } else {
+        printf("CRC8_ITU_MODEL check fails!\n");
+    }
+
+    crc8_calculate_package(CRC8_ROHC_MODEL, input_data, 9);
+    printf("CRC8_ROHC_MODEL result: 0x%02x \n", input_data[8]);
+    check_result = crc8_package_check(CRC8_ROHC_MODEL, input_data, 9);
+    if (check_result) {
+        printf("CRC8_ROHC_MODEL check succeed!\n");
+    } else {
+        printf("CRC8_ROHC_MODEL check fails!\n");
+    }
+
+    crc8_calculate_package(CRC8_MAXIM_MODEL, input_data, 9);
+    printf("CRC8_MAXIM_MODEL result: 0x%02x \n", input_data[8]);
+    check_result = crc8_package_check(CRC8_MAXIM_MODEL, input_data, 9);
+    if (check_result) {
+        printf("CRC8_MAXIM_MODEL check succeed!\n");
+    } else {
+        printf("CRC8_MAXIM_MODEL check fails!\n");
+    }
+#endif
+
+#if 1
+    printf("---------CRC8 lookup table-----------\n");
+    bool check_result2;
+    uint8_t input_data2[9] = {0x01, 0x02, 0x03, 0x05, 0x08, 0x07, 0x06, 0x05};
+
+    crc8_lookup_table_package(CRC8_MODEL, input_data2, 9);
+    printf("CRC8_MODEL result: 0x%02x \n", input_data2[8]);
+    check_result2 = crc8_lookup_table_package_check(CRC8_MODEL, input_data2, 9);
+    if (check_result2) {
+        printf("CRC8_MODEL check succeed!\n");
+    } else {
+        printf("CRC8_MODEL check fails!\n");
+    }
+
+    crc8_lookup_table_package(CRC8_ITU_MODEL, input_data2, 9);
+    printf("CRC8_ITU_MODEL result: 0x%02x \n", input_data2[8]);
+    check_result2 = crc8_lookup_table_package_check(CRC8_ITU_MODEL, input_data2, 9);
+    if (check_result2) {
+        printf("CRC8_ITU_MODEL check succeed!\n");
+    } else {
+        printf("CRC8_ITU_MODEL check fails!\n");
+    }
+
+    crc8_lookup_table_package(CRC8_ROHC_MODEL, input_data2, 9);
+    printf("CRC8_ROHC_MODEL result: 0x%02x \n", input_data2[8]);
+    check_result2 = crc8_lookup_table_package_check(CRC8_ROHC_MODEL, input_data2, 9);
+    if (check_result2) {
+        printf("CRC8_ROHC_MODEL check succeed!\n");
+    } else {
+        printf("CRC8_ROHC_MODEL check fails!\n");
+    }
+
+    crc8_lookup_table_package(CRC8_MAXIM_MODEL, input_data2, 9);
+    printf("CRC8_MAXIM_MODEL result: 0x%02x \n", input_data2[8]);
+    check_result2 = crc8_lookup_table_package_check(CRC8_MAXIM_MODEL, input_data2, 9);
+    if (check_result2) {
+        printf("CRC8_MAXIM_MODEL check succeed!\n");
+    } else {
+        printf("CRC8_MAXIM_MODEL check fails!\n");
+    }
+#endif
+#if 1
+    printf("---------CRC8 error correction-----------\n");
+    static crc8_correction_table_t correction_table;
+    uint8_t correction_count = 0;
+    uint8_t input_data3[3] = {0x5A, 0xC3};
+
+    crc8_lookup_table_package(CRC8_MAXIM_MODEL, input_data3, 3);
+    if (crc8_correction_table_init(&correction_table, CRC8_MAXIM_MODEL, 3)) {
+        printf("CRC8_MAXIM_MODEL corrects up to %d bit errors in 3 byte frames.\n", correction_table.correctable_bits);
+        input_data3[1] ^= 0x04;
+        check_result = crc8_package_correct(&correction_table, input_data3, 3, &correction_count);
+        if (check_result && crc8_lookup_table_package_check(CRC8_MAXIM_MODEL, input_data3, 3)) {
+            printf("CRC8_MAXIM_MODEL correct succeed, %d bit repaired.\n", correction_count);
+        } else {
+            printf("CRC8_MAXIM_MODEL correct fail.\n");
+        }
+    }
+#endif
+#if 1
+    printf("---------CRC8 nibble table-----------\n");
+    uint8_t nibble_data[64];
+    memset(nibble_data, 0x5A, sizeof(nibble_data));
+    crc8_lookup_table_package(CRC8_MODEL, nibble_data, sizeof(nibble_data));
+    if (crc8_kernel_calculate(CRC8_MODEL, CRC8_KERNEL_NIBBLE, nibble_data, sizeof(nibble_data) - 1) == crc8_calculate(CRC8_MODEL, nibble_data, sizeof(nibble_data) - 1) &&
+        crc8_lookup_table_package_check(CRC8_MODEL, nibble_data, sizeof(nibble_data))) {
+        printf("CRC8_MODEL nibble table check succeed.\n");
+    } else {
+        printf("CRC8_MODEL nibble table check fail.\n");
+    }
+    memset(nibble_data, 0x5A, sizeof(nibble_data));
+    crc8_lookup_table_package(CRC8_ITU_MODEL, nibble_data, sizeof(nibble_data));
+    if (crc8_kernel_calculate(CRC8_ITU_MODEL, CRC8_KERNEL_NIBBLE, nibble_data, sizeof(nibble_data) - 1) == crc8_calculate(CRC8_ITU_MODEL, nibble_data, sizeof(nibble_data) - 1) &&
+        crc8_lookup_table_package_check(CRC8_ITU_MODEL, nibble_data, sizeof(nibble_data))) {
+        printf("CRC8_ITU_MODEL nibble table check succeed.\n");
+    } else {
+        printf("CRC8_ITU_MODEL nibble table check fail.\n");
+    }
+    memset(nibble_data, 0x5A, sizeof(nibble_data));
+    crc8_lookup_table_package(CRC8_ROHC_MODEL, nibble_data, sizeof(nibble_data));
+    if (crc8_kernel_calculate(CRC8_ROHC_MODEL, CRC8_KERNEL_NIBBLE, nibble_data, sizeof(nibble_data) - 1) == crc8_calculate(CRC8_ROHC_MODEL, nibble_data, sizeof(nibble_data) - 1) &&
+        crc8_lookup_table_package_check(CRC8_ROHC_MODEL, nibble_data, sizeof(nibble_data))) {
+        printf("CRC8_ROHC_MODEL nibble table check succeed.\n");
+    } else {
+        printf("CRC8_ROHC_MODEL nibble table check fail.\n");
+    }
+    memset(nibble_data, 0x5A, sizeof(nibble_data));
+    crc8_lookup_table_package(CRC8_MAXIM_MODEL, nibble_data, sizeof(nibble_data));
+    if (crc8_kernel_calculate(CRC8_MAXIM_MODEL, CRC8_KERNEL_NIBBLE, nibble_data, sizeof(nibble_data) - 1) == crc8_calculate(CRC8_MAXIM_MODEL, nibble_data, sizeof(nibble_data) - 1) &&
+        crc8_lookup_table_package_check(CRC8_MAXIM_MODEL, nibble_data, sizeof(nibble_data))) {
+        printf("CRC8_MAXIM_MODEL nibble table check succeed.\n");
+    } else {
+        printf("CRC8_MAXIM_MODEL nibble table check fail.\n");
+    }
+#endif
+
+#if 1
+    /* slicing against the bit by bit reference: every model, lengths around the 4 and 8 byte
+       steps, unaligned starts, and streaming updates split inside a step */
+    printf("---------CRC8 slicing-----------\n");
+    {
+        static const char *slicing_name[CRC8_NONE_MODEL] = {"CRC8_MODEL", "CRC8_ITU_MODEL", "CRC8_ROHC_MODEL", "CRC8_MAXIM_MODEL"};
+        uint8_t slicing_data[80];
+        for (size_t i = 0; i < sizeof(slicing_data); i++) {
+            slicing_data[i] = (uint8_t)(i * 29 + 3);
+        }
+        for (int m = 0; m < CRC8_NONE_MODEL; m++) {
+            bool succeed = true;
+            for (size_t offset = 0; offset < 8; offset++) {
+                for (size_t length = 1; length + offset <= sizeof(slicing_data); length++) {
+                    uint8_t reference = crc8_kernel_calculate((CRC8_reference_model_e)m, CRC8_KERNEL_BITWISE, slicing_data + offset, length);
+                    succeed &= crc8_kernel_calculate((CRC8_reference_model_e)m, CRC8_KERNEL_SLICE4, slicing_data + offset, length) == reference;
+                    succeed &= crc8_kernel_calculate((CRC8_reference_model_e)m, CRC8_KERNEL_SLICE8, slicing_data + offset, length) == reference;
+                    succeed &= crc8_lookup_table_calculate((CRC8_reference_model_e)m, slicing_data + offset, length) == reference;
+                }
+            }
+            crc8_ctx ctx;
+            crc8_init(&ctx, (CRC8_reference_model_e)m);
+            crc8_update(&ctx, slicing_data, 3);
+            crc8_update(&ctx, slicing_data + 3, 61);
+            crc8_update(&ctx, slicing_data + 64, 16);
+            succeed &= crc8_final(&ctx) == crc8_calculate((CRC8_reference_model_e)m, slicing_data, sizeof(slicing_data));
+            printf("%s slicing-by-4/8 check %s\n", slicing_name[m], succeed ? "succeed." : "fail.");
+        }
+    }
+#endif
+
+#if 1
+#ifdef CRC8_SHUFFLE
+    /* shuffle folding against the bit by bit reference, over the 16 byte SSSE3 and the 128/32 byte
+       AVX2 loops and their tails, SSSE3 forced on AVX2 machines */
+    printf("---------CRC8 shuffle-----------\n");
+    if (crc8_shuffle_supported() > 0) {
+        static const char *shuffle_name[CRC8_NONE_MODEL] = {"CRC8_MODEL", "CRC8_ITU_MODEL", "CRC8_ROHC_MODEL", "CRC8_MAXIM_MODEL"};
+        int shuffle = crc8_shuffle_supported();
+        uint8_t shuffle_data[420];
+        for (size_t i = 0; i < sizeof(shuffle_data); i++) {
+            shuffle_data[i] = (uint8_t)(i * 151 + (i >> 3));
+        }
+        for (int m = 0; m < CRC8_NONE_MODEL; m++) {
+            bool succeed = true;
+            for (int level = shuffle; level > 0; level--) {
+                crc8_shuffle = level;
+                for (size_t offset = 0; offset < 4; offset++) {
+                    for (size_t length = 1; length + offset <= sizeof(shuffle_data); length++) {
+                        uint8_t reference = crc8_kernel_calculate((CRC8_reference_model_e)m, CRC8_KERNEL_BITWISE, shuffle_data + offset, length);
+                        succeed &= crc8_kernel_calculate((CRC8_reference_model_e)m, CRC8_KERNEL_SHUFFLE, shuffle_data + offset, length) == reference;
+                        succeed &= crc8_lookup_table_calculate((CRC8_reference_model_e)m, shuffle_data + offset, length) == reference;
+                    }
+                }
+            }
+            crc8_shuffle = shuffle;
+            printf("%s %s shuffle check %s\n", shuffle_name[m], shuffle > 1 ? "AVX2 and SSSE3" : "SSSE3", succeed ? "succeed." : "fail.");
+        }
+    } else {
+        printf("no SSSE3, shuffle check skipped.\n");
+    }
+#endif
+#endif
+
+#if 1
+    /* bit-sliced batch check against one package at a time: lengths inside and across the 8 byte
+       transposition blocks, counts around the 64 and 256 package groups, damaged packages */
+    printf("---------CRC8 batch check-----------\n");
+    {
+        static const char *batch_name[CRC8_NONE_MODEL] = {"CRC8_MODEL", "CRC8_ITU_MODEL", "CRC8_ROHC_MODEL", "CRC8_MAXIM_MODEL"};
+        static const size_t batch_length[] = {1, 2, 5, 8, 9, 17, 33};
+        static uint8_t batch_data[600 * 33];
+        uint64_t valid[10];
+#ifdef CRC8_SHUFFLE
+        int shuffle = crc8_shuffle_supported();
+#endif
+        for (int m = 0; m < CRC8_NONE_MODEL; m++) {
+            bool succeed = true;
+            for (size_t l = 0; l < sizeof(batch_length) / sizeof(batch_length[0]); l++) {
+                size_t length = batch_length[l];
+                for (size_t count = 1; count <= 600; count += (count < 70) ? 1 : 53) {
+                    for (size_t i = 0; i < count; i++) {
+                        uint8_t *package = batch_data + i * length;
+                        for (size_t j = 0; j < length; j++) {
+                            package[j] = (uint8_t)(i * 7 + j * 31 + m);
+                        }
+                        crc8_lookup_table_package((CRC8_reference_model_e)m, package, length);
+                        if (i % 5 == 3) {
+                            package[(i / 5) % length] ^= (uint8_t)(1 << (i % 8));
+                        }
+                    }
+#ifdef CRC8_SHUFFLE
+                    /* both the AVX2 and the 64 bit lanes */
+                    for (int level = shuffle; level >= 0 && level >= shuffle - 1; level--) {
+                        crc8_shuffle = level;
+#endif
+                        memset(valid, 0xA5, sizeof(valid));
+                        crc8_package_check_batch((CRC8_reference_model_e)m, batch_data, count, length, valid);
+                        for (size_t i = 0; i < count; i++) {
+                            bool expect = crc8_lookup_table_package_check((CRC8_reference_model_e)m, batch_data + i * length, length);
+                            succeed &= ((valid[i / 64] >> (i % 64)) & 1) == expect;
+                        }
+                        if (count % 64 != 0) {
+                            succeed &= (valid[count / 64] >> (count % 64)) == 0;
+                        }
+#ifdef CRC8_SHUFFLE
+                    }
+                    crc8_shuffle = shuffle;
+#endif
+                }
+            }
+            printf("%s batch check %s\n", batch_name[m], succeed ? "succeed." : "fail.");
+        }
+    }
+#endif
+
+#if 1
+#ifndef CRC8_USE_NIBBLE_TABLE
+    printf("---------CRC8 fixed length-----------\n");
+    CRC8_FIXED_TEST(fixed_crc8, CRC8_MODEL);
+    CRC8_FIXED_TEST(fixed_itu, CRC8_ITU_MODEL);
+    CRC8_FIXED_TEST(fixed_rohc, CRC8_ROHC_MODEL);
+    CRC8_FIXED_TEST(fixed_maxim, CRC8_MAXIM_MODEL);
+#endif
+#endif
+
+#if 1
+    printf("---------CRC8 copy-----------\n");
+    /* two pieces per copy, into a misaligned destination; the longest one past the non-temporal threshold */
+    static uint8_t copy_source[2 * 1024 * 1024 + 7];
+    static uint8_t copy_destination[sizeof(copy_source) + 1];
+    const size_t copy_length[] = {0, 1, 7, 4096, 4097, 10000, sizeof(copy_source)};
+    bool copy_succeed = true;
+
+    for (size_t i = 0; i < sizeof(copy_source); i++) {
+        copy_source[i] = (uint8_t)((i * 2654435761u) >> 13);
+    }
+    for (CRC8_reference_model_e model = CRC8_MODEL; model < CRC8_NONE_MODEL; model++) {
+        for (size_t i = 0; i < sizeof(copy_length) / sizeof(copy_length[0]); i++) {
+            crc8_ctx ctx, copy_ctx;
+            size_t first = copy_length[i] / 3;
+
+            memset(copy_destination, 0, sizeof(copy_destination));
+            crc8_init(&ctx, model);
+            crc8_update(&ctx, copy_source, copy_length[i]);
+            crc8_init(&copy_ctx, model);
+            crc8_copy(&copy_ctx, copy_destination + 1, copy_source, first);
+            crc8_copy(&copy_ctx, copy_destination + 1 + first, copy_source + first, copy_length[i] - first);
+            if (crc8_final(&ctx) != crc8_final(&copy_ctx) || memcmp(copy_destination + 1, copy_source, copy_length[i]) != 0) {
+                copy_succeed = false;
+            }
+        }
+    }
+    printf("crc8_copy check %s.\n", copy_succeed ? "succeed" : "fail");
+#endif
+    return 0;
+}
+
+static void print_crc8_table(CRC8_reference_model_e model) {
+    uint8_t crc8_result = 0;
+    uint8_t i = 0;
+    switch (model)
+    {
+    case CRC8_MODEL:
+        printf("/* Reference Model:CRC8 */\n");
+        printf("static const uint8_t CRC8_8BIT_TABLE[256] = {\n");
+        break;
+
+    case CRC8_ITU_MODEL:
+        printf("/* Reference Model:CRC8_ITU_MODEL */\n");
+        printf("static const uint8_t CRC8_8BIT_ITU_TABLE[256] = {\n");
+        break;
+
+    case CRC8_ROHC_MODEL:
+        printf("/* Reference Model:CRC8_ROHC_MODEL */\n");
+        printf("static const uint8_t CRC8_8BIT_ROHC_TABLE[256] = {\n");
+        break;
+
+    case CRC8_MAXIM_MODEL:
+        printf("/* Reference Model:CRC8_MAXIM_MODEL */\n");
+        printf("static const uint8_t CRC8_8BIT_MAXIM_TABLE[256] = {\n");
+        break;
+
+    default:
+        break;
+    }
+    for (int j = 0; j <= 0xFF; j++, i++) {
+        crc8_result = crc8_calculate(model, &i, 1);
+        if (i % 16 == 0) {
+            printf("    ");
+        } else {
+            printf(" ");
+        }
+        printf("0x%02X", crc8_result);
+        if (i != 0xFF) {
+            printf(",");
+        }
+        if ((i + 1) % 16 == 0) {
+            printf("\n");
+        }
+    }
+    printf("};\n");
+}
+#endif
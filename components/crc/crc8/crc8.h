@@ -1,30 +1,71 @@
-#ifndef __CRC8_H__
-#define __CRC8_H__
-
-#include <stdint.h>
-#include <stdbool.h>
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-typedef enum {
-    CRC8_MODEL = 0,
-    CRC8_ITU_MODEL,
-    CRC8_ROHC_MODEL,
-    CRC8_MAXIM_MODEL,
-    CRC8_NONE_MODEL,
-}CRC8_reference_model_e;
-
-uint8_t crc8_calculate(CRC8_reference_model_e model, uint8_t *input_data, size_t length);
-uint8_t crc8_calculate_mirror_mode(CRC8_reference_model_e model, uint8_t *input_data, size_t length);
-void crc8_calculate_package(CRC8_reference_model_e model, uint8_t *input_data, size_t length);
-void crc8_lookup_table_package(CRC8_reference_model_e model, uint8_t *input_data, size_t length);
-bool crc8_package_check(CRC8_reference_model_e model, uint8_t *input_data, size_t length);
-bool crc8_lookup_table_package_check(CRC8_reference_model_e model, uint8_t *input_data, size_t length);
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif
+#ifndef __CRC8_H__
+#define __CRC8_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    CRC8_MODEL = 0,
+    CRC8_ITU_MODEL,
+    CRC8_ROHC_MODEL,
+    CRC8_MAXIM_MODEL,
+    CRC8_NONE_MODEL,
+}CRC8_reference_model_e;
+
+/* Kernels crc8_calculate routes between by length, see crc8_route_set */
+typedef enum {
+    CRC8_KERNEL_BITWISE = 0, /* bit by bit, the reference */
+    CRC8_KERNEL_NIBBLE,      /* 16 entry table, two lookups per byte */
+    CRC8_KERNEL_TABLE,       /* 256 entry table, the 16 entry one with CRC8_USE_NIBBLE_TABLE */
+    CRC8_KERNEL_SLICE4,      /* four bytes per step, tables generated from the model parameters */
+    CRC8_KERNEL_SLICE8,      /* eight bytes per step */
+    CRC8_KERNEL_SHUFFLE,     /* SSSE3/AVX2 byte shuffle folding, where the CPU has it */
+    CRC8_KERNEL_NONE,
+} crc8_kernel_e;
+
+/* Streaming CRC8 computation, the same result as crc8_calculate over all the updates joined */
+typedef struct {
+    CRC8_reference_model_e model;
+    uint8_t crc;                /* CRC8 register, result xor value not yet applied */
+} crc8_ctx;
+
+/* longest frame (CRC8 included) a correction table can be built for */
+#define CRC8_CORRECTION_MAX_LENGTH 256
+
+/* Syndrome table for repairing damaged frames of one model and one frame length */
+typedef struct {
+    CRC8_reference_model_e model;
+    size_t length;                  /* frame length the table was built for, CRC8 included */
+    uint8_t correctable_bits;       /* 0: detection only, 1: single bit errors, 2: single and double bit errors */
+    uint32_t syndrome[256];         /* syndrome -> bit positions + 1 of the flipped bits, low and high half word */
+} crc8_correction_table_t;
+
+uint8_t crc8_calculate(CRC8_reference_model_e model, uint8_t *input_data, size_t length);
+uint8_t crc8_calculate_mirror_mode(CRC8_reference_model_e model, uint8_t *input_data, size_t length);
+void crc8_calculate_package(CRC8_reference_model_e model, uint8_t *input_data, size_t length);
+void crc8_lookup_table_package(CRC8_reference_model_e model, uint8_t *input_data, size_t length);
+bool crc8_package_check(CRC8_reference_model_e model, uint8_t *input_data, size_t length);
+bool crc8_lookup_table_package_check(CRC8_reference_model_e model, uint8_t *input_data, size_t length);
+void crc8_init(crc8_ctx *ctx, CRC8_reference_model_e model);
+void crc8_update(crc8_ctx *ctx, uint8_t *input_data, size_t length);
+void crc8_copy(crc8_ctx *ctx, uint8_t *destination, const uint8_t *source, size_t length);
+uint8_t crc8_final(crc8_ctx *ctx);
+bool crc8_kernel_available(CRC8_reference_model_e model, crc8_kernel_e kernel);
+uint8_t crc8_kernel_calculate(CRC8_reference_model_e model, crc8_kernel_e kernel, uint8_t *input_data, size_t length);
+void crc8_route_set(CRC8_reference_model_e model, const size_t threshold[CRC8_KERNEL_NONE]);
+void crc8_route_get(CRC8_reference_model_e model, size_t threshold[CRC8_KERNEL_NONE]);
+void crc8_param_get(CRC8_reference_model_e model, uint8_t *initial_value, uint8_t *result_xor_value);
+bool crc8_correction_table_init(crc8_correction_table_t *table, CRC8_reference_model_e model, size_t length);
+bool crc8_package_correct(const crc8_correction_table_t *table, uint8_t *input_data, size_t length, uint8_t *correction_count);
+void crc8_package_check_batch(CRC8_reference_model_e model, const uint8_t *packages, size_t count, size_t length, uint64_t *valid);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,439 @@
+/**
+ * @file crc_autotune.c
+ * @brief Times the CRC kernels on the running machine and routes crcN_calculate to the fastest per length
+ * @copyright Copyright (c) 2023
+ */
+#define _GNU_SOURCE
+#include "crc_autotune.h"
+#include "../crc8/crc8.h"
+#include "../crc16/crc16.h"
+#include "../crc32/crc32.h"
+#include "../crc64/crc64.h"
+#include "../crc_config/crc_config.h"
+#include <assert.h>
+#include <string.h>
+#include <time.h>
+
+#define CRC_AUTOTUNE_VERSION 4
+#define CRC_AUTOTUNE_MAX_KERNELS 6
+#define CRC_AUTOTUNE_MAX_MODELS 16
+#define CRC_AUTOTUNE_SIZES 17           /* lengths 1, 2, 4 ... 64 KiB */
+#define CRC_AUTOTUNE_BYTES 16384        /* bytes hashed per timing, at least one call */
+#define CRC_AUTOTUNE_ROUNDS 3           /* best of */
+
+/* One CRC width as seen by the tuner, models and kernels as plain indexes */
+typedef struct {
+    const char *name;
+    int models;
+    int kernels;
+    const char *kernel_name[CRC_AUTOTUNE_MAX_KERNELS];
+    bool (*enabled)(int model);
+    bool (*available)(int model, int kernel);
+    uint64_t (*calculate)(int model, int kernel, uint8_t *input_data, size_t length);
+    void (*route_set)(int model, const size_t *threshold);
+    void (*route_get)(int model, size_t *threshold);
+} crc_autotune_width_t;
+
+#define CRC_AUTOTUNE_ADAPTER(n) \
+static bool crc##n##_autotune_enabled(int model) { \
+    return CRC##n##_MODEL_ENABLED(model); \
+} \
+static bool crc##n##_autotune_available(int model, int kernel) { \
+    return crc##n##_kernel_available((CRC##n##_reference_model_e)model, (crc##n##_kernel_e)kernel); \
+} \
+static uint64_t crc##n##_autotune_calculate(int model, int kernel, uint8_t *input_data, size_t length) { \
+    return crc##n##_kernel_calculate((CRC##n##_reference_model_e)model, (crc##n##_kernel_e)kernel, input_data, length); \
+} \
+static void crc##n##_autotune_route_set(int model, const size_t *threshold) { \
+    crc##n##_route_set((CRC##n##_reference_model_e)model, threshold); \
+} \
+static void crc##n##_autotune_route_get(int model, size_t *threshold) { \
+    crc##n##_route_get((CRC##n##_reference_model_e)model, threshold); \
+}
+
+CRC_AUTOTUNE_ADAPTER(8)
+CRC_AUTOTUNE_ADAPTER(16)
+CRC_AUTOTUNE_ADAPTER(32)
+CRC_AUTOTUNE_ADAPTER(64)
+
+static const crc_autotune_width_t crc_autotune_width[] = {
+    {"crc8", CRC8_NONE_MODEL, CRC8_KERNEL_NONE, {"bitwise", "nibble", "table", "slicing-by-4", "slicing-by-8", "shuffle"},
+     crc8_autotune_enabled, crc8_autotune_available, crc8_autotune_calculate, crc8_autotune_route_set, crc8_autotune_route_get},
+    {"crc16", CRC16_NONE_MODEL, CRC16_KERNEL_NONE, {"bitwise", "nibble", "table", "slicing-by-4", "slicing-by-8"},
+     crc16_autotune_enabled, crc16_autotune_available, crc16_autotune_calculate, crc16_autotune_route_set, crc16_autotune_route_get},
+    {"crc32", CRC32_NONE_MODEL, CRC32_KERNEL_NONE, {"bitwise", "nibble", "table", "hardware"},
+     crc32_autotune_enabled, crc32_autotune_available, crc32_autotune_calculate, crc32_autotune_route_set, crc32_autotune_route_get},
+    {"crc64", CRC64_NONE_MODEL, CRC64_KERNEL_NONE, {"bitwise", "slicing", "clmul"},
+     crc64_autotune_enabled, crc64_autotune_available, crc64_autotune_calculate, crc64_autotune_route_set, crc64_autotune_route_get},
+};
+
+#define CRC_AUTOTUNE_WIDTHS (sizeof(crc_autotune_width) / sizeof(crc_autotune_width[0]))
+
+static double crc_autotune_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Names the CPU the thresholds were measured on, a cache file from another CPU is not used
+ *
+ * @param cpu Output, "model name" of /proc/cpuinfo or "unknown"
+ * @param size Size of cpu
+ */
+static void crc_autotune_cpu(char *cpu, size_t size) {
+    char line[256];
+    FILE *file = fopen("/proc/cpuinfo", "r");
+
+    snprintf(cpu, size, "unknown");
+    if (file == NULL) {
+        return;
+    }
+    while (fgets(line, sizeof(line), file) != NULL) {
+        char *value = strchr(line, ':');
+        if (strncmp(line, "model name", 10) == 0 && value != NULL) {
+            value += (value[1] == ' ') ? 2 : 1;
+            value[strcspn(value, "\n")] = '\0';
+            snprintf(cpu, size, "%s", value);
+            break;
+        }
+    }
+    fclose(file);
+}
+
+/**
+ * @brief Times the available kernels of every model compiled in at lengths 1 to 64 KiB and routes each
+ *        model's crcN_calculate to the fastest one. A kernel takes over from the shortest
+ *        length at which it, or a kernel after it, stays fastest for every longer length.
+ *        Takes a fraction of a second; not thread safe.
+ */
+void crc_autotune_calibrate(void) {
+    static uint8_t data[(size_t)1 << (CRC_AUTOTUNE_SIZES - 1)];
+    volatile uint64_t sink = 0;
+
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)(i * 131 + (i >> 8));
+    }
+
+    for (size_t w = 0; w < CRC_AUTOTUNE_WIDTHS; w++) {
+        const crc_autotune_width_t *width = &crc_autotune_width[w];
+        for (int model = 0; model < width->models; model++) {
+            int best[CRC_AUTOTUNE_SIZES];
+            size_t threshold[CRC_AUTOTUNE_MAX_KERNELS] = {0};
+
+            if (!width->enabled(model)) {
+                continue;
+            }
+
+            for (int s = 0; s < CRC_AUTOTUNE_SIZES; s++) {
+                size_t length = (size_t)1 << s;
+                size_t calls = (length < CRC_AUTOTUNE_BYTES) ? CRC_AUTOTUNE_BYTES / length : 1;
+                double fastest = 0.0;
+
+                best[s] = 0;
+                for (int kernel = 0; kernel < width->kernels; kernel++) {
+                    if (!width->available(model, kernel)) {
+                        continue;
+                    }
+                    double seconds = 0.0;
+                    for (int round = 0; round < CRC_AUTOTUNE_ROUNDS; round++) {
+                        double start = crc_autotune_seconds();
+                        for (size_t c = 0; c < calls; c++) {
+                            sink ^= width->calculate(model, kernel, data, length);
+                        }
+                        double elapsed = crc_autotune_seconds() - start;
+                        if (round == 0 || elapsed < seconds) {
+                            seconds = elapsed;
+                        }
+                    }
+                    if (kernel == 0 || seconds < fastest) {
+                        fastest = seconds;
+                        best[s] = kernel;
+                    }
+                }
+            }
+
+            /* kernel k takes over from the shortest length from which kernel k or a later one is always fastest */
+            int slowest_after = width->kernels;
+            for (int s = CRC_AUTOTUNE_SIZES - 1; s >= 0; s--) {
+                if (best[s] < slowest_after) {
+                    slowest_after = best[s];
+                }
+                for (int kernel = 1; kernel <= slowest_after && kernel < width->kernels; kernel++) {
+                    threshold[kernel] = (size_t)1 << s;
+                }
+            }
+            width->route_set(model, threshold);
+        }
+    }
+    (void)sink;
+}
+
+/**
+ * @brief Routes every model compiled in with thresholds saved by crc_autotune_save on the same CPU.
+ *        Lines of models this build leaves out are skipped.
+ *
+ * @param cache_path Cache file
+ * @return true The file matched this CPU and build, thresholds applied
+ * @return false Missing, stale or malformed file, nothing changed
+ */
+bool crc_autotune_load(const char *cache_path) {
+    /* parameter checkout */
+    assert(cache_path != NULL);
+
+    size_t threshold[CRC_AUTOTUNE_WIDTHS][CRC_AUTOTUNE_MAX_MODELS][CRC_AUTOTUNE_MAX_KERNELS];
+    bool seen[CRC_AUTOTUNE_WIDTHS][CRC_AUTOTUNE_MAX_MODELS];
+    char line[512], cpu[256], name[16];
+    int version = 0, model, used;
+    bool valid = true;
+    FILE *file = fopen(cache_path, "r");
+
+    if (file == NULL) {
+        return false;
+    }
+    memset(threshold, 0, sizeof(threshold));
+    memset(seen, 0, sizeof(seen));
+
+    crc_autotune_cpu(cpu, sizeof(cpu));
+    if (fgets(line, sizeof(line), file) == NULL || sscanf(line, "crc_autotune %d", &version) != 1 ||
+        version != CRC_AUTOTUNE_VERSION || fgets(line, sizeof(line), file) == NULL) {
+        fclose(file);
+        return false;
+    }
+    line[strcspn(line, "\n")] = '\0';
+    if (strncmp(line, "cpu ", 4) != 0 || strcmp(line + 4, cpu) != 0) {
+        fclose(file);
+        return false;
+    }
+
+    while (valid && fgets(line, sizeof(line), file) != NULL) {
+        size_t w;
+        if (sscanf(line, "%15s %d%n", name, &model, &used) != 2) {
+            valid = false;
+            break;
+        }
+        for (w = 0; w < CRC_AUTOTUNE_WIDTHS && strcmp(name, crc_autotune_width[w].name) != 0; w++) {
+        }
+        if (w == CRC_AUTOTUNE_WIDTHS || model < 0 || model >= crc_autotune_width[w].models || seen[w][model]) {
+            valid = false;
+            break;
+        }
+        char *p = line + used;
+        for (int kernel = 1; kernel < crc_autotune_width[w].kernels; kernel++) {
+            unsigned long long value;
+            if (sscanf(p, "%llu%n", &value, &used) != 1) {
+                valid = false;
+                break;
+            }
+            threshold[w][model][kernel] = (size_t)value;
+            p += used;
+        }
+        seen[w][model] = true;
+    }
+    fclose(file);
+
+    for (size_t w = 0; w < CRC_AUTOTUNE_WIDTHS && valid; w++) {
+        for (int m = 0; m < crc_autotune_width[w].models; m++) {
+            valid = valid && (seen[w][m] || !crc_autotune_width[w].enabled(m));
+        }
+    }
+    if (!valid) {
+        return false;
+    }
+
+    for (size_t w = 0; w < CRC_AUTOTUNE_WIDTHS; w++) {
+        for (int m = 0; m < crc_autotune_width[w].models; m++) {
+            if (crc_autotune_width[w].enabled(m)) {
+                crc_autotune_width[w].route_set(m, threshold[w][m]);
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Saves the current thresholds of every model compiled in, written to a temporary file and renamed
+ *
+ * @param cache_path Cache file
+ * @return true Saved
+ * @return false The file couldn't be written
+ */
+bool crc_autotune_save(const char *cache_path) {
+    /* parameter checkout */
+    assert(cache_path != NULL);
+
+    char temporary[4096], cpu[256];
+    size_t threshold[CRC_AUTOTUNE_MAX_KERNELS];
+    FILE *file;
+
+    if (snprintf(temporary, sizeof(temporary), "%s.tmp", cache_path) >= (int)sizeof(temporary) ||
+        (file = fopen(temporary, "w")) == NULL) {
+        return false;
+    }
+
+    crc_autotune_cpu(cpu, sizeof(cpu));
+    fprintf(file, "crc_autotune %d\ncpu %s\n", CRC_AUTOTUNE_VERSION, cpu);
+    for (size_t w = 0; w < CRC_AUTOTUNE_WIDTHS; w++) {
+        for (int m = 0; m < crc_autotune_width[w].models; m++) {
+            if (!crc_autotune_width[w].enabled(m)) {
+                continue;
+            }
+            crc_autotune_width[w].route_get(m, threshold);
+            fprintf(file, "%s %d", crc_autotune_width[w].name, m);
+            for (int kernel = 1; kernel < crc_autotune_width[w].kernels; kernel++) {
+                fprintf(file, " %llu", (unsigned long long)threshold[kernel]);
+            }
+            fprintf(file, "\n");
+        }
+    }
+
+    if (fclose(file) != 0 || rename(temporary, cache_path) != 0) {
+        remove(temporary);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Routes crcN_calculate by length at program start: thresholds come from the cache
+ *        file when it was written on this CPU, otherwise the kernels are timed and the
+ *        cache file rewritten.
+ *
+ * @param cache_path Cache file, NULL to always calibrate without caching
+ * @return crc_autotune_result_e Where the thresholds came from
+ */
+crc_autotune_result_e crc_autotune(const char *cache_path) {
+    if (cache_path != NULL && crc_autotune_load(cache_path)) {
+        return CRC_AUTOTUNE_LOADED;
+    }
+    crc_autotune_calibrate();
+    if (cache_path != NULL) {
+        crc_autotune_save(cache_path);
+    }
+    return CRC_AUTOTUNE_CALIBRATED;
+}
+
+/**
+ * @brief Prints the length ranges the kernels of each model compiled in run
+ *
+ * @param stream Output stream
+ */
+void crc_autotune_dump(FILE *stream) {
+    /* parameter checkout */
+    assert(stream != NULL);
+
+    size_t threshold[CRC_AUTOTUNE_MAX_KERNELS];
+
+    for (size_t w = 0; w < CRC_AUTOTUNE_WIDTHS; w++) {
+        for (int m = 0; m < crc_autotune_width[w].models; m++) {
+            if (!crc_autotune_width[w].enabled(m)) {
+                continue;
+            }
+            crc_autotune_width[w].route_get(m, threshold);
+            fprintf(stream, "%-6s model %d: %s", crc_autotune_width[w].name, m, crc_autotune_width[w].kernel_name[0]);
+            for (int kernel = 1; kernel < crc_autotune_width[w].kernels; kernel++) {
+                if (threshold[kernel] != 0) {
+                    fprintf(stream, ", %s from %llu", crc_autotune_width[w].kernel_name[kernel],
+                            (unsigned long long)threshold[kernel]);
+                }
+            }
+            fprintf(stream, "\n");
+        }
+    }
+}
+
+#ifndef CHECKSUM_NO_MAIN
+#define TEST
+#endif
+#ifdef TEST
+#ifndef TEST_CACHE
+#define TEST_CACHE "/tmp/crc_autotune_test.cache"
+#endif
+#define TEST_BYTES 70000
+
+int main() {
+    static uint8_t data[TEST_BYTES];
+    bool succeed = true;
+
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)(i * 7 + (i >> 9));
+    }
+
+#if 1
+    printf("---------crc autotune-----------\n");
+    remove(TEST_CACHE);
+    double start = crc_autotune_seconds();
+    if (crc_autotune(TEST_CACHE) != CRC_AUTOTUNE_CALIBRATED) {
+        succeed = false;
+    }
+    printf("calibrated in %.3f s\n", crc_autotune_seconds() - start);
+    crc_autotune_dump(stdout);
+
+    /* the routed result equals the bitwise reference at every length around the thresholds, for the models compiled in */
+    static const size_t lengths[] = {1, 2, 3, 7, 8, 15, 16, 17, 31, 63, 64, 65, 127, 128, 129, 255, 256, 1000, 4096, 4097, 65536, TEST_BYTES};
+    for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+        size_t length = lengths[i];
+        for (int m = 0; m < CRC8_NONE_MODEL; m++) {
+            if (!CRC8_MODEL_ENABLED(m)) {
+                /* left out, no kernel to route to */
+                succeed = succeed && !crc8_kernel_available((CRC8_reference_model_e)m, CRC8_KERNEL_BITWISE);
+                continue;
+            }
+            succeed = succeed && crc8_calculate((CRC8_reference_model_e)m, data, length) ==
+                                 crc8_kernel_calculate((CRC8_reference_model_e)m, CRC8_KERNEL_BITWISE, data, length);
+        }
+        for (int m = 0; m < CRC16_NONE_MODEL; m++) {
+            if (!CRC16_MODEL_ENABLED(m)) {
+                /* left out, no kernel to route to */
+                succeed = succeed && !crc16_kernel_available((CRC16_reference_model_e)m, CRC16_KERNEL_BITWISE);
+                continue;
+            }
+            succeed = succeed && crc16_calculate((CRC16_reference_model_e)m, data, length) ==
+                                 crc16_kernel_calculate((CRC16_reference_model_e)m, CRC16_KERNEL_BITWISE, data, length);
+        }
+        for (int m = 0; m < CRC32_NONE_MODEL; m++) {
+            if (!CRC32_MODEL_ENABLED(m)) {
+                /* left out, no kernel to route to */
+                succeed = succeed && !crc32_kernel_available((CRC32_reference_model_e)m, CRC32_KERNEL_BITWISE);
+                continue;
+            }
+            succeed = succeed && crc32_calculate((CRC32_reference_model_e)m, data, length) ==
+                                 crc32_kernel_calculate((CRC32_reference_model_e)m, CRC32_KERNEL_BITWISE, data, length);
+        }
+        for (int m = 0; m < CRC64_NONE_MODEL; m++) {
+            if (!CRC64_MODEL_ENABLED(m)) {
+                /* left out, no kernel to route to */
+                succeed = succeed && !crc64_kernel_available((CRC64_reference_model_e)m, CRC64_KERNEL_BITWISE);
+                continue;
+            }
+            succeed = succeed && crc64_calculate((CRC64_reference_model_e)m, data, length) ==
+                                 crc64_kernel_calculate((CRC64_reference_model_e)m, CRC64_KERNEL_BITWISE, data, length);
+        }
+    }
+
+    /* a second start reads the cache back, to the same thresholds */
+    size_t before[CRC32_KERNEL_NONE], after[CRC32_KERNEL_NONE];
+    CRC32_reference_model_e cached = CRC32C_MODEL;
+    while (!CRC32_MODEL_ENABLED(cached)) {
+        cached--;
+    }
+    crc32_route_get(cached, before);
+    static const size_t reset[CRC32_KERNEL_NONE] = {0};
+    crc32_route_set(cached, reset);
+    if (crc_autotune(TEST_CACHE) != CRC_AUTOTUNE_LOADED) {
+        succeed = false;
+    }
+    crc32_route_get(cached, after);
+    succeed = succeed && memcmp(before, after, sizeof(before)) == 0;
+
+    /* a cache from another CPU is ignored */
+    FILE *file = fopen(TEST_CACHE, "w");
+    fprintf(file, "crc_autotune %d\ncpu some other cpu\n", CRC_AUTOTUNE_VERSION);
+    fclose(file);
+    succeed = succeed && !crc_autotune_load(TEST_CACHE);
+    remove(TEST_CACHE);
+    printf("crc autotune check %s.\n", succeed ? "succeed" : "fail");
+#endif
+    return 0;
+}
+#endif
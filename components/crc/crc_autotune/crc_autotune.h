@@ -0,0 +1,28 @@
+#ifndef __CRC_AUTOTUNE_H__
+#define __CRC_AUTOTUNE_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    CRC_AUTOTUNE_LOADED = 0,        /* thresholds read back from the cache file */
+    CRC_AUTOTUNE_CALIBRATED,        /* kernels timed on this machine, cache file written if given */
+} crc_autotune_result_e;
+
+crc_autotune_result_e crc_autotune(const char *cache_path);
+void crc_autotune_calibrate(void);
+bool crc_autotune_load(const char *cache_path);
+bool crc_autotune_save(const char *cache_path);
+void crc_autotune_dump(FILE *stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CRC_AUTOTUNE_H__ */
@@ -0,0 +1,111 @@
+#ifndef __CRC_CONFIG_H__
+#define __CRC_CONFIG_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Footprint of libcrc, chosen at compile time with -D or the CHECKSUM_CRC_* CMake options;
+ * left alone, everything is compiled in.
+ *
+ * CRCn_MODELS            models compiled in, an or of the CRCn_..._BIT below. The byte tables
+ *                        of the others are left out and the table kernels assert on them.
+ * CRCn_USE_NIBBLE_TABLE  16 entry tables instead of 256 entry ones (n = 8, 16, 32)
+ * CRC_NO_SLICING         no slicing-by-4/8, so none of the tables it generates into RAM on
+ *                        first use: 2 KiB per CRC8 model, 4 KiB per CRC16 and 14 KiB per CRC64.
+ *                        The CRC8 byte shuffle folding is built on them and goes as well.
+ * CRC_NO_BITWISE         the bitwise kernel runs the lookup table instead of its own loop
+ * CRCn_NO_HARDWARE       no CRC8 byte shuffle, CRC32 SSE4.2 or CRC64 PCLMULQDQ kernel (n = 8, 32, 64)
+ */
+
+#define CRC8_MODEL_BIT                  (1u << 0)
+#define CRC8_ITU_MODEL_BIT              (1u << 1)
+#define CRC8_ROHC_MODEL_BIT             (1u << 2)
+#define CRC8_MAXIM_MODEL_BIT            (1u << 3)
+#define CRC8_ALL_MODELS                 0x000Fu
+
+#define CRC16_IBM_MODEL_BIT             (1u << 0)
+#define CRC16_MAXIM_MODEL_BIT           (1u << 1)
+#define CRC16_USB_MODEL_BIT             (1u << 2)
+#define CRC16_MODBUS_MODEL_BIT          (1u << 3)
+#define CRC16_CCITT_MODEL_BIT           (1u << 4)
+#define CRC16_CCITT_FALSE_MODEL_BIT     (1u << 5)
+#define CRC16_X25_MODEL_BIT             (1u << 6)
+#define CRC16_XMODEM_MODEL_BIT          (1u << 7)
+#define CRC16_DNP_MODEL_BIT             (1u << 8)
+#define CRC16_ALL_MODELS                0x01FFu
+
+#define CRC32_MODEL_BIT                 (1u << 0)
+#define CRC32_MPEG2_MODEL_BIT           (1u << 1)
+#define CRC32C_MODEL_BIT                (1u << 2)
+#define CRC32_ALL_MODELS                0x0007u
+
+#define CRC64_ECMA182_MODEL_BIT         (1u << 0)
+#define CRC64_XZ_MODEL_BIT              (1u << 1)
+#define CRC64_GO_ISO_MODEL_BIT          (1u << 2)
+#define CRC64_ALL_MODELS                0x0007u
+
+#ifndef CRC8_MODELS
+#define CRC8_MODELS                     CRC8_ALL_MODELS
+#endif
+#ifndef CRC16_MODELS
+#define CRC16_MODELS                    CRC16_ALL_MODELS
+#endif
+#ifndef CRC32_MODELS
+#define CRC32_MODELS                    CRC32_ALL_MODELS
+#endif
+#ifndef CRC64_MODELS
+#define CRC64_MODELS                    CRC64_ALL_MODELS
+#endif
+
+#if (CRC8_MODELS & CRC8_ALL_MODELS) == 0 || (CRC16_MODELS & CRC16_ALL_MODELS) == 0 || \
+    (CRC32_MODELS & CRC32_ALL_MODELS) == 0 || (CRC64_MODELS & CRC64_ALL_MODELS) == 0
+#error "every CRC width needs at least one model compiled in"
+#endif
+
+/* whether a model is compiled in, for run time checks */
+#define CRC8_MODEL_ENABLED(model)       (((CRC8_MODELS) >> (model)) & 1u)
+#define CRC16_MODEL_ENABLED(model)      (((CRC16_MODELS) >> (model)) & 1u)
+#define CRC32_MODEL_ENABLED(model)      (((CRC32_MODELS) >> (model)) & 1u)
+#define CRC64_MODEL_ENABLED(model)      (((CRC64_MODELS) >> (model)) & 1u)
+
+/* models in a mask: the tables generated per model in RAM only have rows for those compiled in */
+#define CRC_MODEL_COUNT(models) \
+    (((models) & 1u) + (((models) >> 1) & 1u) + (((models) >> 2) & 1u) + (((models) >> 3) & 1u) + \
+     (((models) >> 4) & 1u) + (((models) >> 5) & 1u) + (((models) >> 6) & 1u) + (((models) >> 7) & 1u) + \
+     (((models) >> 8) & 1u) + (((models) >> 9) & 1u) + (((models) >> 10) & 1u) + (((models) >> 11) & 1u))
+
+/**
+ * @brief Gives the row of a model in the tables generated per model, its rank among the models compiled in
+ *
+ * @param models Models compiled in, CRCn_MODELS
+ * @param all Every model of the width, CRCn_ALL_MODELS
+ * @param model Model, compiled in
+ * @return size_t Row
+ */
+static inline size_t crc_model_slot(uint32_t models, uint32_t all, int model) {
+    size_t slot = 0;
+
+    /* folded away in full builds */
+    if (models == all) {
+        return (size_t)model;
+    }
+    for (int m = 0; m < model; m++) {
+        slot += (models >> m) & 1u;
+    }
+    return slot;
+}
+
+#define CRC8_MODEL_SLOT(model)          crc_model_slot(CRC8_MODELS, CRC8_ALL_MODELS, (int)(model))
+#define CRC16_MODEL_SLOT(model)         crc_model_slot(CRC16_MODELS, CRC16_ALL_MODELS, (int)(model))
+#define CRC64_MODEL_SLOT(model)         crc_model_slot(CRC64_MODELS, CRC64_ALL_MODELS, (int)(model))
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CRC_CONFIG_H__ */
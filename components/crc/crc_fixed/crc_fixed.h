@@ -0,0 +1,157 @@
+#ifndef __CRC_FIXED_H__
+#define __CRC_FIXED_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "../crc8/crc8.h"
+#include "../crc16/crc16.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Fixed length CRC8/CRC16 for short frames, inlined and fully unrolled: the model and the
+ * payload length are bound at compile time, so there is no assert, switch or loop left and a
+ * frame costs one table lookup per byte. Define the functions once per model and length:
+ *
+ *     CRC16_FIXED_DEFINE(modbus_read, CRC16_MODBUS, 6)
+ *
+ * gives, for a 6 byte payload followed by its CRC16 low byte first (8 byte frame),
+ *
+ *     uint16_t modbus_read_calculate(const uint8_t *input_data);   CRC16 of the payload
+ *     void modbus_read_package(uint8_t *input_data);               stores the CRC16 after it
+ *     bool modbus_read_check(const uint8_t *input_data);           compares without branching
+ *
+ * The same results as crcN_calculate, crcN_lookup_table_package and crcN_lookup_table_package_check
+ * with length + N/8. The payload length goes from 1 to CRC_FIXED_MAX_LENGTH and has to be a literal.
+ * The 256 entry tables of libcrc are used, so CRCn_USE_NIBBLE_TABLE builds can't link these, nor
+ * builds leaving the model out (CRCn_MODELS).
+ */
+#define CRC_FIXED_MAX_LENGTH 32
+
+extern const uint8_t CRC8_8BIT_TABLE[256];
+extern const uint8_t CRC8_8BIT_ITU_TABLE[256];
+extern const uint8_t CRC8_8BIT_ROHC_TABLE[256];
+extern const uint8_t CRC8_8BIT_MAXIM_TABLE[256];
+
+extern const uint16_t CRC16_IBM_MODEL_TABLE[256];
+extern const uint16_t CRC16_MAXIM_MODEL_TABLE[256];
+extern const uint16_t CRC16_USB_MODEL_TABLE[256];
+extern const uint16_t CRC16_MODBUS_MODEL_TABLE[256];
+extern const uint16_t CRC16_CCITT_MODEL_TABLE[256];
+extern const uint16_t CRC16_CCITT_FALSE_MODEL_TABLE[256];
+extern const uint16_t CRC16_X25_MODEL_TABLE[256];
+extern const uint16_t CRC16_XMODEM_MODEL_TABLE[256];
+extern const uint16_t CRC16_DNP_MODEL_TABLE[256];
+
+/* Compile time model parameters: table, initial value, result xor value, reflected */
+#define CRC8_FIXED                  CRC8_8BIT_TABLE, 0x00, 0x00, false
+#define CRC8_ITU_FIXED              CRC8_8BIT_ITU_TABLE, 0x00, 0x55, false
+#define CRC8_ROHC_FIXED             CRC8_8BIT_ROHC_TABLE, 0xFF, 0x00, true
+#define CRC8_MAXIM_FIXED            CRC8_8BIT_MAXIM_TABLE, 0x00, 0x00, true
+
+#define CRC16_IBM_FIXED             CRC16_IBM_MODEL_TABLE, 0x0000, 0x0000, true
+#define CRC16_MAXIM_FIXED           CRC16_MAXIM_MODEL_TABLE, 0x0000, 0xFFFF, true
+#define CRC16_USB_FIXED             CRC16_USB_MODEL_TABLE, 0xFFFF, 0xFFFF, true
+#define CRC16_MODBUS_FIXED          CRC16_MODBUS_MODEL_TABLE, 0xFFFF, 0x0000, true
+#define CRC16_CCITT_FIXED           CRC16_CCITT_MODEL_TABLE, 0x0000, 0x0000, true
+#define CRC16_CCITT_FALSE_FIXED     CRC16_CCITT_FALSE_MODEL_TABLE, 0xFFFF, 0x0000, false
+#define CRC16_X25_FIXED             CRC16_X25_MODEL_TABLE, 0xFFFF, 0xFFFF, true
+#define CRC16_XMODEM_FIXED          CRC16_XMODEM_MODEL_TABLE, 0x0000, 0x0000, false
+#define CRC16_DNP_FIXED             CRC16_DNP_MODEL_TABLE, 0x0000, 0xFFFF, true
+
+/* CRC_FIXED_UNROLL_n(step) expands to step(0) ... step(n - 1) */
+#define CRC_FIXED_UNROLL_1(step)  step(0)
+#define CRC_FIXED_UNROLL_2(step)  CRC_FIXED_UNROLL_1(step) step(1)
+#define CRC_FIXED_UNROLL_3(step)  CRC_FIXED_UNROLL_2(step) step(2)
+#define CRC_FIXED_UNROLL_4(step)  CRC_FIXED_UNROLL_3(step) step(3)
+#define CRC_FIXED_UNROLL_5(step)  CRC_FIXED_UNROLL_4(step) step(4)
+#define CRC_FIXED_UNROLL_6(step)  CRC_FIXED_UNROLL_5(step) step(5)
+#define CRC_FIXED_UNROLL_7(step)  CRC_FIXED_UNROLL_6(step) step(6)
+#define CRC_FIXED_UNROLL_8(step)  CRC_FIXED_UNROLL_7(step) step(7)
+#define CRC_FIXED_UNROLL_9(step)  CRC_FIXED_UNROLL_8(step) step(8)
+#define CRC_FIXED_UNROLL_10(step) CRC_FIXED_UNROLL_9(step) step(9)
+#define CRC_FIXED_UNROLL_11(step) CRC_FIXED_UNROLL_10(step) step(10)
+#define CRC_FIXED_UNROLL_12(step) CRC_FIXED_UNROLL_11(step) step(11)
+#define CRC_FIXED_UNROLL_13(step) CRC_FIXED_UNROLL_12(step) step(12)
+#define CRC_FIXED_UNROLL_14(step) CRC_FIXED_UNROLL_13(step) step(13)
+#define CRC_FIXED_UNROLL_15(step) CRC_FIXED_UNROLL_14(step) step(14)
+#define CRC_FIXED_UNROLL_16(step) CRC_FIXED_UNROLL_15(step) step(15)
+#define CRC_FIXED_UNROLL_17(step) CRC_FIXED_UNROLL_16(step) step(16)
+#define CRC_FIXED_UNROLL_18(step) CRC_FIXED_UNROLL_17(step) step(17)
+#define CRC_FIXED_UNROLL_19(step) CRC_FIXED_UNROLL_18(step) step(18)
+#define CRC_FIXED_UNROLL_20(step) CRC_FIXED_UNROLL_19(step) step(19)
+#define CRC_FIXED_UNROLL_21(step) CRC_FIXED_UNROLL_20(step) step(20)
+#define CRC_FIXED_UNROLL_22(step) CRC_FIXED_UNROLL_21(step) step(21)
+#define CRC_FIXED_UNROLL_23(step) CRC_FIXED_UNROLL_22(step) step(22)
+#define CRC_FIXED_UNROLL_24(step) CRC_FIXED_UNROLL_23(step) step(23)
+#define CRC_FIXED_UNROLL_25(step) CRC_FIXED_UNROLL_24(step) step(24)
+#define CRC_FIXED_UNROLL_26(step) CRC_FIXED_UNROLL_25(step) step(25)
+#define CRC_FIXED_UNROLL_27(step) CRC_FIXED_UNROLL_26(step) step(26)
+#define CRC_FIXED_UNROLL_28(step) CRC_FIXED_UNROLL_27(step) step(27)
+#define CRC_FIXED_UNROLL_29(step) CRC_FIXED_UNROLL_28(step) step(28)
+#define CRC_FIXED_UNROLL_30(step) CRC_FIXED_UNROLL_29(step) step(29)
+#define CRC_FIXED_UNROLL_31(step) CRC_FIXED_UNROLL_30(step) step(30)
+#define CRC_FIXED_UNROLL_32(step) CRC_FIXED_UNROLL_31(step) step(31)
+
+/* one table step of the CRC register, reflected is a constant so only one side survives */
+static inline uint8_t crc8_fixed_step(const uint8_t *table, bool reflected, uint8_t crc, uint8_t data) {
+    (void)reflected; /* CRC8 shifts the whole register out either way */
+    return table[crc ^ data];
+}
+
+static inline uint16_t crc16_fixed_step(const uint16_t *table, bool reflected, uint16_t crc, uint8_t data) {
+    return reflected ? (uint16_t)((crc >> 8) ^ table[(crc ^ data) & 0xFF])
+                     : (uint16_t)((crc << 8) ^ table[((crc >> 8) ^ data) & 0xFF]);
+}
+
+#define CRC8_FIXED_STEP(i)  crc = crc8_fixed_step(table, reflected, crc, input_data[i]);
+#define CRC16_FIXED_STEP(i) crc = crc16_fixed_step(table, reflected, crc, input_data[i]);
+
+#define CRC_FIXED_EXPAND(define, ...) define(__VA_ARGS__)
+
+#define CRC8_FIXED_DEFINE(name, model, length) \
+    CRC_FIXED_EXPAND(CRC8_FIXED_FUNCTIONS, name, length, model##_FIXED)
+
+#define CRC8_FIXED_FUNCTIONS(name, length, model_table, initial_value, result_xor_value, model_reflected) \
+static inline uint8_t name##_calculate(const uint8_t *input_data) { \
+    const uint8_t *const table = model_table; \
+    const bool reflected = model_reflected; \
+    uint8_t crc = initial_value; \
+    CRC_FIXED_UNROLL_##length(CRC8_FIXED_STEP) \
+    return (uint8_t)(crc ^ result_xor_value); \
+} \
+static inline void name##_package(uint8_t *input_data) { \
+    input_data[length] = name##_calculate(input_data); \
+} \
+static inline bool name##_check(const uint8_t *input_data) { \
+    return name##_calculate(input_data) == input_data[length]; \
+}
+
+#define CRC16_FIXED_DEFINE(name, model, length) \
+    CRC_FIXED_EXPAND(CRC16_FIXED_FUNCTIONS, name, length, model##_FIXED)
+
+#define CRC16_FIXED_FUNCTIONS(name, length, model_table, initial_value, result_xor_value, model_reflected) \
+static inline uint16_t name##_calculate(const uint8_t *input_data) { \
+    const uint16_t *const table = model_table; \
+    const bool reflected = model_reflected; \
+    uint16_t crc = initial_value; \
+    CRC_FIXED_UNROLL_##length(CRC16_FIXED_STEP) \
+    return (uint16_t)(crc ^ result_xor_value); \
+} \
+static inline void name##_package(uint8_t *input_data) { \
+    uint16_t crc16_result = name##_calculate(input_data); \
+    input_data[length] = crc16_result & 0xFF; \
+    input_data[length + 1] = (crc16_result >> 8) & 0xFF; \
+} \
+static inline bool name##_check(const uint8_t *input_data) { \
+    return name##_calculate(input_data) == (uint16_t)(input_data[length] | (input_data[length + 1] << 8)); \
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,1212 @@
+/**
+ * @file crc_reveng.c
+ * @brief Recovers the CRC parameters of sample frames: the polynomial by factoring over GF(2),
+ *        the initial and xor values by linear algebra
+ * @copyright Copyright (c) 2023
+ */
+#include "crc_reveng.h"
+#include "../crc8/crc8.h"
+#include "../crc16/crc16.h"
+#include "../crc32/crc32.h"
+#include "../crc64/crc64.h"
+#include "../crc_config/crc_config.h"
+#include <assert.h>
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/*
+ * A CRC register is the message polynomial M(x) times x^w mod P, plus the initial value carried
+ * through the message and the xor value: linear in everything but P. Two messages of one length
+ * share the initial value and xor value terms, so their CRCs c1, c2 differ by
+ *
+ *     (M1 + M2) x^w = f^-1(c1 + c2)  mod P,     f reflecting the register if the output is
+ *
+ * that is, P divides G = (M1 + M2) x^w + f^-1(c1 + c2). Every pair of frames of one length gives
+ * such a G; P divides their gcd, usually the polynomial itself once there are three frames. The
+ * degree w divisors are the products of its irreducible factors of degree w or less, found by
+ * distinct degree factorization (x^(2^i) - x is the product of the irreducibles of degree
+ * dividing i) and split with Cantor-Zassenhaus. The initial and xor values then solve a linear
+ * system over GF(2), w equations per frame length. Every search (width, input and output
+ * reflection, CRC byte order) is independent, they are spread over threads.
+ */
+
+/* candidate polynomials tried per search, more only when the samples say too little */
+#define CRC_REVENG_MAX_CANDIDATES 4096
+
+/* GF(2) polynomial, bit i of the words the coefficient of x^i */
+typedef struct {
+    uint64_t *word;
+    size_t words;                   /* allocated */
+    int degree;                     /* -1 for zero */
+} crc_reveng_poly_t;
+
+/* irreducible factor of degree 64 or less, x^degree left out of the bits */
+typedef struct {
+    uint64_t bits;
+    int degree;
+    int multiplicity;
+} crc_reveng_factor_t;
+
+/* One search: a width, a reflection and a byte order */
+typedef struct {
+    unsigned int width;
+    bool big_endian;
+    bool input_inversion;
+    bool output_inversion;
+    crc_reveng_result_t *results;
+    size_t count;
+    int error;
+} crc_reveng_variant_t;
+
+typedef struct {
+    const crc_reveng_frame_t *frames;
+    size_t count;
+    size_t *order;                  /* frame indexes by length */
+    crc_reveng_variant_t *variant;
+    size_t variants;
+    size_t next;                    /* next variant for a thread to take */
+} crc_reveng_search_t;
+
+static uint64_t crc_reveng_mask(unsigned int width) {
+    return (width == 64) ? ~0ull : ((1ull << width) - 1);
+}
+
+static uint64_t crc_reveng_reverse(uint64_t value, unsigned int width) {
+    value = ((value >> 1) & 0x5555555555555555ull) | ((value & 0x5555555555555555ull) << 1);
+    value = ((value >> 2) & 0x3333333333333333ull) | ((value & 0x3333333333333333ull) << 2);
+    value = ((value >> 4) & 0x0F0F0F0F0F0F0F0Full) | ((value & 0x0F0F0F0F0F0F0F0Full) << 4);
+    value = ((value >> 8) & 0x00FF00FF00FF00FFull) | ((value & 0x00FF00FF00FF00FFull) << 8);
+    value = ((value >> 16) & 0x0000FFFF0000FFFFull) | ((value & 0x0000FFFF0000FFFFull) << 16);
+    value = (value >> 32) | (value << 32);
+    return value >> (64 - width);
+}
+
+/**
+ * @brief Runs a CRC register over bytes, most significant bit first after the optional reflection
+ *
+ * @param width CRC bits
+ * @param polynomial Normal form, x^width left out
+ * @param reflected Reflect every byte first
+ * @param crc Register
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint64_t Register
+ */
+static uint64_t crc_reveng_register(unsigned int width, uint64_t polynomial, bool reflected, uint64_t crc,
+                                   const uint8_t *input_data, size_t length) {
+    uint64_t top = 1ull << (width - 1), mask = crc_reveng_mask(width);
+
+    for (size_t i = 0; i < length; i++) {
+        uint8_t byte = reflected ? (uint8_t)crc_reveng_reverse(input_data[i], 8) : input_data[i];
+        for (int bit = 7; bit >= 0; bit--) {
+            bool feedback = ((crc & top) != 0) ^ ((byte >> bit) & 1);
+            crc = (crc << 1) & mask;
+            if (feedback) {
+                crc ^= polynomial;
+            }
+        }
+    }
+    return crc;
+}
+
+/**
+ * @brief Calculates the CRC of an input with recovered (or any catalogue) parameters, bit by bit
+ *
+ * @param model Parameters, width from 1 to 64
+ * @param input_data Input uint8 t type array data
+ * @param length Input uint8 t type array length
+ * @return uint64_t CRC
+ */
+uint64_t crc_reveng_calculate(const crc_reveng_result_t *model, const uint8_t *input_data, size_t length) {
+    /* parameter checkout */
+    assert(model != NULL);
+    assert(model->width > 0 && model->width <= 64);
+    assert(input_data != NULL || length == 0);
+
+    uint64_t crc = crc_reveng_register(model->width, model->polynomial, model->input_inversion,
+                                       model->initial_value, input_data, length);
+    if (model->output_inversion) {
+        crc = crc_reveng_reverse(crc, model->width);
+    }
+    return (crc ^ model->result_xor_value) & crc_reveng_mask(model->width);
+}
+
+/* ---- GF(2) polynomials ---- */
+
+static bool crc_reveng_poly_alloc(crc_reveng_poly_t *p, size_t words) {
+    p->word = (uint64_t *)calloc(words, sizeof(uint64_t));
+    p->words = words;
+    p->degree = -1;
+    return p->word != NULL;
+}
+
+static void crc_reveng_poly_free(crc_reveng_poly_t *p) {
+    free(p->word);
+    p->word = NULL;
+}
+
+static void crc_reveng_poly_zero(crc_reveng_poly_t *p) {
+    if (p->degree >= 0) {
+        memset(p->word, 0, (size_t)(p->degree / 64 + 1) * sizeof(uint64_t));
+    }
+    p->degree = -1;
+}
+
+static void crc_reveng_poly_copy(crc_reveng_poly_t *destination, const crc_reveng_poly_t *source) {
+    crc_reveng_poly_zero(destination);
+    if (source->degree >= 0) {
+        memcpy(destination->word, source->word, (size_t)(source->degree / 64 + 1) * sizeof(uint64_t));
+    }
+    destination->degree = source->degree;
+}
+
+/* degree from a bound down, after coefficients above it were cleared */
+static void crc_reveng_poly_normalize(crc_reveng_poly_t *p, int bound) {
+    for (int w = bound / 64; w >= 0; w--) {
+        if (p->word[w] != 0) {
+            p->degree = w * 64 + 63 - __builtin_clzll(p->word[w]);
+            return;
+        }
+    }
+    p->degree = -1;
+}
+
+/* a += b x^shift, a's degree left to the caller. Each word only reads its two source words, no
+   carry runs from one to the next, so the loop vectorizes: the bulk of the gcds and reductions. */
+static void crc_reveng_poly_add_shifted(crc_reveng_poly_t *a, const crc_reveng_poly_t *b, int shift) {
+    size_t words = (size_t)(b->degree / 64 + 1);
+    int bits = shift % 64;
+    uint64_t *restrict w = a->word + shift / 64;
+    const uint64_t *restrict source = b->word;
+
+    if (bits == 0) {
+        for (size_t i = 0; i < words; i++) {
+            w[i] ^= source[i];
+        }
+        return;
+    }
+    w[0] ^= source[0] << bits;
+    for (size_t i = 1; i < words; i++) {
+        w[i] ^= (source[i] << bits) | (source[i - 1] >> (64 - bits));
+    }
+    w[words] ^= source[words - 1] >> (64 - bits);
+}
+
+/**
+ * @brief Divides a by b, b not zero: a becomes the remainder, the quotient goes to quotient if given
+ */
+static void crc_reveng_poly_divide(crc_reveng_poly_t *a, const crc_reveng_poly_t *b, crc_reveng_poly_t *quotient) {
+    if (quotient != NULL) {
+        crc_reveng_poly_zero(quotient);
+        if (a->degree >= b->degree) {
+            quotient->degree = a->degree - b->degree;
+        }
+    }
+    while (a->degree >= b->degree) {
+        int shift = a->degree - b->degree;
+        crc_reveng_poly_add_shifted(a, b, shift);
+        if (quotient != NULL) {
+            quotient->word[shift / 64] ^= 1ull << (shift % 64);
+        }
+        crc_reveng_poly_normalize(a, a->degree);
+    }
+}
+
+/* a = gcd(a, b), b clobbered */
+static void crc_reveng_poly_gcd(crc_reveng_poly_t *a, crc_reveng_poly_t *b) {
+    while (b->degree >= 0) {
+        crc_reveng_poly_divide(a, b, NULL);
+        crc_reveng_poly_t t = *a;
+        *a = *b;
+        *b = t;
+    }
+}
+
+/* bit i of x goes to bit 2i */
+static uint64_t crc_reveng_spread(uint32_t x) {
+    uint64_t v = x;
+    v = (v | (v << 16)) & 0x0000FFFF0000FFFFull;
+    v = (v | (v << 8)) & 0x00FF00FF00FF00FFull;
+    v = (v | (v << 4)) & 0x0F0F0F0F0F0F0F0Full;
+    v = (v | (v << 2)) & 0x3333333333333333ull;
+    v = (v | (v << 1)) & 0x5555555555555555ull;
+    return v;
+}
+
+/* a = a^2 mod m, through scratch; squaring over GF(2) only spreads the bits apart */
+static void crc_reveng_poly_square_mod(crc_reveng_poly_t *a, const crc_reveng_poly_t *m, crc_reveng_poly_t *scratch) {
+    crc_reveng_poly_zero(scratch);
+    if (a->degree < 0) {
+        return;
+    }
+    for (int w = 0; w <= a->degree / 64; w++) {
+        scratch->word[2 * w] = crc_reveng_spread((uint32_t)a->word[w]);
+        scratch->word[2 * w + 1] = crc_reveng_spread((uint32_t)(a->word[w] >> 32));
+    }
+    scratch->degree = 2 * a->degree;
+    crc_reveng_poly_divide(scratch, m, NULL);
+    crc_reveng_poly_t t = *a;
+    *a = *scratch;
+    *scratch = t;
+}
+
+/* ---- factoring ---- */
+
+typedef struct {
+    size_t words;
+    uint64_t random;                /* xorshift state of the splits */
+    crc_reveng_factor_t *factor;
+    size_t factors;
+    size_t capacity;
+    int error;
+} crc_reveng_factoring_t;
+
+static uint64_t crc_reveng_random(crc_reveng_factoring_t *f) {
+    f->random ^= f->random << 13;
+    f->random ^= f->random >> 7;
+    f->random ^= f->random << 17;
+    return f->random;
+}
+
+static void crc_reveng_factor_add(crc_reveng_factoring_t *f, const crc_reveng_poly_t *q) {
+    if (f->factors == f->capacity) {
+        size_t capacity = f->capacity ? 2 * f->capacity : 16;
+        crc_reveng_factor_t *factor = (crc_reveng_factor_t *)realloc(f->factor, capacity * sizeof(crc_reveng_factor_t));
+        if (factor == NULL) {
+            f->error = ENOMEM;
+            return;
+        }
+        f->factor = factor;
+        f->capacity = capacity;
+    }
+    f->factor[f->factors].bits = (q->degree == 64) ? q->word[0] : (q->word[0] & ((1ull << q->degree) - 1));
+    f->factor[f->factors].degree = q->degree;
+    f->factor[f->factors].multiplicity = 0;
+    f->factors++;
+}
+
+/**
+ * @brief Splits a product of distinct irreducibles of one degree into them (Cantor-Zassenhaus):
+ *        the trace a + a^2 + ... + a^(2^(degree-1)) of a random a is 0 modulo a random half of
+ *        the factors, which its gcd with the product collects
+ *
+ * @param f Factoring state, the factors are appended
+ * @param d Product, clobbered
+ * @param degree Degree of every factor
+ */
+static void crc_reveng_split(crc_reveng_factoring_t *f, crc_reveng_poly_t *d, int degree) {
+    crc_reveng_poly_t a, trace, e, scratch;
+
+    if (d->degree == degree) {
+        crc_reveng_factor_add(f, d);
+        return;
+    }
+    if (!crc_reveng_poly_alloc(&a, f->words) || !crc_reveng_poly_alloc(&trace, f->words) ||
+        !crc_reveng_poly_alloc(&e, f->words) || !crc_reveng_poly_alloc(&scratch, f->words)) {
+        f->error = ENOMEM;
+    }
+    while (f->error == 0) {
+        crc_reveng_poly_zero(&a);
+        for (int w = 0; w <= (d->degree - 1) / 64; w++) {
+            a.word[w] = crc_reveng_random(f);
+        }
+        if ((d->degree % 64) != 0) {
+            a.word[(d->degree - 1) / 64] &= ~0ull >> (64 - d->degree % 64);
+        }
+        crc_reveng_poly_normalize(&a, d->degree - 1);
+        crc_reveng_poly_copy(&trace, &a);
+        for (int i = 1; i < degree; i++) {
+            crc_reveng_poly_square_mod(&a, d, &scratch);
+            crc_reveng_poly_add_shifted(&trace, &a, 0);
+            crc_reveng_poly_normalize(&trace, d->degree);
+        }
+        crc_reveng_poly_copy(&e, d);
+        crc_reveng_poly_gcd(&e, &trace);
+        if (e.degree > 0 && e.degree < d->degree) {
+            crc_reveng_poly_divide(d, &e, &a);
+            crc_reveng_split(f, &e, degree);
+            crc_reveng_split(f, &a, degree);
+            break;
+        }
+    }
+    crc_reveng_poly_free(&a);
+    crc_reveng_poly_free(&trace);
+    crc_reveng_poly_free(&e);
+    crc_reveng_poly_free(&scratch);
+}
+
+/**
+ * @brief Finds the irreducible factors of degree up to max_degree with their multiplicities
+ *        (distinct degree factorization, the factors of each degree split apart)
+ *
+ * @param f Factoring state, the factors are appended
+ * @param g Polynomial, not divisible by x, clobbered
+ * @param max_degree Highest factor degree wanted
+ */
+static void crc_reveng_factor(crc_reveng_factoring_t *f, crc_reveng_poly_t *g, int max_degree) {
+    crc_reveng_poly_t h, t, d, q, r, scratch;
+
+    if (!crc_reveng_poly_alloc(&h, f->words) || !crc_reveng_poly_alloc(&t, f->words) ||
+        !crc_reveng_poly_alloc(&d, f->words) || !crc_reveng_poly_alloc(&q, f->words) ||
+        !crc_reveng_poly_alloc(&r, f->words) || !crc_reveng_poly_alloc(&scratch, f->words)) {
+        f->error = ENOMEM;
+    }
+    /* h = x^(2^i) mod g */
+    if (f->error == 0 && g->degree > 1) {
+        h.word[0] = 2;
+        h.degree = 1;
+    }
+    for (int i = 1; f->error == 0 && i <= max_degree && g->degree > 0; i++) {
+        if (g->degree < 2 * i) {
+            /* no factor below i left, so what remains is irreducible */
+            if (g->degree <= max_degree) {
+                size_t first = f->factors;
+                crc_reveng_factor_add(f, g);
+                if (f->error == 0) {
+                    f->factor[first].multiplicity = 1;
+                }
+            }
+            break;
+        }
+        crc_reveng_poly_square_mod(&h, g, &scratch);
+        crc_reveng_poly_copy(&t, &h);
+        t.word[0] ^= 2;
+        crc_reveng_poly_normalize(&t, t.degree > 1 ? t.degree : 1);
+        crc_reveng_poly_copy(&d, g);
+        crc_reveng_poly_gcd(&d, &t);
+        if (d.degree <= 0) {
+            continue;
+        }
+
+        /* d is the product of the degree i factors, each divided out as often as it goes */
+        size_t first = f->factors;
+        crc_reveng_split(f, &d, i);
+        for (size_t k = first; f->error == 0 && k < f->factors; k++) {
+            crc_reveng_poly_zero(&d);
+            d.word[0] = f->factor[k].bits;
+            if (i == 64) {
+                d.word[1] = 1;
+            } else {
+                d.word[0] |= 1ull << i;
+            }
+            d.degree = i;
+            for (;;) {
+                crc_reveng_poly_copy(&r, g);
+                crc_reveng_poly_divide(&r, &d, &q);
+                if (r.degree >= 0) {
+                    break;
+                }
+                crc_reveng_poly_copy(g, &q);
+                f->factor[k].multiplicity++;
+            }
+        }
+        crc_reveng_poly_divide(&h, g, NULL);
+    }
+    crc_reveng_poly_free(&h);
+    crc_reveng_poly_free(&t);
+    crc_reveng_poly_free(&d);
+    crc_reveng_poly_free(&q);
+    crc_reveng_poly_free(&r);
+    crc_reveng_poly_free(&scratch);
+}
+
+/* product of two polynomials of degree 64 or less, low and high words */
+static void crc_reveng_multiply(uint64_t a_low, uint64_t a_high, uint64_t b_low, uint64_t b_high,
+                                uint64_t *low, uint64_t *high) {
+    uint64_t l = 0, h = 0;
+    for (int bit = 0; bit < 65; bit++) {
+        bool set = (bit < 64) ? ((b_low >> bit) & 1) : (b_high & 1);
+        if (set) {
+            l ^= (bit < 64) ? (a_low << bit) : 0;
+            h ^= (bit == 0) ? a_high : ((bit < 64) ? ((a_high << bit) | (a_low >> (64 - bit))) : a_low);
+        }
+    }
+    *low = l;
+    *high = h;
+}
+
+/**
+ * @brief Collects the degree width products of the factors, the candidate polynomials
+ *
+ * @param f Factors
+ * @param k Next factor to take or skip
+ * @param degree Degree still to reach
+ * @param low Product so far, low word
+ * @param high Product so far, high word
+ * @param candidate Polynomials found, normal form
+ * @param candidates Number found
+ */
+static void crc_reveng_combine(const crc_reveng_factoring_t *f, size_t k, int degree, uint64_t low, uint64_t high,
+                               uint64_t *candidate, size_t *candidates) {
+    if (degree == 0) {
+        if (*candidates < CRC_REVENG_MAX_CANDIDATES) {
+            candidate[(*candidates)++] = low;
+        }
+        return;
+    }
+    if (k == f->factors || *candidates == CRC_REVENG_MAX_CANDIDATES) {
+        return;
+    }
+    crc_reveng_combine(f, k + 1, degree, low, high, candidate, candidates);
+    const crc_reveng_factor_t *q = &f->factor[k];
+    uint64_t q_low = (q->degree == 64) ? q->bits : (q->bits | (1ull << q->degree));
+    uint64_t q_high = (q->degree == 64) ? 1 : 0;
+    for (int m = 1; m <= q->multiplicity && m * q->degree <= degree; m++) {
+        crc_reveng_multiply(low, high, q_low, q_high, &low, &high);
+        crc_reveng_combine(f, k + 1, degree - m * q->degree, low, high, candidate, candidates);
+    }
+}
+
+/* ---- a search ---- */
+
+static uint64_t crc_reveng_frame_crc(const crc_reveng_frame_t *frame, unsigned int bytes, bool big_endian) {
+    const uint8_t *p = frame->data + frame->length - bytes;
+    uint64_t crc = 0;
+
+    for (unsigned int i = 0; i < bytes; i++) {
+        crc |= (uint64_t)p[big_endian ? bytes - 1 - i : i] << (8 * i);
+    }
+    return crc;
+}
+
+/**
+ * @brief Sets g to (M1 + M2) x^w + f^-1(c1 + c2) of two frames of one length
+ */
+static void crc_reveng_pair(const crc_reveng_variant_t *v, const crc_reveng_frame_t *a, const crc_reveng_frame_t *b,
+                            crc_reveng_poly_t *g) {
+    unsigned int bytes = v->width / 8;
+    size_t n = a->length - bytes;
+    uint64_t c = crc_reveng_frame_crc(a, bytes, v->big_endian) ^ crc_reveng_frame_crc(b, bytes, v->big_endian);
+
+    crc_reveng_poly_zero(g);
+    if (v->output_inversion) {
+        c = crc_reveng_reverse(c, v->width);
+    }
+    /* the first message bit is the highest power */
+    for (size_t k = 0; k < n; k++) {
+        uint8_t d = a->data[k] ^ b->data[k];
+        if (d == 0) {
+            continue;
+        }
+        if (v->input_inversion) {
+            d = (uint8_t)crc_reveng_reverse(d, 8);
+        }
+        for (int bit = 7; bit >= 0; bit--) {
+            if ((d >> bit) & 1) {
+                size_t power = 8 * (n - 1 - k) + (size_t)bit + v->width;
+                g->word[power / 64] ^= 1ull << (power % 64);
+            }
+        }
+    }
+    g->word[0] ^= c & crc_reveng_mask(v->width);
+    crc_reveng_poly_normalize(g, (int)(8 * n + v->width));
+}
+
+/* One equation of the initial and xor value bits: columns 0..w-1 the xor value, w..2w-1 the initial value */
+typedef struct {
+    uint64_t x;
+    uint64_t i;
+    bool rhs;
+} crc_reveng_row_t;
+
+static bool crc_reveng_row_get(const crc_reveng_row_t *row, unsigned int width, unsigned int column) {
+    return (column < width) ? ((row->x >> column) & 1) : ((row->i >> (column - width)) & 1);
+}
+
+/**
+ * @brief Adds an equation to the echelon basis, pivots on the xor value first
+ *
+ * @return false It contradicts the basis
+ */
+static bool crc_reveng_row_insert(crc_reveng_row_t *basis, bool *pivot, unsigned int width, crc_reveng_row_t row) {
+    for (unsigned int column = 0; column < 2 * width; column++) {
+        if (!crc_reveng_row_get(&row, width, column)) {
+            continue;
+        }
+        if (!pivot[column]) {
+            basis[column] = row;
+            pivot[column] = true;
+            return true;
+        }
+        row.x ^= basis[column].x;
+        row.i ^= basis[column].i;
+        row.rhs ^= basis[column].rhs;
+    }
+    return !row.rhs;
+}
+
+static void crc_reveng_result_add(crc_reveng_variant_t *v, const crc_reveng_result_t *result) {
+    crc_reveng_result_t *results = (crc_reveng_result_t *)realloc(v->results, (v->count + 1) * sizeof(crc_reveng_result_t));
+    if (results == NULL) {
+        v->error = ENOMEM;
+        return;
+    }
+    v->results = results;
+    v->results[v->count++] = *result;
+}
+
+/* inputs a libcrc model is compared on: its check string, a single byte and a longer pattern */
+static const size_t crc_reveng_vector_length[3] = {9, 1, 40};
+
+static void crc_reveng_vectors(uint8_t vector[3][40]) {
+    memset(vector, 0, 3 * 40);
+    memcpy(vector[0], "123456789", 9);
+    vector[1][0] = 0xA5;
+    for (size_t i = 0; i < 40; i++) {
+        vector[2][i] = (uint8_t)(i * 37 + 11);
+    }
+}
+
+static int crc_reveng_library_models(unsigned int width) {
+    switch (width)
+    {
+    case 8: return CRC8_NONE_MODEL;
+    case 16: return CRC16_NONE_MODEL;
+    case 32: return CRC32_NONE_MODEL;
+    case 64: return CRC64_NONE_MODEL;
+    default: return 0;
+    }
+}
+
+/**
+ * @brief Runs a libcrc model
+ *
+ * @return bool false when the model isn't compiled in
+ */
+static bool crc_reveng_library_crc(unsigned int width, int model, uint8_t *input_data, size_t length, uint64_t *crc) {
+    switch (width)
+    {
+    case 8:
+        if (!CRC8_MODEL_ENABLED(model)) {
+            return false;
+        }
+        *crc = crc8_calculate((CRC8_reference_model_e)model, input_data, length);
+        return true;
+    case 16:
+        if (!CRC16_MODEL_ENABLED(model)) {
+            return false;
+        }
+        *crc = crc16_calculate((CRC16_reference_model_e)model, input_data, length);
+        return true;
+    case 32:
+        if (!CRC32_MODEL_ENABLED(model)) {
+            return false;
+        }
+        *crc = crc32_calculate((CRC32_reference_model_e)model, input_data, length);
+        return true;
+    default:
+        if (!CRC64_MODEL_ENABLED(model)) {
+            return false;
+        }
+        *crc = crc64_calculate((CRC64_reference_model_e)model, input_data, length);
+        return true;
+    }
+}
+
+/* the initial and result xor values of a libcrc model, as the catalogues give them */
+static void crc_reveng_library_param(unsigned int width, int model, uint64_t *initial_value, uint64_t *result_xor_value) {
+    uint8_t init8, x8;
+    uint16_t init16, x16;
+    uint32_t init32, x32;
+
+    switch (width)
+    {
+    case 8:
+        crc8_param_get((CRC8_reference_model_e)model, &init8, &x8);
+        *initial_value = init8;
+        *result_xor_value = x8;
+        break;
+    case 16:
+        crc16_param_get((CRC16_reference_model_e)model, &init16, &x16);
+        *initial_value = init16;
+        *result_xor_value = x16;
+        break;
+    case 32:
+        crc32_param_get((CRC32_reference_model_e)model, &init32, &x32);
+        *initial_value = init32;
+        *result_xor_value = x32;
+        break;
+    default:
+        crc64_param_get((CRC64_reference_model_e)model, initial_value, result_xor_value);
+        break;
+    }
+}
+
+/* the libcrc model of a width computing the same as the parameters on a few inputs, -1 for none */
+static int crc_reveng_library_model(const crc_reveng_result_t *result) {
+    uint8_t vector[3][40];
+    int models = crc_reveng_library_models(result->width);
+
+    crc_reveng_vectors(vector);
+    for (int m = 0; m < models; m++) {
+        bool same = true;
+        for (int k = 0; same && k < 3; k++) {
+            uint64_t crc;
+            same = crc_reveng_library_crc(result->width, m, vector[k], crc_reveng_vector_length[k], &crc) &&
+                   crc == crc_reveng_calculate(result, vector[k], crc_reveng_vector_length[k]);
+        }
+        if (same) {
+            return m;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Adds the w equations of a message and its CRC under a candidate polynomial:
+ *        c + f(M x^w mod P) = f(I x^8n mod P) + X
+ *
+ * @return bool false when they contradict the basis
+ */
+static bool crc_reveng_equations(const crc_reveng_variant_t *v, uint64_t polynomial, crc_reveng_row_t *basis,
+                                 bool *pivot, const uint8_t *input_data, size_t length, uint64_t crc) {
+    unsigned int width = v->width;
+    uint64_t mask = crc_reveng_mask(width), top = 1ull << (width - 1);
+    uint64_t column_i[64];
+    uint64_t known, z = 1;
+
+    known = crc_reveng_register(width, polynomial, v->input_inversion, 0, input_data, length);
+    if (v->output_inversion) {
+        known = crc_reveng_reverse(known, width);
+    }
+    known ^= crc;
+
+    /* initial value bit i ends up as x^(i + 8n) mod P */
+    for (size_t b = 0; b < 8 * length; b++) {
+        z = (z & top) ? (((z << 1) & mask) ^ polynomial) : (z << 1);
+    }
+    for (unsigned int i = 0; i < width; i++) {
+        column_i[i] = v->output_inversion ? crc_reveng_reverse(z, width) : z;
+        z = (z & top) ? (((z << 1) & mask) ^ polynomial) : (z << 1);
+    }
+    for (unsigned int j = 0; j < width; j++) {
+        crc_reveng_row_t row = {1ull << j, 0, (known >> j) & 1};
+        for (unsigned int i = 0; i < width; i++) {
+            row.i |= ((column_i[i] >> j) & 1) << i;
+        }
+        if (!crc_reveng_row_insert(basis, pivot, width, row)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* a solution of the basis, the free initial value bits set to fill */
+static void crc_reveng_back_substitute(const crc_reveng_row_t *basis, const bool *pivot, unsigned int width,
+                                       bool fill, uint64_t *initial_value, uint64_t *result_xor_value) {
+    uint64_t x = 0, init = 0;
+
+    for (int column = (int)(2 * width) - 1; column >= 0; column--) {
+        bool value;
+        if (pivot[column]) {
+            const crc_reveng_row_t *row = &basis[column];
+            value = row->rhs ^ (__builtin_popcountll(row->x & x) & 1) ^ (__builtin_popcountll(row->i & init) & 1);
+        } else {
+            value = (column >= (int)width) && fill;
+        }
+        if (value) {
+            if (column < (int)width) {
+                x |= 1ull << column;
+            } else {
+                init |= 1ull << (column - width);
+            }
+        }
+    }
+    *initial_value = init;
+    *result_xor_value = x;
+}
+
+/**
+ * @brief Keeps a parameter set if it reproduces every frame
+ *
+ * @return bool Kept
+ */
+static bool crc_reveng_emit(crc_reveng_search_t *s, crc_reveng_variant_t *v, uint64_t polynomial,
+                            uint64_t initial_value, uint64_t result_xor_value, unsigned int free_bits) {
+    unsigned int bytes = v->width / 8;
+    crc_reveng_result_t result = {v->width, polynomial, initial_value, result_xor_value, v->input_inversion,
+                                  v->output_inversion, v->big_endian, free_bits, 0, -1};
+
+    for (size_t k = 0; k < s->count; k++) {
+        const crc_reveng_frame_t *frame = &s->frames[k];
+        if (frame->length > bytes && crc_reveng_calculate(&result, frame->data, frame->length - bytes) !=
+                                     crc_reveng_frame_crc(frame, bytes, v->big_endian)) {
+            return false;
+        }
+    }
+    result.check = crc_reveng_calculate(&result, (const uint8_t *)"123456789", 9);
+    result.library_model = crc_reveng_library_model(&result);
+    crc_reveng_result_add(v, &result);
+    return true;
+}
+
+/**
+ * @brief Solves the initial and xor values of a candidate polynomial from one frame per length,
+ *        then checks them on every frame. Bits the frames leave open are settled by a libcrc model
+ *        agreeing with the frames when there is one, reported with that model's own values, else
+ *        reported both ways. Some stay open
+ *        whatever the frames: a factor (x + 1)^k of P divides every x^8n - x^8m, so k initial
+ *        value bits move the register the same at every length and the xor value makes up for them.
+ */
+static void crc_reveng_solve(crc_reveng_search_t *s, crc_reveng_variant_t *v, uint64_t polynomial) {
+    unsigned int width = v->width, bytes = width / 8;
+    crc_reveng_row_t basis[128], pinned[128];
+    bool pivot[128] = {false}, pinned_pivot[128];
+    uint64_t init, x;
+    size_t previous = 0;
+
+    for (size_t k = 0; k < s->count; k++) {
+        const crc_reveng_frame_t *frame = &s->frames[s->order[k]];
+        if (frame->length <= bytes || (k > 0 && frame->length == previous)) {
+            continue;
+        }
+        previous = frame->length;
+        if (!crc_reveng_equations(v, polynomial, basis, pivot, frame->data, frame->length - bytes,
+                                  crc_reveng_frame_crc(frame, bytes, v->big_endian))) {
+            return;
+        }
+    }
+
+    unsigned int free_bits = 0;
+    for (unsigned int column = width; column < 2 * width; column++) {
+        free_bits += !pivot[column];
+    }
+    if (free_bits == 0) {
+        crc_reveng_back_substitute(basis, pivot, width, false, &init, &x);
+        crc_reveng_emit(s, v, polynomial, init, x, 0);
+        return;
+    }
+
+    /* a libcrc model among the solutions: its CRCs of the comparison inputs pin the rest down */
+    bool library = false;
+    int models = crc_reveng_library_models(width);
+    uint8_t vector[3][40];
+    crc_reveng_vectors(vector);
+    for (int m = 0; m < models && v->error == 0; m++) {
+        bool consistent = true;
+        memcpy(pinned, basis, sizeof(basis));
+        memcpy(pinned_pivot, pivot, sizeof(pivot));
+        for (int k = 0; consistent && k < 3; k++) {
+            uint64_t crc;
+            consistent = crc_reveng_library_crc(width, m, vector[k], crc_reveng_vector_length[k], &crc) &&
+                         crc_reveng_equations(v, polynomial, pinned, pinned_pivot, vector[k],
+                                              crc_reveng_vector_length[k], crc);
+        }
+        if (consistent) {
+            /* the model computes the same as the pinned solution, but its catalogue values are the ones people know */
+            crc_reveng_library_param(width, m, &init, &x);
+            if (crc_reveng_emit(s, v, polynomial, init, x, free_bits)) {
+                library = true;
+                continue;
+            }
+            crc_reveng_back_substitute(pinned, pinned_pivot, width, false, &init, &x);
+            library |= crc_reveng_emit(s, v, polynomial, init, x, free_bits);
+        }
+    }
+    /* otherwise the open bits all 0, then all 1 */
+    for (int fill = 0; !library && fill < 2 && v->error == 0; fill++) {
+        crc_reveng_back_substitute(basis, pivot, width, fill, &init, &x);
+        crc_reveng_emit(s, v, polynomial, init, x, free_bits);
+    }
+}
+
+/**
+ * @brief Runs one search: the gcd of the pair polynomials, its factors, the candidates they make
+ */
+static void crc_reveng_variant_run(crc_reveng_search_t *s, crc_reveng_variant_t *v) {
+    unsigned int bytes = v->width / 8;
+    crc_reveng_factoring_t f = {0};
+    crc_reveng_poly_t g, pair;
+    uint64_t *candidate = NULL;
+    size_t candidates = 0;
+    size_t longest = 0;
+
+    for (size_t k = 0; k < s->count; k++) {
+        if (s->frames[k].length > longest) {
+            longest = s->frames[k].length;
+        }
+    }
+    /* room for the square of a pair polynomial */
+    f.words = (2 * (8 * longest + 64) + 64) / 64 + 2;
+    f.random = 0x9E3779B97F4A7C15ull ^ ((uint64_t)v->width << 8) ^ (v->big_endian << 2) ^
+               (v->input_inversion << 1) ^ v->output_inversion;
+    if (!crc_reveng_poly_alloc(&g, f.words) || !crc_reveng_poly_alloc(&pair, f.words)) {
+        v->error = ENOMEM;
+        goto done;
+    }
+
+    /* frames of one length pair up with the first of them */
+    for (size_t k = 0; k < s->count;) {
+        const crc_reveng_frame_t *first = &s->frames[s->order[k]];
+        size_t end = k + 1;
+        while (end < s->count && s->frames[s->order[end]].length == first->length) {
+            end++;
+        }
+        for (size_t j = k + 1; first->length > bytes && j < end; j++) {
+            crc_reveng_pair(v, first, &s->frames[s->order[j]], &pair);
+            if (pair.degree < 0) {
+                continue;
+            }
+            if (g.degree < 0) {
+                crc_reveng_poly_copy(&g, &pair);
+            } else {
+                crc_reveng_poly_gcd(&g, &pair);
+            }
+            if (g.degree < (int)v->width) {
+                goto done;
+            }
+        }
+        k = end;
+    }
+    if (g.degree < (int)v->width) {
+        goto done;
+    }
+
+    /* P has a constant term, so the factors x go */
+    int shift = 0;
+    while (((g.word[shift / 64] >> (shift % 64)) & 1) == 0) {
+        shift++;
+    }
+    if (shift > 0) {
+        crc_reveng_poly_copy(&pair, &g);
+        crc_reveng_poly_zero(&g);
+        for (int bit = shift; bit <= pair.degree; bit++) {
+            if ((pair.word[bit / 64] >> (bit % 64)) & 1) {
+                g.word[(bit - shift) / 64] |= 1ull << ((bit - shift) % 64);
+            }
+        }
+        g.degree = pair.degree - shift;
+    }
+
+    candidate = (uint64_t *)malloc(CRC_REVENG_MAX_CANDIDATES * sizeof(uint64_t));
+    if (candidate == NULL) {
+        v->error = ENOMEM;
+        goto done;
+    }
+    if (g.degree == (int)v->width) {
+        candidate[candidates++] = g.word[0];
+    } else if (g.degree > (int)v->width) {
+        crc_reveng_factor(&f, &g, (int)v->width);
+        if (f.error != 0) {
+            v->error = f.error;
+            goto done;
+        }
+        crc_reveng_combine(&f, 0, (int)v->width, 1, 0, candidate, &candidates);
+    }
+    for (size_t c = 0; c < candidates && v->error == 0; c++) {
+        crc_reveng_solve(s, v, candidate[c] & crc_reveng_mask(v->width));
+    }
+
+done:
+    free(candidate);
+    free(f.factor);
+    crc_reveng_poly_free(&g);
+    crc_reveng_poly_free(&pair);
+}
+
+static void *crc_reveng_worker(void *argument) {
+    crc_reveng_search_t *s = (crc_reveng_search_t *)argument;
+    size_t v;
+
+    while ((v = __atomic_fetch_add(&s->next, 1, __ATOMIC_RELAXED)) < s->variants) {
+        crc_reveng_variant_run(s, &s->variant[v]);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Fills a configuration with every width, both byte orders and a thread per CPU
+ *
+ * @param config Configuration
+ */
+void crc_reveng_config_default(crc_reveng_config_t *config) {
+    /* parameter checkout */
+    assert(config != NULL);
+
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    memset(config, 0, sizeof(*config));
+    config->width = 0;
+    config->endian = CRC_REVENG_ANY_ENDIAN;
+    config->threads = (cpus > 0) ? (unsigned int)cpus : 1;
+}
+
+/**
+ * @brief Finds every CRC parameter set reproducing all the frames. The polynomial needs two frames
+ *        of one length, differing; three or more of one length leave chance matches out, and
+ *        frames of a second length pin the initial value down.
+ *
+ * @param config Widths, byte orders and threads
+ * @param frames Samples, each message followed by its CRC
+ * @param count Number of samples
+ * @param results Parameter sets found, by width, byte order and reflection
+ * @param capacity Room in results
+ * @param found Parameter sets found, more than capacity when some didn't fit
+ * @return int 0, EINVAL without two different frames of one length, ENOMEM, or a pthread_create error
+ */
+int crc_reveng_search(const crc_reveng_config_t *config, const crc_reveng_frame_t *frames, size_t count,
+                      crc_reveng_result_t *results, size_t capacity, size_t *found) {
+    /* parameter checkout */
+    assert(config != NULL);
+    assert(frames != NULL || count == 0);
+    assert(results != NULL || capacity == 0);
+    assert(found != NULL);
+
+    crc_reveng_search_t s = {frames, count, NULL, NULL, 0, 0};
+    pthread_t thread[64];
+    unsigned int threads = 0;
+    bool paired = false;
+    int error = 0;
+
+    *found = 0;
+    if (config->width % 8 != 0 || config->width > 64) {
+        return EINVAL;
+    }
+    s.order = (size_t *)malloc((count ? count : 1) * sizeof(size_t));
+    s.variant = (crc_reveng_variant_t *)calloc(8 * 2 * 4, sizeof(crc_reveng_variant_t));
+    if (s.order == NULL || s.variant == NULL) {
+        error = ENOMEM;
+        goto done;
+    }
+    /* frame indexes by length, a handful of samples: insertion sort */
+    for (size_t k = 0; k < count; k++) {
+        size_t j = k;
+        for (; j > 0 && frames[s.order[j - 1]].length > frames[k].length; j--) {
+            s.order[j] = s.order[j - 1];
+        }
+        s.order[j] = k;
+    }
+    for (size_t k = 1; k < count && !paired; k++) {
+        const crc_reveng_frame_t *a = &frames[s.order[k - 1]], *b = &frames[s.order[k]];
+        paired = a->length == b->length && memcmp(a->data, b->data, a->length) != 0;
+    }
+    if (!paired) {
+        error = EINVAL;
+        goto done;
+    }
+
+    for (unsigned int width = 8; width <= 64; width += 8) {
+        if (config->width != 0 && width != config->width) {
+            continue;
+        }
+        for (int endian = 0; endian < 2; endian++) {
+            /* one byte has no order */
+            if ((width == 8) ? (endian != 0) :
+                (config->endian != CRC_REVENG_ANY_ENDIAN && endian != (int)config->endian)) {
+                continue;
+            }
+            for (int reflection = 0; reflection < 4; reflection++) {
+                crc_reveng_variant_t *v = &s.variant[s.variants++];
+                v->width = width;
+                v->big_endian = endian;
+                v->input_inversion = reflection & 1;
+                v->output_inversion = (reflection >> 1) & 1;
+            }
+        }
+    }
+
+    threads = config->threads ? config->threads : 1;
+    if (threads > s.variants) {
+        threads = (unsigned int)s.variants;
+    }
+    if (threads > sizeof(thread) / sizeof(thread[0])) {
+        threads = sizeof(thread) / sizeof(thread[0]);
+    }
+    for (unsigned int t = 1; t < threads; t++) {
+        error = pthread_create(&thread[t], NULL, crc_reveng_worker, &s);
+        if (error != 0) {
+            threads = t;
+            break;
+        }
+    }
+    crc_reveng_worker(&s);
+    for (unsigned int t = 1; t < threads; t++) {
+        pthread_join(thread[t], NULL);
+    }
+
+    for (size_t v = 0; v < s.variants; v++) {
+        if (s.variant[v].error != 0 && error == 0) {
+            error = s.variant[v].error;
+        }
+        for (size_t r = 0; r < s.variant[v].count; r++) {
+            if (*found < capacity) {
+                results[*found] = s.variant[v].results[r];
+            }
+            (*found)++;
+        }
+        free(s.variant[v].results);
+    }
+
+done:
+    free(s.order);
+    free(s.variant);
+    return error;
+}
+
+#ifndef CHECKSUM_NO_MAIN
+#define TEST
+#endif
+#ifdef TEST
+#include <stdio.h>
+
+#define TEST_FRAMES 5
+#define TEST_MESSAGE 24
+
+/* frames of lengths TEST_MESSAGE (three of them) and TEST_MESSAGE + 9 (two), CRC appended */
+static void test_frames(const crc_reveng_result_t *model, uint8_t data[TEST_FRAMES][TEST_MESSAGE + 17],
+                        crc_reveng_frame_t *frames, uint32_t seed) {
+    unsigned int bytes = model->width / 8;
+
+    for (int k = 0; k < TEST_FRAMES; k++) {
+        size_t n = (k < 3) ? TEST_MESSAGE : TEST_MESSAGE + 9;
+        for (size_t i = 0; i < n; i++) {
+            seed = seed * 1103515245u + 12345u;
+            data[k][i] = (uint8_t)(seed >> 16);
+        }
+        uint64_t crc = crc_reveng_calculate(model, data[k], n);
+        for (unsigned int i = 0; i < bytes; i++) {
+            data[k][n + (model->big_endian ? bytes - 1 - i : i)] = (uint8_t)(crc >> (8 * i));
+        }
+        frames[k].data = data[k];
+        frames[k].length = n + bytes;
+    }
+}
+
+/* whether the results hold the model */
+static bool test_found(const crc_reveng_result_t *results, size_t found, const crc_reveng_result_t *model) {
+    for (size_t r = 0; r < found; r++) {
+        if (results[r].width == model->width && results[r].polynomial == model->polynomial &&
+            results[r].initial_value == model->initial_value && results[r].result_xor_value == model->result_xor_value &&
+            results[r].input_inversion == model->input_inversion && results[r].output_inversion == model->output_inversion &&
+            results[r].big_endian == model->big_endian) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int main() {
+    static uint8_t data[TEST_FRAMES][TEST_MESSAGE + 17];
+    crc_reveng_frame_t frames[TEST_FRAMES];
+    crc_reveng_result_t results[64];
+    crc_reveng_config_t config;
+    size_t found;
+    bool succeed = true;
+
+    crc_reveng_config_default(&config);
+
+#if 1
+    printf("---------crc reveng library models-----------\n");
+    /* libcrc packages store the CRC low byte first */
+    static const int models[4] = {CRC8_NONE_MODEL, CRC16_NONE_MODEL, CRC32_NONE_MODEL, CRC64_NONE_MODEL};
+    for (int w = 0; w < 4; w++) {
+        unsigned int width = 8u << w, bytes = width / 8;
+        config.width = width;
+        config.endian = CRC_REVENG_LITTLE_ENDIAN;
+        for (int m = 0; m < models[w]; m++) {
+            uint32_t seed = (uint32_t)(w * 31 + m);
+            for (int k = 0; k < TEST_FRAMES; k++) {
+                size_t n = ((k < 3) ? TEST_MESSAGE : TEST_MESSAGE + 9) + bytes;
+                for (size_t i = 0; i < n; i++) {
+                    seed = seed * 1103515245u + 12345u;
+                    data[k][i] = (uint8_t)(seed >> 16);
+                }
+                switch (w)
+                {
+                case 0: crc8_calculate_package((CRC8_reference_model_e)m, data[k], n); break;
+                case 1: crc16_calculate_package((CRC16_reference_model_e)m, data[k], n); break;
+                case 2: crc32_calculate_package((CRC32_reference_model_e)m, data[k], n); break;
+                default: crc64_calculate_package((CRC64_reference_model_e)m, data[k], n); break;
+                }
+                frames[k].data = data[k];
+                frames[k].length = n;
+            }
+            /* found with the model's own initial and xor values, whatever bits the frames leave open */
+            bool model_found = false;
+            uint64_t init, x;
+            crc_reveng_library_param(width, m, &init, &x);
+            succeed &= crc_reveng_search(&config, frames, TEST_FRAMES, results, 64, &found) == 0;
+            for (size_t r = 0; r < found && r < 64; r++) {
+                model_found |= results[r].library_model == m && results[r].initial_value == init &&
+                               results[r].result_xor_value == x;
+            }
+            succeed &= model_found && found == 1;
+            printf("crc%u model %d: %zu found, poly 0x%llx init 0x%llx xorout 0x%llx\n", width, m, found,
+                   found ? (unsigned long long)results[0].polynomial : 0ull,
+                   found ? (unsigned long long)results[0].initial_value : 0ull,
+                   found ? (unsigned long long)results[0].result_xor_value : 0ull);
+        }
+    }
+    printf("crc reveng library model check %s.\n", succeed ? "succeed" : "fail");
+#endif
+
+#if 1
+    printf("---------crc reveng catalogue models-----------\n");
+    /* widths and reflections libcrc lacks, any width, any byte order */
+    static const struct {
+        const char *name;
+        crc_reveng_result_t model;
+        uint64_t check;
+    } catalogue[] = {
+        {"CRC-16/RIELLO", {16, 0x1021, 0xB2AA, 0x0000, true, true, false, 0, 0, -1}, 0x63D0},
+        {"CRC-24/OPENPGP", {24, 0x864CFB, 0xB704CE, 0x000000, false, false, true, 0, 0, -1}, 0x21CF02},
+        {"CRC-32/BZIP2", {32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, false, false, true, 0, 0, -1}, 0xFC891918},
+        {"CRC-40/GSM", {40, 0x0004820009, 0, 0xFFFFFFFFFF, false, false, true, 0, 0, -1}, 0xD4164FC646},
+        {"CRC-64/WE", {64, 0x42F0E1EBA9EA3693, ~0ull, ~0ull, false, false, false, 0, 0, -1}, 0x62EC59E3F1A4F00A},
+    };
+    crc_reveng_config_default(&config);
+    for (size_t c = 0; c < sizeof(catalogue) / sizeof(catalogue[0]); c++) {
+        bool check = crc_reveng_calculate(&catalogue[c].model, (const uint8_t *)"123456789", 9) == catalogue[c].check;
+        test_frames(&catalogue[c].model, data, frames, (uint32_t)c + 100);
+        int error = crc_reveng_search(&config, frames, TEST_FRAMES, results, 64, &found);
+        bool model_found = error == 0 && test_found(results, found < 64 ? found : 64, &catalogue[c].model);
+        succeed &= check && model_found;
+        printf("%-15s check %s, %s among %zu\n", catalogue[c].name, check ? "ok" : "wrong",
+               model_found ? "found" : "missing", found);
+    }
+
+    /* one frame length: the initial value stays open, the xor value following it */
+    config.width = 24;
+    config.endian = CRC_REVENG_BIG_ENDIAN;
+    test_frames(&catalogue[1].model, data, frames, 7);
+    succeed &= crc_reveng_search(&config, frames, 3, results, 64, &found) == 0 && found == 2 &&
+               results[0].free_bits == 24 && results[0].initial_value == 0 && results[1].initial_value == 0xFFFFFF;
+
+    /* nothing to pair: all lengths differ */
+    frames[1] = frames[3];
+    succeed &= crc_reveng_search(&config, frames, 2, results, 64, &found) == EINVAL;
+    printf("crc reveng catalogue check %s.\n", succeed ? "succeed" : "fail");
+#endif
+
+#if 1
+    printf("---------crc reveng long frames-----------\n");
+    /* two 1500 byte frames differing from their first byte: the pair polynomial is long and the
+       polynomial has to be factored out of it */
+    static uint8_t large[2][1500 + 4];
+    crc_reveng_result_t model = {32, 0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF, true, true, false, 0, 0, -1};
+    for (int k = 0; k < 2; k++) {
+        for (size_t i = 0; i < 1500; i++) {
+            large[k][i] = (uint8_t)(i * 13 + k * 101 + (i >> 7));
+        }
+        uint32_t crc = (uint32_t)crc_reveng_calculate(&model, large[k], 1500);
+        memcpy(&large[k][1500], &crc, 4);
+        frames[k].data = large[k];
+        frames[k].length = 1504;
+    }
+    crc_reveng_config_default(&config);
+    config.width = 32;
+    int error = crc_reveng_search(&config, frames, 2, results, 64, &found);
+    bool model_found = false;
+    for (size_t r = 0; r < found && r < 64; r++) {
+        model_found |= results[r].polynomial == model.polynomial && results[r].input_inversion &&
+                       results[r].output_inversion && results[r].free_bits == 32;
+    }
+    succeed &= error == 0 && model_found;
+    printf("crc reveng long frames check %s.\n", succeed ? "succeed" : "fail");
+#endif
+    return 0;
+}
+#endif
@@ -0,0 +1,56 @@
+#ifndef __CRC_REVENG_H__
+#define __CRC_REVENG_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Byte order of the CRC in the last bytes of the sample frames */
+typedef enum {
+    CRC_REVENG_LITTLE_ENDIAN = 0,   /* low byte first, as crcN_calculate_package stores it */
+    CRC_REVENG_BIG_ENDIAN,          /* high byte first */
+    CRC_REVENG_ANY_ENDIAN,          /* both tried */
+} crc_reveng_endian_e;
+
+typedef struct {
+    unsigned int width;             /* CRC bits, a multiple of 8 up to 64, 0 tries them all */
+    crc_reveng_endian_e endian;     /* byte order of the CRC in the frames */
+    unsigned int threads;           /* threads the searches are spread over, one per CPU by default */
+} crc_reveng_config_t;
+
+/* A sample: the message followed by its CRC */
+typedef struct {
+    const uint8_t *data;
+    size_t length;                  /* message and CRC bytes */
+} crc_reveng_frame_t;
+
+/* Parameters reproducing every sample, in the notation of the CRC catalogues */
+typedef struct {
+    unsigned int width;             /* CRC bits */
+    uint64_t polynomial;            /* normal form, x^width left out */
+    uint64_t initial_value;         /* register before the message, unreflected */
+    uint64_t result_xor_value;      /* xored onto the register after output inversion */
+    bool input_inversion;           /* bytes enter least significant bit first */
+    bool output_inversion;          /* register reflected before the xor */
+    bool big_endian;                /* CRC stored high byte first in the frames */
+    unsigned int free_bits;         /* initial value bits the samples leave open, 0 when they pin it
+                                       down; otherwise they were taken from the libcrc model, or set
+                                       to 0 in one result, 1 in another */
+    uint64_t check;                 /* CRC of "123456789" */
+    int library_model;              /* CRCn_reference_model_e of libcrc computing the same, -1 for none */
+} crc_reveng_result_t;
+
+void crc_reveng_config_default(crc_reveng_config_t *config);
+int crc_reveng_search(const crc_reveng_config_t *config, const crc_reveng_frame_t *frames, size_t count,
+                      crc_reveng_result_t *results, size_t capacity, size_t *found);
+uint64_t crc_reveng_calculate(const crc_reveng_result_t *model, const uint8_t *input_data, size_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CRC_REVENG_H__ */
@@ -0,0 +1,1074 @@
+/**
+ * @file file_checksum.c
+ * @brief Checksums many files at once: an io_uring read pipeline, or a thread pool where io_uring is unavailable
+ * @copyright Copyright (c) 2023
+ */
+#define _GNU_SOURCE
+#include "file_checksum.h"
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define FILE_CHECKSUM_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#endif
+#endif
+
+#define FILE_CHECKSUM_BLOCK_SIZE (128 * 1024)
+#define FILE_CHECKSUM_QUEUE_DEPTH 64
+#define FILE_CHECKSUM_FILE_DEPTH 8
+#define FILE_CHECKSUM_THREADS 4
+#define FILE_CHECKSUM_PIPELINE_BLOCK_SIZE (1024 * 1024)
+#define FILE_CHECKSUM_PIPELINE_BUFFERS 4
+/* O_DIRECT buffer, offset and length alignment, the logical block size of common devices */
+#define FILE_CHECKSUM_DIRECT_ALIGN 4096
+/* bytes read between two POSIX_FADV_DONTNEED of the direct mode */
+#define FILE_CHECKSUM_DONTNEED_WINDOW (8 * 1024 * 1024)
+
+/**
+ * @brief Fills a configuration with the defaults: 128 KiB reads, 64 in flight, 8 per file, 4 fallback threads,
+ *        4 rotating 1 MiB buffers for a pipelined single file
+ *
+ * @param config Configuration to fill
+ */
+void file_checksum_config_default(file_checksum_config_t *config) {
+    /* parameter checkout */
+    assert(config != NULL);
+
+    config->block_size = FILE_CHECKSUM_BLOCK_SIZE;
+    config->queue_depth = FILE_CHECKSUM_QUEUE_DEPTH;
+    config->file_depth = FILE_CHECKSUM_FILE_DEPTH;
+    config->threads = FILE_CHECKSUM_THREADS;
+    config->force_thread_pool = false;
+    config->pipeline_block_size = FILE_CHECKSUM_PIPELINE_BLOCK_SIZE;
+    config->pipeline_buffers = FILE_CHECKSUM_PIPELINE_BUFFERS;
+    config->direct = false;
+}
+
+/**
+ * @brief Describes one file to checksum
+ *
+ * @param job Job to fill
+ * @param path File path, must stay valid until file_checksum_run returns
+ * @param algorithm Checksum algorithm
+ * @param model CRCn_reference_model_e of the CRC algorithms, ignored for MD5
+ */
+void file_checksum_job_init(file_checksum_job_t *job, const char *path, file_checksum_algorithm_e algorithm, int model) {
+    /* parameter checkout */
+    assert(job != NULL);
+    assert(path != NULL);
+    assert(algorithm < FILE_CHECKSUM_NONE);
+
+    memset(job, 0, sizeof(*job));
+    job->path = path;
+    job->algorithm = algorithm;
+    job->model = model;
+}
+
+static void file_checksum_start(file_checksum_job_t *job) {
+    job->error = 0;
+    job->size = 0;
+    switch (job->algorithm) {
+    case FILE_CHECKSUM_MD5:
+        md5_init(&job->ctx.md5);
+        break;
+    case FILE_CHECKSUM_CRC8:
+        crc8_init(&job->ctx.crc8, (CRC8_reference_model_e)job->model);
+        break;
+    case FILE_CHECKSUM_CRC16:
+        crc16_init(&job->ctx.crc16, (CRC16_reference_model_e)job->model);
+        break;
+    case FILE_CHECKSUM_CRC32:
+        crc32_init(&job->ctx.crc32, (CRC32_reference_model_e)job->model);
+        break;
+    case FILE_CHECKSUM_CRC64:
+        crc64_init(&job->ctx.crc64, (CRC64_reference_model_e)job->model);
+        break;
+    default:
+        break;
+    }
+}
+
+static void file_checksum_feed(file_checksum_job_t *job, uint8_t *data, size_t length) {
+    switch (job->algorithm) {
+    case FILE_CHECKSUM_MD5:
+        md5_update(&job->ctx.md5, data, length);
+        break;
+    case FILE_CHECKSUM_CRC8:
+        crc8_update(&job->ctx.crc8, data, length);
+        break;
+    case FILE_CHECKSUM_CRC16:
+        crc16_update(&job->ctx.crc16, data, length);
+        break;
+    case FILE_CHECKSUM_CRC32:
+        crc32_update(&job->ctx.crc32, data, length);
+        break;
+    case FILE_CHECKSUM_CRC64:
+        crc64_update(&job->ctx.crc64, data, length);
+        break;
+    default:
+        break;
+    }
+    job->size += length;
+}
+
+static void file_checksum_finish(file_checksum_job_t *job) {
+    switch (job->algorithm) {
+    case FILE_CHECKSUM_MD5:
+        md5_final(&job->ctx.md5);
+        memcpy(job->digest, job->ctx.md5.digest, sizeof(job->digest));
+        break;
+    case FILE_CHECKSUM_CRC8:
+        job->crc = crc8_final(&job->ctx.crc8);
+        break;
+    case FILE_CHECKSUM_CRC16:
+        job->crc = crc16_final(&job->ctx.crc16);
+        break;
+    case FILE_CHECKSUM_CRC32:
+        job->crc = crc32_final(&job->ctx.crc32);
+        break;
+    case FILE_CHECKSUM_CRC64:
+        job->crc = crc64_final(&job->ctx.crc64);
+        break;
+    default:
+        break;
+    }
+}
+
+/* Direct mode: O_DIRECT where the file system takes it, POSIX_FADV_DONTNEED behind the reads either way */
+static size_t file_checksum_direct_size(size_t size) {
+    return (size + FILE_CHECKSUM_DIRECT_ALIGN - 1) / FILE_CHECKSUM_DIRECT_ALIGN * FILE_CHECKSUM_DIRECT_ALIGN;
+}
+
+/* Opens a file for reading, with O_DIRECT in direct mode unless the file system refuses it */
+static int file_checksum_open(const char *path, bool direct) {
+    int fd = -1;
+
+#ifdef O_DIRECT
+    if (direct) {
+        fd = open(path, O_RDONLY | O_CLOEXEC | O_DIRECT);
+        if (fd >= 0 || errno != EINVAL) {
+            return fd;
+        }
+    }
+#endif
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+#ifdef POSIX_FADV_SEQUENTIAL
+    if (fd >= 0 && !direct) {
+        posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+#endif
+    return fd;
+}
+
+/* read(), restarted on EINTR. An O_DIRECT read the file system rejects (unaligned tail offset,
+   no direct I/O support behind the open) is retried as a plain read. */
+static ssize_t file_checksum_read(int fd, uint8_t *buffer, size_t length) {
+    ssize_t bytes;
+
+    for (;;) {
+        bytes = read(fd, buffer, length);
+        if (bytes >= 0) {
+            return bytes;
+        }
+        if (errno == EINTR) {
+            continue;
+        }
+#ifdef O_DIRECT
+        if (errno == EINVAL) {
+            int flags = fcntl(fd, F_GETFL);
+            if (flags >= 0 && (flags & O_DIRECT) && fcntl(fd, F_SETFL, flags & ~O_DIRECT) == 0) {
+                continue;
+            }
+            errno = EINVAL;
+        }
+#endif
+        return -1;
+    }
+}
+
+/* Drops the cached pages of [*dropped, offset) once a window is read, or all of them at the end */
+static void file_checksum_dontneed(int fd, uint64_t *dropped, uint64_t offset, bool end) {
+#ifdef POSIX_FADV_DONTNEED
+    if (offset > *dropped && (end || offset - *dropped >= FILE_CHECKSUM_DONTNEED_WINDOW)) {
+        posix_fadvise(fd, (off_t)*dropped, (off_t)(offset - *dropped), POSIX_FADV_DONTNEED);
+        *dropped = offset;
+    }
+#else
+    (void)fd;
+    (void)dropped;
+    (void)offset;
+    (void)end;
+#endif
+}
+
+/* Thread pool backend: every worker takes the next file and reads it start to end */
+typedef struct {
+    file_checksum_job_t *job;
+    size_t count;
+    size_t next;                /* next job to hand out */
+    size_t block_size;
+    bool direct;
+    pthread_mutex_t lock;
+} file_checksum_pool_t;
+
+/* Reads an open file to its end and closes it, the job is started already */
+static void file_checksum_read_fd(file_checksum_job_t *job, int fd, uint8_t *buffer, size_t block_size, bool direct) {
+    uint64_t dropped = 0;
+    ssize_t bytes;
+
+    for (;;) {
+        bytes = file_checksum_read(fd, buffer, block_size);
+        if (bytes < 0) {
+            job->error = errno;
+            break;
+        }
+        if (bytes == 0) {
+            break;
+        }
+        file_checksum_feed(job, buffer, (size_t)bytes);
+        if (direct) {
+            file_checksum_dontneed(fd, &dropped, job->size, false);
+        }
+    }
+    if (direct) {
+        file_checksum_dontneed(fd, &dropped, job->size, true);
+    }
+    close(fd);
+
+    if (job->error == 0) {
+        file_checksum_finish(job);
+    }
+}
+
+static void file_checksum_read_file(file_checksum_job_t *job, uint8_t *buffer, size_t block_size, bool direct) {
+    int fd;
+
+    file_checksum_start(job);
+    fd = file_checksum_open(job->path, direct);
+    if (fd < 0) {
+        job->error = errno;
+        return;
+    }
+    file_checksum_read_fd(job, fd, buffer, block_size, direct);
+}
+
+static void *file_checksum_worker(void *arg) {
+    file_checksum_pool_t *pool = (file_checksum_pool_t *)arg;
+    uint8_t *buffer = NULL;
+    size_t i;
+
+    /* O_DIRECT reads go straight into the buffer, so it is aligned like the file offsets */
+    if (posix_memalign((void **)&buffer, FILE_CHECKSUM_DIRECT_ALIGN, pool->block_size) != 0) {
+        buffer = NULL;
+    }
+
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        i = pool->next++;
+        pthread_mutex_unlock(&pool->lock);
+        if (i >= pool->count) {
+            break;
+        }
+        if (buffer == NULL) {
+            pool->job[i].error = ENOMEM;
+            continue;
+        }
+        file_checksum_read_file(&pool->job[i], buffer, pool->block_size, pool->direct);
+    }
+
+    free(buffer);
+    return NULL;
+}
+
+static int file_checksum_thread_pool_run(file_checksum_job_t *job, size_t count, const file_checksum_config_t *config) {
+    file_checksum_pool_t pool = {job, count, 0, config->block_size, config->direct, PTHREAD_MUTEX_INITIALIZER};
+    size_t threads = (config->threads < count) ? config->threads : count;
+    pthread_t *thread = (pthread_t *)malloc((threads > 0 ? threads : 1) * sizeof(pthread_t));
+    size_t started = 0;
+
+    while (thread != NULL && started < threads && pthread_create(&thread[started], NULL, file_checksum_worker, &pool) == 0) {
+        started++;
+    }
+    /* no thread could be started, do the work on the caller's */
+    if (started == 0) {
+        file_checksum_worker(&pool);
+    }
+    for (size_t i = 0; i < started; i++) {
+        pthread_join(thread[i], NULL);
+    }
+
+    free(thread);
+    pthread_mutex_destroy(&pool.lock);
+    return FILE_CHECKSUM_BACKEND_THREAD_POOL;
+}
+
+/* Pipelined single file: an I/O thread fills rotating buffers while the caller hashes */
+typedef struct {
+    int fd;
+    size_t block_size;
+    bool direct;
+    unsigned int buffers;
+    uint8_t *buffer;            /* buffers * block_size bytes */
+    size_t *length;             /* bytes read into each buffer */
+    unsigned int filled;        /* buffers read and not hashed yet */
+    int error;                  /* errno of the I/O thread */
+    bool stop;                  /* the hashing side is done */
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+} file_checksum_pipeline_t;
+
+static void *file_checksum_pipeline_reader(void *arg) {
+    file_checksum_pipeline_t *pipeline = (file_checksum_pipeline_t *)arg;
+    unsigned int index = 0;
+    uint64_t offset = 0, dropped = 0;
+    size_t length;
+    ssize_t bytes;
+    int error;
+
+    for (;;) {
+        pthread_mutex_lock(&pipeline->lock);
+        while (pipeline->filled == pipeline->buffers && !pipeline->stop) {
+            pthread_cond_wait(&pipeline->cond, &pipeline->lock);
+        }
+        if (pipeline->stop) {
+            pthread_mutex_unlock(&pipeline->lock);
+            break;
+        }
+        pthread_mutex_unlock(&pipeline->lock);
+
+        /* fill the whole buffer, only the last one of the file is short */
+        uint8_t *buffer = pipeline->buffer + (size_t)index * pipeline->block_size;
+        length = 0;
+        error = 0;
+        while (length < pipeline->block_size) {
+            bytes = file_checksum_read(pipeline->fd, buffer + length, pipeline->block_size - length);
+            if (bytes < 0) {
+                error = errno;
+                break;
+            }
+            if (bytes == 0) {
+                break;
+            }
+            length += (size_t)bytes;
+        }
+        offset += length;
+        if (pipeline->direct) {
+            /* the pages only go once read, the hashing side works from the buffer */
+            file_checksum_dontneed(pipeline->fd, &dropped, offset, error != 0 || length < pipeline->block_size);
+        }
+
+        pthread_mutex_lock(&pipeline->lock);
+        pipeline->length[index] = length;
+        if (error != 0) {
+            pipeline->error = error;
+        }
+        pipeline->filled++;
+        pthread_cond_broadcast(&pipeline->cond);
+        pthread_mutex_unlock(&pipeline->lock);
+
+        if (error != 0 || length < pipeline->block_size) {
+            break;
+        }
+        index = (index + 1) % pipeline->buffers;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Checksums one large file with reading and hashing overlapped: a dedicated I/O
+ *        thread reads ahead into pipeline_buffers rotating page aligned buffers while the
+ *        calling thread hashes the filled ones in order, so the wall time approaches the
+ *        larger of the I/O and hashing times rather than their sum. In direct mode the
+ *        reads bypass or are dropped from the page cache, see file_checksum_run.
+ *
+ * @param job File to checksum, the result is stored back into it
+ * @param config Configuration, NULL for the defaults
+ * @return int 0, or the errno that stopped the file (also left in job->error)
+ */
+int file_checksum_pipelined(file_checksum_job_t *job, const file_checksum_config_t *config) {
+    file_checksum_config_t defaults;
+    file_checksum_pipeline_t pipeline;
+    pthread_t reader;
+    unsigned int index = 0;
+    size_t length;
+
+    /* parameter checkout */
+    assert(job != NULL);
+    if (config == NULL) {
+        file_checksum_config_default(&defaults);
+        config = &defaults;
+    }
+    assert(config->pipeline_block_size > 0 && config->pipeline_buffers >= 2);
+
+    memset(&pipeline, 0, sizeof(pipeline));
+    pipeline.block_size = config->direct ? file_checksum_direct_size(config->pipeline_block_size) : config->pipeline_block_size;
+    pipeline.direct = config->direct;
+    pipeline.buffers = config->pipeline_buffers;
+    pipeline.length = (size_t *)calloc(pipeline.buffers, sizeof(size_t));
+    if (pipeline.length == NULL ||
+        posix_memalign((void **)&pipeline.buffer, FILE_CHECKSUM_DIRECT_ALIGN, (size_t)pipeline.buffers * pipeline.block_size) != 0) {
+        free(pipeline.length);
+        file_checksum_start(job);
+        job->error = ENOMEM;
+        return job->error;
+    }
+
+    file_checksum_start(job);
+    pipeline.fd = file_checksum_open(job->path, pipeline.direct);
+    if (pipeline.fd < 0) {
+        job->error = errno;
+        goto exit;
+    }
+    pthread_mutex_init(&pipeline.lock, NULL);
+    pthread_cond_init(&pipeline.cond, NULL);
+
+    if (pthread_create(&reader, NULL, file_checksum_pipeline_reader, &pipeline) != 0) {
+        /* no I/O thread, read and hash in turn */
+        close(pipeline.fd);
+        file_checksum_read_file(job, pipeline.buffer, pipeline.block_size, pipeline.direct);
+        goto destroy;
+    }
+
+    for (;;) {
+        pthread_mutex_lock(&pipeline.lock);
+        while (pipeline.filled == 0) {
+            pthread_cond_wait(&pipeline.cond, &pipeline.lock);
+        }
+        length = pipeline.length[index];
+        job->error = pipeline.error;
+        pthread_mutex_unlock(&pipeline.lock);
+        if (job->error != 0) {
+            break;
+        }
+
+        file_checksum_feed(job, pipeline.buffer + (size_t)index * pipeline.block_size, length);
+
+        pthread_mutex_lock(&pipeline.lock);
+        pipeline.filled--;
+        pthread_cond_broadcast(&pipeline.cond);
+        pthread_mutex_unlock(&pipeline.lock);
+        if (length < pipeline.block_size) {
+            break;
+        }
+        index = (index + 1) % pipeline.buffers;
+    }
+
+    pthread_mutex_lock(&pipeline.lock);
+    pipeline.stop = true;
+    pthread_cond_broadcast(&pipeline.cond);
+    pthread_mutex_unlock(&pipeline.lock);
+    pthread_join(reader, NULL);
+    close(pipeline.fd);
+    if (job->error == 0) {
+        file_checksum_finish(job);
+    }
+
+destroy:
+    pthread_cond_destroy(&pipeline.cond);
+    pthread_mutex_destroy(&pipeline.lock);
+exit:
+    free(pipeline.buffer);
+    free(pipeline.length);
+    return job->error;
+}
+
+#ifdef FILE_CHECKSUM_IO_URING
+/* io_uring driven through the raw system calls, there is no liburing dependency */
+typedef struct {
+    int fd;
+    unsigned int entries;
+    unsigned int *sq_head, *sq_tail, *sq_mask, *sq_array;
+    unsigned int *cq_head, *cq_tail, *cq_mask;
+    struct io_uring_sqe *sqes;
+    struct io_uring_cqe *cqes;
+    void *sq_ring, *cq_ring;
+    size_t sq_ring_size, cq_ring_size, sqes_size;
+    unsigned int pending;       /* SQEs queued but not submitted yet */
+    unsigned int inflight;      /* SQEs submitted but not completed yet */
+} file_checksum_ring_t;
+
+/* One read buffer and the file block it holds */
+typedef struct {
+    unsigned int file;          /* active file slot */
+    uint64_t offset;            /* file offset of the block */
+    uint32_t length;            /* bytes wanted */
+    uint32_t done;              /* bytes read so far, short reads are continued */
+    int result;                 /* 0, or the negative errno of the read */
+    bool complete;
+} file_checksum_block_t;
+
+/* A file being read: its blocks are hashed in file order as they complete */
+typedef struct {
+    size_t job;
+    int fd;
+    uint64_t size;              /* file size at open */
+    uint64_t submit_offset;     /* next offset to read */
+    unsigned int inflight;      /* blocks read or waiting to be hashed */
+    unsigned int fifo_head;     /* oldest block, the next one to hash */
+    unsigned int *fifo;         /* block indexes in file order */
+    bool used;
+} file_checksum_file_t;
+
+static int file_checksum_ring_init(file_checksum_ring_t *ring, unsigned int entries) {
+    struct io_uring_params params;
+    int fd;
+
+    memset(ring, 0, sizeof(*ring));
+    memset(&params, 0, sizeof(params));
+    fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+    if (fd < 0) {
+        return -errno;
+    }
+    ring->fd = fd;
+    ring->entries = params.sq_entries;
+
+    ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+    ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        if (ring->cq_ring_size > ring->sq_ring_size) {
+            ring->sq_ring_size = ring->cq_ring_size;
+        }
+        ring->cq_ring_size = ring->sq_ring_size;
+    }
+    ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+    if (ring->sq_ring == MAP_FAILED) {
+        close(fd);
+        return -errno;
+    }
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        ring->cq_ring = ring->sq_ring;
+    } else {
+        ring->cq_ring = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+        if (ring->cq_ring == MAP_FAILED) {
+            munmap(ring->sq_ring, ring->sq_ring_size);
+            close(fd);
+            return -errno;
+        }
+    }
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = (struct io_uring_sqe *)mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED) {
+        if (ring->cq_ring != ring->sq_ring) {
+            munmap(ring->cq_ring, ring->cq_ring_size);
+        }
+        munmap(ring->sq_ring, ring->sq_ring_size);
+        close(fd);
+        return -errno;
+    }
+
+    ring->sq_head = (unsigned int *)((uint8_t *)ring->sq_ring + params.sq_off.head);
+    ring->sq_tail = (unsigned int *)((uint8_t *)ring->sq_ring + params.sq_off.tail);
+    ring->sq_mask = (unsigned int *)((uint8_t *)ring->sq_ring + params.sq_off.ring_mask);
+    ring->sq_array = (unsigned int *)((uint8_t *)ring->sq_ring + params.sq_off.array);
+    ring->cq_head = (unsigned int *)((uint8_t *)ring->cq_ring + params.cq_off.head);
+    ring->cq_tail = (unsigned int *)((uint8_t *)ring->cq_ring + params.cq_off.tail);
+    ring->cq_mask = (unsigned int *)((uint8_t *)ring->cq_ring + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *)((uint8_t *)ring->cq_ring + params.cq_off.cqes);
+    return 0;
+}
+
+static void file_checksum_ring_exit(file_checksum_ring_t *ring) {
+    munmap(ring->sqes, ring->sqes_size);
+    if (ring->cq_ring != ring->sq_ring) {
+        munmap(ring->cq_ring, ring->cq_ring_size);
+    }
+    munmap(ring->sq_ring, ring->sq_ring_size);
+    close(ring->fd);
+}
+
+/* Queues a read of the rest of a block, at most one SQE per block is ever queued */
+static void file_checksum_ring_read(file_checksum_ring_t *ring, file_checksum_file_t *file, file_checksum_block_t *block,
+                                    unsigned int index, uint8_t *buffer, bool fixed) {
+    unsigned int tail = *ring->sq_tail;
+    unsigned int slot = tail & *ring->sq_mask;
+    struct io_uring_sqe *sqe = &ring->sqes[slot];
+
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = fixed ? IORING_OP_READ_FIXED : IORING_OP_READ;
+    sqe->fd = file->fd;
+    sqe->off = block->offset + block->done;
+    sqe->addr = (uint64_t)(uintptr_t)(buffer + block->done);
+    sqe->len = block->length - block->done;
+    sqe->buf_index = fixed ? (uint16_t)index : 0;
+    sqe->user_data = index;
+    ring->sq_array[slot] = slot;
+    __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    ring->pending++;
+}
+
+static int file_checksum_ring_enter(file_checksum_ring_t *ring, unsigned int wait) {
+    long submitted;
+
+    do {
+        submitted = syscall(__NR_io_uring_enter, ring->fd, ring->pending, wait, wait ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+    } while (submitted < 0 && errno == EINTR);
+    if (submitted < 0) {
+        return -errno;
+    }
+    ring->pending -= (unsigned int)submitted;
+    ring->inflight += (unsigned int)submitted;
+    return 0;
+}
+
+/* Reaps the completions of every submitted read, so that none still targets the buffers */
+static int file_checksum_ring_quiesce(file_checksum_ring_t *ring) {
+    while (ring->inflight > 0) {
+        unsigned int head = *ring->cq_head;
+        unsigned int tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+
+        if (head != tail) {
+            ring->inflight -= tail - head;
+            __atomic_store_n(ring->cq_head, tail, __ATOMIC_RELEASE);
+            continue;
+        }
+        if (syscall(__NR_io_uring_enter, ring->fd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0) < 0 && errno != EINTR) {
+            return -errno;
+        }
+    }
+    return 0;
+}
+
+/* Hashes the file's completed blocks that are next in file order, retires the file when it is done */
+static void file_checksum_drain(file_checksum_job_t *jobs, file_checksum_file_t *file, file_checksum_block_t *blocks,
+                                uint8_t *buffers, size_t block_size, unsigned int file_depth,
+                                unsigned int *free_block, unsigned int *free_count, unsigned int *active) {
+    file_checksum_job_t *job = &jobs[file->job];
+
+    while (file->inflight > 0) {
+        unsigned int index = file->fifo[file->fifo_head];
+        file_checksum_block_t *block = &blocks[index];
+
+        if (!block->complete) {
+            break;
+        }
+        if (job->error == 0) {
+            file_checksum_feed(job, buffers + (size_t)index * block_size, block->length);
+        }
+        free_block[(*free_count)++] = index;
+        file->fifo_head = (file->fifo_head + 1) % file_depth;
+        file->inflight--;
+    }
+
+    if (file->inflight == 0 && (job->error != 0 || file->submit_offset >= file->size)) {
+        if (job->error == 0) {
+            file_checksum_finish(job);
+        }
+        close(file->fd);
+        file->used = false;
+        (*active)--;
+    }
+}
+
+static int file_checksum_io_uring_run(file_checksum_job_t *jobs, size_t count, const file_checksum_config_t *config) {
+    const unsigned int depth = config->queue_depth;
+    const unsigned int file_depth = config->file_depth;
+    const size_t block_size = config->block_size;
+    file_checksum_ring_t ring;
+    file_checksum_block_t *blocks = NULL;
+    file_checksum_file_t *files = NULL;
+    unsigned int *fifo = NULL, *free_block = NULL;
+    struct iovec *iov = NULL;
+    uint8_t *buffers = NULL, *stream = NULL;
+    unsigned int free_count = depth, active = 0, rr = 0;
+    size_t next_job = 0;
+    bool fixed;
+    int ret;
+
+    ret = file_checksum_ring_init(&ring, depth);
+    if (ret < 0) {
+        return ret;
+    }
+    blocks = (file_checksum_block_t *)calloc(depth, sizeof(*blocks));
+    files = (file_checksum_file_t *)calloc(depth, sizeof(*files));
+    fifo = (unsigned int *)calloc((size_t)depth * file_depth, sizeof(*fifo));
+    free_block = (unsigned int *)calloc(depth, sizeof(*free_block));
+    iov = (struct iovec *)calloc(depth, sizeof(*iov));
+    stream = (uint8_t *)malloc(block_size);
+    if (blocks == NULL || files == NULL || fifo == NULL || free_block == NULL || iov == NULL || stream == NULL ||
+        posix_memalign((void **)&buffers, 4096, (size_t)depth * block_size) != 0) {
+        ret = -ENOMEM;
+        buffers = NULL;
+        goto exit;
+    }
+
+    /* registered buffers save the kernel pinning pages per read, plain reads do if RLIMIT_MEMLOCK says no */
+    for (unsigned int i = 0; i < depth; i++) {
+        iov[i].iov_base = buffers + (size_t)i * block_size;
+        iov[i].iov_len = block_size;
+        free_block[i] = depth - 1 - i;
+        files[i].fifo = fifo + (size_t)i * file_depth;
+    }
+    fixed = syscall(__NR_io_uring_register, ring.fd, IORING_REGISTER_BUFFERS, iov, depth) == 0;
+
+    for (;;) {
+        /* open files while there are free file slots, a slot per buffer keeps small files flowing */
+        while (active < depth && next_job < count) {
+            file_checksum_job_t *job = &jobs[next_job];
+            file_checksum_file_t *file = files;
+            struct stat st;
+            int fd;
+
+            file_checksum_start(job);
+            fd = open(job->path, O_RDONLY | O_CLOEXEC);
+            if (fd < 0 || fstat(fd, &st) != 0) {
+                job->error = errno;
+                if (fd >= 0) {
+                    close(fd);
+                }
+                next_job++;
+                continue;
+            }
+            /* pipes, devices and /proc files have no size to split into blocks, they are read to their end */
+            if (!S_ISREG(st.st_mode) || st.st_size == 0) {
+                file_checksum_read_fd(job, fd, stream, block_size, false);
+                next_job++;
+                continue;
+            }
+#ifdef POSIX_FADV_SEQUENTIAL
+            posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+            while (file->used) {
+                file++;
+            }
+            file->job = next_job++;
+            file->fd = fd;
+            file->size = (uint64_t)st.st_size;
+            file->submit_offset = 0;
+            file->inflight = 0;
+            file->fifo_head = 0;
+            file->used = true;
+            active++;
+        }
+
+        /* hand the free buffers out round robin, at most file_depth reads per file */
+        for (unsigned int n = 0; n < depth && free_count > 0; n++) {
+            file_checksum_file_t *file = &files[(rr + n) % depth];
+
+            while (file->used && jobs[file->job].error == 0 && file->inflight < file_depth &&
+                   file->submit_offset < file->size && free_count > 0) {
+                unsigned int index = free_block[--free_count];
+                file_checksum_block_t *block = &blocks[index];
+                uint64_t rest = file->size - file->submit_offset;
+
+                block->file = (unsigned int)(file - files);
+                block->offset = file->submit_offset;
+                block->length = (uint32_t)((rest < block_size) ? rest : block_size);
+                block->done = 0;
+                block->result = 0;
+                block->complete = false;
+                file->fifo[(file->fifo_head + file->inflight) % file_depth] = index;
+                file->inflight++;
+                file->submit_offset += block->length;
+                file_checksum_ring_read(&ring, file, block, index, buffers + (size_t)index * block_size, fixed);
+            }
+        }
+        rr++;
+
+        if (active == 0 && next_job >= count) {
+            break;
+        }
+
+        ret = file_checksum_ring_enter(&ring, free_count < depth ? 1 : 0);
+        if (ret < 0) {
+            /* the ring is unusable, the caller starts every job over on the thread pool;
+               the submitted reads complete before their files and buffers go */
+            if (file_checksum_ring_quiesce(&ring) != 0) {
+                buffers = NULL;     /* a read may still land in them, leaked rather than reused */
+            }
+            file_checksum_ring_exit(&ring);
+            for (unsigned int i = 0; i < depth; i++) {
+                if (files[i].used) {
+                    close(files[i].fd);
+                }
+            }
+            goto release;
+        }
+
+        unsigned int head = *ring.cq_head;
+        unsigned int tail = __atomic_load_n(ring.cq_tail, __ATOMIC_ACQUIRE);
+        ring.inflight -= tail - head;
+        for (; head != tail; head++) {
+            struct io_uring_cqe *cqe = &ring.cqes[head & *ring.cq_mask];
+            unsigned int index = (unsigned int)cqe->user_data;
+            file_checksum_block_t *block = &blocks[index];
+            file_checksum_file_t *file = &files[block->file];
+
+            if (cqe->res == -EAGAIN || cqe->res == -EINTR) {
+                file_checksum_ring_read(&ring, file, block, index, buffers + (size_t)index * block_size, fixed);
+                continue;
+            }
+            if (cqe->res > 0) {
+                block->done += (uint32_t)cqe->res;
+                if (block->done < block->length) {
+                    file_checksum_ring_read(&ring, file, block, index, buffers + (size_t)index * block_size, fixed);
+                    continue;
+                }
+            } else {
+                /* a read error, or end of file before the size fstat reported: the file shrank */
+                block->result = (cqe->res < 0) ? cqe->res : -EIO;
+                if (jobs[file->job].error == 0) {
+                    jobs[file->job].error = -block->result;
+                }
+            }
+            block->complete = true;
+            file_checksum_drain(jobs, file, blocks, buffers, block_size, file_depth, free_block, &free_count, &active);
+        }
+        __atomic_store_n(ring.cq_head, head, __ATOMIC_RELEASE);
+    }
+
+exit:
+    file_checksum_ring_exit(&ring);
+release:
+    free(stream);
+    free(buffers);
+    free(iov);
+    free(free_block);
+    free(fifo);
+    free(files);
+    free(blocks);
+    return ret;
+}
+#endif
+
+/**
+ * @brief Checksums the files of the jobs. With io_uring a single thread keeps up to
+ *        queue_depth reads in flight across files and feeds each file's blocks to its
+ *        streaming context in file order; pipes, devices and files that report no size,
+ *        like those of /proc, are read to their end in between. Without it (non-Linux,
+ *        old kernels, seccomp) or if the ring fails part way, a thread pool reads one
+ *        file per worker.
+ *        In direct mode the thread pool does the work, each worker reading O_DIRECT into
+ *        its own aligned buffer so that a bulk verification leaves the page cache to the
+ *        other workloads; where O_DIRECT is refused the read pages are dropped with
+ *        POSIX_FADV_DONTNEED every FILE_CHECKSUM_DONTNEED_WINDOW bytes instead.
+ *
+ * @param job Files to checksum, results are stored back into them
+ * @param count Number of jobs
+ * @param config Configuration, NULL for the defaults
+ * @return int The file_checksum_backend_e that did the work
+ */
+int file_checksum_run(file_checksum_job_t *job, size_t count, const file_checksum_config_t *config) {
+    file_checksum_config_t defaults;
+
+    /* parameter checkout */
+    assert(job != NULL || count == 0);
+    if (config == NULL) {
+        file_checksum_config_default(&defaults);
+        config = &defaults;
+    }
+    assert(config->block_size > 0 && config->block_size <= UINT32_MAX);
+    assert(config->queue_depth > 0 && config->file_depth > 0);
+
+#ifdef FILE_CHECKSUM_IO_URING
+    if (!config->force_thread_pool && !config->direct && file_checksum_io_uring_run(job, count, config) == 0) {
+        return FILE_CHECKSUM_BACKEND_IO_URING;
+    }
+#endif
+    if (config->direct && config->block_size % FILE_CHECKSUM_DIRECT_ALIGN != 0) {
+        file_checksum_config_t aligned = *config;
+        aligned.block_size = file_checksum_direct_size(config->block_size);
+        return file_checksum_thread_pool_run(job, count, &aligned);
+    }
+    return file_checksum_thread_pool_run(job, count, config);
+}
+
+#ifndef CHECKSUM_NO_MAIN
+#define TEST
+#endif
+#ifdef TEST
+#include <stdio.h>
+
+/* sizes of the checked files, around the block size and the 4 KiB page */
+static const size_t TEST_FILE_SIZE[] = {0, 1, 4095, 4096, 131071, 131072, 131073, 1000003, 8 * 1024 * 1024 + 5};
+#define TEST_FILES (sizeof(TEST_FILE_SIZE) / sizeof(TEST_FILE_SIZE[0]))
+#define TEST_DATA_BYTES (8 * 1024 * 1024 + 64)
+
+static void write_test_file(const char *path, size_t size, uint8_t *data) {
+    FILE *file = fopen(path, "wb");
+
+    if (file != NULL) {
+        fwrite(data, 1, size, file);
+        fclose(file);
+    }
+}
+
+/* the expected result, computed in memory */
+static bool check_job(file_checksum_job_t *job, uint8_t *data, size_t size) {
+    md5_ctx md5;
+
+    if (job->error != 0 || job->size != size) {
+        return false;
+    }
+    switch (job->algorithm) {
+    case FILE_CHECKSUM_MD5:
+        md5_init(&md5);
+        md5_update(&md5, data, size);
+        md5_final(&md5);
+        return memcmp(md5.digest, job->digest, 16) == 0;
+    case FILE_CHECKSUM_CRC8:
+        return size == 0 || job->crc == crc8_calculate((CRC8_reference_model_e)job->model, data, size);
+    case FILE_CHECKSUM_CRC16:
+        return size == 0 || job->crc == crc16_calculate((CRC16_reference_model_e)job->model, data, size);
+    case FILE_CHECKSUM_CRC32:
+        return size == 0 || job->crc == crc32_calculate((CRC32_reference_model_e)job->model, data, size);
+    case FILE_CHECKSUM_CRC64:
+        return size == 0 || job->crc == crc64_calculate((CRC64_reference_model_e)job->model, data, size);
+    default:
+        return false;
+    }
+}
+
+int main() {
+    static const char *backend_name[] = {"io_uring", "thread pool"};
+    static uint8_t data[TEST_DATA_BYTES];
+    static char path[TEST_FILES][64];
+    static file_checksum_job_t job[TEST_FILES * FILE_CHECKSUM_NONE + 1];     /* and a missing file */
+    file_checksum_config_t config;
+    int backend;
+
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)((i * 2654435761u) >> 13);
+    }
+
+#if 1
+    printf("---------file checksum-----------\n");
+    /* default configuration, small odd sized queues wrapping around often, thread pool */
+    for (int variant = 0; variant < 3; variant++) {
+        bool succeed = true;
+        size_t n = 0;
+
+        for (size_t i = 0; i < TEST_FILES; i++) {
+            snprintf(path[i], sizeof(path[i]), "/tmp/file_checksum_test_%zu", i);
+            write_test_file(path[i], TEST_FILE_SIZE[i], data + i);
+            for (int algorithm = 0; algorithm < FILE_CHECKSUM_NONE; algorithm++) {
+                file_checksum_job_init(&job[n++], path[i], (file_checksum_algorithm_e)algorithm, (int)(i % 2));
+            }
+        }
+        file_checksum_job_init(&job[n++], "/tmp/file_checksum_test_missing", FILE_CHECKSUM_MD5, 0);
+
+        file_checksum_config_default(&config);
+        if (variant == 1) {
+            config.block_size = 4096;
+            config.queue_depth = 7;
+            config.file_depth = 3;
+        }
+        config.force_thread_pool = (variant == 2);
+        backend = file_checksum_run(job, n, &config);
+        for (size_t i = 0; i + 1 < n; i++) {
+            size_t file = i / FILE_CHECKSUM_NONE;
+            if (!check_job(&job[i], data + file, TEST_FILE_SIZE[file])) {
+                printf("%s size %zu algorithm %d fail.\n", job[i].path, TEST_FILE_SIZE[file], job[i].algorithm);
+                succeed = false;
+            }
+        }
+        if (job[n - 1].error != ENOENT) {
+            succeed = false;
+        }
+        printf("%s block size %zu check %s.\n", backend_name[backend], config.block_size, succeed ? "succeed" : "fail");
+    }
+    for (size_t i = 0; i < TEST_FILES; i++) {
+        remove(path[i]);
+    }
+#endif
+
+#if 1
+    printf("---------file checksum pipelined-----------\n");
+    bool pipelined_succeed = true;
+    snprintf(path[0], sizeof(path[0]), "/tmp/file_checksum_test_pipelined");
+    for (size_t i = 0; i < TEST_FILES; i++) {
+        write_test_file(path[0], TEST_FILE_SIZE[i], data);
+        for (int algorithm = 0; algorithm < FILE_CHECKSUM_NONE; algorithm++) {
+            file_checksum_config_default(&config);
+            /* odd buffer counts and sizes that don't divide the files */
+            config.pipeline_block_size = (algorithm % 2) ? 4096 : 100000;
+            config.pipeline_buffers = 2 + (unsigned int)algorithm;
+            file_checksum_job_init(&job[0], path[0], (file_checksum_algorithm_e)algorithm, 0);
+            if (file_checksum_pipelined(&job[0], &config) != 0 || !check_job(&job[0], data, TEST_FILE_SIZE[i])) {
+                printf("pipelined size %zu algorithm %d fail.\n", TEST_FILE_SIZE[i], algorithm);
+                pipelined_succeed = false;
+            }
+        }
+    }
+    remove(path[0]);
+    file_checksum_job_init(&job[0], "/tmp/file_checksum_test_missing", FILE_CHECKSUM_MD5, 0);
+    if (file_checksum_pipelined(&job[0], NULL) != ENOENT) {
+        pipelined_succeed = false;
+    }
+    printf("pipelined check %s.\n", pipelined_succeed ? "succeed" : "fail");
+#endif
+
+#if 1
+    printf("---------file checksum direct-----------\n");
+    bool direct_succeed = true;
+    snprintf(path[0], sizeof(path[0]), "/tmp/file_checksum_test_direct");
+    for (size_t i = 0; i < TEST_FILES; i++) {
+        write_test_file(path[0], TEST_FILE_SIZE[i], data);
+        for (int algorithm = 0; algorithm < FILE_CHECKSUM_NONE; algorithm++) {
+            file_checksum_config_default(&config);
+            config.direct = true;
+            /* sizes that are no multiple of the O_DIRECT alignment get rounded up */
+            config.block_size = (algorithm % 2) ? 4096 : 100000;
+            config.pipeline_block_size = (algorithm % 2) ? 100000 : 4096;
+            file_checksum_job_init(&job[0], path[0], (file_checksum_algorithm_e)algorithm, 1);
+            file_checksum_job_init(&job[1], path[0], (file_checksum_algorithm_e)algorithm, 1);
+            if (file_checksum_run(&job[0], 1, &config) != FILE_CHECKSUM_BACKEND_THREAD_POOL ||
+                !check_job(&job[0], data, TEST_FILE_SIZE[i]) ||
+                file_checksum_pipelined(&job[1], &config) != 0 || !check_job(&job[1], data, TEST_FILE_SIZE[i])) {
+                printf("direct size %zu algorithm %d fail.\n", TEST_FILE_SIZE[i], algorithm);
+                direct_succeed = false;
+            }
+        }
+    }
+    remove(path[0]);
+    printf("direct check %s.\n", direct_succeed ? "succeed" : "fail");
+#endif
+
+#if 1
+    printf("---------file checksum pipe and proc-----------\n");
+    /* no size to go by: a pipe holding a file's worth of data, and a /proc file fstat calls empty */
+    for (int variant = 0; variant < 2; variant++) {
+        bool succeed = true;
+        uint8_t cmdline[4096];
+        size_t cmdline_size = 0;
+        FILE *file;
+        int fds[2];
+
+        file = fopen("/proc/self/cmdline", "rb");
+        if (file != NULL) {
+            cmdline_size = fread(cmdline, 1, sizeof(cmdline), file);
+            fclose(file);
+        }
+        if (pipe(fds) != 0 || write(fds[1], data, 4097) != 4097) {
+            succeed = false;
+        }
+        close(fds[1]);
+        snprintf(path[0], sizeof(path[0]), "/proc/self/fd/%d", fds[0]);
+        file_checksum_job_init(&job[0], path[0], FILE_CHECKSUM_MD5, 0);
+        file_checksum_job_init(&job[1], "/proc/self/cmdline", FILE_CHECKSUM_MD5, 0);
+        file_checksum_job_init(&job[2], "/proc/self/cmdline", FILE_CHECKSUM_CRC32, 1);
+        file_checksum_config_default(&config);
+        config.force_thread_pool = (variant == 1);
+        backend = file_checksum_run(job, 3, &config);
+        close(fds[0]);
+        if (!check_job(&job[0], data, 4097) || cmdline_size == 0 || cmdline_size == sizeof(cmdline) ||
+            !check_job(&job[1], cmdline, cmdline_size) || !check_job(&job[2], cmdline, cmdline_size)) {
+            succeed = false;
+        }
+        printf("%s pipe and proc check %s.\n", backend_name[backend], succeed ? "succeed" : "fail");
+    }
+#endif
+    return 0;
+}
+#endif
@@ -0,0 +1,70 @@
+#ifndef __FILE_CHECKSUM_H__
+#define __FILE_CHECKSUM_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "../md5/md5.h"
+#include "../crc/crc8/crc8.h"
+#include "../crc/crc16/crc16.h"
+#include "../crc/crc32/crc32.h"
+#include "../crc/crc64/crc64.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    FILE_CHECKSUM_MD5 = 0,
+    FILE_CHECKSUM_CRC8,
+    FILE_CHECKSUM_CRC16,
+    FILE_CHECKSUM_CRC32,
+    FILE_CHECKSUM_CRC64,
+    FILE_CHECKSUM_NONE,
+} file_checksum_algorithm_e;
+
+typedef enum {
+    FILE_CHECKSUM_BACKEND_IO_URING = 0,     /* one thread, many reads in flight across files */
+    FILE_CHECKSUM_BACKEND_THREAD_POOL,      /* blocking reads, one file per worker thread */
+} file_checksum_backend_e;
+
+/* One file to checksum, and its result */
+typedef struct {
+    const char *path;
+    file_checksum_algorithm_e algorithm;
+    int model;                      /* CRCn_reference_model_e of the CRC algorithms */
+    int error;                      /* 0, or the errno that stopped the file */
+    uint64_t size;                  /* bytes hashed */
+    union {
+        md5_ctx md5;
+        crc8_ctx crc8;
+        crc16_ctx crc16;
+        crc32_ctx crc32;
+        crc64_ctx crc64;
+    } ctx;                          /* streaming context, fed the file's blocks in order */
+    uint8_t digest[16];             /* MD5 digest */
+    uint64_t crc;                   /* CRC result */
+} file_checksum_job_t;
+
+typedef struct {
+    size_t block_size;              /* bytes per read */
+    unsigned int queue_depth;       /* reads in flight, one buffer each */
+    unsigned int file_depth;        /* reads in flight per file */
+    unsigned int threads;           /* worker threads of the thread pool backend */
+    bool force_thread_pool;         /* don't try io_uring */
+    size_t pipeline_block_size;     /* bytes per buffer of file_checksum_pipelined */
+    unsigned int pipeline_buffers;  /* rotating buffers of file_checksum_pipelined */
+    bool direct;                    /* keep the files out of the page cache: O_DIRECT reads, or
+                                       POSIX_FADV_DONTNEED behind the reads where O_DIRECT fails */
+} file_checksum_config_t;
+
+void file_checksum_config_default(file_checksum_config_t *config);
+void file_checksum_job_init(file_checksum_job_t *job, const char *path, file_checksum_algorithm_e algorithm, int model);
+int file_checksum_run(file_checksum_job_t *job, size_t count, const file_checksum_config_t *config);
+int file_checksum_pipelined(file_checksum_job_t *job, const file_checksum_config_t *config);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __FILE_CHECKSUM_H__ */
@@ -0,0 +1,284 @@
+/**
+ * @file hex.c
+ * @brief Hex encoding and decoding of digests, 16 bytes at a time with SSE2
+ * @copyright Copyright (c) 2023
+ */
+#include "hex.h"
+#include <assert.h>
+#include <string.h>
+
+/* SSE2 is part of x86-64, no runtime check needed */
+#if defined(__SSE2__) || defined(_M_X64)
+#define HEX_SSE2
+#include <emmintrin.h>
+#endif
+
+static const char HEX_DIGITS[16] = {
+    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
+};
+
+/* value of a hex digit, 0xFF for anything else */
+static uint8_t hex_value(char c) {
+    if (c >= '0' && c <= '9') {
+        return (uint8_t)(c - '0');
+    }
+    if (c >= 'a' && c <= 'f') {
+        return (uint8_t)(c - 'a' + 10);
+    }
+    if (c >= 'A' && c <= 'F') {
+        return (uint8_t)(c - 'A' + 10);
+    }
+    return 0xFF;
+}
+
+#ifdef HEX_SSE2
+/* nibble to its lower case digit: n + '0', plus 'a' - '0' - 10 for the letters */
+static inline __m128i hex_encode_nibbles(__m128i nibbles) {
+    __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)), _mm_set1_epi8('a' - '0' - 10));
+    return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letter);
+}
+
+/* 16 bytes to 32 digits */
+static inline void hex_encode16(const uint8_t *input, char *output) {
+    const __m128i low_nibble = _mm_set1_epi8(0x0F);
+    __m128i bytes = _mm_loadu_si128((const __m128i *)input);
+    __m128i high = _mm_and_si128(_mm_srli_epi16(bytes, 4), low_nibble);
+    __m128i low = _mm_and_si128(bytes, low_nibble);
+
+    /* the high nibble of each byte is written first */
+    _mm_storeu_si128((__m128i *)output, hex_encode_nibbles(_mm_unpacklo_epi8(high, low)));
+    _mm_storeu_si128((__m128i *)(output + 16), hex_encode_nibbles(_mm_unpackhi_epi8(high, low)));
+}
+
+/* 16 digits, either case, to 8 bytes; false when one of them is no hex digit */
+static inline bool hex_decode8(const char *input, uint8_t *output) {
+    __m128i chars = _mm_loadu_si128((const __m128i *)input);
+    /* digits already have bit 5 set, letters get lower case */
+    __m128i lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+    /* signed compares, bytes from 0x80 up are negative and fall out of both ranges */
+    __m128i is_digit = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)),
+                                     _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), chars));
+    __m128i is_letter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                                      _mm_cmpgt_epi8(_mm_set1_epi8('f' + 1), lower));
+    __m128i nibbles = _mm_or_si128(_mm_and_si128(is_digit, _mm_sub_epi8(chars, _mm_set1_epi8('0'))),
+                                   _mm_and_si128(is_letter, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10))));
+
+    if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)) != 0xFFFF) {
+        return false;
+    }
+    /* each 16 bit lane holds the high nibble in its low byte and the low nibble above it */
+    __m128i bytes = _mm_or_si128(_mm_and_si128(_mm_slli_epi16(nibbles, 4), _mm_set1_epi16(0x00F0)),
+                                 _mm_srli_epi16(nibbles, 8));
+    _mm_storel_epi64((__m128i *)output, _mm_packus_epi16(bytes, bytes));
+    return true;
+}
+#endif
+
+/**
+ * @brief Encodes bytes as lower case hex digits, the high nibble of each byte first
+ *
+ * @param input Bytes to encode
+ * @param length Number of bytes
+ * @param output 2 * length digits, not terminated
+ */
+void hex_encode(const uint8_t *input, size_t length, char *output) {
+    /* parameter checkout */
+    assert(input != NULL || length == 0);
+    assert(output != NULL || length == 0);
+
+#ifdef HEX_SSE2
+    while (length >= 16) {
+        hex_encode16(input, output);
+        input += 16;
+        output += 32;
+        length -= 16;
+    }
+#endif
+    for (size_t i = 0; i < length; i++) {
+        output[2 * i] = HEX_DIGITS[input[i] >> 4];
+        output[2 * i + 1] = HEX_DIGITS[input[i] & 0x0F];
+    }
+}
+
+/**
+ * @brief Decodes hex digits of either case
+ *
+ * @param input 2 * length hex digits
+ * @param length Number of bytes to decode
+ * @param output Decoded bytes, undefined on failure
+ * @return true All the digits were hex digits
+ * @return false Some weren't
+ */
+bool hex_decode(const char *input, size_t length, uint8_t *output) {
+    /* parameter checkout */
+    assert(input != NULL || length == 0);
+    assert(output != NULL || length == 0);
+
+#ifdef HEX_SSE2
+    while (length >= 8) {
+        if (!hex_decode8(input, output)) {
+            return false;
+        }
+        input += 16;
+        output += 8;
+        length -= 8;
+    }
+#endif
+    for (size_t i = 0; i < length; i++) {
+        uint8_t high = hex_value(input[2 * i]);
+        uint8_t low = hex_value(input[2 * i + 1]);
+        if ((high | low) == 0xFF) {
+            return false;
+        }
+        output[i] = (uint8_t)((high << 4) | low);
+    }
+    return true;
+}
+
+/**
+ * @brief Compares computed digests against expected hex strings, as read from a manifest.
+ *        The strings are decoded rather than the digests formatted, so either case matches.
+ *
+ * @param digests count digests of digest_size bytes, back to back
+ * @param digest_size Bytes per digest, 16 for MD5, at most 64
+ * @param expected count strings, only the first 2 * digest_size characters are read
+ * @param count Number of digests
+ * @param match NULL, or (count + 63) / 64 words, bit i % 64 of word i / 64 set when digest i matches
+ * @return size_t Number of digests that don't match, a short or malformed string counts as a mismatch
+ */
+size_t hex_digest_compare_batch(const uint8_t *digests, size_t digest_size, const char *const *expected,
+                                size_t count, uint64_t *match) {
+    uint8_t decoded[64];
+    size_t mismatches = 0;
+
+    /* parameter checkout */
+    assert(digests != NULL || count == 0);
+    assert(expected != NULL || count == 0);
+    assert(digest_size > 0 && digest_size <= sizeof(decoded));
+
+    for (size_t i = 0; i < count; i++) {
+        /* hex_decode reads 16 digits at a time, a short string must not be handed to it */
+        bool equal = strnlen(expected[i], 2 * digest_size) == 2 * digest_size &&
+                     hex_decode(expected[i], digest_size, decoded) &&
+                     memcmp(decoded, digests + i * digest_size, digest_size) == 0;
+        if (match != NULL) {
+            if (i % 64 == 0) {
+                match[i / 64] = 0;
+            }
+            match[i / 64] |= (uint64_t)equal << (i % 64);
+        }
+        mismatches += !equal;
+    }
+    return mismatches;
+}
+
+#ifndef CHECKSUM_NO_MAIN
+#define TEST
+#endif
+#ifdef TEST
+#include <stdio.h>
+#include <stdlib.h>
+
+int main() {
+    uint8_t data[100], decoded[100];
+    char text[201], reference[201];
+
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)((i * 2654435761u) >> 11);
+    }
+    data[0] = 0x00;
+    data[1] = 0xFF;
+    data[2] = 0x9A;
+
+#if 1
+    printf("---------hex encode-----------\n");
+    bool encode_succeed = true;
+    for (size_t length = 0; length <= sizeof(data); length++) {
+        for (size_t i = 0; i < length; i++) {
+            sprintf(&reference[2 * i], "%02x", data[i]);
+        }
+        hex_encode(data, length, text);
+        if (memcmp(text, reference, 2 * length) != 0) {
+            printf("hex encode length %zu fail.\n", length);
+            encode_succeed = false;
+        }
+    }
+    printf("hex encode check %s.\n", encode_succeed ? "succeed" : "fail");
+#endif
+
+#if 1
+    printf("---------hex decode-----------\n");
+    bool decode_succeed = true;
+    for (size_t length = 0; length <= sizeof(data); length++) {
+        hex_encode(data, length, text);
+        /* upper case every third digit */
+        for (size_t i = 0; i < 2 * length; i += 3) {
+            if (text[i] >= 'a') {
+                text[i] = (char)(text[i] - 'a' + 'A');
+            }
+        }
+        if (!hex_decode(text, length, decoded) || memcmp(decoded, data, length) != 0) {
+            printf("hex decode length %zu fail.\n", length);
+            decode_succeed = false;
+        }
+        /* any character that is no hex digit at any position is refused */
+        static const char invalid[] = {'/', ':', '@', 'G', '`', 'g', ' ', '\0', (char)0x80, (char)0xB0, (char)0xE1};
+        for (size_t i = 0; i < 2 * length; i++) {
+            char saved = text[i];
+            text[i] = invalid[i % sizeof(invalid)];
+            if (hex_decode(text, length, decoded)) {
+                printf("hex decode length %zu invalid digit at %zu fail.\n", length, i);
+                decode_succeed = false;
+            }
+            text[i] = saved;
+        }
+    }
+    printf("hex decode check %s.\n", decode_succeed ? "succeed" : "fail");
+#endif
+
+#if 1
+    printf("---------hex digest compare batch-----------\n");
+    static uint8_t digests[150][16];
+    static char lines[150][33];
+    static const char *expected[150];
+    uint64_t match[3];
+    bool batch_succeed = true;
+    size_t wrong = 0;
+
+    for (size_t i = 0; i < 150; i++) {
+        for (size_t b = 0; b < 16; b++) {
+            digests[i][b] = (uint8_t)(i * 31 + b * 7);
+        }
+        hex_encode(digests[i], 16, lines[i]);
+        lines[i][32] = '\0';
+        expected[i] = lines[i];
+        /* every seventh line has a wrong digit, every eleventh a malformed one, every thirteenth ends early */
+        if (i % 7 == 3) {
+            lines[i][i % 32] = (lines[i][i % 32] == '0') ? '1' : '0';
+            wrong++;
+        } else if (i % 11 == 5) {
+            lines[i][31 - i % 32] = 'x';
+            wrong++;
+        } else if (i % 13 == 8) {
+            lines[i][i % 32] = '\0';
+            wrong++;
+        }
+    }
+    if (hex_digest_compare_batch(&digests[0][0], 16, expected, 150, match) != wrong) {
+        batch_succeed = false;
+    }
+    for (size_t i = 0; i < 150; i++) {
+        bool equal = (i % 7 != 3) && (i % 11 != 5) && (i % 13 != 8);
+        if ((bool)((match[i / 64] >> (i % 64)) & 1) != equal) {
+            printf("hex digest compare %zu fail.\n", i);
+            batch_succeed = false;
+        }
+    }
+    if ((match[2] >> (150 % 64)) != 0) {
+        batch_succeed = false;
+    }
+    printf("hex digest compare batch check %s.\n", batch_succeed ? "succeed" : "fail");
+#endif
+    return 0;
+}
+#endif
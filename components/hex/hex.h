@@ -0,0 +1,21 @@
+#ifndef __HEX_H__
+#define __HEX_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void hex_encode(const uint8_t *input, size_t length, char *output);
+bool hex_decode(const char *input, size_t length, uint8_t *output);
+size_t hex_digest_compare_batch(const uint8_t *digests, size_t digest_size, const char *const *expected,
+                                size_t count, uint64_t *match);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HEX_H__ */
@@ -0,0 +1,265 @@
+/**
+ * @file hmac_md5.c
+ * @brief HMAC-MD5 (RFC 2104) with cached keyed inner/outer states
+ * @copyright Copyright (c) 2023
+ */
+#define _GNU_SOURCE
+#define __STDC_WANT_LIB_EXT1__ 1
+#include "hmac_md5.h"
+#include <assert.h>
+#include <string.h>
+
+#define HMAC_MD5_BLOCK_SIZE 64
+#define HMAC_MD5_IPAD 0x36
+#define HMAC_MD5_OPAD 0x5C
+
+/* Zeroes a secret in a way the compiler can't drop as a dead store: the C11 Annex K or
+   libc wipe where there is one, byte stores through a volatile pointer otherwise */
+static void hmac_md5_wipe(void *buffer, size_t length) {
+#if defined(__STDC_LIB_EXT1__)
+    memset_s(buffer, length, 0, length);
+#elif (defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 25))) || \
+    defined(__OpenBSD__) || defined(__FreeBSD__)
+    explicit_bzero(buffer, length);
+#else
+    volatile uint8_t *p = (volatile uint8_t *)buffer;
+
+    while (length-- > 0) {
+        *p++ = 0;
+    }
+#endif
+}
+
+/**
+ * @brief Precomputes the inner and outer MD5 states of a key, so each message
+ *        only costs its own blocks plus one outer block
+ *
+ * @param key Key schedule to fill
+ * @param key_data Key bytes, keys longer than one block are hashed first
+ * @param key_length Key length in bytes
+ */
+void hmac_md5_key_init(hmac_md5_key_t *key, uint8_t *key_data, size_t key_length) {
+    /* parameter checkout */
+    assert(key != NULL);
+    assert(key_data != NULL || key_length == 0);
+
+    uint8_t block[HMAC_MD5_BLOCK_SIZE] = {0};
+    md5_ctx ctx;
+
+    if (key_length > HMAC_MD5_BLOCK_SIZE) {
+        md5_init(&ctx);
+        md5_update(&ctx, key_data, key_length);
+        md5_final(&ctx);
+        memcpy(block, ctx.digest, sizeof(ctx.digest));
+    } else if (key_length > 0) {
+        memcpy(block, key_data, key_length);
+    }
+
+    for (size_t i = 0; i < HMAC_MD5_BLOCK_SIZE; i++) {
+        block[i] ^= HMAC_MD5_IPAD;
+    }
+    md5_init(&key->inner);
+    md5_update(&key->inner, block, HMAC_MD5_BLOCK_SIZE);
+
+    for (size_t i = 0; i < HMAC_MD5_BLOCK_SIZE; i++) {
+        block[i] ^= HMAC_MD5_IPAD ^ HMAC_MD5_OPAD;
+    }
+    md5_init(&key->outer);
+    md5_update(&key->outer, block, HMAC_MD5_BLOCK_SIZE);
+
+    /* the key schedule is the secret, don't leave a copy of it on the stack */
+    hmac_md5_wipe(block, sizeof(block));
+    hmac_md5_wipe(&ctx, sizeof(ctx));
+}
+
+/**
+ * @brief Starts a message with a precomputed key
+ *
+ * @param ctx HMAC-MD5 context
+ * @param key Key schedule from hmac_md5_key_init, must outlive the context
+ */
+void hmac_md5_init(hmac_md5_ctx *ctx, const hmac_md5_key_t *key) {
+    /* parameter checkout */
+    assert(ctx != NULL);
+    assert(key != NULL);
+
+    ctx->md5 = key->inner;
+    ctx->key = key;
+}
+
+/**
+ * @brief Adds message bytes
+ *
+ * @param ctx HMAC-MD5 context
+ * @param input_buffer Message bytes
+ * @param input_length Number of message bytes
+ */
+void hmac_md5_update(hmac_md5_ctx *ctx, uint8_t *input_buffer, size_t input_length) {
+    /* parameter checkout */
+    assert(ctx != NULL);
+    assert(input_buffer != NULL || input_length == 0);
+
+    md5_update(&ctx->md5, input_buffer, input_length);
+}
+
+/**
+ * @brief Finishes the message, the MAC is left in ctx->digest
+ *
+ * @param ctx HMAC-MD5 context
+ */
+void hmac_md5_final(hmac_md5_ctx *ctx) {
+    /* parameter checkout */
+    assert(ctx != NULL);
+
+    md5_ctx outer = ctx->key->outer;
+
+    md5_final(&ctx->md5);
+    md5_update(&outer, ctx->md5.digest, sizeof(ctx->md5.digest));
+    md5_final(&outer);
+    memcpy(ctx->digest, outer.digest, sizeof(ctx->digest));
+}
+
+/**
+ * @brief Computes the HMAC-MD5 of one message
+ *
+ * @param key Key schedule from hmac_md5_key_init
+ * @param input_buffer Message bytes
+ * @param input_length Number of message bytes
+ * @param digest The 16 byte MAC
+ */
+void hmac_md5(const hmac_md5_key_t *key, uint8_t *input_buffer, size_t input_length, uint8_t digest[16]) {
+    hmac_md5_ctx ctx;
+
+    hmac_md5_init(&ctx, key);
+    hmac_md5_update(&ctx, input_buffer, input_length);
+    hmac_md5_final(&ctx);
+    memcpy(digest, ctx.digest, sizeof(ctx.digest));
+}
+
+/**
+ * @brief Computes the HMAC-MD5 of many messages under one key, MD5_LANES
+ *        messages at a time through md5_multi_lane. The inner hashes of a
+ *        group run side by side, then their outer blocks do.
+ *
+ * @param key Key schedule from hmac_md5_key_init
+ * @param input_buffer Message pointers
+ * @param input_length Message lengths
+ * @param digest One 16 byte MAC per message
+ * @param count Number of messages
+ */
+void hmac_md5_batch(const hmac_md5_key_t *key, uint8_t *input_buffer[], size_t input_length[],
+                    uint8_t (*digest)[16], size_t count) {
+    /* parameter checkout */
+    assert(key != NULL);
+    assert(count == 0 || (input_buffer != NULL && input_length != NULL && digest != NULL));
+
+    md5_ctx inner[MD5_LANES], outer[MD5_LANES];
+    md5_ctx *lane[MD5_LANES];
+    uint8_t *data[MD5_LANES];
+    size_t length[MD5_LANES];
+    unsigned int l;
+
+    for (size_t n = 0; n < count; n += MD5_LANES) {
+        for (l = 0; l < MD5_LANES; l++) {
+            if (n + l < count) {
+                inner[l] = key->inner;
+                lane[l] = &inner[l];
+                data[l] = input_buffer[n + l];
+                length[l] = input_length[n + l];
+            } else {
+                lane[l] = NULL;
+                data[l] = NULL;
+                length[l] = 0;
+            }
+        }
+        md5_multi_lane(lane, data, length);
+
+        for (l = 0; l < MD5_LANES; l++) {
+            if (lane[l] != NULL) {
+                outer[l] = key->outer;
+                lane[l] = &outer[l];
+                data[l] = inner[l].digest;
+                length[l] = sizeof(inner[l].digest);
+            }
+        }
+        md5_multi_lane(lane, data, length);
+
+        for (l = 0; l < MD5_LANES && n + l < count; l++) {
+            memcpy(digest[n + l], outer[l].digest, sizeof(outer[l].digest));
+        }
+    }
+}
+
+#ifndef CHECKSUM_NO_MAIN
+#define TEST
+#endif
+#ifdef TEST
+#include <stdio.h>
+
+typedef struct {
+    const char *key;
+    size_t key_length;
+    const char *data;
+    size_t data_length;
+    uint8_t digest[16];
+} hmac_md5_vector_t;
+
+int main() {
+    hmac_md5_key_t key;
+    uint8_t digest[16];
+
+#if 1
+    printf("---------HMAC-MD5 RFC 2202-----------\n");
+    static uint8_t key3[16], data3[50], key6[80];
+    memset(key3, 0xAA, sizeof(key3));
+    memset(data3, 0xDD, sizeof(data3));
+    memset(key6, 0xAA, sizeof(key6));
+    hmac_md5_vector_t vector[] = {
+        {"\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b\x0b", 16, "Hi There", 8,
+         {0x92, 0x94, 0x72, 0x7a, 0x36, 0x38, 0xbb, 0x1c, 0x13, 0xf4, 0x8e, 0xf8, 0x15, 0x8b, 0xfc, 0x9d}},
+        {"Jefe", 4, "what do ya want for nothing?", 28,
+         {0x75, 0x0c, 0x78, 0x3e, 0x6a, 0xb0, 0xb5, 0x03, 0xea, 0xa8, 0x6e, 0x31, 0x0a, 0x5d, 0xb7, 0x38}},
+        {(const char *)key3, sizeof(key3), (const char *)data3, sizeof(data3),
+         {0x56, 0xbe, 0x34, 0x52, 0x1d, 0x14, 0x4c, 0x88, 0xdb, 0xb8, 0xc7, 0x33, 0xf0, 0xe8, 0xb3, 0xf6}},
+        {(const char *)key6, sizeof(key6), "Test Using Larger Than Block-Size Key - Hash Key First", 54,
+         {0x6b, 0x1a, 0xb7, 0xfe, 0x4b, 0xd7, 0xbf, 0x8f, 0x0b, 0x62, 0xe6, 0xce, 0x61, 0xb9, 0xd0, 0xcd}},
+    };
+    for (size_t i = 0; i < sizeof(vector) / sizeof(vector[0]); i++) {
+        hmac_md5_key_init(&key, (uint8_t *)vector[i].key, vector[i].key_length);
+        hmac_md5(&key, (uint8_t *)vector[i].data, vector[i].data_length, digest);
+        if (memcmp(digest, vector[i].digest, 16) == 0) {
+            printf("test case %zu check succeed.\n", i + 1);
+        } else {
+            printf("test case %zu check fail.\n", i + 1);
+        }
+    }
+#endif
+
+#if 1
+    printf("---------HMAC-MD5 batch-----------\n");
+    static uint8_t message[23][300];
+    uint8_t *input_buffer[23];
+    size_t input_length[23];
+    uint8_t batch_digest[23][16];
+    int succeed = 1;
+
+    hmac_md5_key_init(&key, (uint8_t *)"batch key", 9);
+    for (size_t i = 0; i < 23; i++) {
+        for (size_t j = 0; j < sizeof(message[i]); j++) {
+            message[i][j] = (uint8_t)(i * 31 + j * 7);
+        }
+        input_buffer[i] = message[i];
+        input_length[i] = (i * 37) % 300;
+    }
+    hmac_md5_batch(&key, input_buffer, input_length, batch_digest, 23);
+    for (size_t i = 0; i < 23; i++) {
+        hmac_md5(&key, input_buffer[i], input_length[i], digest);
+        if (memcmp(digest, batch_digest[i], 16) != 0) {
+            succeed = 0;
+        }
+    }
+    printf("batch check %s.\n", succeed ? "succeed" : "fail");
+#endif
+    return 0;
+}
+#endif
@@ -0,0 +1,38 @@
+#ifndef __HMAC_MD5_H__
+#define __HMAC_MD5_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include "../md5/md5.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* HMAC-MD5 key schedule: the MD5 states after the ipad and opad key blocks,
+   computed once per key and copied into every message */
+typedef struct {
+    md5_ctx inner;          /* state after hashing (key ^ ipad) */
+    md5_ctx outer;          /* state after hashing (key ^ opad) */
+} hmac_md5_key_t;
+
+/* Data structure for HMAC-MD5 computation of one message */
+typedef struct {
+    md5_ctx md5;            /* inner hash of the message */
+    const hmac_md5_key_t *key;
+    uint8_t digest[16];     /* actual digest after hmac_md5_final call */
+} hmac_md5_ctx;
+
+void hmac_md5_key_init(hmac_md5_key_t *key, uint8_t *key_data, size_t key_length);
+void hmac_md5_init(hmac_md5_ctx *ctx, const hmac_md5_key_t *key);
+void hmac_md5_update(hmac_md5_ctx *ctx, uint8_t *input_buffer, size_t input_length);
+void hmac_md5_final(hmac_md5_ctx *ctx);
+void hmac_md5(const hmac_md5_key_t *key, uint8_t *input_buffer, size_t input_length, uint8_t digest[16]);
+void hmac_md5_batch(const hmac_md5_key_t *key, uint8_t *input_buffer[], size_t input_length[],
+                    uint8_t (*digest)[16], size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __HMAC_MD5_H__ */
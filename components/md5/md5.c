@@ -1,276 +1,651 @@
-/**
- * @file dm5.c
- * @brief MD5 algorithm
- * @copyright Copyright (c) 2023
- *
- * Change Logs:
- * Data             Author                          Notes
- * 2023-04-24       vector(vector_qiu@163.com)      refer to
- *
- */
-#include "md5.h"
-
-/*
- **********************************************************************
- ** md5.c                                                            **
- ** RSA Data Security, Inc. MD5 Message Digest Algorithm             **
- ** Created: 2/17/90 RLR                                             **
- ** Revised: 1/91 SRD,AJ,BSK,JT Reference C Version                  **
- **********************************************************************
- */
-
-/*
- **********************************************************************
- ** Copyright (C) 1990, RSA Data Security, Inc. All rights reserved. **
- **                                                                  **
- ** License to copy and use this software is granted provided that   **
- ** it is identified as the "RSA Data Security, Inc. MD5 Message     **
- ** Digest Algorithm" in all material mentioning or referencing this **
- ** software or this function.                                       **
- **                                                                  **
- ** License is also granted to make and use derivative works         **
- ** provided that such works are identified as "derived from the RSA **
- ** Data Security, Inc. MD5 Message Digest Algorithm" in all         **
- ** material mentioning or referencing the derived work.             **
- **                                                                  **
- ** RSA Data Security, Inc. makes no representations concerning      **
- ** either the merchantability of this software or the suitability   **
- ** of this software for any particular purpose.  It is provided "as **
- ** is" without express or implied warranty of any kind.             **
- **                                                                  **
- ** These notices must be retained in any copies of any part of this **
- ** documentation and/or software.                                   **
- **********************************************************************
- */
-
-
-/* forward declaration */
-static void trans_form(uint32_t *buf, uint32_t *in);
-
-static uint8_t PADDING[64] = {
-    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-
-/* F, G and H are basic MD5 functions: selection, majority, parity */
-#define F(x, y, z) (((x) & (y)) | ((~x) & (z)))
-#define G(x, y, z) (((x) & (z)) | ((y) & (~z)))
-#define H(x, y, z) ((x) ^ (y) ^ (z))
-#define I(x, y, z) ((y) ^ ((x) | (~z)))
-
-/* ROTATE_LEFT rotates x left n bits */
-#define ROTATE_LEFT(x, n) (((x) << (n)) | ((x) >> (32-(n))))
-
-/* FF, GG, HH, and II trans_formations for rounds 1, 2, 3, and 4 */
-/* Rotation is separate from addition to prevent recomputation */
-#define FF(a, b, c, d, x, s, ac) \
-  {(a) += F ((b), (c), (d)) + (x) + (uint32_t)(ac); \
-   (a) = ROTATE_LEFT ((a), (s)); \
-   (a) += (b); \
-  }
-#define GG(a, b, c, d, x, s, ac) \
-  {(a) += G ((b), (c), (d)) + (x) + (uint32_t)(ac); \
-   (a) = ROTATE_LEFT ((a), (s)); \
-   (a) += (b); \
-  }
-#define HH(a, b, c, d, x, s, ac) \
-  {(a) += H ((b), (c), (d)) + (x) + (uint32_t)(ac); \
-   (a) = ROTATE_LEFT ((a), (s)); \
-   (a) += (b); \
-  }
-#define II(a, b, c, d, x, s, ac) \
-  {(a) += I ((b), (c), (d)) + (x) + (uint32_t)(ac); \
-   (a) = ROTATE_LEFT ((a), (s)); \
-   (a) += (b); \
-  }
-
-void md5_init(md5_ctx *ctx)
-{
-    ctx->i[0] = ctx->i[1] = (uint32_t)0;
-
-    /* Load magic initialization constants.
-    */
-    ctx->buf[0] = (uint32_t)0x67452301;
-    ctx->buf[1] = (uint32_t)0xefcdab89;
-    ctx->buf[2] = (uint32_t)0x98badcfe;
-    ctx->buf[3] = (uint32_t)0x10325476;
-}
-
-void md5_update(md5_ctx *ctx, uint8_t *input_buffer , size_t input_length)
-{
-    uint32_t in[16];
-    int mdi;
-    unsigned int i, ii;
-
-    /* compute number of bytes mod 64 */
-    mdi = (int)((ctx->i[0] >> 3) & 0x3F);
-
-    /* update number of bits */
-    if ((ctx->i[0] + ((uint32_t)input_length << 3)) < ctx->i[0]) {
-        ctx->i[1]++;
-    }
-    ctx->i[0] += ((uint32_t)input_length << 3);
-    ctx->i[1] += ((uint32_t)input_length >> 29);
-
-    while (input_length--) {
-        /* add new character to buffer, increment mdi */
-        ctx->in[mdi++] = *input_buffer++;
-
-        /* trans_form if necessary */
-        if (mdi == 0x40) {
-            for (i = 0, ii = 0; i < 16; i++, ii += 4)
-            {
-                in[i] = (((uint32_t)ctx->in[ii+3]) << 24) |
-                        (((uint32_t)ctx->in[ii+2]) << 16) |
-                        (((uint32_t)ctx->in[ii+1]) << 8) |
-                        ((uint32_t)ctx->in[ii]);
-            }
-            trans_form(ctx->buf, in);
-            mdi = 0;
-        }
-    }
-}
-
-void md5_final(md5_ctx *ctx)
-{
-    uint32_t in[16];
-    int mdi;
-    unsigned int i, ii;
-    unsigned int pad_len;
-
-    /* save number of bits */
-    in[14] = ctx->i[0];
-    in[15] = ctx->i[1];
-
-    /* compute number of bytes mod 64 */
-    mdi = (int)((ctx->i[0] >> 3) & 0x3F);
-
-    /* pad out to 56 mod 64 */
-    pad_len = (mdi < 56) ? (56 - mdi) : (120 - mdi);
-    md5_update(ctx, PADDING, pad_len);
-
-    /* append length in bits and trans_form */
-    for (i = 0, ii = 0; i < 14; i++, ii += 4)
-    {
-        in[i] = (((uint32_t)ctx->in[ii+3]) << 24) |
-                (((uint32_t)ctx->in[ii+2]) << 16) |
-                (((uint32_t)ctx->in[ii+1]) << 8) |
-                ((uint32_t)ctx->in[ii]);
-    }
-    trans_form(ctx->buf, in);
-
-    /* store buffer in digest */
-    for (i = 0, ii = 0; i < 4; i++, ii += 4) {
-        ctx->digest[ii] = (uint8_t)(ctx->buf[i] & 0xFF);
-        ctx->digest[ii+1] = (uint8_t)((ctx->buf[i] >> 8) & 0xFF);
-        ctx->digest[ii+2] = (uint8_t)((ctx->buf[i] >> 16) & 0xFF);
-        ctx->digest[ii+3] = (uint8_t)((ctx->buf[i] >> 24) & 0xFF);
-    }
-}
-
-/* Basic MD5 step. trans_form buf based on in.
- */
-static void trans_form(uint32_t *buf, uint32_t *in)
-{
-    uint32_t a = buf[0], b = buf[1], c = buf[2], d = buf[3];
-
-  /* Round 1 */
-#define S11 7
-#define S12 12
-#define S13 17
-#define S14 22
-    FF ( a, b, c, d, in[ 0], S11, 3614090360); /* 1 */
-    FF ( d, a, b, c, in[ 1], S12, 3905402710); /* 2 */
-    FF ( c, d, a, b, in[ 2], S13,  606105819); /* 3 */
-    FF ( b, c, d, a, in[ 3], S14, 3250441966); /* 4 */
-    FF ( a, b, c, d, in[ 4], S11, 4118548399); /* 5 */
-    FF ( d, a, b, c, in[ 5], S12, 1200080426); /* 6 */
-    FF ( c, d, a, b, in[ 6], S13, 2821735955); /* 7 */
-    FF ( b, c, d, a, in[ 7], S14, 4249261313); /* 8 */
-    FF ( a, b, c, d, in[ 8], S11, 1770035416); /* 9 */
-    FF ( d, a, b, c, in[ 9], S12, 2336552879); /* 10 */
-    FF ( c, d, a, b, in[10], S13, 4294925233); /* 11 */
-    FF ( b, c, d, a, in[11], S14, 2304563134); /* 12 */
-    FF ( a, b, c, d, in[12], S11, 1804603682); /* 13 */
-    FF ( d, a, b, c, in[13], S12, 4254626195); /* 14 */
-    FF ( c, d, a, b, in[14], S13, 2792965006); /* 15 */
-    FF ( b, c, d, a, in[15], S14, 1236535329); /* 16 */
-
-  /* Round 2 */
-#define S21 5
-#define S22 9
-#define S23 14
-#define S24 20
-    GG ( a, b, c, d, in[ 1], S21, 4129170786); /* 17 */
-    GG ( d, a, b, c, in[ 6], S22, 3225465664); /* 18 */
-    GG ( c, d, a, b, in[11], S23,  643717713); /* 19 */
-    GG ( b, c, d, a, in[ 0], S24, 3921069994); /* 20 */
-    GG ( a, b, c, d, in[ 5], S21, 3593408605); /* 21 */
-    GG ( d, a, b, c, in[10], S22,   38016083); /* 22 */
-    GG ( c, d, a, b, in[15], S23, 3634488961); /* 23 */
-    GG ( b, c, d, a, in[ 4], S24, 3889429448); /* 24 */
-    GG ( a, b, c, d, in[ 9], S21,  568446438); /* 25 */
-    GG ( d, a, b, c, in[14], S22, 3275163606); /* 26 */
-    GG ( c, d, a, b, in[ 3], S23, 4107603335); /* 27 */
-    GG ( b, c, d, a, in[ 8], S24, 1163531501); /* 28 */
-    GG ( a, b, c, d, in[13], S21, 2850285829); /* 29 */
-    GG ( d, a, b, c, in[ 2], S22, 4243563512); /* 30 */
-    GG ( c, d, a, b, in[ 7], S23, 1735328473); /* 31 */
-    GG ( b, c, d, a, in[12], S24, 2368359562); /* 32 */
-
-  /* Round 3 */
-#define S31 4
-#define S32 11
-#define S33 16
-#define S34 23
-    HH ( a, b, c, d, in[ 5], S31, 4294588738); /* 33 */
-    HH ( d, a, b, c, in[ 8], S32, 2272392833); /* 34 */
-    HH ( c, d, a, b, in[11], S33, 1839030562); /* 35 */
-    HH ( b, c, d, a, in[14], S34, 4259657740); /* 36 */
-    HH ( a, b, c, d, in[ 1], S31, 2763975236); /* 37 */
-    HH ( d, a, b, c, in[ 4], S32, 1272893353); /* 38 */
-    HH ( c, d, a, b, in[ 7], S33, 4139469664); /* 39 */
-    HH ( b, c, d, a, in[10], S34, 3200236656); /* 40 */
-    HH ( a, b, c, d, in[13], S31,  681279174); /* 41 */
-    HH ( d, a, b, c, in[ 0], S32, 3936430074); /* 42 */
-    HH ( c, d, a, b, in[ 3], S33, 3572445317); /* 43 */
-    HH ( b, c, d, a, in[ 6], S34,   76029189); /* 44 */
-    HH ( a, b, c, d, in[ 9], S31, 3654602809); /* 45 */
-    HH ( d, a, b, c, in[12], S32, 3873151461); /* 46 */
-    HH ( c, d, a, b, in[15], S33,  530742520); /* 47 */
-    HH ( b, c, d, a, in[ 2], S34, 3299628645); /* 48 */
-
-  /* Round 4 */
-#define S41 6
-#define S42 10
-#define S43 15
-#define S44 21
-    II ( a, b, c, d, in[ 0], S41, 4096336452); /* 49 */
-    II ( d, a, b, c, in[ 7], S42, 1126891415); /* 50 */
-    II ( c, d, a, b, in[14], S43, 2878612391); /* 51 */
-    II ( b, c, d, a, in[ 5], S44, 4237533241); /* 52 */
-    II ( a, b, c, d, in[12], S41, 1700485571); /* 53 */
-    II ( d, a, b, c, in[ 3], S42, 2399980690); /* 54 */
-    II ( c, d, a, b, in[10], S43, 4293915773); /* 55 */
-    II ( b, c, d, a, in[ 1], S44, 2240044497); /* 56 */
-    II ( a, b, c, d, in[ 8], S41, 1873313359); /* 57 */
-    II ( d, a, b, c, in[15], S42, 4264355552); /* 58 */
-    II ( c, d, a, b, in[ 6], S43, 2734768916); /* 59 */
-    II ( b, c, d, a, in[13], S44, 1309151649); /* 60 */
-    II ( a, b, c, d, in[ 4], S41, 4149444226); /* 61 */
-    II ( d, a, b, c, in[11], S42, 3174756917); /* 62 */
-    II ( c, d, a, b, in[ 2], S43,  718787259); /* 63 */
-    II ( b, c, d, a, in[ 9], S44, 3951481745); /* 64 */
-
-    buf[0] += a;
-    buf[1] += b;
-    buf[2] += c;
-    buf[3] += d;
-}
-
+/**
+ * @file dm5.c
+ * @brief MD5 algorithm
+ * @copyright Copyright (c) 2023
+ *
+ * Change Logs:
+ * Data             Author                          Notes
+ * 2023-04-24       vector(vector_qiu@163.com)      refer to
+ *
+ */
+#include "md5.h"
+#include "../checksum_stats/checksum_stats.h"
+#include "../checksum_copy/checksum_copy.h"
+#include <string.h>
+
+/*
+ **********************************************************************
+ ** md5.c                                                            **
+ ** RSA Data Security, Inc. MD5 Message Digest Algorithm             **
+ ** Created: 2/17/90 RLR                                             **
+ ** Revised: 1/91 SRD,AJ,BSK,JT Reference C Version                  **
+ **********************************************************************
+ */
+
+/*
+ **********************************************************************
+ ** Copyright (C) 1990, RSA Data Security, Inc. All rights reserved. **
+ **                                                                  **
+ ** License to copy and use this software is granted provided that   **
+ ** it is identified as the "RSA Data Security, Inc. MD5 Message     **
+ ** Digest Algorithm" in all material mentioning or referencing this **
+ ** software or this function.                                       **
+ **                                                                  **
+ ** License is also granted to make and use derivative works         **
+ ** provided that such works are identified as "derived from the RSA **
+ ** Data Security, Inc. MD5 Message Digest Algorithm" in all         **
+ ** material mentioning or referencing the derived work.             **
+ **                                                                  **
+ ** RSA Data Security, Inc. makes no representations concerning      **
+ ** either the merchantability of this software or the suitability   **
+ ** of this software for any particular purpose.  It is provided "as **
+ ** is" without express or implied warranty of any kind.             **
+ **                                                                  **
+ ** These notices must be retained in any copies of any part of this **
+ ** documentation and/or software.                                   **
+ **********************************************************************
+ */
+
+
+/* lanes are hashed as GCC vectors, SSE2 or NEON registers on the usual targets */
+#if defined(__GNUC__)
+#define MD5_MULTI_LANE_VECTOR
+typedef uint32_t md5_lane_t __attribute__((vector_size(MD5_LANES * sizeof(uint32_t))));
+#endif
+
+/* LOAD_LE32 reads a little endian word from a byte pointer */
+#define LOAD_LE32(p) (((uint32_t)(p)[3] << 24) | ((uint32_t)(p)[2] << 16) | \
+                      ((uint32_t)(p)[1] << 8) | (uint32_t)(p)[0])
+
+/* MD5_WORD reads message word k of a block in place, one load on little endian targets */
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+static inline uint32_t md5_word(const uint8_t *p) {
+    uint32_t word;
+    memcpy(&word, p, sizeof(word));
+    return word;
+}
+#define MD5_WORD(block, k) md5_word((block) + 4 * (k))
+#else
+#define MD5_WORD(block, k) LOAD_LE32((block) + 4 * (k))
+#endif
+
+/* md5_store_word writes a little endian word to a byte pointer, one store on little endian targets */
+static inline void md5_store_word(uint8_t *p, uint32_t word) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    memcpy(p, &word, sizeof(word));
+#else
+    p[0] = (uint8_t)(word & 0xFF);
+    p[1] = (uint8_t)((word >> 8) & 0xFF);
+    p[2] = (uint8_t)((word >> 16) & 0xFF);
+    p[3] = (uint8_t)((word >> 24) & 0xFF);
+#endif
+}
+
+/* MD5_ROTL is a single rotate instruction: the intrinsic where there is one, the
+   shift pattern compilers turn into rol otherwise */
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_rotateleft32)
+#define MD5_BUILTIN_ROTATELEFT32
+#endif
+#endif
+#if defined(_MSC_VER)
+#include <stdlib.h>
+#define MD5_ROTL(x, n) _rotl((x), (n))
+#elif defined(MD5_BUILTIN_ROTATELEFT32)
+#define MD5_ROTL(x, n) __builtin_rotateleft32((x), (n))
+#else
+#define MD5_ROTL(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+#endif
+
+/* forward declaration */
+static void trans_form(uint32_t *buf, const uint8_t *block);
+static void md5_append(md5_ctx *ctx, uint8_t *input_buffer, size_t input_length);
+#ifdef MD5_MULTI_LANE_VECTOR
+static void trans_form_lanes(md5_lane_t *buf, uint8_t *block[MD5_LANES], md5_lane_t mask);
+#endif
+
+static uint8_t PADDING[64] = {
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+/* F, G and H are basic MD5 functions: selection, majority, parity */
+#define F(x, y, z) (((x) & (y)) | ((~x) & (z)))
+#define G(x, y, z) (((x) & (z)) | ((y) & (~z)))
+#define H(x, y, z) ((x) ^ (y) ^ (z))
+#define I(x, y, z) ((y) ^ ((x) | (~z)))
+
+/* ROTATE_LEFT rotates x left n bits */
+#define ROTATE_LEFT(x, n) (((x) << (n)) | ((x) >> (32-(n))))
+
+/* FF, GG, HH, and II trans_formations for rounds 1, 2, 3, and 4 */
+/* Rotation is separate from addition to prevent recomputation */
+#define FF(a, b, c, d, x, s, ac) \
+  {(a) += F ((b), (c), (d)) + (x) + (uint32_t)(ac); \
+   (a) = ROTATE_LEFT ((a), (s)); \
+   (a) += (b); \
+  }
+#define GG(a, b, c, d, x, s, ac) \
+  {(a) += G ((b), (c), (d)) + (x) + (uint32_t)(ac); \
+   (a) = ROTATE_LEFT ((a), (s)); \
+   (a) += (b); \
+  }
+#define HH(a, b, c, d, x, s, ac) \
+  {(a) += H ((b), (c), (d)) + (x) + (uint32_t)(ac); \
+   (a) = ROTATE_LEFT ((a), (s)); \
+   (a) += (b); \
+  }
+#define II(a, b, c, d, x, s, ac) \
+  {(a) += I ((b), (c), (d)) + (x) + (uint32_t)(ac); \
+   (a) = ROTATE_LEFT ((a), (s)); \
+   (a) += (b); \
+  }
+
+void md5_init(md5_ctx *ctx)
+{
+    ctx->i[0] = ctx->i[1] = (uint32_t)0;
+
+    /* Load magic initialization constants.
+    */
+    ctx->buf[0] = (uint32_t)0x67452301;
+    ctx->buf[1] = (uint32_t)0xefcdab89;
+    ctx->buf[2] = (uint32_t)0x98badcfe;
+    ctx->buf[3] = (uint32_t)0x10325476;
+}
+
+void md5_update(md5_ctx *ctx, uint8_t *input_buffer , size_t input_length)
+{
+    CHECKSUM_STATS_BEGIN(stats_start);
+    md5_append(ctx, input_buffer, input_length);
+    CHECKSUM_STATS_RECORD(CHECKSUM_STATS_MD5, 0, CHECKSUM_STATS_SCALAR, input_length, stats_start);
+}
+
+/* md5_update that also copies the input to a destination in the same pass: each chunk is
+   hashed while it sits in the L1 cache and copied from there, non-temporal for long copies */
+void md5_copy_update(md5_ctx *ctx, uint8_t *destination, const uint8_t *input_buffer, size_t input_length)
+{
+    bool nontemporal = input_length >= CHECKSUM_COPY_NONTEMPORAL;
+    size_t length = input_length, chunk;
+
+    CHECKSUM_STATS_BEGIN(stats_start);
+    while (length > 0) {
+        chunk = (length < CHECKSUM_COPY_CHUNK) ? length : CHECKSUM_COPY_CHUNK;
+        md5_append(ctx, (uint8_t *)input_buffer, chunk);
+        checksum_copy_chunk(destination, input_buffer, chunk, nontemporal);
+        destination += chunk;
+        input_buffer += chunk;
+        length -= chunk;
+    }
+    checksum_copy_fence(nontemporal);
+    CHECKSUM_STATS_RECORD(CHECKSUM_STATS_MD5, 0, CHECKSUM_STATS_SCALAR, input_length, stats_start);
+}
+
+/* md5_update without the counters, for the padding and the multi lane top up */
+static void md5_append(md5_ctx *ctx, uint8_t *input_buffer, size_t input_length)
+{
+    size_t mdi, fill;
+
+    /* compute number of bytes mod 64 */
+    mdi = (size_t)((ctx->i[0] >> 3) & 0x3F);
+
+    /* update number of bits */
+    if ((ctx->i[0] + ((uint32_t)input_length << 3)) < ctx->i[0]) {
+        ctx->i[1]++;
+    }
+    ctx->i[0] += ((uint32_t)input_length << 3);
+    ctx->i[1] += ((uint32_t)input_length >> 29);
+
+    /* complete a partially filled input buffer */
+    if (mdi != 0) {
+        fill = 64 - mdi;
+        if (input_length < fill) {
+            memcpy(ctx->in + mdi, input_buffer, input_length);
+            return;
+        }
+        memcpy(ctx->in + mdi, input_buffer, fill);
+        trans_form(ctx->buf, ctx->in);
+        input_buffer += fill;
+        input_length -= fill;
+    }
+
+    /* full blocks are compressed in place */
+    while (input_length >= 64) {
+        trans_form(ctx->buf, input_buffer);
+        input_buffer += 64;
+        input_length -= 64;
+    }
+
+    /* keep the rest for the next call */
+    memcpy(ctx->in, input_buffer, input_length);
+}
+
+void md5_final(md5_ctx *ctx)
+{
+    uint8_t bits[8];
+    int mdi;
+    unsigned int i, ii;
+    unsigned int pad_len;
+
+    /* save number of bits */
+    for (i = 0; i < 4; i++) {
+        bits[i] = (uint8_t)((ctx->i[0] >> (8 * i)) & 0xFF);
+        bits[i+4] = (uint8_t)((ctx->i[1] >> (8 * i)) & 0xFF);
+    }
+
+    /* compute number of bytes mod 64 */
+    mdi = (int)((ctx->i[0] >> 3) & 0x3F);
+
+    /* pad out to 56 mod 64 */
+    pad_len = (mdi < 56) ? (56 - mdi) : (120 - mdi);
+    md5_append(ctx, PADDING, pad_len);
+
+    /* append length in bits and trans_form */
+    memcpy(ctx->in + 56, bits, 8);
+    trans_form(ctx->buf, ctx->in);
+
+    /* store buffer in digest */
+    for (i = 0, ii = 0; i < 4; i++, ii += 4) {
+        ctx->digest[ii] = (uint8_t)(ctx->buf[i] & 0xFF);
+        ctx->digest[ii+1] = (uint8_t)((ctx->buf[i] >> 8) & 0xFF);
+        ctx->digest[ii+2] = (uint8_t)((ctx->buf[i] >> 16) & 0xFF);
+        ctx->digest[ii+3] = (uint8_t)((ctx->buf[i] >> 24) & 0xFF);
+    }
+}
+
+/* Pads the last input_length (< 64) bytes of a message into one block, or two when the
+   length field doesn't fit behind them, and compresses them into buf */
+static void md5_digest_tail(uint32_t *buf, const uint8_t *input, size_t input_length, uint64_t bits)
+{
+    uint8_t block[128];
+    size_t words = (input_length < 56) ? 16 : 32;
+    size_t full = input_length / 4, k;
+    uint32_t last = (uint32_t)0x80 << (8 * (input_length % 4));
+
+    /* fixed size zeroing stays inline, and the message and length go in a word at a time:
+       every word trans_form loads then comes from a single store */
+    memset(block, 0, 64);
+    if (words == 32) {
+        memset(block + 64, 0, 64);
+    }
+    for (k = 0; k < full; k++) {
+        md5_store_word(block + 4 * k, MD5_WORD(input, k));
+    }
+    for (k = input_length % 4; k > 0; k--) {
+        last |= (uint32_t)input[4 * full + k - 1] << (8 * (k - 1));
+    }
+    md5_store_word(block + 4 * full, last);
+    md5_store_word(block + 4 * (words - 2), (uint32_t)bits);
+    md5_store_word(block + 4 * (words - 1), (uint32_t)(bits >> 32));
+
+    trans_form(buf, block);
+    if (words == 32) {
+        trans_form(buf, block + 64);
+    }
+}
+
+/* Hashes a whole message in one call, the same digest as md5_init, md5_update and
+   md5_final without a context: up to 55 bytes are one padded block, up to 119 two,
+   longer messages have their full blocks compressed in place first.
+ */
+void md5_digest(const void *input_buffer, size_t input_length, uint8_t digest[16])
+{
+    CHECKSUM_STATS_BEGIN(stats_start);
+    const uint8_t *input = (const uint8_t *)input_buffer;
+    uint32_t buf[4] = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476};
+    uint64_t bits = (uint64_t)input_length << 3;
+    size_t rest = input_length;
+    unsigned int i;
+
+    while (rest >= 64) {
+        trans_form(buf, input);
+        input += 64;
+        rest -= 64;
+    }
+    md5_digest_tail(buf, input, rest, bits);
+
+    /* store buffer in digest */
+    for (i = 0; i < 4; i++) {
+        md5_store_word(digest + 4 * i, buf[i]);
+    }
+    CHECKSUM_STATS_RECORD(CHECKSUM_STATS_MD5, 0, CHECKSUM_STATS_SCALAR, input_length, stats_start);
+}
+
+/* Hashes one message per lane to completion, the same as md5_update followed
+   by md5_final on every lane, but with the lanes' blocks compressed side by side.
+   Unused lanes have a NULL ctx. The contexts may already hold data (a keyed
+   HMAC state for example). Lanes of similar length share the most work.
+ */
+void md5_multi_lane(md5_ctx *ctx[MD5_LANES], uint8_t *input_buffer[MD5_LANES], size_t input_length[MD5_LANES])
+{
+#ifdef MD5_MULTI_LANE_VECTOR
+    CHECKSUM_STATS_BEGIN(stats_start);
+    static uint8_t zero_block[64];
+    uint8_t tail[MD5_LANES][128];
+    uint8_t *data[MD5_LANES];
+    uint8_t *block[MD5_LANES];
+    size_t blocks[MD5_LANES], total[MD5_LANES], max_blocks = 0;
+    md5_lane_t state[4] = {{0}};
+    md5_lane_t mask = {0};
+    unsigned int l, i, ii;
+    size_t k;
+
+    for (l = 0; l < MD5_LANES; l++) {
+        uint8_t *input = input_buffer[l];
+        size_t length = input_length[l];
+        size_t rest, tail_len;
+        int mdi;
+
+        blocks[l] = 0;
+        total[l] = 0;
+        if (ctx[l] == NULL) {
+            continue;
+        }
+
+        /* top up a partially filled input buffer first */
+        mdi = (int)((ctx[l]->i[0] >> 3) & 0x3F);
+        if (mdi != 0) {
+            size_t fill = (length < (size_t)(64 - mdi)) ? length : (size_t)(64 - mdi);
+            md5_append(ctx[l], input, fill);
+            input += fill;
+            length -= fill;
+            mdi = (int)((ctx[l]->i[0] >> 3) & 0x3F);
+        }
+
+        /* update number of bits */
+        if ((ctx[l]->i[0] + ((uint32_t)length << 3)) < ctx[l]->i[0]) {
+            ctx[l]->i[1]++;
+        }
+        ctx[l]->i[0] += ((uint32_t)length << 3);
+        ctx[l]->i[1] += ((uint32_t)length >> 29);
+
+        /* full blocks are read in place, the rest is padded into one or two tail blocks */
+        data[l] = input;
+        blocks[l] = length / 64;
+        rest = (mdi != 0) ? (size_t)mdi : length % 64;
+        memcpy(tail[l], (mdi != 0) ? ctx[l]->in : input + blocks[l] * 64, rest);
+        tail_len = (rest < 56) ? 64 : 128;
+        memcpy(tail[l] + rest, PADDING, tail_len - 8 - rest);
+        for (i = 0; i < 4; i++) {
+            tail[l][tail_len - 8 + i] = (uint8_t)((ctx[l]->i[0] >> (8 * i)) & 0xFF);
+            tail[l][tail_len - 4 + i] = (uint8_t)((ctx[l]->i[1] >> (8 * i)) & 0xFF);
+        }
+
+        total[l] = blocks[l] + tail_len / 64;
+        if (total[l] > max_blocks) {
+            max_blocks = total[l];
+        }
+        for (i = 0; i < 4; i++) {
+            state[i][l] = ctx[l]->buf[i];
+        }
+    }
+
+    for (k = 0; k < max_blocks; k++) {
+        for (l = 0; l < MD5_LANES; l++) {
+            if (k < blocks[l]) {
+                block[l] = data[l] + k * 64;
+            } else if (k < total[l]) {
+                block[l] = tail[l] + (k - blocks[l]) * 64;
+            } else {
+                block[l] = zero_block;
+            }
+            mask[l] = (k < total[l]) ? 0xFFFFFFFF : 0;
+        }
+        trans_form_lanes(state, block, mask);
+    }
+
+    /* store buffer in digest */
+    for (l = 0; l < MD5_LANES; l++) {
+        if (ctx[l] == NULL) {
+            continue;
+        }
+        for (i = 0, ii = 0; i < 4; i++, ii += 4) {
+            ctx[l]->buf[i] = state[i][l];
+            ctx[l]->digest[ii] = (uint8_t)(ctx[l]->buf[i] & 0xFF);
+            ctx[l]->digest[ii+1] = (uint8_t)((ctx[l]->buf[i] >> 8) & 0xFF);
+            ctx[l]->digest[ii+2] = (uint8_t)((ctx[l]->buf[i] >> 16) & 0xFF);
+            ctx[l]->digest[ii+3] = (uint8_t)((ctx[l]->buf[i] >> 24) & 0xFF);
+        }
+    }
+#ifdef CHECKSUM_STATS
+    size_t stats_bytes = 0;
+    for (l = 0; l < MD5_LANES; l++) {
+        stats_bytes += (ctx[l] != NULL) ? input_length[l] : 0;
+    }
+    CHECKSUM_STATS_RECORD(CHECKSUM_STATS_MD5, 0, CHECKSUM_STATS_MULTI_LANE, stats_bytes, stats_start);
+#endif
+#else
+    unsigned int l;
+
+    for (l = 0; l < MD5_LANES; l++) {
+        if (ctx[l] != NULL) {
+            md5_update(ctx[l], input_buffer[l], input_length[l]);
+            md5_final(ctx[l]);
+        }
+    }
+#endif
+}
+
+/* Scalar MD5 steps, the same functions as FF, GG, HH and II arranged for a short
+   dependency chain through b, the register written by the previous step:
+   F is ((c ^ d) & b) ^ d, and G adds its two disjoint halves separately so that
+   (c & ~d) and the message word are summed before b is ready. Message words are
+   loaded straight from the block and the rotate is one instruction.
+ */
+#define MD5_STEP_F(a, b, c, d, k, s, ac) \
+  {(a) += ((((c) ^ (d)) & (b)) ^ (d)) + MD5_WORD(block, k) + (uint32_t)(ac); \
+   (a) = MD5_ROTL((a), (s)) + (b); \
+  }
+#define MD5_STEP_G(a, b, c, d, k, s, ac) \
+  {(a) += ((c) & ~(d)) + MD5_WORD(block, k) + (uint32_t)(ac); \
+   (a) += (b) & (d); \
+   (a) = MD5_ROTL((a), (s)) + (b); \
+  }
+#define MD5_STEP_H(a, b, c, d, k, s, ac) \
+  {(a) += ((b) ^ (c) ^ (d)) + MD5_WORD(block, k) + (uint32_t)(ac); \
+   (a) = MD5_ROTL((a), (s)) + (b); \
+  }
+#define MD5_STEP_I(a, b, c, d, k, s, ac) \
+  {(a) += ((c) ^ ((b) | ~(d))) + MD5_WORD(block, k) + (uint32_t)(ac); \
+   (a) = MD5_ROTL((a), (s)) + (b); \
+  }
+
+/* Basic MD5 step. trans_form buf based on one 64 byte block, the state stays in registers.
+ */
+static void trans_form(uint32_t *buf, const uint8_t *block)
+{
+    uint32_t a = buf[0], b = buf[1], c = buf[2], d = buf[3];
+
+  /* Round 1 */
+#define S11 7
+#define S12 12
+#define S13 17
+#define S14 22
+    MD5_STEP_F(a, b, c, d,  0, S11, 3614090360); /* 1 */
+    MD5_STEP_F(d, a, b, c,  1, S12, 3905402710); /* 2 */
+    MD5_STEP_F(c, d, a, b,  2, S13,  606105819); /* 3 */
+    MD5_STEP_F(b, c, d, a,  3, S14, 3250441966); /* 4 */
+    MD5_STEP_F(a, b, c, d,  4, S11, 4118548399); /* 5 */
+    MD5_STEP_F(d, a, b, c,  5, S12, 1200080426); /* 6 */
+    MD5_STEP_F(c, d, a, b,  6, S13, 2821735955); /* 7 */
+    MD5_STEP_F(b, c, d, a,  7, S14, 4249261313); /* 8 */
+    MD5_STEP_F(a, b, c, d,  8, S11, 1770035416); /* 9 */
+    MD5_STEP_F(d, a, b, c,  9, S12, 2336552879); /* 10 */
+    MD5_STEP_F(c, d, a, b, 10, S13, 4294925233); /* 11 */
+    MD5_STEP_F(b, c, d, a, 11, S14, 2304563134); /* 12 */
+    MD5_STEP_F(a, b, c, d, 12, S11, 1804603682); /* 13 */
+    MD5_STEP_F(d, a, b, c, 13, S12, 4254626195); /* 14 */
+    MD5_STEP_F(c, d, a, b, 14, S13, 2792965006); /* 15 */
+    MD5_STEP_F(b, c, d, a, 15, S14, 1236535329); /* 16 */
+
+  /* Round 2 */
+#define S21 5
+#define S22 9
+#define S23 14
+#define S24 20
+    MD5_STEP_G(a, b, c, d,  1, S21, 4129170786); /* 17 */
+    MD5_STEP_G(d, a, b, c,  6, S22, 3225465664); /* 18 */
+    MD5_STEP_G(c, d, a, b, 11, S23,  643717713); /* 19 */
+    MD5_STEP_G(b, c, d, a,  0, S24, 3921069994); /* 20 */
+    MD5_STEP_G(a, b, c, d,  5, S21, 3593408605); /* 21 */
+    MD5_STEP_G(d, a, b, c, 10, S22,   38016083); /* 22 */
+    MD5_STEP_G(c, d, a, b, 15, S23, 3634488961); /* 23 */
+    MD5_STEP_G(b, c, d, a,  4, S24, 3889429448); /* 24 */
+    MD5_STEP_G(a, b, c, d,  9, S21,  568446438); /* 25 */
+    MD5_STEP_G(d, a, b, c, 14, S22, 3275163606); /* 26 */
+    MD5_STEP_G(c, d, a, b,  3, S23, 4107603335); /* 27 */
+    MD5_STEP_G(b, c, d, a,  8, S24, 1163531501); /* 28 */
+    MD5_STEP_G(a, b, c, d, 13, S21, 2850285829); /* 29 */
+    MD5_STEP_G(d, a, b, c,  2, S22, 4243563512); /* 30 */
+    MD5_STEP_G(c, d, a, b,  7, S23, 1735328473); /* 31 */
+    MD5_STEP_G(b, c, d, a, 12, S24, 2368359562); /* 32 */
+
+  /* Round 3 */
+#define S31 4
+#define S32 11
+#define S33 16
+#define S34 23
+    MD5_STEP_H(a, b, c, d,  5, S31, 4294588738); /* 33 */
+    MD5_STEP_H(d, a, b, c,  8, S32, 2272392833); /* 34 */
+    MD5_STEP_H(c, d, a, b, 11, S33, 1839030562); /* 35 */
+    MD5_STEP_H(b, c, d, a, 14, S34, 4259657740); /* 36 */
+    MD5_STEP_H(a, b, c, d,  1, S31, 2763975236); /* 37 */
+    MD5_STEP_H(d, a, b, c,  4, S32, 1272893353); /* 38 */
+    MD5_STEP_H(c, d, a, b,  7, S33, 4139469664); /* 39 */
+    MD5_STEP_H(b, c, d, a, 10, S34, 3200236656); /* 40 */
+    MD5_STEP_H(a, b, c, d, 13, S31,  681279174); /* 41 */
+    MD5_STEP_H(d, a, b, c,  0, S32, 3936430074); /* 42 */
+    MD5_STEP_H(c, d, a, b,  3, S33, 3572445317); /* 43 */
+    MD5_STEP_H(b, c, d, a,  6, S34,   76029189); /* 44 */
+    MD5_STEP_H(a, b, c, d,  9, S31, 3654602809); /* 45 */
+    MD5_STEP_H(d, a, b, c, 12, S32, 3873151461); /* 46 */
+    MD5_STEP_H(c, d, a, b, 15, S33,  530742520); /* 47 */
+    MD5_STEP_H(b, c, d, a,  2, S34, 3299628645); /* 48 */
+
+  /* Round 4 */
+#define S41 6
+#define S42 10
+#define S43 15
+#define S44 21
+    MD5_STEP_I(a, b, c, d,  0, S41, 4096336452); /* 49 */
+    MD5_STEP_I(d, a, b, c,  7, S42, 1126891415); /* 50 */
+    MD5_STEP_I(c, d, a, b, 14, S43, 2878612391); /* 51 */
+    MD5_STEP_I(b, c, d, a,  5, S44, 4237533241); /* 52 */
+    MD5_STEP_I(a, b, c, d, 12, S41, 1700485571); /* 53 */
+    MD5_STEP_I(d, a, b, c,  3, S42, 2399980690); /* 54 */
+    MD5_STEP_I(c, d, a, b, 10, S43, 4293915773); /* 55 */
+    MD5_STEP_I(b, c, d, a,  1, S44, 2240044497); /* 56 */
+    MD5_STEP_I(a, b, c, d,  8, S41, 1873313359); /* 57 */
+    MD5_STEP_I(d, a, b, c, 15, S42, 4264355552); /* 58 */
+    MD5_STEP_I(c, d, a, b,  6, S43, 2734768916); /* 59 */
+    MD5_STEP_I(b, c, d, a, 13, S44, 1309151649); /* 60 */
+    MD5_STEP_I(a, b, c, d,  4, S41, 4149444226); /* 61 */
+    MD5_STEP_I(d, a, b, c, 11, S42, 3174756917); /* 62 */
+    MD5_STEP_I(c, d, a, b,  2, S43,  718787259); /* 63 */
+    MD5_STEP_I(b, c, d, a,  9, S44, 3951481745); /* 64 */
+
+    buf[0] += a;
+    buf[1] += b;
+    buf[2] += c;
+    buf[3] += d;
+}
+
+#ifdef MD5_MULTI_LANE_VECTOR
+/* Basic MD5 step on MD5_LANES independent states at once. trans_form buf based
+   on the blocks, lanes whose mask is 0 keep their state.
+ */
+static void trans_form_lanes(md5_lane_t *buf, uint8_t *block[MD5_LANES], md5_lane_t mask)
+{
+    md5_lane_t in[16];
+    md5_lane_t a = buf[0], b = buf[1], c = buf[2], d = buf[3];
+    unsigned int i, ii;
+
+    for (i = 0, ii = 0; i < 16; i++, ii += 4) {
+        in[i] = (md5_lane_t){LOAD_LE32(block[0] + ii), LOAD_LE32(block[1] + ii),
+                             LOAD_LE32(block[2] + ii), LOAD_LE32(block[3] + ii)};
+    }
+
+  /* Round 1 */
+    FF ( a, b, c, d, in[ 0], S11, 3614090360); /* 1 */
+    FF ( d, a, b, c, in[ 1], S12, 3905402710); /* 2 */
+    FF ( c, d, a, b, in[ 2], S13,  606105819); /* 3 */
+    FF ( b, c, d, a, in[ 3], S14, 3250441966); /* 4 */
+    FF ( a, b, c, d, in[ 4], S11, 4118548399); /* 5 */
+    FF ( d, a, b, c, in[ 5], S12, 1200080426); /* 6 */
+    FF ( c, d, a, b, in[ 6], S13, 2821735955); /* 7 */
+    FF ( b, c, d, a, in[ 7], S14, 4249261313); /* 8 */
+    FF ( a, b, c, d, in[ 8], S11, 1770035416); /* 9 */
+    FF ( d, a, b, c, in[ 9], S12, 2336552879); /* 10 */
+    FF ( c, d, a, b, in[10], S13, 4294925233); /* 11 */
+    FF ( b, c, d, a, in[11], S14, 2304563134); /* 12 */
+    FF ( a, b, c, d, in[12], S11, 1804603682); /* 13 */
+    FF ( d, a, b, c, in[13], S12, 4254626195); /* 14 */
+    FF ( c, d, a, b, in[14], S13, 2792965006); /* 15 */
+    FF ( b, c, d, a, in[15], S14, 1236535329); /* 16 */
+
+  /* Round 2 */
+    GG ( a, b, c, d, in[ 1], S21, 4129170786); /* 17 */
+    GG ( d, a, b, c, in[ 6], S22, 3225465664); /* 18 */
+    GG ( c, d, a, b, in[11], S23,  643717713); /* 19 */
+    GG ( b, c, d, a, in[ 0], S24, 3921069994); /* 20 */
+    GG ( a, b, c, d, in[ 5], S21, 3593408605); /* 21 */
+    GG ( d, a, b, c, in[10], S22,   38016083); /* 22 */
+    GG ( c, d, a, b, in[15], S23, 3634488961); /* 23 */
+    GG ( b, c, d, a, in[ 4], S24, 3889429448); /* 24 */
+    GG ( a, b, c, d, in[ 9], S21,  568446438); /* 25 */
+    GG ( d, a, b, c, in[14], S22, 3275163606); /* 26 */
+    GG ( c, d, a, b, in[ 3], S23, 4107603335); /* 27 */
+    GG ( b, c, d, a, in[ 8], S24, 1163531501); /* 28 */
+    GG ( a, b, c, d, in[13], S21, 2850285829); /* 29 */
+    GG ( d, a, b, c, in[ 2], S22, 4243563512); /* 30 */
+    GG ( c, d, a, b, in[ 7], S23, 1735328473); /* 31 */
+    GG ( b, c, d, a, in[12], S24, 2368359562); /* 32 */
+
+  /* Round 3 */
+    HH ( a, b, c, d, in[ 5], S31, 4294588738); /* 33 */
+    HH ( d, a, b, c, in[ 8], S32, 2272392833); /* 34 */
+    HH ( c, d, a, b, in[11], S33, 1839030562); /* 35 */
+    HH ( b, c, d, a, in[14], S34, 4259657740); /* 36 */
+    HH ( a, b, c, d, in[ 1], S31, 2763975236); /* 37 */
+    HH ( d, a, b, c, in[ 4], S32, 1272893353); /* 38 */
+    HH ( c, d, a, b, in[ 7], S33, 4139469664); /* 39 */
+    HH ( b, c, d, a, in[10], S34, 3200236656); /* 40 */
+    HH ( a, b, c, d, in[13], S31,  681279174); /* 41 */
+    HH ( d, a, b, c, in[ 0], S32, 3936430074); /* 42 */
+    HH ( c, d, a, b, in[ 3], S33, 3572445317); /* 43 */
+    HH ( b, c, d, a, in[ 6], S34,   76029189); /* 44 */
+    HH ( a, b, c, d, in[ 9], S31, 3654602809); /* 45 */
+    HH ( d, a, b, c, in[12], S32, 3873151461); /* 46 */
+    HH ( c, d, a, b, in[15], S33,  530742520); /* 47 */
+    HH ( b, c, d, a, in[ 2], S34, 3299628645); /* 48 */
+
+  /* Round 4 */
+    II ( a, b, c, d, in[ 0], S41, 4096336452); /* 49 */
+    II ( d, a, b, c, in[ 7], S42, 1126891415); /* 50 */
+    II ( c, d, a, b, in[14], S43, 2878612391); /* 51 */
+    II ( b, c, d, a, in[ 5], S44, 4237533241); /* 52 */
+    II ( a, b, c, d, in[12], S41, 1700485571); /* 53 */
+    II ( d, a, b, c, in[ 3], S42, 2399980690); /* 54 */
+    II ( c, d, a, b, in[10], S43, 4293915773); /* 55 */
+    II ( b, c, d, a, in[ 1], S44, 2240044497); /* 56 */
+    II ( a, b, c, d, in[ 8], S41, 1873313359); /* 57 */
+    II ( d, a, b, c, in[15], S42, 4264355552); /* 58 */
+    II ( c, d, a, b, in[ 6], S43, 2734768916); /* 59 */
+    II ( b, c, d, a, in[13], S44, 1309151649); /* 60 */
+    II ( a, b, c, d, in[ 4], S41, 4149444226); /* 61 */
+    II ( d, a, b, c, in[11], S42, 3174756917); /* 62 */
+    II ( c, d, a, b, in[ 2], S43,  718787259); /* 63 */
+    II ( b, c, d, a, in[ 9], S44, 3951481745); /* 64 */
+
+    buf[0] += a & mask;
+    buf[1] += b & mask;
+    buf[2] += c & mask;
+    buf[3] += d & mask;
+}
+#endif
+
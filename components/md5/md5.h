@@ -1,64 +1,71 @@
-#ifndef __MD5_H__
-#define __MD5_H__
-/*
- **********************************************************************
- ** md5.h -- Header file for implementation of MD5                   **
- ** RSA Data Security, Inc. MD5 Message Digest Algorithm             **
- ** Created: 2/17/90 RLR                                             **
- ** Revised: 12/27/90 SRD,AJ,BSK,JT Reference C version              **
- ** Revised (for MD5): RLR 4/27/91                                   **
- **   -- G modified to have y&~z instead of y&z                      **
- **   -- FF, GG, HH modified to add in last register done            **
- **   -- Access pattern: round 2 works mod 5, round 3 works mod 3    **
- **   -- distinct additive constant for each step                    **
- **   -- round 4 added, working mod 7                                **
- **********************************************************************
- */
-
-/*
- **********************************************************************
- ** Copyright (C) 1990, RSA Data Security, Inc. All rights reserved. **
- **                                                                  **
- ** License to copy and use this software is granted provided that   **
- ** it is identified as the "RSA Data Security, Inc. MD5 Message     **
- ** Digest Algorithm" in all material mentioning or referencing this **
- ** software or this function.                                       **
- **                                                                  **
- ** License is also granted to make and use derivative works         **
- ** provided that such works are identified as "derived from the RSA **
- ** Data Security, Inc. MD5 Message Digest Algorithm" in all         **
- ** material mentioning or referencing the derived work.             **
- **                                                                  **
- ** RSA Data Security, Inc. makes no representations concerning      **
- ** either the merchantability of this software or the suitability   **
- ** of this software for any particular purpose.  It is provided "as **
- ** is" without express or implied warranty of any kind.             **
- **                                                                  **
- ** These notices must be retained in any copies of any part of this **
- ** documentation and/or software.                                   **
- **********************************************************************
- */
-
-#include <stdint.h>
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/* Data structure for MD5 (Message Digest) computation */
-typedef struct {
-  uint32_t i[2];        /* number of _bits_ handled mod 2^64 */
-  uint32_t buf[4];      /* scratch buffer */
-  uint8_t in[64];       /* input buffer */
-  uint8_t digest[16];   /* actual digest after MD5Final call */
-} md5_ctx;
-
-void md5_init(md5_ctx *ctx);
-void md5_update(md5_ctx *ctx, uint8_t *input_buffer , size_t input_length);
-void md5_final(md5_ctx *ctx);
-
-#ifdef __cplusplus
-}
-#endif
-
-#endif /* __MD5_H__ */
+#ifndef __MD5_H__
+#define __MD5_H__
+/*
+ **********************************************************************
+ ** md5.h -- Header file for implementation of MD5                   **
+ ** RSA Data Security, Inc. MD5 Message Digest Algorithm             **
+ ** Created: 2/17/90 RLR                                             **
+ ** Revised: 12/27/90 SRD,AJ,BSK,JT Reference C version              **
+ ** Revised (for MD5): RLR 4/27/91                                   **
+ **   -- G modified to have y&~z instead of y&z                      **
+ **   -- FF, GG, HH modified to add in last register done            **
+ **   -- Access pattern: round 2 works mod 5, round 3 works mod 3    **
+ **   -- distinct additive constant for each step                    **
+ **   -- round 4 added, working mod 7                                **
+ **********************************************************************
+ */
+
+/*
+ **********************************************************************
+ ** Copyright (C) 1990, RSA Data Security, Inc. All rights reserved. **
+ **                                                                  **
+ ** License to copy and use this software is granted provided that   **
+ ** it is identified as the "RSA Data Security, Inc. MD5 Message     **
+ ** Digest Algorithm" in all material mentioning or referencing this **
+ ** software or this function.                                       **
+ **                                                                  **
+ ** License is also granted to make and use derivative works         **
+ ** provided that such works are identified as "derived from the RSA **
+ ** Data Security, Inc. MD5 Message Digest Algorithm" in all         **
+ ** material mentioning or referencing the derived work.             **
+ **                                                                  **
+ ** RSA Data Security, Inc. makes no representations concerning      **
+ ** either the merchantability of this software or the suitability   **
+ ** of this software for any particular purpose.  It is provided "as **
+ ** is" without express or implied warranty of any kind.             **
+ **                                                                  **
+ ** These notices must be retained in any copies of any part of this **
+ ** documentation and/or software.                                   **
+ **********************************************************************
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Data structure for MD5 (Message Digest) computation */
+typedef struct {
+  uint32_t i[2];        /* number of _bits_ handled mod 2^64 */
+  uint32_t buf[4];      /* scratch buffer */
+  uint8_t in[64];       /* input buffer */
+  uint8_t digest[16];   /* actual digest after MD5Final call */
+} md5_ctx;
+
+/* number of messages md5_multi_lane hashes side by side */
+#define MD5_LANES 4
+
+void md5_init(md5_ctx *ctx);
+void md5_update(md5_ctx *ctx, uint8_t *input_buffer , size_t input_length);
+void md5_copy_update(md5_ctx *ctx, uint8_t *destination, const uint8_t *input_buffer, size_t input_length);
+void md5_final(md5_ctx *ctx);
+void md5_digest(const void *input_buffer, size_t input_length, uint8_t digest[16]);
+void md5_multi_lane(md5_ctx *ctx[MD5_LANES], uint8_t *input_buffer[MD5_LANES], size_t input_length[MD5_LANES]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MD5_H__ */
@@ -0,0 +1,827 @@
+/**
+ * @file udp_gateway.c
+ * @brief CRC16 or CRC32 checking UDP gateway: recvmmsg batches checked side by side, good datagrams forwarded with sendmmsg,
+ *        SO_REUSEPORT workers, and a loopback load generator to measure it
+ * @copyright Copyright (c) 2023
+ */
+#define _GNU_SOURCE
+#include "udp_gateway.h"
+#include <assert.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <sys/socket.h>
+
+#define UDP_GATEWAY_BATCH 64
+#define UDP_GATEWAY_DATAGRAM_SIZE 2048
+#define UDP_GATEWAY_SOCKET_BUFFER (4 * 1024 * 1024)
+/* receive timeout, how long a worker takes to notice udp_gateway_stop */
+#define UDP_GATEWAY_POLL_MS 50
+#define UDP_GATEWAY_CACHE_LINE 64
+/* load generator: datagrams, senders and window by default */
+#define UDP_GATEWAY_LOAD_DATAGRAMS 100000
+#define UDP_GATEWAY_LOAD_SENDERS 2
+#define UDP_GATEWAY_LOAD_WINDOW 256
+/* seconds without a datagram at the sink before the ones on their way are given up as lost */
+#define UDP_GATEWAY_LOAD_LOSS_SECONDS 0.2
+
+/* One worker: its socket, receive and send headers over one buffer of batch datagrams */
+typedef struct {
+    udp_gateway_t *gateway;
+    int socket;
+    pthread_t thread;
+    uint8_t *buffer;                /* batch datagrams of datagram_size bytes */
+    struct mmsghdr *receive;
+    struct iovec *receive_iov;
+    struct mmsghdr *send;
+    struct iovec *send_iov;
+    uint8_t **packages;             /* datagrams long enough to carry a CRC */
+    size_t *lengths;
+    uint64_t *valid;
+    udp_gateway_counters_t counters;/* written by the worker only */
+} __attribute__((aligned(UDP_GATEWAY_CACHE_LINE))) udp_gateway_worker_t;
+
+struct udp_gateway {
+    udp_gateway_config_t config;
+    uint16_t port;                  /* bound port, host byte order */
+    int stop;
+    unsigned int started;           /* worker threads running */
+    udp_gateway_worker_t *worker;
+};
+
+/* State of one udp_gateway_load_run, shared by the senders and the sink */
+typedef struct {
+    udp_gateway_load_t *load;
+    const struct sockaddr_in *target;
+    uint64_t good_sent;             /* datagrams sent with a good CRC */
+    uint64_t received;              /* datagrams at the sink */
+    uint64_t received_damaged;      /* of them failing the check */
+    uint64_t written_off;           /* good datagrams given up as lost */
+    uint64_t last_receive;          /* nanoseconds, the latest datagram at the sink */
+    int stop;
+    int error;                      /* first errno of the senders or the sink */
+} udp_gateway_load_run_t;
+
+typedef struct {
+    udp_gateway_load_run_t *run;
+    pthread_t thread;
+    uint64_t datagrams;             /* this sender's share */
+    uint64_t sent;
+    uint64_t damaged;
+} udp_gateway_sender_t;
+
+static uint64_t udp_gateway_nanoseconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/* whether a model index names a model of the width */
+static inline bool udp_gateway_model_valid(unsigned int width, int model) {
+    return (width == 16 && model >= 0 && model < CRC16_NONE_MODEL) ||
+           (width == 32 && model >= 0 && model < CRC32_NONE_MODEL);
+}
+
+/**
+ * @brief Stores the CRC of a datagram's payload in its last two or four bytes
+ *
+ * @param width CRC bits, 16 or 32
+ * @param model CRC16_reference_model_e or CRC32_reference_model_e, by width
+ * @param datagram Datagram, the CRC included
+ * @param length Length of the datagram
+ */
+static void udp_gateway_package(unsigned int width, int model, uint8_t *datagram, size_t length) {
+    if (width == 16) {
+        crc16_lookup_table_package((CRC16_reference_model_e)model, datagram, length);
+    } else {
+        crc32_lookup_table_package((CRC32_reference_model_e)model, datagram, length);
+    }
+}
+
+/**
+ * @brief Checks the CRC of a batch of datagrams with the batch check of the width
+ *
+ * @param width CRC bits, 16 or 32
+ * @param model CRC16_reference_model_e or CRC32_reference_model_e, by width
+ * @param packages Datagrams, each longer than its CRC
+ * @param lengths Length of each datagram
+ * @param count Number of datagrams
+ * @param valid (count + 63) / 64 words, bit i % 64 of word i / 64 set when datagram i checks
+ */
+static void udp_gateway_check_batch(unsigned int width, int model, uint8_t *const *packages, const size_t *lengths,
+                                    size_t count, uint64_t *valid) {
+    if (width == 16) {
+        crc16_package_check_batch((CRC16_reference_model_e)model, packages, lengths, count, valid);
+    } else {
+        crc32_package_check_batch((CRC32_reference_model_e)model, packages, lengths, count, valid);
+    }
+}
+
+/**
+ * @brief Opens a UDP socket with the buffer sizes and the receive timeout, bound to an address
+ *
+ * @param address Address to bind, NULL to leave the socket unbound
+ * @param reuse_port Share the address with the other workers' sockets
+ * @param buffer SO_RCVBUF and SO_SNDBUF bytes, 0 keeps the system default
+ * @return int The socket, or -1 with errno set
+ */
+static int udp_gateway_socket(const struct sockaddr_in *address, bool reuse_port, int buffer) {
+    struct timeval timeout = {0, UDP_GATEWAY_POLL_MS * 1000};
+    int one = 1, error;
+    int fd = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+
+    if (fd < 0) {
+        return -1;
+    }
+    if ((reuse_port && setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &one, sizeof(one)) != 0) ||
+        (buffer > 0 && setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &buffer, sizeof(buffer)) != 0) ||
+        (buffer > 0 && setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &buffer, sizeof(buffer)) != 0) ||
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) != 0 ||
+        (address != NULL && bind(fd, (const struct sockaddr *)address, sizeof(*address)) != 0)) {
+        error = errno;
+        close(fd);
+        errno = error;
+        return -1;
+    }
+    return fd;
+}
+
+/**
+ * @brief Sends a batch of datagrams, sendmmsg restarted after the ones already sent. A datagram
+ *        the kernel refuses is skipped, and one without buffer space retried.
+ *
+ * @param fd Socket
+ * @param message Datagrams, addressed or for a connected socket
+ * @param count Number of datagrams
+ * @return unsigned int Datagrams sent
+ */
+static unsigned int udp_gateway_send(int fd, struct mmsghdr *message, unsigned int count) {
+    unsigned int done = 0, sent = 0;
+
+    while (done < count) {
+        int n = sendmmsg(fd, message + done, count - done, 0);
+        if (n > 0) {
+            done += (unsigned int)n;
+            sent += (unsigned int)n;
+        } else if (n < 0 && (errno == ENOBUFS || errno == EAGAIN || errno == EWOULDBLOCK)) {
+            sched_yield();
+        } else if (n < 0 && errno != EINTR) {
+            done++;
+        }
+    }
+    return sent;
+}
+
+/**
+ * @brief Fills a configuration with the defaults: one worker per online CPU, batches of 64
+ *        datagrams up to 2 KiB, 4 MiB socket buffers, CRC32C, loopback with a port picked at
+ *        start. The forward address has to be set.
+ *
+ * @param config Configuration to fill
+ */
+void udp_gateway_config_default(udp_gateway_config_t *config) {
+    /* parameter checkout */
+    assert(config != NULL);
+
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+    memset(config, 0, sizeof(*config));
+    config->listen.sin_family = AF_INET;
+    config->listen.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    config->listen.sin_port = 0;
+    config->forward.sin_family = AF_INET;
+    config->forward.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    config->forward.sin_port = 0;
+    config->width = 32;
+    config->model = CRC32C_MODEL;
+    config->workers = (cpus > 0) ? (unsigned int)cpus : 1;
+    config->batch = UDP_GATEWAY_BATCH;
+    config->datagram_size = UDP_GATEWAY_DATAGRAM_SIZE;
+    config->socket_buffer = UDP_GATEWAY_SOCKET_BUFFER;
+}
+
+/**
+ * @brief Receives a batch, checks the CRC of all its datagrams at once and forwards the good ones,
+ *        until the gateway stops
+ *
+ * @param argument udp_gateway_worker_t
+ * @return void* NULL
+ */
+static void *udp_gateway_worker(void *argument) {
+    udp_gateway_worker_t *worker = (udp_gateway_worker_t *)argument;
+    udp_gateway_t *gateway = worker->gateway;
+    const udp_gateway_config_t *config = &gateway->config;
+    udp_gateway_counters_t *counters = &worker->counters;
+
+    while (!__atomic_load_n(&gateway->stop, __ATOMIC_RELAXED)) {
+        int received = recvmmsg(worker->socket, worker->receive, config->batch, MSG_WAITFORONE, NULL);
+        if (received <= 0) {
+            continue;
+        }
+
+        /* runts and truncated datagrams are dropped before the check */
+        size_t candidates = 0;
+        for (int i = 0; i < received; i++) {
+            if (worker->receive[i].msg_len > config->width / 8 && (worker->receive[i].msg_hdr.msg_flags & MSG_TRUNC) == 0) {
+                worker->packages[candidates] = worker->buffer + (size_t)i * config->datagram_size;
+                worker->lengths[candidates] = worker->receive[i].msg_len;
+                candidates++;
+            }
+        }
+        udp_gateway_check_batch(config->width, config->model, worker->packages, worker->lengths, candidates, worker->valid);
+
+        unsigned int good = 0;
+        for (size_t i = 0; i < candidates; i++) {
+            if ((worker->valid[i / 64] >> (i % 64)) & 1) {
+                worker->send_iov[good].iov_base = worker->packages[i];
+                worker->send_iov[good].iov_len = worker->lengths[i];
+                good++;
+            }
+        }
+        unsigned int forwarded = udp_gateway_send(worker->socket, worker->send, good);
+
+        __atomic_store_n(&counters->received, counters->received + (uint64_t)received, __ATOMIC_RELAXED);
+        __atomic_store_n(&counters->forwarded, counters->forwarded + forwarded, __ATOMIC_RELAXED);
+        __atomic_store_n(&counters->dropped, counters->dropped + (uint64_t)received - forwarded, __ATOMIC_RELAXED);
+        __atomic_store_n(&counters->batches, counters->batches + 1, __ATOMIC_RELAXED);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Opens a worker's socket and allocates its batch
+ *
+ * @param worker Worker, zeroed
+ * @param gateway Gateway of the worker
+ * @param address Address to bind
+ * @return int 0, or the errno of the failure
+ */
+static int udp_gateway_worker_init(udp_gateway_worker_t *worker, udp_gateway_t *gateway, const struct sockaddr_in *address) {
+    const udp_gateway_config_t *config = &gateway->config;
+    unsigned int batch = config->batch;
+
+    worker->gateway = gateway;
+    worker->socket = udp_gateway_socket(address, true, config->socket_buffer);
+    if (worker->socket < 0) {
+        return errno;
+    }
+    worker->buffer = (uint8_t *)malloc((size_t)batch * config->datagram_size);
+    worker->receive = (struct mmsghdr *)calloc(batch, sizeof(struct mmsghdr));
+    worker->receive_iov = (struct iovec *)calloc(batch, sizeof(struct iovec));
+    worker->send = (struct mmsghdr *)calloc(batch, sizeof(struct mmsghdr));
+    worker->send_iov = (struct iovec *)calloc(batch, sizeof(struct iovec));
+    worker->packages = (uint8_t **)calloc(batch, sizeof(uint8_t *));
+    worker->lengths = (size_t *)calloc(batch, sizeof(size_t));
+    worker->valid = (uint64_t *)calloc((batch + 63) / 64, sizeof(uint64_t));
+    if (worker->buffer == NULL || worker->receive == NULL || worker->receive_iov == NULL || worker->send == NULL ||
+        worker->send_iov == NULL || worker->packages == NULL || worker->lengths == NULL || worker->valid == NULL) {
+        return ENOMEM;
+    }
+
+    for (unsigned int i = 0; i < batch; i++) {
+        worker->receive_iov[i].iov_base = worker->buffer + (size_t)i * config->datagram_size;
+        worker->receive_iov[i].iov_len = config->datagram_size;
+        worker->receive[i].msg_hdr.msg_iov = &worker->receive_iov[i];
+        worker->receive[i].msg_hdr.msg_iovlen = 1;
+        worker->send[i].msg_hdr.msg_name = (void *)&config->forward;
+        worker->send[i].msg_hdr.msg_namelen = sizeof(config->forward);
+        worker->send[i].msg_hdr.msg_iov = &worker->send_iov[i];
+        worker->send[i].msg_hdr.msg_iovlen = 1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Starts a gateway: the workers' sockets share the listening address with SO_REUSEPORT,
+ *        so the kernel spreads the flows over them, and each worker thread runs its own
+ *        receive, check and forward loop.
+ *
+ * @param gateway Started gateway, NULL on failure
+ * @param config Configuration, copied
+ * @return int 0, or the errno of the failure
+ */
+int udp_gateway_start(udp_gateway_t **gateway, const udp_gateway_config_t *config) {
+    /* parameter checkout */
+    assert(gateway != NULL);
+    assert(config != NULL);
+    assert(udp_gateway_model_valid(config->width, config->model));
+    assert(config->workers > 0);
+    assert(config->batch > 0);
+    assert(config->datagram_size > config->width / 8);
+
+    struct sockaddr_in address = config->listen;
+    socklen_t address_length = sizeof(address);
+    udp_gateway_t *g;
+    int error = 0;
+
+    *gateway = NULL;
+    g = (udp_gateway_t *)calloc(1, sizeof(udp_gateway_t));
+    if (g == NULL) {
+        return ENOMEM;
+    }
+    g->config = *config;
+    if (posix_memalign((void **)&g->worker, UDP_GATEWAY_CACHE_LINE, config->workers * sizeof(udp_gateway_worker_t)) != 0) {
+        free(g);
+        return ENOMEM;
+    }
+    memset(g->worker, 0, config->workers * sizeof(udp_gateway_worker_t));
+    for (unsigned int w = 0; w < config->workers; w++) {
+        g->worker[w].socket = -1;
+    }
+
+    for (unsigned int w = 0; w < config->workers && error == 0; w++) {
+        error = udp_gateway_worker_init(&g->worker[w], g, &address);
+        /* the others join the port the first one was given */
+        if (error == 0 && w == 0 && getsockname(g->worker[0].socket, (struct sockaddr *)&address, &address_length) != 0) {
+            error = errno;
+        }
+    }
+    g->port = ntohs(address.sin_port);
+
+    while (error == 0 && g->started < config->workers) {
+        error = pthread_create(&g->worker[g->started].thread, NULL, udp_gateway_worker, &g->worker[g->started]);
+        if (error == 0) {
+            g->started++;
+        }
+    }
+    if (error != 0) {
+        udp_gateway_stop(g);
+        return error;
+    }
+    *gateway = g;
+    return 0;
+}
+
+/**
+ * @brief Port the gateway receives on, the one picked at start when the configuration had 0
+ *
+ * @param gateway Gateway
+ * @return uint16_t Port, host byte order
+ */
+uint16_t udp_gateway_port(const udp_gateway_t *gateway) {
+    /* parameter checkout */
+    assert(gateway != NULL);
+
+    return gateway->port;
+}
+
+/**
+ * @brief Sums the workers' counters, while the gateway runs or after
+ *
+ * @param gateway Gateway
+ * @param counters Sums
+ */
+void udp_gateway_counters(const udp_gateway_t *gateway, udp_gateway_counters_t *counters) {
+    /* parameter checkout */
+    assert(gateway != NULL);
+    assert(counters != NULL);
+
+    memset(counters, 0, sizeof(*counters));
+    for (unsigned int w = 0; w < gateway->config.workers; w++) {
+        const udp_gateway_counters_t *from = &gateway->worker[w].counters;
+        counters->received += __atomic_load_n(&from->received, __ATOMIC_RELAXED);
+        counters->forwarded += __atomic_load_n(&from->forwarded, __ATOMIC_RELAXED);
+        counters->dropped += __atomic_load_n(&from->dropped, __ATOMIC_RELAXED);
+        counters->batches += __atomic_load_n(&from->batches, __ATOMIC_RELAXED);
+    }
+}
+
+/**
+ * @brief Stops the workers, within one receive timeout, and frees the gateway
+ *
+ * @param gateway Gateway from udp_gateway_start, NULL does nothing
+ */
+void udp_gateway_stop(udp_gateway_t *gateway) {
+    if (gateway == NULL) {
+        return;
+    }
+
+    __atomic_store_n(&gateway->stop, 1, __ATOMIC_RELAXED);
+    for (unsigned int w = 0; w < gateway->started; w++) {
+        pthread_join(gateway->worker[w].thread, NULL);
+    }
+    for (unsigned int w = 0; w < gateway->config.workers; w++) {
+        udp_gateway_worker_t *worker = &gateway->worker[w];
+        if (worker->socket >= 0) {
+            close(worker->socket);
+        }
+        free(worker->buffer);
+        free(worker->receive);
+        free(worker->receive_iov);
+        free(worker->send);
+        free(worker->send_iov);
+        free(worker->packages);
+        free(worker->lengths);
+        free(worker->valid);
+    }
+    free(gateway->worker);
+    free(gateway);
+}
+
+/**
+ * @brief Fills a load generator configuration with the defaults: two senders, 100000 datagrams
+ *        of 64 bytes with CRC32C, every tenth damaged, sent in batches of 64 with 256 in flight,
+ *        the sink on loopback with a port picked at open
+ *
+ * @param config Configuration to fill
+ */
+void udp_gateway_load_config_default(udp_gateway_load_config_t *config) {
+    /* parameter checkout */
+    assert(config != NULL);
+
+    memset(config, 0, sizeof(*config));
+    config->sink.sin_family = AF_INET;
+    config->sink.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    config->sink.sin_port = 0;
+    config->width = 32;
+    config->model = CRC32C_MODEL;
+    config->senders = UDP_GATEWAY_LOAD_SENDERS;
+    config->batch = UDP_GATEWAY_BATCH;
+    config->datagram_size = 64;
+    config->datagrams = UDP_GATEWAY_LOAD_DATAGRAMS;
+    config->damage_every = 10;
+    config->window = UDP_GATEWAY_LOAD_WINDOW;
+}
+
+/**
+ * @brief Opens the sink of a load generator, to be given to the gateway as its forward address
+ *
+ * @param load Load generator to open
+ * @param config Configuration, copied
+ * @return int 0, or the errno of the failure
+ */
+int udp_gateway_load_open(udp_gateway_load_t *load, const udp_gateway_load_config_t *config) {
+    /* parameter checkout */
+    assert(load != NULL);
+    assert(config != NULL);
+    assert(udp_gateway_model_valid(config->width, config->model));
+    assert(config->senders > 0);
+    assert(config->batch > 0);
+    assert(config->datagram_size > config->width / 8);
+
+    socklen_t address_length = sizeof(load->sink_address);
+
+    load->config = *config;
+    load->sink = udp_gateway_socket(&config->sink, false, UDP_GATEWAY_SOCKET_BUFFER);
+    if (load->sink < 0) {
+        return errno;
+    }
+    if (getsockname(load->sink, (struct sockaddr *)&load->sink_address, &address_length) != 0) {
+        int error = errno;
+        close(load->sink);
+        load->sink = -1;
+        return error;
+    }
+    return 0;
+}
+
+/**
+ * @brief Waits until at most window good datagrams are on their way to the sink. When none
+ *        arrives for a while, the ones on their way are written off as lost.
+ *
+ * @param run Load run
+ * @param window Good datagrams allowed on their way
+ */
+static void udp_gateway_load_wait(udp_gateway_load_run_t *run, uint64_t window) {
+    uint64_t seen = __atomic_load_n(&run->received, __ATOMIC_RELAXED);
+    uint64_t since = udp_gateway_nanoseconds();
+
+    for (;;) {
+        uint64_t received = __atomic_load_n(&run->received, __ATOMIC_RELAXED);
+        uint64_t settled = received - __atomic_load_n(&run->received_damaged, __ATOMIC_RELAXED) +
+                           __atomic_load_n(&run->written_off, __ATOMIC_RELAXED);
+        int64_t in_flight = (int64_t)(__atomic_load_n(&run->good_sent, __ATOMIC_RELAXED) - settled);
+
+        if (in_flight <= (int64_t)window) {
+            return;
+        }
+        if (received != seen) {
+            seen = received;
+            since = udp_gateway_nanoseconds();
+        } else if ((double)(udp_gateway_nanoseconds() - since) * 1e-9 > UDP_GATEWAY_LOAD_LOSS_SECONDS) {
+            __atomic_add_fetch(&run->written_off, (uint64_t)in_flight, __ATOMIC_RELAXED);
+            return;
+        }
+        sched_yield();
+    }
+}
+
+/**
+ * @brief Sends one sender's share from its own socket, the same prepared batch over and over:
+ *        every damage_every-th datagram of it with a broken CRC
+ *
+ * @param argument udp_gateway_sender_t
+ * @return void* NULL
+ */
+static void *udp_gateway_load_sender(void *argument) {
+    udp_gateway_sender_t *sender = (udp_gateway_sender_t *)argument;
+    udp_gateway_load_run_t *run = sender->run;
+    const udp_gateway_load_config_t *config = &run->load->config;
+    unsigned int batch = config->batch;
+    int fd = udp_gateway_socket(NULL, false, UDP_GATEWAY_SOCKET_BUFFER);
+    uint8_t *buffer = (uint8_t *)malloc((size_t)batch * config->datagram_size);
+    struct mmsghdr *message = (struct mmsghdr *)calloc(batch, sizeof(struct mmsghdr));
+    struct iovec *iov = (struct iovec *)calloc(batch, sizeof(struct iovec));
+    int error = 0;
+
+    if (fd < 0 || connect(fd, (const struct sockaddr *)run->target, sizeof(*run->target)) != 0) {
+        error = errno;
+    } else if (buffer == NULL || message == NULL || iov == NULL) {
+        error = ENOMEM;
+    }
+
+    for (unsigned int i = 0; error == 0 && i < batch; i++) {
+        uint8_t *datagram = buffer + (size_t)i * config->datagram_size;
+        for (size_t j = 0; j < config->datagram_size; j++) {
+            datagram[j] = (uint8_t)((i * 131 + j * 7) ^ (uintptr_t)sender);
+        }
+        udp_gateway_package(config->width, config->model, datagram, config->datagram_size);
+        if (config->damage_every > 0 && (i + 1) % config->damage_every == 0) {
+            datagram[0] ^= 0x01;
+        }
+        iov[i].iov_base = datagram;
+        iov[i].iov_len = config->datagram_size;
+        message[i].msg_hdr.msg_iov = &iov[i];
+        message[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    while (error == 0 && sender->sent < sender->datagrams) {
+        uint64_t left = sender->datagrams - sender->sent;
+        unsigned int n = (left < batch) ? (unsigned int)left : batch;
+        unsigned int damaged = (config->damage_every > 0) ? n / config->damage_every : 0;
+
+        if (config->window > 0) {
+            udp_gateway_load_wait(run, config->window);
+        }
+        __atomic_add_fetch(&run->good_sent, n - damaged, __ATOMIC_RELAXED);
+        unsigned int sent = udp_gateway_send(fd, message, n);
+        if (sent < n) {
+            /* refused by the kernel, not on their way */
+            __atomic_add_fetch(&run->written_off, n - sent, __ATOMIC_RELAXED);
+        }
+        sender->sent += n;
+        sender->damaged += damaged;
+    }
+
+    if (error != 0) {
+        __atomic_compare_exchange_n(&run->error, &(int){0}, error, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    }
+    if (fd >= 0) {
+        close(fd);
+    }
+    free(buffer);
+    free(message);
+    free(iov);
+    return NULL;
+}
+
+/**
+ * @brief Receives at the sink and checks what the gateway forwarded, until the run stops
+ *
+ * @param argument udp_gateway_load_run_t
+ * @return void* NULL
+ */
+static void *udp_gateway_load_sink(void *argument) {
+    udp_gateway_load_run_t *run = (udp_gateway_load_run_t *)argument;
+    const udp_gateway_load_config_t *config = &run->load->config;
+    unsigned int batch = config->batch;
+    size_t size = config->datagram_size + 1;    /* a longer datagram shows as one */
+    uint8_t *buffer = (uint8_t *)malloc((size_t)batch * size);
+    struct mmsghdr *message = (struct mmsghdr *)calloc(batch, sizeof(struct mmsghdr));
+    struct iovec *iov = (struct iovec *)calloc(batch, sizeof(struct iovec));
+    uint8_t **packages = (uint8_t **)calloc(batch, sizeof(uint8_t *));
+    size_t *lengths = (size_t *)calloc(batch, sizeof(size_t));
+    uint64_t *valid = (uint64_t *)calloc((batch + 63) / 64, sizeof(uint64_t));
+
+    if (buffer == NULL || message == NULL || iov == NULL || packages == NULL || lengths == NULL || valid == NULL) {
+        __atomic_compare_exchange_n(&run->error, &(int){0}, ENOMEM, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+        batch = 0;
+    }
+    for (unsigned int i = 0; i < batch; i++) {
+        iov[i].iov_base = buffer + (size_t)i * size;
+        iov[i].iov_len = size;
+        message[i].msg_hdr.msg_iov = &iov[i];
+        message[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    while (batch > 0 && !__atomic_load_n(&run->stop, __ATOMIC_RELAXED)) {
+        int received = recvmmsg(run->load->sink, message, batch, MSG_WAITFORONE, NULL);
+        if (received <= 0) {
+            continue;
+        }
+
+        size_t candidates = 0, damaged = 0;
+        for (int i = 0; i < received; i++) {
+            if (message[i].msg_len == config->datagram_size) {
+                packages[candidates] = buffer + (size_t)i * size;
+                lengths[candidates] = message[i].msg_len;
+                candidates++;
+            } else {
+                damaged++;
+            }
+        }
+        udp_gateway_check_batch(config->width, config->model, packages, lengths, candidates, valid);
+        for (size_t i = 0; i < candidates; i++) {
+            damaged += ((valid[i / 64] >> (i % 64)) & 1) ^ 1;
+        }
+
+        __atomic_store_n(&run->last_receive, udp_gateway_nanoseconds(), __ATOMIC_RELAXED);
+        __atomic_add_fetch(&run->received_damaged, damaged, __ATOMIC_RELAXED);
+        __atomic_add_fetch(&run->received, (uint64_t)received, __ATOMIC_RELAXED);
+    }
+
+    free(buffer);
+    free(message);
+    free(iov);
+    free(packages);
+    free(lengths);
+    free(valid);
+    return NULL;
+}
+
+/**
+ * @brief Sends the configured datagrams to a gateway from the sender threads and counts what
+ *        arrives at the sink, until everything sent arrived or was given up as lost
+ *
+ * @param load Opened load generator
+ * @param target Address of the gateway
+ * @param result Counts and the time from the first send to the last datagram at the sink
+ * @return int 0, or the errno that stopped a sender or the sink
+ */
+int udp_gateway_load_run(udp_gateway_load_t *load, const struct sockaddr_in *target, udp_gateway_load_result_t *result) {
+    /* parameter checkout */
+    assert(load != NULL);
+    assert(load->sink >= 0);
+    assert(target != NULL);
+    assert(result != NULL);
+
+    const udp_gateway_load_config_t *config = &load->config;
+    udp_gateway_load_run_t run;
+    udp_gateway_sender_t *sender;
+    pthread_t sink;
+    unsigned int started = 0;
+    int error;
+
+    memset(result, 0, sizeof(*result));
+    memset(&run, 0, sizeof(run));
+    run.load = load;
+    run.target = target;
+    sender = (udp_gateway_sender_t *)calloc(config->senders, sizeof(udp_gateway_sender_t));
+    if (sender == NULL) {
+        return ENOMEM;
+    }
+
+    uint64_t start = udp_gateway_nanoseconds();
+    run.last_receive = start;
+    error = pthread_create(&sink, NULL, udp_gateway_load_sink, &run);
+    if (error != 0) {
+        free(sender);
+        return error;
+    }
+    for (unsigned int s = 0; s < config->senders; s++) {
+        sender[s].run = &run;
+        sender[s].datagrams = config->datagrams / config->senders + (s < config->datagrams % config->senders);
+        if (error == 0) {
+            error = pthread_create(&sender[s].thread, NULL, udp_gateway_load_sender, &sender[s]);
+            started += (error == 0);
+        }
+    }
+    for (unsigned int s = 0; s < started; s++) {
+        pthread_join(sender[s].thread, NULL);
+    }
+
+    /* the tail still on its way */
+    udp_gateway_load_wait(&run, 0);
+    __atomic_store_n(&run.stop, 1, __ATOMIC_RELAXED);
+    pthread_join(sink, NULL);
+
+    for (unsigned int s = 0; s < config->senders; s++) {
+        result->sent += sender[s].sent;
+        result->damaged += sender[s].damaged;
+    }
+    result->received = run.received;
+    result->received_damaged = run.received_damaged;
+    result->seconds = (double)(run.last_receive - start) * 1e-9;
+    free(sender);
+    return (error != 0) ? error : run.error;
+}
+
+/**
+ * @brief Closes the sink of a load generator
+ *
+ * @param load Load generator
+ */
+void udp_gateway_load_close(udp_gateway_load_t *load) {
+    /* parameter checkout */
+    assert(load != NULL);
+
+    if (load->sink >= 0) {
+        close(load->sink);
+        load->sink = -1;
+    }
+}
+
+#ifndef CHECKSUM_NO_MAIN
+#define TEST
+#endif
+#ifdef TEST
+#include <stdio.h>
+
+/* datagrams of the check */
+#define TEST_DATAGRAMS 20000
+
+/* waits for the gateway's counters to catch up with what it received */
+static void test_counters(udp_gateway_t *gateway, uint64_t received, udp_gateway_counters_t *counters) {
+    uint64_t start = udp_gateway_nanoseconds();
+
+    do {
+        udp_gateway_counters(gateway, counters);
+    } while (counters->received < received && udp_gateway_nanoseconds() - start < 1000000000u);
+}
+
+int main() {
+    udp_gateway_config_t config;
+    udp_gateway_load_config_t load_config;
+    udp_gateway_load_t load;
+    udp_gateway_load_result_t result;
+    udp_gateway_counters_t counters;
+    udp_gateway_t *gateway;
+
+#if 1
+    printf("---------udp gateway-----------\n");
+    /* every CRC32 model, and a reflected and a normal CRC16 one */
+    static const struct {
+        unsigned int width;
+        int model;
+        const char *name;
+    } test_model[] = {
+        {32, CRC32_MODEL, "CRC32_MODEL"},
+        {32, CRC32_MPEG2_MODEL, "CRC32_MPEG2_MODEL"},
+        {32, CRC32C_MODEL, "CRC32C_MODEL"},
+        {16, CRC16_MODBUS_MODEL, "CRC16_MODBUS_MODEL"},
+        {16, CRC16_XMODEM_MODEL, "CRC16_XMODEM_MODEL"},
+    };
+
+    for (size_t m = 0; m < sizeof(test_model) / sizeof(test_model[0]); m++) {
+        const char *name = test_model[m].name;
+        bool succeed = true;
+
+        udp_gateway_load_config_default(&load_config);
+        load_config.width = test_model[m].width;
+        load_config.model = test_model[m].model;
+        load_config.datagrams = TEST_DATAGRAMS;
+        load_config.datagram_size = 64 + m * 29;
+        load_config.damage_every = 5;
+        load_config.batch = 60;                 /* a multiple of damage_every, one in five damaged overall */
+        load_config.window = 64;
+        udp_gateway_config_default(&config);
+        config.width = test_model[m].width;
+        config.model = test_model[m].model;
+        config.workers = 2;
+        config.datagram_size = 200;
+        if (udp_gateway_load_open(&load, &load_config) != 0) {
+            printf("%s udp gateway open fail.\n", name);
+            continue;
+        }
+        config.forward = load.sink_address;
+        if (udp_gateway_start(&gateway, &config) != 0) {
+            printf("%s udp gateway start fail.\n", name);
+            udp_gateway_load_close(&load);
+            continue;
+        }
+
+        /* a runt and a datagram over the size the gateway receives, both dropped */
+        struct sockaddr_in target = config.listen;
+        uint8_t odd[300] = {0};
+        int fd = socket(AF_INET, SOCK_DGRAM, 0);
+        target.sin_port = htons(udp_gateway_port(gateway));
+        udp_gateway_package(config.width, config.model, odd, sizeof(odd));
+        sendto(fd, odd, config.width / 8, 0, (const struct sockaddr *)&target, sizeof(target));
+        sendto(fd, odd, sizeof(odd), 0, (const struct sockaddr *)&target, sizeof(target));
+        close(fd);
+
+        if (udp_gateway_load_run(&load, &target, &result) != 0) {
+            succeed = false;
+        }
+        test_counters(gateway, result.sent + 2, &counters);
+        if (result.sent != TEST_DATAGRAMS || result.damaged != TEST_DATAGRAMS / 5 || result.received_damaged != 0 ||
+            result.received != result.sent - result.damaged || counters.received != result.sent + 2 ||
+            counters.forwarded != result.received || counters.dropped != result.damaged + 2) {
+            succeed = false;
+        }
+        printf("%s udp gateway check %s: %llu sent, %llu damaged, %llu forwarded in %llu batches.\n", name,
+               succeed ? "succeed" : "fail", (unsigned long long)result.sent, (unsigned long long)result.damaged,
+               (unsigned long long)counters.forwarded, (unsigned long long)counters.batches);
+
+        udp_gateway_stop(gateway);
+        udp_gateway_load_close(&load);
+    }
+#endif
+    return 0;
+}
+#endif
@@ -0,0 +1,79 @@
+#ifndef __UDP_GATEWAY_H__
+#define __UDP_GATEWAY_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <netinet/in.h>
+#include "../crc/crc16/crc16.h"
+#include "../crc/crc32/crc32.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Datagrams counted by a gateway, summed over its workers */
+typedef struct {
+    uint64_t received;              /* datagrams received */
+    uint64_t forwarded;             /* datagrams that checked and were sent on */
+    uint64_t dropped;               /* CRC mismatches, datagrams too short or truncated, failed sends */
+    uint64_t batches;               /* recvmmsg calls that returned datagrams */
+} udp_gateway_counters_t;
+
+typedef struct {
+    struct sockaddr_in listen;      /* address the workers receive on, port 0 picks one, see udp_gateway_port */
+    struct sockaddr_in forward;     /* address the good datagrams are sent to */
+    unsigned int width;             /* CRC bits, 16 or 32, in the last two or four bytes of the datagrams */
+    int model;                      /* CRC16_reference_model_e or CRC32_reference_model_e, by width */
+    unsigned int workers;           /* threads, one SO_REUSEPORT socket each */
+    unsigned int batch;             /* datagrams per recvmmsg and sendmmsg */
+    size_t datagram_size;           /* largest datagram, longer ones are truncated and dropped */
+    int socket_buffer;              /* SO_RCVBUF and SO_SNDBUF bytes, 0 keeps the system default */
+} udp_gateway_config_t;
+
+typedef struct udp_gateway udp_gateway_t;
+
+/* Loopback load generator: sender threads, one flow (source port) each so the kernel spreads
+   them over the gateway workers, and a sink socket the gateway forwards to */
+typedef struct {
+    struct sockaddr_in sink;        /* address the sink receives on, port 0 picks one */
+    unsigned int width;             /* CRC bits the datagrams are sent with, 16 or 32 */
+    int model;                      /* CRC16_reference_model_e or CRC32_reference_model_e, by width */
+    unsigned int senders;           /* sender threads */
+    unsigned int batch;             /* datagrams per sendmmsg and recvmmsg */
+    size_t datagram_size;           /* bytes per datagram, CRC included, longer than the CRC */
+    uint64_t datagrams;             /* datagrams to send, over all senders */
+    unsigned int damage_every;      /* every n-th datagram of a batch sent with a broken CRC, 0 for none */
+    unsigned int window;            /* good datagrams on their way to the sink before the senders wait,
+                                       0 sends open loop and lets the socket buffers overflow */
+} udp_gateway_load_config_t;
+
+typedef struct {
+    udp_gateway_load_config_t config;
+    int sink;                       /* socket the gateway forwards to */
+    struct sockaddr_in sink_address;/* its bound address, the forward address of the gateway */
+} udp_gateway_load_t;
+
+typedef struct {
+    uint64_t sent;                  /* datagrams sent */
+    uint64_t damaged;               /* of them sent with a broken CRC */
+    uint64_t received;              /* datagrams at the sink */
+    uint64_t received_damaged;      /* of them failing the CRC check, the gateway let them through */
+    double seconds;                 /* first send to last datagram at the sink */
+} udp_gateway_load_result_t;
+
+void udp_gateway_config_default(udp_gateway_config_t *config);
+int udp_gateway_start(udp_gateway_t **gateway, const udp_gateway_config_t *config);
+uint16_t udp_gateway_port(const udp_gateway_t *gateway);
+void udp_gateway_counters(const udp_gateway_t *gateway, udp_gateway_counters_t *counters);
+void udp_gateway_stop(udp_gateway_t *gateway);
+void udp_gateway_load_config_default(udp_gateway_load_config_t *config);
+int udp_gateway_load_open(udp_gateway_load_t *load, const udp_gateway_load_config_t *config);
+int udp_gateway_load_run(udp_gateway_load_t *load, const struct sockaddr_in *target, udp_gateway_load_result_t *result);
+void udp_gateway_load_close(udp_gateway_load_t *load);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __UDP_GATEWAY_H__ */
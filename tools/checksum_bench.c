@@ -0,0 +1,675 @@
+/**
+ * @file checksum_bench.c
+ * @brief Benchmark suite of the public checksum functions, also the training run of the PGO build
+ * @copyright Copyright (c) 2023
+ */
+#include "../components/crc/crc8/crc8.h"
+#include "../components/crc/crc16/crc16.h"
+#include "../components/crc/crc32/crc32.h"
+#include "../components/crc/crc64/crc64.h"
+#include "../components/crc/crc_autotune/crc_autotune.h"
+#include "../components/crc/crc_fixed/crc_fixed.h"
+#include "../components/md5/md5.h"
+#include "../components/hmac/hmac_md5.h"
+#include "../components/hex/hex.h"
+#include "../components/file_checksum/file_checksum.h"
+#include "../components/checksum_stats/checksum_stats.h"
+#include <fcntl.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#define BENCH_MAX_BYTES (1024 * 1024)
+#define BENCH_DEFAULT_BUDGET (8 * 1024 * 1024)      /* bytes hashed per function and size */
+
+typedef void (*bench_function_t)(uint8_t *data, size_t length);
+
+typedef struct {
+    const char *name;
+    bench_function_t function;
+} bench_case_t;
+
+static const size_t BENCH_SIZE[] = {16, 64, 256, 1500, 9000, 65536, BENCH_MAX_BYTES};
+#define BENCH_SIZES (sizeof(BENCH_SIZE) / sizeof(BENCH_SIZE[0]))
+
+static hmac_md5_key_t bench_key;
+static volatile uint64_t bench_sink;
+
+static void bench_crc8(uint8_t *data, size_t length) {
+    crc8_lookup_table_package(CRC8_MAXIM_MODEL, data, length);
+}
+
+static void bench_crc16(uint8_t *data, size_t length) {
+    crc16_lookup_table_package(CRC16_MODBUS_MODEL, data, length);
+}
+
+static void bench_crc32(uint8_t *data, size_t length) {
+    crc32_lookup_table_package(CRC32_MODEL, data, length);
+}
+
+static void bench_crc32c(uint8_t *data, size_t length) {
+    crc32_lookup_table_package(CRC32C_MODEL, data, length);
+}
+
+static void bench_crc32_routed(uint8_t *data, size_t length) {
+    bench_sink ^= crc32_calculate(CRC32_MODEL, data, length);
+}
+
+static void bench_crc64(uint8_t *data, size_t length) {
+    crc64_lookup_table_package(CRC64_XZ_MODEL, data, length);
+}
+
+static void bench_md5(uint8_t *data, size_t length) {
+    md5_ctx ctx;
+    md5_init(&ctx);
+    md5_update(&ctx, data, length);
+    md5_final(&ctx);
+    bench_sink ^= ctx.digest[0];
+}
+
+static void bench_hmac_md5(uint8_t *data, size_t length) {
+    uint8_t digest[16];
+    hmac_md5(&bench_key, data, length, digest);
+    bench_sink ^= digest[0];
+}
+
+static const bench_case_t BENCH_CASE[] = {
+    {"crc8 table", bench_crc8},
+    {"crc16 table", bench_crc16},
+    {"crc32 table", bench_crc32},
+    {"crc32c", bench_crc32c},
+    {"crc32 routed", bench_crc32_routed},
+    {"crc64", bench_crc64},
+    {"md5", bench_md5},
+    {"hmac-md5", bench_hmac_md5},
+};
+
+static double bench_seconds(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* Every kernel of one model per width, through crcN_kernel_calculate */
+typedef struct {
+    const char *name;
+    int kernels;
+    const char *kernel_name[6];
+    bool (*available)(int kernel);
+    uint64_t (*calculate)(int kernel, uint8_t *data, size_t length);
+} bench_kernel_width_t;
+
+#define BENCH_KERNEL_ADAPTER(tag, n, model) \
+static bool bench_##tag##_available(int kernel) { \
+    return crc##n##_kernel_available(model, (crc##n##_kernel_e)kernel); \
+} \
+static uint64_t bench_##tag##_calculate(int kernel, uint8_t *data, size_t length) { \
+    return crc##n##_kernel_calculate(model, (crc##n##_kernel_e)kernel, data, length); \
+}
+
+BENCH_KERNEL_ADAPTER(crc8_maxim, 8, CRC8_MAXIM_MODEL)
+BENCH_KERNEL_ADAPTER(crc16_modbus, 16, CRC16_MODBUS_MODEL)
+BENCH_KERNEL_ADAPTER(crc32, 32, CRC32_MODEL)
+BENCH_KERNEL_ADAPTER(crc32c, 32, CRC32C_MODEL)
+BENCH_KERNEL_ADAPTER(crc64_xz, 64, CRC64_XZ_MODEL)
+
+static const bench_kernel_width_t BENCH_KERNEL_WIDTH[] = {
+    {"crc8 maxim", CRC8_KERNEL_NONE, {"bitwise", "nibble", "table", "slicing-by-4", "slicing-by-8", "shuffle"},
+     bench_crc8_maxim_available, bench_crc8_maxim_calculate},
+    {"crc16 modbus", CRC16_KERNEL_NONE, {"bitwise", "nibble", "table", "slicing-by-4", "slicing-by-8"},
+     bench_crc16_modbus_available, bench_crc16_modbus_calculate},
+    {"crc32", CRC32_KERNEL_NONE, {"bitwise", "nibble", "table", "hardware"},
+     bench_crc32_available, bench_crc32_calculate},
+    {"crc32c", CRC32_KERNEL_NONE, {"bitwise", "nibble", "table", "hardware"},
+     bench_crc32c_available, bench_crc32c_calculate},
+    {"crc64 xz", CRC64_KERNEL_NONE, {"bitwise", "slicing", "clmul"},
+     bench_crc64_xz_available, bench_crc64_xz_calculate},
+};
+
+/* warm: one buffer hashed over and over, its tables in cache; cold: a short frame hashed right
+   after a large write evicted the tables from the caches, as in a sleepy device or a busy server */
+#define BENCH_WARM_BYTES 4096
+#define BENCH_COLD_BYTES 256
+#define BENCH_COLD_ROUNDS 50
+#define BENCH_EVICT_BYTES (4 * 1024 * 1024)
+
+/**
+ * @brief Prints the warm and cold throughput of every available kernel
+ */
+static void bench_kernels(uint8_t *data, size_t budget) {
+    static uint8_t evict[BENCH_EVICT_BYTES];
+
+    printf("\n%-14s%-14s%10s%10s\n", "kernel MB/s", "", "warm", "cold");
+    for (size_t w = 0; w < sizeof(BENCH_KERNEL_WIDTH) / sizeof(BENCH_KERNEL_WIDTH[0]); w++) {
+        const bench_kernel_width_t *width = &BENCH_KERNEL_WIDTH[w];
+        for (int kernel = 0; kernel < width->kernels; kernel++) {
+            if (!width->available(kernel)) {
+                continue;
+            }
+            /* the bitwise kernel gets a sixteenth of the budget, it would take minutes otherwise */
+            size_t calls = ((kernel == 0) ? budget / 16 : budget) / BENCH_WARM_BYTES + 1;
+            double start = bench_seconds();
+            for (size_t i = 0; i < calls; i++) {
+                bench_sink ^= width->calculate(kernel, data, BENCH_WARM_BYTES);
+            }
+            double warm = bench_seconds() - start, cold = 0.0;
+
+            for (int i = 0; i < BENCH_COLD_ROUNDS; i++) {
+                memset(evict, i, sizeof(evict));
+                start = bench_seconds();
+                bench_sink ^= width->calculate(kernel, data, BENCH_COLD_BYTES);
+                cold += bench_seconds() - start;
+            }
+            printf("%-14s%-14s%10.1f%10.1f\n", width->name, width->kernel_name[kernel],
+                   (double)calls * BENCH_WARM_BYTES / warm / 1e6,
+                   (double)BENCH_COLD_ROUNDS * BENCH_COLD_BYTES / cold / 1e6);
+        }
+    }
+}
+
+/* one comparison: what was measured, then ways pairs of a way of doing it and its cost in unit */
+static void bench_row(const char *name, const char *unit, int ways, ...) {
+    va_list list;
+
+    printf("%-36s", name);
+    va_start(list, ways);
+    for (int i = 0; i < ways; i++) {
+        const char *way = va_arg(list, const char *);
+        printf(" %-18s%10.1f", way, va_arg(list, double));
+    }
+    va_end(list);
+    printf(" %s\n", unit);
+}
+
+#ifndef CRC8_USE_NIBBLE_TABLE
+CRC8_FIXED_DEFINE(bench_maxim_4, CRC8_MAXIM, 4)
+#endif
+#ifndef CRC16_USE_NIBBLE_TABLE
+CRC16_FIXED_DEFINE(bench_modbus_6, CRC16_MODBUS, 6)
+#endif
+
+#define BENCH_RECORDS 4096
+
+/**
+ * @brief Short frame checks one call at a time against the batch, fixed length and scanning paths
+ */
+static void bench_frames(size_t budget) {
+    static uint8_t records[BENCH_RECORDS][8];
+    static uint64_t valid[BENCH_RECORDS / 64];
+    /* called through pointers like across the library boundary, where model and length aren't constants */
+    bool (*volatile crc8_check)(CRC8_reference_model_e, uint8_t *, size_t) = crc8_lookup_table_package_check;
+    bool (*volatile crc16_check)(CRC16_reference_model_e, uint8_t *, size_t) = crc16_lookup_table_package_check;
+    bool (*volatile crc32_check)(CRC32_reference_model_e, uint8_t *, size_t) = crc32_lookup_table_package_check;
+    size_t rounds = budget / sizeof(records) + 1;
+    double start, one, other;
+
+    printf("\n%-36s\n", "frame checks");
+
+    /* 8 byte CRC8_MAXIM records, bit-sliced in one batch */
+    for (size_t i = 0; i < BENCH_RECORDS; i++) {
+        for (size_t j = 0; j < 7; j++) {
+            records[i][j] = (uint8_t)(i * 13 + j);
+        }
+        crc8_lookup_table_package(CRC8_MAXIM_MODEL, records[i], 8);
+    }
+    start = bench_seconds();
+    for (size_t round = 0; round < rounds; round++) {
+        for (size_t i = 0; i < BENCH_RECORDS; i++) {
+            bench_sink += crc8_check(CRC8_MAXIM_MODEL, records[i], 8);
+        }
+    }
+    one = bench_seconds() - start;
+    start = bench_seconds();
+    for (size_t round = 0; round < rounds; round++) {
+        crc8_package_check_batch(CRC8_MAXIM_MODEL, &records[0][0], BENCH_RECORDS, 8, valid);
+        bench_sink += valid[round % (BENCH_RECORDS / 64)] & 1;
+    }
+    other = bench_seconds() - start;
+    bench_row("crc8 maxim 8 byte records", "ns", 2, "one at a time", one * 1e9 / (double)(rounds * BENCH_RECORDS),
+              "batch", other * 1e9 / (double)(rounds * BENCH_RECORDS));
+
+#ifndef CRC8_USE_NIBBLE_TABLE
+    /* 5 byte sensor frames, the model and length bound at compile time */
+    for (size_t i = 0; i < BENCH_RECORDS; i++) {
+        bench_maxim_4_package(records[i]);
+    }
+    start = bench_seconds();
+    for (size_t round = 0; round < rounds; round++) {
+        for (size_t i = 0; i < BENCH_RECORDS; i++) {
+            bench_sink += crc8_check(CRC8_MAXIM_MODEL, records[i], 5);
+        }
+    }
+    one = bench_seconds() - start;
+    start = bench_seconds();
+    for (size_t round = 0; round < rounds; round++) {
+        for (size_t i = 0; i < BENCH_RECORDS; i++) {
+            bench_sink += bench_maxim_4_check(records[i]);
+        }
+    }
+    other = bench_seconds() - start;
+    bench_row("crc8 maxim 5 byte frames", "ns", 2, "lookup table", one * 1e9 / (double)(rounds * BENCH_RECORDS),
+              "fixed length", other * 1e9 / (double)(rounds * BENCH_RECORDS));
+#endif
+
+#ifndef CRC16_USE_NIBBLE_TABLE
+    /* 8 byte Modbus frames */
+    for (size_t i = 0; i < BENCH_RECORDS; i++) {
+        bench_modbus_6_package(records[i]);
+    }
+    start = bench_seconds();
+    for (size_t round = 0; round < rounds; round++) {
+        for (size_t i = 0; i < BENCH_RECORDS; i++) {
+            bench_sink += crc16_check(CRC16_MODBUS_MODEL, records[i], 8);
+        }
+    }
+    one = bench_seconds() - start;
+    start = bench_seconds();
+    for (size_t round = 0; round < rounds; round++) {
+        for (size_t i = 0; i < BENCH_RECORDS; i++) {
+            bench_sink += bench_modbus_6_check(records[i]);
+        }
+    }
+    other = bench_seconds() - start;
+    bench_row("crc16 modbus 8 byte frames", "ns", 2, "lookup table", one * 1e9 / (double)(rounds * BENCH_RECORDS),
+              "fixed length", other * 1e9 / (double)(rounds * BENCH_RECORDS));
+#endif
+
+    /* a receive batch of 64 datagrams of 256 bytes */
+    static uint8_t datagram[64][256];
+    static uint8_t *packages[64];
+    static size_t lengths[64];
+    static const char *const crc32_name[CRC32_NONE_MODEL] = {"crc32", "crc32 mpeg2", "crc32c"};
+    size_t datagram_rounds = budget / sizeof(datagram) + 1;
+    for (CRC32_reference_model_e model = CRC32_MODEL; model < CRC32_NONE_MODEL; model++) {
+        char name[64];
+        for (size_t i = 0; i < 64; i++) {
+            memset(datagram[i], (int)i, sizeof(datagram[i]));
+            crc32_lookup_table_package(model, datagram[i], sizeof(datagram[i]));
+            packages[i] = datagram[i];
+            lengths[i] = sizeof(datagram[i]);
+        }
+        start = bench_seconds();
+        for (size_t round = 0; round < datagram_rounds; round++) {
+            for (size_t i = 0; i < 64; i++) {
+                bench_sink += crc32_check(model, packages[i], lengths[i]);
+            }
+        }
+        one = bench_seconds() - start;
+        start = bench_seconds();
+        for (size_t round = 0; round < datagram_rounds; round++) {
+            crc32_package_check_batch(model, packages, lengths, 64, valid);
+            bench_sink += valid[0];
+        }
+        other = bench_seconds() - start;
+        snprintf(name, sizeof(name), "%s 256 byte datagrams", crc32_name[model]);
+        bench_row(name, "ns", 2, "one at a time", one * 1e9 / (double)(datagram_rounds * 64),
+                  "batch", other * 1e9 / (double)(datagram_rounds * 64));
+    }
+
+    /* resynchronizing on a 64 byte Modbus frame at the end of 1 MiB of noise */
+    static uint8_t stream[1024 * 1024];
+    static crc16_window_table_t window_table;
+    size_t offset;
+    srand(7);
+    for (size_t i = 0; i < sizeof(stream); i++) {
+        stream[i] = (uint8_t)rand();
+    }
+    crc16_lookup_table_package(CRC16_MODBUS_MODEL, stream + sizeof(stream) - 100, 64);
+    start = bench_seconds();
+    for (offset = 0; offset + 64 <= sizeof(stream); offset++) {
+        if (crc16_check(CRC16_MODBUS_MODEL, stream + offset, 64)) {
+            break;
+        }
+    }
+    one = bench_seconds() - start;
+    start = bench_seconds();
+    crc16_window_table_init(&window_table, CRC16_MODBUS_MODEL, 64);
+    bench_sink += crc16_frame_scan(&window_table, stream, sizeof(stream), &offset, 1);
+    other = bench_seconds() - start;
+    bench_row("crc16 modbus frame in 1 MiB noise", "ms", 2, "check per offset", one * 1e3, "frame scan", other * 1e3);
+}
+
+#define BENCH_COPY_LONG (16 * 1024 * 1024)     /* well past the L2 cache */
+
+/**
+ * @brief Transmit path: a payload copied into its frame buffer and the CRC32 computed over the frame,
+ *        as memcpy then a second pass and fused; memcpy alone as the floor
+ */
+static void bench_copy(size_t budget) {
+    static const CRC32_reference_model_e model[] = {CRC32_MODEL, CRC32C_MODEL};
+    static const size_t length[] = {1500, BENCH_COPY_LONG};
+    uint8_t *source = (uint8_t *)malloc(BENCH_COPY_LONG + 8);
+    uint8_t *destination = (uint8_t *)malloc(BENCH_COPY_LONG);
+
+    if (source == NULL || destination == NULL) {
+        free(source);
+        free(destination);
+        return;
+    }
+    memset(source, 0x5A, BENCH_COPY_LONG + 8);
+    memset(destination, 0, BENCH_COPY_LONG);
+
+    printf("\n%-36s\n", "copy and crc32");
+    for (size_t m = 0; m < sizeof(model) / sizeof(model[0]); m++) {
+        for (size_t i = 0; i < sizeof(length) / sizeof(length[0]); i++) {
+            size_t rounds = 4 * budget / length[i] + 2;
+            double start, copy_time, twice, fused;
+            crc32_ctx ctx;
+
+            start = bench_seconds();
+            for (size_t round = 0; round < rounds; round++) {
+                memcpy(destination, source + (round & 7), length[i]);
+                bench_sink ^= destination[round % length[i]];
+            }
+            copy_time = bench_seconds() - start;
+            start = bench_seconds();
+            for (size_t round = 0; round < rounds; round++) {
+                memcpy(destination, source + (round & 7), length[i]);
+                crc32_init(&ctx, model[m]);
+                crc32_update(&ctx, destination, length[i]);
+                bench_sink ^= crc32_final(&ctx);
+            }
+            twice = bench_seconds() - start;
+            start = bench_seconds();
+            for (size_t round = 0; round < rounds; round++) {
+                crc32_init(&ctx, model[m]);
+                crc32_copy(&ctx, destination, source + (round & 7), length[i]);
+                bench_sink ^= crc32_final(&ctx);
+            }
+            fused = bench_seconds() - start;
+            char name[64];
+            snprintf(name, sizeof(name), "%s %zu bytes", model[m] == CRC32C_MODEL ? "crc32c" : "crc32", length[i]);
+            bench_row(name, "ns", 3, "memcpy", copy_time / (double)rounds * 1e9, "memcpy + crc",
+                      twice / (double)rounds * 1e9, "crc32_copy", fused / (double)rounds * 1e9);
+        }
+    }
+    free(source);
+    free(destination);
+}
+
+#define BENCH_MESSAGES 65536
+#define BENCH_SHORT_KEY_BYTES 32
+#define BENCH_HMAC_BYTES 64
+
+/**
+ * @brief Short message hashing, MD5 digests to hex and back
+ */
+static void bench_digests(size_t budget) {
+    static uint8_t message[BENCH_MESSAGES][BENCH_HMAC_BYTES];
+    static uint8_t *buffer[BENCH_MESSAGES];
+    static size_t length[BENCH_MESSAGES];
+    static uint8_t digest[BENCH_MESSAGES][16];
+    static char line[BENCH_MESSAGES][33];
+    static const char *expected[BENCH_MESSAGES];
+    static uint64_t match[BENCH_MESSAGES / 64];
+    size_t rounds = budget / (BENCH_MESSAGES * BENCH_SHORT_KEY_BYTES) + 1;
+    hmac_md5_key_t key;
+    double start, one, other;
+    md5_ctx ctx;
+
+    printf("\n%-36s\n", "digests");
+    for (size_t i = 0; i < BENCH_MESSAGES; i++) {
+        memset(message[i], (int)i, BENCH_HMAC_BYTES);
+        buffer[i] = message[i];
+        length[i] = BENCH_HMAC_BYTES;
+    }
+
+    /* 32 byte keys, streaming against one-shot */
+    start = bench_seconds();
+    for (size_t round = 0; round < rounds; round++) {
+        for (size_t i = 0; i < BENCH_MESSAGES; i++) {
+            md5_init(&ctx);
+            md5_update(&ctx, message[i], BENCH_SHORT_KEY_BYTES);
+            md5_final(&ctx);
+            bench_sink ^= ctx.digest[0];
+        }
+    }
+    one = bench_seconds() - start;
+    start = bench_seconds();
+    for (size_t round = 0; round < rounds; round++) {
+        for (size_t i = 0; i < BENCH_MESSAGES; i++) {
+            md5_digest(message[i], BENCH_SHORT_KEY_BYTES, digest[i]);
+            bench_sink ^= digest[i][0];
+        }
+    }
+    other = bench_seconds() - start;
+    bench_row("md5 32 byte keys", "ns", 2, "init/update/final", one * 1e9 / (double)(rounds * BENCH_MESSAGES),
+              "md5_digest", other * 1e9 / (double)(rounds * BENCH_MESSAGES));
+
+    /* 64 byte messages, the key set up for every message against once */
+    start = bench_seconds();
+    for (size_t i = 0; i < BENCH_MESSAGES; i++) {
+        hmac_md5_key_init(&key, (uint8_t *)"batch key", 9);
+        hmac_md5(&key, message[i], BENCH_HMAC_BYTES, digest[i]);
+    }
+    one = bench_seconds() - start;
+    hmac_md5_key_init(&key, (uint8_t *)"batch key", 9);
+    start = bench_seconds();
+    for (size_t i = 0; i < BENCH_MESSAGES; i++) {
+        hmac_md5(&key, message[i], BENCH_HMAC_BYTES, digest[i]);
+    }
+    other = bench_seconds() - start;
+    start = bench_seconds();
+    hmac_md5_batch(&key, buffer, length, digest, BENCH_MESSAGES);
+    double batch = bench_seconds() - start;
+    bench_row("hmac-md5 64 byte messages", "ns", 3, "key per message", one * 1e9 / BENCH_MESSAGES,
+              "cached key", other * 1e9 / BENCH_MESSAGES, "batch", batch * 1e9 / BENCH_MESSAGES);
+
+    /* manifest lines: sprintf against hex_encode, then checked back */
+    for (size_t i = 0; i < BENCH_MESSAGES; i++) {
+        expected[i] = line[i];
+    }
+    start = bench_seconds();
+    for (size_t i = 0; i < BENCH_MESSAGES; i++) {
+        for (size_t b = 0; b < 16; b++) {
+            sprintf(&line[i][2 * b], "%02x", digest[i][b]);
+        }
+    }
+    one = bench_seconds() - start;
+    start = bench_seconds();
+    for (size_t i = 0; i < BENCH_MESSAGES; i++) {
+        hex_encode(digest[i], 16, line[i]);
+    }
+    other = bench_seconds() - start;
+    start = bench_seconds();
+    bench_sink += hex_digest_compare_batch(&digest[0][0], 16, expected, BENCH_MESSAGES, match);
+    batch = bench_seconds() - start;
+    bench_row("md5 digests to hex and back", "ns", 3, "sprintf", one * 1e9 / BENCH_MESSAGES,
+              "hex_encode", other * 1e9 / BENCH_MESSAGES, "batch compare", batch * 1e9 / BENCH_MESSAGES);
+}
+
+#define BENCH_FILES 32
+#define BENCH_FILE_BYTES (4 * 1024 * 1024)
+
+/* pages of the file in the page cache */
+static size_t bench_resident_pages(const char *path, size_t size) {
+    size_t page = (size_t)sysconf(_SC_PAGESIZE), pages = (size + page - 1) / page, resident = 0;
+    unsigned char *vec = (unsigned char *)malloc(pages > 0 ? pages : 1);
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    void *map = (fd >= 0 && size > 0) ? mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+
+    if (map != MAP_FAILED && vec != NULL && mincore(map, size, vec) == 0) {
+        for (size_t i = 0; i < pages; i++) {
+            resident += vec[i] & 1;
+        }
+    }
+    if (map != MAP_FAILED) {
+        munmap(map, size);
+    }
+    if (fd >= 0) {
+        close(fd);
+    }
+    free(vec);
+    return resident;
+}
+
+/* writes the file back and drops it from the page cache, so the next read comes from the disk */
+static void bench_evict_file(const char *path) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+
+    if (fd >= 0) {
+        fdatasync(fd);
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        close(fd);
+    }
+}
+
+/**
+ * @brief Files in the temporary directory through both file_checksum backends, pipelined, and from the disk
+ */
+static void bench_files(uint8_t *data) {
+    static const char *const backend_name[] = {"io_uring", "thread pool"};
+    static char path[BENCH_FILES][64];
+    static file_checksum_job_t job[BENCH_FILES];
+    const double bytes = (double)BENCH_FILES * BENCH_FILE_BYTES;
+    file_checksum_config_t config;
+    double start;
+    int backend;
+
+    printf("\n%-36s\n", "files");
+    for (size_t i = 0; i < BENCH_FILES; i++) {
+        snprintf(path[i], sizeof(path[i]), "/tmp/checksum_bench_%d_%zu", (int)getpid(), i);
+        FILE *file = fopen(path[i], "wb");
+        size_t written = 0;
+        while (file != NULL && written < BENCH_FILE_BYTES && fwrite(data, 1, BENCH_MAX_BYTES, file) == BENCH_MAX_BYTES) {
+            written += BENCH_MAX_BYTES;
+        }
+        if (written < BENCH_FILE_BYTES) {
+            if (file != NULL) {
+                fclose(file);
+            }
+            for (size_t j = 0; j <= i; j++) {
+                remove(path[j]);
+            }
+            printf("no room for the files in /tmp\n");
+            return;
+        }
+        fclose(file);
+    }
+
+    for (int algorithm = FILE_CHECKSUM_MD5; algorithm <= FILE_CHECKSUM_CRC32; algorithm += FILE_CHECKSUM_CRC32) {
+        for (int force = 0; force < 2; force++) {
+            for (size_t i = 0; i < BENCH_FILES; i++) {
+                file_checksum_job_init(&job[i], path[i], (file_checksum_algorithm_e)algorithm,
+                                       algorithm == FILE_CHECKSUM_CRC32 ? CRC32C_MODEL : 0);
+            }
+            file_checksum_config_default(&config);
+            config.force_thread_pool = force;
+            start = bench_seconds();
+            backend = file_checksum_run(job, BENCH_FILES, &config);
+            bench_row(algorithm == FILE_CHECKSUM_MD5 ? "md5, page cache" : "crc32c, page cache", "MB/s", 1,
+                      backend_name[backend], bytes / (bench_seconds() - start) / 1e6);
+        }
+    }
+    /* one file at a time, read then hash against read ahead while hashing */
+    for (int pipelined = 0; pipelined < 2; pipelined++) {
+        file_checksum_config_default(&config);
+        config.threads = 1;
+        config.force_thread_pool = true;
+        start = bench_seconds();
+        for (size_t i = 0; i < BENCH_FILES; i++) {
+            file_checksum_job_init(&job[i], path[i], FILE_CHECKSUM_MD5, 0);
+            if (pipelined) {
+                file_checksum_pipelined(&job[i], &config);
+            } else {
+                file_checksum_run(&job[i], 1, &config);
+            }
+        }
+        bench_row("md5, page cache, one thread", "MB/s", 1, pipelined ? "pipelined" : "sequential",
+                  bytes / (bench_seconds() - start) / 1e6);
+    }
+    /* from the disk, buffered against direct: throughput and what is left in the page cache */
+    for (int direct = 0; direct < 2; direct++) {
+        size_t resident = 0;
+        for (size_t i = 0; i < BENCH_FILES; i++) {
+            bench_evict_file(path[i]);
+            file_checksum_job_init(&job[i], path[i], FILE_CHECKSUM_MD5, 0);
+        }
+        file_checksum_config_default(&config);
+        config.direct = direct;
+        start = bench_seconds();
+        backend = file_checksum_run(job, BENCH_FILES, &config);
+        double seconds = bench_seconds() - start;
+        for (size_t i = 0; i < BENCH_FILES; i++) {
+            resident += bench_resident_pages(path[i], BENCH_FILE_BYTES);
+        }
+        bench_row(direct ? "md5, disk, direct" : "md5, disk, buffered", "MB/s, % cached", 2,
+                  backend_name[backend], bytes / seconds / 1e6,
+                  "cached", 100.0 * (double)resident * (double)sysconf(_SC_PAGESIZE) / bytes);
+    }
+    for (size_t i = 0; i < BENCH_FILES; i++) {
+        remove(path[i]);
+    }
+}
+
+#ifdef CHECKSUM_STATS
+/**
+ * @brief Cost of one checksum_stats_record, what every counted call pays
+ */
+static void bench_stats(size_t budget) {
+    size_t calls = budget / 64 + 1;
+    uint64_t start = checksum_stats_now();
+
+    for (size_t i = 0; i < calls; i++) {
+        checksum_stats_record(CHECKSUM_STATS_CRC8, 0, CHECKSUM_STATS_BITWISE, 64, checksum_stats_now());
+    }
+    printf("\n");
+    bench_row("checksum stats", "ns per call", 1, "record", (double)(checksum_stats_now() - start) / (double)calls);
+}
+#endif
+
+/**
+ * @brief Usage: checksum_bench [budget MiB per function and size]
+ */
+int main(int argc, char *argv[]) {
+    static uint8_t data[BENCH_MAX_BYTES];
+    size_t budget = BENCH_DEFAULT_BUDGET;
+
+    if (argc > 1) {
+        budget = (size_t)strtoul(argv[1], NULL, 10) * 1024 * 1024;
+        if (budget == 0) {
+            fprintf(stderr, "usage: %s [budget MiB per function and size]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)(i * 131 + (i >> 10));
+    }
+    hmac_md5_key_init(&bench_key, (uint8_t *)"benchmark key", 13);
+    printf("autotune: %s\n", crc_autotune(NULL) == CRC_AUTOTUNE_LOADED ? "loaded" : "calibrated");
+
+    printf("%-14s", "MB/s");
+    for (size_t s = 0; s < BENCH_SIZES; s++) {
+        printf("%10zu", BENCH_SIZE[s]);
+    }
+    printf("\n");
+
+    for (size_t c = 0; c < sizeof(BENCH_CASE) / sizeof(BENCH_CASE[0]); c++) {
+        printf("%-14s", BENCH_CASE[c].name);
+        for (size_t s = 0; s < BENCH_SIZES; s++) {
+            size_t length = BENCH_SIZE[s];
+            size_t calls = (budget + length - 1) / length;
+            double start = bench_seconds();
+            for (size_t i = 0; i < calls; i++) {
+                BENCH_CASE[c].function(data, length);
+            }
+            printf("%10.1f", (double)calls * length / (bench_seconds() - start) / 1e6);
+        }
+        printf("\n");
+    }
+
+    bench_kernels(data, budget);
+    bench_frames(budget);
+    bench_copy(budget);
+    bench_digests(budget);
+    bench_files(data);
+#ifdef CHECKSUM_STATS
+    bench_stats(budget);
+#endif
+    return 0;
+}
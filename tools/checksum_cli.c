@@ -0,0 +1,141 @@
+/**
+ * @file checksum_cli.c
+ * @brief Command line checksum of files: MD5 or any CRC model, many files at once
+ * @copyright Copyright (c) 2023
+ */
+#include "../components/file_checksum/file_checksum.h"
+#include "../components/hex/hex.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+static const char *algorithm_name[FILE_CHECKSUM_NONE] = {"md5", "crc8", "crc16", "crc32", "crc64"};
+static const int algorithm_models[FILE_CHECKSUM_NONE] = {1, CRC8_NONE_MODEL, CRC16_NONE_MODEL, CRC32_NONE_MODEL, CRC64_NONE_MODEL};
+
+static void usage(const char *program) {
+    fprintf(stderr,
+            "usage: %s [-a md5|crc8|crc16|crc32|crc64] [-m model] [-j threads] [-p] [-d] [-t] file...\n"
+            "  -a  algorithm, md5 by default\n"
+            "  -m  CRC reference model index, 0 by default\n"
+            "  -j  worker threads when io_uring is unavailable\n"
+            "  -p  one file at a time, reading ahead on an I/O thread\n"
+            "  -d  direct I/O, leave the page cache to other workloads\n"
+            "  -t  report the throughput on stderr\n",
+            program);
+}
+
+static double wall_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Prints "<checksum>  <path>" per file like md5sum, errors and the throughput to stderr
+ *
+ * @return int 0, 1 when a file couldn't be read, 2 on bad arguments
+ */
+int main(int argc, char *argv[]) {
+    file_checksum_algorithm_e algorithm = FILE_CHECKSUM_MD5;
+    file_checksum_config_t config;
+    file_checksum_job_t *job;
+    bool pipelined = false, throughput = false;
+    int model = 0, option, status = 0;
+    uint64_t bytes = 0;
+    double start;
+
+    file_checksum_config_default(&config);
+    while ((option = getopt(argc, argv, "a:m:j:pdt")) != -1) {
+        switch (option)
+        {
+        case 'a':
+            for (algorithm = FILE_CHECKSUM_MD5; algorithm < FILE_CHECKSUM_NONE; algorithm++) {
+                if (strcmp(optarg, algorithm_name[algorithm]) == 0) {
+                    break;
+                }
+            }
+            if (algorithm == FILE_CHECKSUM_NONE) {
+                usage(argv[0]);
+                return 2;
+            }
+            break;
+
+        case 'm':
+            model = atoi(optarg);
+            break;
+
+        case 'j':
+            config.threads = (unsigned int)atoi(optarg);
+            break;
+
+        case 'p':
+            pipelined = true;
+            break;
+
+        case 'd':
+            config.direct = true;
+            break;
+
+        case 't':
+            throughput = true;
+            break;
+
+        default:
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (optind == argc || model < 0 || model >= algorithm_models[algorithm] || config.threads == 0) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    size_t count = (size_t)(argc - optind);
+    job = (file_checksum_job_t *)calloc(count, sizeof(file_checksum_job_t));
+    if (job == NULL) {
+        perror("calloc");
+        return 1;
+    }
+    for (size_t i = 0; i < count; i++) {
+        file_checksum_job_init(&job[i], argv[optind + i], algorithm, model);
+    }
+
+    start = wall_seconds();
+    if (pipelined) {
+        for (size_t i = 0; i < count; i++) {
+            file_checksum_pipelined(&job[i], &config);
+        }
+    } else {
+        file_checksum_run(job, count, &config);
+    }
+    double seconds = wall_seconds() - start;
+
+    for (size_t i = 0; i < count; i++) {
+        if (job[i].error != 0) {
+            fprintf(stderr, "%s: %s\n", job[i].path, strerror(job[i].error));
+            status = 1;
+            continue;
+        }
+        if (algorithm == FILE_CHECKSUM_MD5) {
+            char text[32];
+            hex_encode(job[i].digest, 16, text);
+            fwrite(text, 1, sizeof(text), stdout);
+        } else {
+            /* two hex digits per CRC byte */
+            int digits = (algorithm == FILE_CHECKSUM_CRC8) ? 2 : (algorithm == FILE_CHECKSUM_CRC16) ? 4 :
+                         (algorithm == FILE_CHECKSUM_CRC32) ? 8 : 16;
+            printf("%0*llx", digits, (unsigned long long)job[i].crc);
+        }
+        printf("  %s\n", job[i].path);
+        bytes += job[i].size;
+    }
+    if (throughput) {
+        fprintf(stderr, "%llu bytes in %.3f s, %.1f MB/s\n", (unsigned long long)bytes, seconds,
+                seconds > 0 ? (double)bytes / seconds / 1e6 : 0.0);
+    }
+
+    free(job);
+    return status;
+}
@@ -0,0 +1,233 @@
+/**
+ * @file crc_reveng_cli.c
+ * @brief Command line recovery of CRC parameters from sample frames given in hex
+ * @copyright Copyright (c) 2023
+ */
+#include "../components/crc/crc_reveng/crc_reveng.h"
+#include "../components/hex/hex.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#define MAX_RESULTS 256
+
+/* libcrc model names in CRCn_reference_model_e order */
+static const char *const crc8_name[] = {"CRC8_MODEL", "CRC8_ITU_MODEL", "CRC8_ROHC_MODEL", "CRC8_MAXIM_MODEL"};
+static const char *const crc16_name[] = {"CRC16_IBM_MODEL", "CRC16_MAXIM_MODEL", "CRC16_USB_MODEL",
+                                         "CRC16_MODBUS_MODEL", "CRC16_CCITT_MODEL", "CRC16_CCITT_FALSE_MODEL",
+                                         "CRC16_X25_MODEL", "CRC16_XMODEM_MODEL", "CRC16_DNP_MODEL"};
+static const char *const crc32_name[] = {"CRC32_MODEL", "CRC32_MPEG2_MODEL", "CRC32C_MODEL"};
+static const char *const crc64_name[] = {"CRC64_ECMA182_MODEL", "CRC64_XZ_MODEL", "CRC64_GO_ISO_MODEL"};
+
+static void usage(const char *program) {
+    fprintf(stderr,
+            "usage: %s [-w width] [-e little|big|any] [-j threads] [-t] [frame...]\n"
+            "  frames in hex, the message followed by its CRC, one per line on stdin without arguments;\n"
+            "  three or more of one length rule chance matches out, a second length pins the init down\n"
+            "  -w  CRC bits, a multiple of 8 up to 64, all of them by default\n"
+            "  -e  byte order of the CRC in the frames, any by default\n"
+            "  -j  threads, one per CPU by default\n"
+            "  -t  report the search time on stderr\n",
+            program);
+}
+
+static double wall_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Decodes a hex frame, blanks around it ignored
+ *
+ * @return bool false when it isn't an even number of hex digits
+ */
+static bool frame_parse(const char *text, crc_reveng_frame_t *frame) {
+    size_t length;
+    uint8_t *data;
+
+    while (*text == ' ' || *text == '\t') {
+        text++;
+    }
+    length = strlen(text);
+    while (length > 0 && strchr(" \t\r\n", text[length - 1]) != NULL) {
+        length--;
+    }
+    if (length == 0 || length % 2 != 0) {
+        return false;
+    }
+    data = (uint8_t *)malloc(length / 2);
+    if (data == NULL || !hex_decode(text, length / 2, data)) {
+        free(data);
+        return false;
+    }
+    frame->data = data;
+    frame->length = length / 2;
+    return true;
+}
+
+static const char *library_name(const crc_reveng_result_t *result) {
+    if (result->library_model < 0) {
+        return NULL;
+    }
+    switch (result->width)
+    {
+    case 8: return crc8_name[result->library_model];
+    case 16: return crc16_name[result->library_model];
+    case 32: return crc32_name[result->library_model];
+    default: return crc64_name[result->library_model];
+    }
+}
+
+/**
+ * @brief Prints the parameters reproducing every frame, one set per line in the catalogue notation
+ *
+ * @return int 0 when some were found, 1 when none, 2 on bad arguments
+ */
+int main(int argc, char *argv[]) {
+    crc_reveng_config_t config;
+    crc_reveng_frame_t *frames = NULL;
+    crc_reveng_result_t *results;
+    size_t count = 0, capacity = 0, found = 0;
+    bool timing = false;
+    int option, status;
+    char line[8192];
+
+    crc_reveng_config_default(&config);
+    while ((option = getopt(argc, argv, "w:e:j:t")) != -1) {
+        switch (option)
+        {
+        case 'w':
+            config.width = (unsigned int)atoi(optarg);
+            if (config.width == 0 || config.width % 8 != 0 || config.width > 64) {
+                usage(argv[0]);
+                return 2;
+            }
+            break;
+
+        case 'e':
+            if (strcmp(optarg, "little") == 0) {
+                config.endian = CRC_REVENG_LITTLE_ENDIAN;
+            } else if (strcmp(optarg, "big") == 0) {
+                config.endian = CRC_REVENG_BIG_ENDIAN;
+            } else if (strcmp(optarg, "any") == 0) {
+                config.endian = CRC_REVENG_ANY_ENDIAN;
+            } else {
+                usage(argv[0]);
+                return 2;
+            }
+            break;
+
+        case 'j':
+            config.threads = (unsigned int)atoi(optarg);
+            break;
+
+        case 't':
+            timing = true;
+            break;
+
+        default:
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (config.threads == 0) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    /* frames from the arguments, or stdin lines */
+    for (int i = optind; ; i++) {
+        const char *text;
+        if (optind < argc) {
+            if (i == argc) {
+                break;
+            }
+            text = argv[i];
+        } else {
+            if (fgets(line, sizeof(line), stdin) == NULL) {
+                break;
+            }
+            if (strspn(line, " \t\r\n") == strlen(line)) {
+                continue;
+            }
+            text = line;
+        }
+        if (count == capacity) {
+            capacity = capacity ? 2 * capacity : 16;
+            crc_reveng_frame_t *grown = (crc_reveng_frame_t *)realloc(frames, capacity * sizeof(crc_reveng_frame_t));
+            if (grown == NULL) {
+                perror("realloc");
+                return 1;
+            }
+            frames = grown;
+        }
+        if (!frame_parse(text, &frames[count])) {
+            fprintf(stderr, "not a hex frame: %s\n", text);
+            return 2;
+        }
+        count++;
+    }
+
+    /* a single pair of one length leaves every divisor of its difference standing */
+    size_t pairs = 0;
+    for (size_t i = 1; i < count; i++) {
+        for (size_t j = 0; j < i; j++) {
+            if (frames[j].length == frames[i].length) {
+                pairs++;
+                break;
+            }
+        }
+    }
+    if (pairs == 1) {
+        fprintf(stderr, "only two frames of one length, some parameter sets may match by chance\n");
+    }
+
+    results = (crc_reveng_result_t *)calloc(MAX_RESULTS, sizeof(crc_reveng_result_t));
+    if (results == NULL) {
+        perror("calloc");
+        return 1;
+    }
+    double start = wall_seconds();
+    status = crc_reveng_search(&config, frames, count, results, MAX_RESULTS, &found);
+    if (status != 0) {
+        fprintf(stderr, "%s\n", (status == EINVAL) ? "no two different frames of one length to compare"
+                                                    : strerror(status));
+        return (status == EINVAL) ? 2 : 1;
+    }
+    if (timing) {
+        fprintf(stderr, "%zu frames searched in %.3f s\n", count, wall_seconds() - start);
+    }
+
+    for (size_t r = 0; r < found && r < MAX_RESULTS; r++) {
+        const crc_reveng_result_t *result = &results[r];
+        int digits = (int)(result->width + 3) / 4;
+        const char *name = library_name(result);
+        printf("width=%u poly=0x%0*llx init=0x%0*llx refin=%s refout=%s xorout=0x%0*llx check=0x%0*llx %s",
+               result->width, digits, (unsigned long long)result->polynomial, digits,
+               (unsigned long long)result->initial_value, result->input_inversion ? "true" : "false",
+               result->output_inversion ? "true" : "false", digits, (unsigned long long)result->result_xor_value,
+               digits, (unsigned long long)result->check, result->width == 8 ? "" :
+               result->big_endian ? "big-endian" : "little-endian");
+        if (name != NULL) {
+            printf(" libcrc=%s", name);
+        }
+        if (result->free_bits != 0) {
+            printf(" (%u init bits open)", result->free_bits);
+        }
+        printf("\n");
+    }
+    if (found > MAX_RESULTS) {
+        fprintf(stderr, "%zu more parameter sets not shown, more frames narrow them down\n", found - MAX_RESULTS);
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        free((void *)frames[i].data);
+    }
+    free(frames);
+    free(results);
+    return found ? 0 : 1;
+}
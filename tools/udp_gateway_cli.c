@@ -0,0 +1,215 @@
+/**
+ * @file udp_gateway_cli.c
+ * @brief Runs a CRC16 or CRC32 checking UDP gateway, or measures one against the loopback load generator
+ * @copyright Copyright (c) 2023
+ */
+#include "../components/udp_gateway/udp_gateway.h"
+#include <arpa/inet.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static volatile sig_atomic_t stop = 0;
+
+static void usage(const char *program) {
+    fprintf(stderr,
+            "usage: %s [-w workers] [-b batch] [-c bits] [-m model] [-s size] -f address:port [address:]port\n"
+            "       %s -L [-w workers] [-b batch] [-c bits] [-m model] [-s size] [-j senders] [-n datagrams] [-k window]\n"
+            "  -f  forward the datagrams whose CRC checks to this address\n"
+            "  -L  loopback: measure a gateway against the load generator\n"
+            "  -w  worker threads, one per CPU by default\n"
+            "  -b  datagrams per recvmmsg and sendmmsg, 64 by default\n"
+            "  -c  CRC width, 16 or 32 (the default)\n"
+            "  -m  reference model index of the width, 3 (CRC16_MODBUS) or 2 (CRC32C) by default\n"
+            "  -s  largest datagram, the datagram size of the load generator\n"
+            "  -j  sender threads of the load generator\n"
+            "  -n  datagrams the load generator sends\n"
+            "  -k  datagrams on their way before the senders wait, 0 for open loop\n",
+            program, program);
+}
+
+static void on_signal(int signal_number) {
+    (void)signal_number;
+    stop = 1;
+}
+
+/* "address:port" or "port", the address staying as it was when left out */
+static bool parse_address(const char *text, struct sockaddr_in *address) {
+    const char *colon = strrchr(text, ':');
+    char host[INET_ADDRSTRLEN];
+
+    if (colon != NULL) {
+        if ((size_t)(colon - text) >= sizeof(host)) {
+            return false;
+        }
+        memcpy(host, text, (size_t)(colon - text));
+        host[colon - text] = '\0';
+        if (inet_pton(AF_INET, host, &address->sin_addr) != 1) {
+            return false;
+        }
+        text = colon + 1;
+    }
+    int port = atoi(text);
+    if (port <= 0 || port > 65535) {
+        return false;
+    }
+    address->sin_port = htons((uint16_t)port);
+    return true;
+}
+
+static int loopback(udp_gateway_config_t *config, const udp_gateway_load_config_t *load_config) {
+    udp_gateway_load_t load;
+    udp_gateway_load_result_t result;
+    udp_gateway_counters_t counters;
+    udp_gateway_t *gateway;
+    int error;
+
+    error = udp_gateway_load_open(&load, load_config);
+    if (error != 0) {
+        fprintf(stderr, "load generator: %s\n", strerror(error));
+        return 1;
+    }
+    config->forward = load.sink_address;
+    error = udp_gateway_start(&gateway, config);
+    if (error != 0) {
+        fprintf(stderr, "gateway: %s\n", strerror(error));
+        udp_gateway_load_close(&load);
+        return 1;
+    }
+
+    struct sockaddr_in target = config->listen;
+    target.sin_port = htons(udp_gateway_port(gateway));
+    error = udp_gateway_load_run(&load, &target, &result);
+    udp_gateway_counters(gateway, &counters);
+    udp_gateway_stop(gateway);
+    udp_gateway_load_close(&load);
+    if (error != 0) {
+        fprintf(stderr, "load generator: %s\n", strerror(error));
+        return 1;
+    }
+
+    printf("%llu sent (%llu damaged), %llu forwarded, %llu lost, %llu damaged let through\n",
+           (unsigned long long)result.sent, (unsigned long long)result.damaged, (unsigned long long)result.received,
+           (unsigned long long)(result.sent - result.damaged - (result.received - result.received_damaged)),
+           (unsigned long long)result.received_damaged);
+    printf("%.3f s, %.0f datagrams/s in, %.0f forwarded/s, %.1f datagrams per receive\n", result.seconds,
+           (double)result.sent / result.seconds, (double)result.received / result.seconds,
+           counters.batches ? (double)counters.received / counters.batches : 0.0);
+    return 0;
+}
+
+/**
+ * @brief Forwards until interrupted, the counters on stderr every second; or, with -L, prints the rates
+ *        of a loopback run
+ *
+ * @return int 0, 1 when the gateway couldn't start, 2 on bad arguments
+ */
+int main(int argc, char *argv[]) {
+    udp_gateway_config_t config;
+    udp_gateway_load_config_t load_config;
+    udp_gateway_counters_t counters;
+    udp_gateway_t *gateway;
+    bool forward = false, measure = false;
+    int option, model = -1, error;
+
+    udp_gateway_config_default(&config);
+    udp_gateway_load_config_default(&load_config);
+    while ((option = getopt(argc, argv, "f:Lw:b:c:m:s:j:n:k:")) != -1) {
+        switch (option)
+        {
+        case 'f':
+            forward = parse_address(optarg, &config.forward);
+            if (!forward) {
+                usage(argv[0]);
+                return 2;
+            }
+            break;
+
+        case 'L':
+            measure = true;
+            break;
+
+        case 'w':
+            config.workers = (unsigned int)atoi(optarg);
+            break;
+
+        case 'b':
+            config.batch = (unsigned int)atoi(optarg);
+            load_config.batch = config.batch;
+            break;
+
+        case 'c':
+            config.width = (unsigned int)atoi(optarg);
+            load_config.width = config.width;
+            break;
+
+        case 'm':
+            model = atoi(optarg);
+            break;
+
+        case 's':
+            config.datagram_size = (size_t)atol(optarg);
+            load_config.datagram_size = config.datagram_size;
+            break;
+
+        case 'j':
+            load_config.senders = (unsigned int)atoi(optarg);
+            break;
+
+        case 'n':
+            load_config.datagrams = (uint64_t)atoll(optarg);
+            break;
+
+        case 'k':
+            load_config.window = (unsigned int)atoi(optarg);
+            break;
+
+        default:
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (model < 0) {
+        model = (config.width == 16) ? CRC16_MODBUS_MODEL : CRC32C_MODEL;
+    }
+    config.model = model;
+    load_config.model = model;
+    if ((config.width != 16 || model >= CRC16_NONE_MODEL) && (config.width != 32 || model >= CRC32_NONE_MODEL)) {
+        usage(argv[0]);
+        return 2;
+    }
+    if (config.workers == 0 || config.batch == 0 || config.datagram_size <= config.width / 8 || load_config.senders == 0) {
+        usage(argv[0]);
+        return 2;
+    }
+    if (measure) {
+        return loopback(&config, &load_config);
+    }
+    if (!forward || optind != argc - 1) {
+        usage(argv[0]);
+        return 2;
+    }
+    config.listen.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (!parse_address(argv[optind], &config.listen)) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    error = udp_gateway_start(&gateway, &config);
+    if (error != 0) {
+        fprintf(stderr, "gateway: %s\n", strerror(error));
+        return 1;
+    }
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+    while (!stop) {
+        sleep(1);
+        udp_gateway_counters(gateway, &counters);
+        fprintf(stderr, "%llu received, %llu forwarded, %llu dropped\n", (unsigned long long)counters.received,
+                (unsigned long long)counters.forwarded, (unsigned long long)counters.dropped);
+    }
+    udp_gateway_stop(gateway);
+    return 0;
+}